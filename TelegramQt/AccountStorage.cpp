@@ -10,12 +10,27 @@
 #include <QLoggingCategory>
 #include <QUrl>
 
+#include <algorithm>
+
 Q_LOGGING_CATEGORY(c_clientAccountStorage, "telegram.client.account", QtWarningMsg)
 
 namespace Telegram {
 
 namespace Client {
 
+struct EndpointRoundTripTime
+{
+    quint32 dcId;
+    QString address;
+    quint16 port;
+    int msecs;
+
+    bool matches(const DcOption &endpoint) const
+    {
+        return (dcId == endpoint.id) && (port == endpoint.port) && (address == endpoint.address);
+    }
+};
+
 class AccountStoragePrivate
 {
     Q_DECLARE_PUBLIC(AccountStorage)
@@ -34,8 +49,12 @@ public:
     quint32 m_contentRelatedMessagesNumber = 0;
     qint32 m_deltaTime = 0;
     DcOption m_dcInfo;
+    QVector<ServerSalt> m_serverSalts;
+    QVector<EndpointRoundTripTime> m_endpointRoundTripTimes;
 
-    static constexpr quint32 c_formatVersion = 1;
+    static constexpr int c_maxServerSalts = 64;
+    static constexpr int c_maxEndpointRoundTripTimes = 16;
+    static constexpr quint32 c_formatVersion = 3;
     static const QByteArray c_signature;
 };
 
@@ -103,6 +122,7 @@ bool AccountStorage::invalidateAuthKey(quint64 authId)
     d->m_authKey.clear();
     d->m_sessionId = 0;
     d->m_contentRelatedMessagesNumber = 0;
+    d->m_serverSalts.clear();
     emit accountInvalidated(d->m_accountIdentifier);
     return true;
 }
@@ -168,6 +188,74 @@ void AccountStorage::setDcInfo(const DcOption &newDcInfo)
     d->m_dcInfo = newDcInfo;
 }
 
+/*!
+    Returns the known server salts of the session with their validity time.
+
+    The client restores the salts on reconnection, so the first request
+    is not bounced with bad_server_salt.
+*/
+QVector<ServerSalt> AccountStorage::serverSalts() const
+{
+    return d->m_serverSalts;
+}
+
+void AccountStorage::setServerSalts(const QVector<ServerSalt> &salts)
+{
+    d->m_serverSalts = salts.mid(0, AccountStoragePrivate::c_maxServerSalts);
+}
+
+/*!
+    Returns the last known round-trip time (in milliseconds) of the transport
+    handshake with the \a endpoint or -1 if the time is unknown.
+
+    The connection API uses the time to try the fastest endpoints of a DC first.
+*/
+int AccountStorage::endpointRoundTripTime(const DcOption &endpoint) const
+{
+    for (const EndpointRoundTripTime &entry : d->m_endpointRoundTripTimes) {
+        if (entry.matches(endpoint)) {
+            return entry.msecs;
+        }
+    }
+    return -1;
+}
+
+/*!
+    Updates the round-trip time of the \a endpoint; a negative \a msecs
+    makes the endpoint unknown (e.g. if the connection attempt failed).
+
+    The time is smoothed with the previous value and only a few fastest
+    endpoints are kept.
+*/
+void AccountStorage::setEndpointRoundTripTime(const DcOption &endpoint, int msecs)
+{
+    QVector<EndpointRoundTripTime> &entries = d->m_endpointRoundTripTimes;
+    int index = 0;
+    for (; index < entries.count(); ++index) {
+        if (entries.at(index).matches(endpoint)) {
+            break;
+        }
+    }
+    if (msecs < 0) {
+        if (index < entries.count()) {
+            entries.remove(index);
+        }
+        return;
+    }
+    if (index < entries.count()) {
+        entries[index].msecs = (entries.at(index).msecs * 3 + msecs) / 4;
+    } else {
+        entries.append({ endpoint.id, endpoint.address, endpoint.port, msecs });
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const EndpointRoundTripTime &left, const EndpointRoundTripTime &right) {
+        return left.msecs < right.msecs;
+    });
+    if (entries.count() > AccountStoragePrivate::c_maxEndpointRoundTripTimes) {
+        entries.resize(AccountStoragePrivate::c_maxEndpointRoundTripTimes);
+    }
+}
+
 bool AccountStorage::sync()
 {
     emit synced();
@@ -260,6 +348,19 @@ bool FileAccountStorage::saveData() const
     stream << d->m_authId;
     stream << d->m_sessionId;
     stream << d->m_contentRelatedMessagesNumber;
+    stream << quint32(d->m_serverSalts.count());
+    for (const ServerSalt &salt : d->m_serverSalts) {
+        stream << salt.salt;
+        stream << salt.validSince;
+        stream << salt.validUntil;
+    }
+    stream << quint32(d->m_endpointRoundTripTimes.count());
+    for (const EndpointRoundTripTime &entry : d->m_endpointRoundTripTimes) {
+        stream << entry.dcId;
+        stream << entry.address.toLatin1();
+        stream << entry.port;
+        stream << qint32(entry.msecs);
+    }
     qCDebug(c_clientAccountStorage) << CALL_INFO
                                     << "Saved key"
                                     << QString::number(authId(), 0x10);
@@ -308,6 +409,47 @@ bool FileAccountStorage::loadData()
     stream >> d->m_sessionId;
     stream >> d->m_contentRelatedMessagesNumber;
 
+    d->m_serverSalts.clear();
+    if (format >= 3) {
+        quint32 count = 0;
+        stream >> count;
+        if (count > quint32(AccountStoragePrivate::c_maxServerSalts)) {
+            qCWarning(c_clientAccountStorage) << CALL_INFO
+                                              << "Invalid number of server salts" << count;
+            return false;
+        }
+        for (quint32 i = 0; i < count; ++i) {
+            ServerSalt salt;
+            stream >> salt.salt;
+            stream >> salt.validSince;
+            stream >> salt.validUntil;
+            d->m_serverSalts.append(salt);
+        }
+    }
+
+    d->m_endpointRoundTripTimes.clear();
+    if (format >= 2) {
+        quint32 count = 0;
+        stream >> count;
+        if (count > quint32(AccountStoragePrivate::c_maxEndpointRoundTripTimes)) {
+            qCWarning(c_clientAccountStorage) << CALL_INFO
+                                              << "Invalid number of endpoints" << count;
+            return false;
+        }
+        for (quint32 i = 0; i < count; ++i) {
+            EndpointRoundTripTime entry;
+            QByteArray entryAddress;
+            qint32 msecs = 0;
+            stream >> entry.dcId;
+            stream >> entryAddress;
+            stream >> entry.port;
+            stream >> msecs;
+            entry.address = QString::fromLatin1(entryAddress);
+            entry.msecs = msecs;
+            d->m_endpointRoundTripTimes.append(entry);
+        }
+    }
+
     qCDebug(c_clientAccountStorage) << CALL_INFO
                                     << "Loaded key" << QString::number(authId(), 0x10);
     return !stream.error();
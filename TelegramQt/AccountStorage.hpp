@@ -44,6 +44,12 @@ public:
     DcOption dcInfo() const;
     void setDcInfo(const DcOption &newDcInfo);
 
+    QVector<ServerSalt> serverSalts() const;
+    void setServerSalts(const QVector<ServerSalt> &salts);
+
+    int endpointRoundTripTime(const DcOption &endpoint) const;
+    void setEndpointRoundTripTime(const DcOption &endpoint, int msecs);
+
 public slots:
     virtual bool saveData() const { return false; }
     virtual bool loadData() { return false; }
@@ -128,7 +128,7 @@ TelegramNamespace::MessageType getPublicMessageType(const TLMessageMedia &media)
     case TLValue::MessageMediaContact:
         return TelegramNamespace::MessageTypeContact;
     case TLValue::MessageMediaDocument:
-        for (const TLDocumentAttribute &attribute : media.document.attributes) {
+        for (const TLDocumentAttribute &attribute : media.document->attributes) {
             switch (attribute.tlType) {
             case TLValue::DocumentAttributeSticker:
                 return TelegramNamespace::MessageTypeSticker;
@@ -20,6 +20,7 @@
 #include "CRawStream.hpp"
 #include "Debug_p.hpp"
 #include "RandomGenerator.hpp"
+#include "TcpFramer.hpp"
 #include "TelegramNamespace.hpp"
 
 #include <QNetworkProxy>
@@ -35,8 +36,6 @@ namespace Client {
 Q_LOGGING_CATEGORY(c_loggingTranport, "telegram.client.transport", QtWarningMsg)
 
 static const quint8 c_abridgedVersionByte = 0xef;
-static const quint32 c_intermediateVersionBytes = 0xeeeeeeeeu;
-static const quint32 c_obfucsatedProcotolIdentifier = 0xefefefefu;
 
 TcpTransport::TcpTransport(QObject *parent) :
     BaseTcpTransport(parent),
@@ -83,7 +82,8 @@ void TcpTransport::startObfuscatedSession()
     qCDebug(c_loggingTranport) << CALL_INFO << "Start the session in Obfuscated format";
     // prepare random part
     const QVector<quint32> headerFirstWordBlackList = {
-        0x44414548u, 0x54534f50u, 0x20544547u, 0x20544547u, c_intermediateVersionBytes,
+        0x44414548u, 0x54534f50u, 0x20544547u, 0x20544547u,
+        TcpFramer::IntermediateTag, TcpFramer::PaddedIntermediateTag,
     };
     const QVector<quint32> headerSecondWordBlackList = {
         0x0,
@@ -116,7 +116,7 @@ void TcpTransport::startObfuscatedSession()
     raw << next4Bytes;
     raw << aesSourceData;
     m_socket->write(raw.getData());
-    raw << c_obfucsatedProcotolIdentifier;
+    raw << static_cast<quint32>(TcpFramer::AbridgedTag);
     raw << trailingRandom;
     QByteArray encrypted = m_writeAesContext->crypt(raw.getData());
     m_socket->write(encrypted.mid(56, 8));
@@ -130,6 +130,14 @@ void TcpTransport::startAbridgedSession()
     setSessionType(Abridged);
 }
 
+void TcpTransport::startIntermediateSession(bool padded)
+{
+    qCDebug(c_loggingTranport) << "Start the session in" << (padded ? "PaddedIntermediate" : "Intermediate") << "format";
+    setSessionType(padded ? PaddedIntermediate : Intermediate);
+    const quint32 tag = m_framer->protocolTag();
+    m_socket->write(reinterpret_cast<const char *>(&tag), sizeof(tag));
+}
+
 bool TcpTransport::setProxy(const QNetworkProxy &proxy)
 {
     if (m_socket->isOpen()) {
@@ -180,6 +188,12 @@ void TcpTransport::writeEvent()
     case Abridged:
         startAbridgedSession();
         break;
+    case Intermediate:
+        startIntermediateSession(/* padded */ false);
+        break;
+    case PaddedIntermediate:
+        startIntermediateSession(/* padded */ true);
+        break;
     default:
         qCCritical(c_loggingTranport) << CALL_INFO
                                       << "The selected session type"
@@ -40,6 +40,7 @@ public:
 
     void startObfuscatedSession();
     void startAbridgedSession();
+    void startIntermediateSession(bool padded);
     bool setProxy(const QNetworkProxy &proxy);
 
 protected:
@@ -91,6 +91,7 @@ void CRawStream::setDevice(QIODevice *newDevice)
     }
 
     m_device = newDevice;
+    m_buffer = qobject_cast<QBuffer*>(newDevice);
 }
 
 void CRawStream::unsetDevice()
@@ -130,6 +131,54 @@ bool CRawStream::write(const void *data, qint64 size)
     return m_error;
 }
 
+const char *CRawStream::readRawData(int size)
+{
+    if (!m_buffer || !m_buffer->isReadable()) {
+        return nullptr;
+    }
+    const qint64 pos = m_buffer->pos();
+    const QByteArray &data = m_buffer->data();
+    if (Q_UNLIKELY(pos + size > data.size())) {
+        m_error = true;
+        return nullptr;
+    }
+    m_buffer->seek(pos + size);
+    return data.constData() + pos;
+}
+
+char *CRawStream::writeRawData(int size)
+{
+    if (!m_buffer || !m_buffer->isWritable()) {
+        return nullptr;
+    }
+    const qint64 pos = m_buffer->pos();
+    QByteArray &data = m_buffer->buffer();
+    if (pos + size > data.size()) {
+        data.resize(static_cast<int>(pos + size));
+    }
+    m_buffer->seek(pos + size);
+    return data.data() + pos;
+}
+
+void CRawStream::skipBytes(int count)
+{
+    if (!count) {
+        return;
+    }
+    if (m_buffer && m_buffer->isReadable()) {
+        readRawData(count);
+        return;
+    }
+    char dummy[16];
+    while (count > 0) {
+        const int chunkSize = qMin(count, int(sizeof(dummy)));
+        if (read(dummy, chunkSize)) {
+            return;
+        }
+        count -= chunkSize;
+    }
+}
+
 void CRawStream::setError(bool error)
 {
     m_error = error;
@@ -244,7 +293,7 @@ CRawStreamEx &CRawStreamEx::operator>>(QByteArray &data)
     *this >> length;
     data.resize(static_cast<int>(length));
     read(data.data(), data.size());
-    readBytes(length.paddingForAlignment(4));
+    skipBytes(length.paddingForAlignment(4));
     return *this;
 }
 
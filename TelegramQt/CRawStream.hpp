@@ -22,6 +22,7 @@
 
 #include <QByteArray>
 
+QT_FORWARD_DECLARE_CLASS(QBuffer)
 QT_FORWARD_DECLARE_CLASS(QIODevice)
 
 namespace Telegram {
@@ -88,6 +89,14 @@ protected:
     bool read(void *data, qint64 size);
     bool write(const void *data, qint64 size);
 
+    // Direct access to the QBuffer memory (if the device is a buffer).
+    // Both methods advance the device position and return nullptr if there is no buffer
+    // or not enough data to read (in the latter case the error is set).
+    const char *readRawData(int size);
+    char *writeRawData(int size);
+
+    void skipBytes(int count);
+
     template<typename Int>
     inline CRawStream &protectedWrite(Int i);
 
@@ -98,6 +107,7 @@ protected:
 
 private:
     QIODevice *m_device = nullptr;
+    QBuffer *m_buffer = nullptr;
     bool m_ownDevice = false;
     bool m_error = false;
 
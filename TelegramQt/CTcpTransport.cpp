@@ -19,6 +19,7 @@
 #include "CTcpTransport.hpp"
 #include "CRawStream.hpp"
 #include "Debug_p.hpp"
+#include "TcpFramer.hpp"
 
 #include <QHostAddress>
 
@@ -36,6 +37,7 @@ namespace Telegram {
 
 BaseTcpTransport::BaseTcpTransport(QObject *parent) :
     BaseTransport(parent),
+    m_framer(new AbridgedTcpFramer()),
     m_socket(nullptr)
 {
 }
@@ -48,6 +50,7 @@ BaseTcpTransport::~BaseTcpTransport()
         qCDebug(c_loggingTcpTransport) << CALL_INFO << "close socket" << m_socket;
         m_socket->disconnectFromHost();
     }
+    delete m_framer;
 }
 
 int BaseTcpTransport::connectionTimeout()
@@ -65,6 +68,11 @@ QString BaseTcpTransport::remoteAddress() const
     return m_socket ? m_socket->peerAddress().toString() : QString();
 }
 
+qint64 BaseTcpTransport::bytesToWrite() const
+{
+    return m_socket ? m_socket->bytesToWrite() : 0;
+}
+
 void BaseTcpTransport::disconnectFromHost()
 {
     qCDebug(c_loggingTcpTransport) << CALL_INFO;
@@ -75,7 +83,20 @@ void BaseTcpTransport::disconnectFromHost()
     m_readBuffer.clear();
     m_packetNumber = 0;
     m_expectedLength = 0;
-    m_sessionType = Unknown;
+    setSessionType(Unknown);
+}
+
+void BaseTcpTransport::abort()
+{
+    qCDebug(c_loggingTcpTransport) << CALL_INFO;
+    if (m_socket) {
+        qCDebug(c_loggingTcpTransport) << CALL_INFO << "abort socket" << m_socket;
+        m_socket->abort();
+    }
+    m_readBuffer.clear();
+    m_packetNumber = 0;
+    m_expectedLength = 0;
+    setSessionType(Unknown);
 }
 
 BaseTcpTransport::SessionType BaseTcpTransport::sessionType() const
@@ -86,20 +107,11 @@ BaseTcpTransport::SessionType BaseTcpTransport::sessionType() const
 void BaseTcpTransport::sendPacketImplementation(const QByteArray &payload)
 {
     qCDebug(c_loggingTcpTransport) << CALL_INFO << payload.size();
+    m_socket->write(packetFromPayload(payload));
+}
 
-    // quint32 length (included length itself + packet number
-    //                 + crc32 + payload (MUST be divisible by 4)
-    // quint32 packet number
-    // quint32 CRC32 (length, quint32 packet number, payload)
-    // Payload
-
-    // Abridged version:
-    // quint8: 0xef
-    // DataLength / 4 < 0x7f ?
-    //      (quint8: Packet length / 4) :
-    //      (quint8: 0x7f, quint24: Packet length / 4)
-    // Payload
-
+QByteArray BaseTcpTransport::packetFromPayload(const QByteArray &payload)
+{
     if (payload.length() % 4) {
         qCCritical(c_loggingTcpTransport) << CALL_INFO
                                           << "Invalid outgoing packet! "
@@ -107,26 +119,46 @@ void BaseTcpTransport::sendPacketImplementation(const QByteArray &payload)
     }
 
     QByteArray packet;
-    packet.reserve(payload.size() + 4);
-    const quint32 length = payload.length() / 4;
-    if (length < 0x7f) {
-        packet.append(char(length));
-    } else {
-        packet.append(char(0x7f));
-        packet.append(reinterpret_cast<const char *>(&length), 3);
-    }
-    packet.append(payload);
+    m_framer->writeFrame(&packet, payload);
 
     if (m_writeAesContext && m_writeAesContext->hasKey()) {
         packet = m_writeAesContext->crypt(packet);
     }
-
-    m_socket->write(packet);
+    return packet;
 }
 
 void BaseTcpTransport::setSessionType(BaseTcpTransport::SessionType sessionType)
 {
     m_sessionType = sessionType;
+    switch (sessionType) {
+    case Intermediate:
+        setFramer(new IntermediateTcpFramer());
+        break;
+    case PaddedIntermediate:
+        setFramer(new PaddedIntermediateTcpFramer());
+        break;
+    case Obfuscated:
+        // The obfuscated session header carries the protocol tag and the framer is already set
+        if (m_framer) {
+            break;
+        }
+        Q_FALLTHROUGH();
+    default:
+        if (!m_framer || (m_framer->protocolTag() != TcpFramer::AbridgedTag)) {
+            setFramer(new AbridgedTcpFramer());
+        }
+        break;
+    }
+}
+
+void BaseTcpTransport::setFramer(TcpFramer *framer)
+{
+    if (m_framer == framer) {
+        return;
+    }
+    delete m_framer;
+    m_framer = framer;
+    m_expectedLength = 0;
 }
 
 void BaseTcpTransport::resetCryptoKeys()
@@ -192,31 +224,29 @@ void BaseTcpTransport::onReadyRead()
         qCCritical(c_loggingTcpTransport) << this << "Unknown session type!";
         return;
     }
-    if (m_socket->bytesAvailable() > 0) {
-        QByteArray allData = m_socket->readAll();
-        if (m_readAesContext) {
-            allData = m_readAesContext->crypt(allData);
-        }
-        m_readBuffer.append(allData);
+    processReceivedData(m_socket->bytesAvailable() > 0 ? m_socket->readAll() : QByteArray());
+}
+
+void BaseTcpTransport::processReceivedData(const QByteArray &data)
+{
+    if (!data.isEmpty()) {
+        m_readBuffer.append(m_readAesContext ? m_readAesContext->crypt(data) : data);
     }
-    while (m_readBuffer.size() >= 4) {
+    while (!m_readBuffer.isEmpty()) {
         if (m_expectedLength == 0) {
-            const quint8 *data = reinterpret_cast<const quint8*>(m_readBuffer.constData());
-            quint8 length_t1 = data[0];
-            if (length_t1 < 0x7fu) {
-                m_expectedLength = length_t1 * 4;
-                m_readBuffer = m_readBuffer.mid(1);
-            } else if (length_t1 == 0x7fu) {
-                m_expectedLength = data[1] + data[2] * 256 + data[3] * 256 * 256;
-                m_expectedLength *= 4;
-                m_readBuffer = m_readBuffer.mid(4);
-            } else {
-                qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet size byte"
-                                                 << hex << showbase << length_t1;
+            int headerSize = 0;
+            const TcpFramer::ReadStatus status = m_framer->readHeader(m_readBuffer, &headerSize, &m_expectedLength);
+            if (status == TcpFramer::ReadStatus::NeedMoreData) {
+                return;
+            }
+            if (status == TcpFramer::ReadStatus::Error) {
+                qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet header"
+                                                 << m_readBuffer.left(4).toHex();
                 setError(QAbstractSocket::UnknownSocketError, QStringLiteral("Invalid read operation"));
                 disconnectFromHost();
                 return;
             }
+            m_readBuffer.remove(0, headerSize);
         }
         if (m_readBuffer.size() < static_cast<int>(m_expectedLength)) {
             qCDebug(c_loggingTcpTransport) << CALL_INFO << "Ready read, but only "
@@ -224,8 +254,8 @@ void BaseTcpTransport::onReadyRead()
                                            << m_expectedLength << "bytes expected)";
             return;
         }
-        const QByteArray payload = m_readBuffer.left(static_cast<int>(m_expectedLength));
-        m_readBuffer = m_readBuffer.mid(static_cast<int>(m_expectedLength));
+        const QByteArray payload = m_framer->payloadFromFrame(m_readBuffer.left(static_cast<int>(m_expectedLength)));
+        m_readBuffer.remove(0, static_cast<int>(m_expectedLength));
         m_expectedLength = 0;
         qCDebug(c_loggingTcpTransport) << CALL_INFO
                                        << "Received a packet (" << payload.size() << " bytes)";
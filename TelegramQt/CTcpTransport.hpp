@@ -24,6 +24,8 @@ class CRawStream;
 
 namespace Telegram {
 
+class TcpFramer;
+
 namespace Crypto {
 
 class AesCtrContext;
@@ -39,6 +41,8 @@ public:
         Abridged, // char(0xef)
         FullSize,
         Obfuscated,
+        Intermediate, // 0xeeeeeeee
+        PaddedIntermediate, // 0xdddddddd
         Default = Unknown,
     };
     Q_ENUM(SessionType)
@@ -53,8 +57,10 @@ public:
     static int connectionTimeout();
 
     QString remoteAddress() const override;
+    qint64 bytesToWrite() const override;
 
     void disconnectFromHost() override;
+    void abort() override;
 
     SessionType sessionType() const;
 
@@ -68,13 +74,20 @@ protected:
     void setSocket(QAbstractSocket *socket);
     void sendPacketImplementation(const QByteArray &payload) override;
 
+    // Returns the framed (and encrypted, if needed) payload ready to be written to the socket
+    QByteArray packetFromPayload(const QByteArray &payload);
+    // Decrypts (if needed) the received data and emits packetReceived() for each complete frame
+    void processReceivedData(const QByteArray &data);
+
     void setSessionType(SessionType sessionType);
+    void setFramer(TcpFramer *framer);
     void resetCryptoKeys();
     void setCryptoKeysSourceData(const QByteArray &source, SourceRevertion revertion);
 
     quint32 m_packetNumber = 0;
     quint32 m_expectedLength = 0;
     SessionType m_sessionType = Unknown;
+    TcpFramer *m_framer = nullptr;
 
     QAbstractSocket *m_socket = nullptr;
     QByteArray m_readBuffer;
@@ -17,9 +17,56 @@
 
 #include "CTelegramStream_p.hpp"
 
+#include "AbridgedLength.hpp"
+#include "Utf8.hpp"
+
 #include <QIODevice>
 #include <QDebug>
 
+static const char s_nulls[4] = { 0, 0, 0, 0 };
+
+CTelegramStream &CTelegramStream::operator>>(QString &str)
+{
+    Telegram::AbridgedLength length;
+    *this >> length;
+    const int size = static_cast<int>(length);
+    const char *data = readRawData(size);
+    if (data) {
+        // UTF-16 representation is never longer than UTF-8 one
+        str.resize(size);
+        const int decodedSize = Telegram::Utf8::decode(data, size, str.data());
+        if (decodedSize < 0) {
+            str = QString::fromUtf8(data, size);
+        } else {
+            str.resize(decodedSize);
+        }
+    } else if (error()) {
+        str.clear();
+    } else {
+        str = QString::fromUtf8(readBytes(size));
+    }
+    skipBytes(length.paddingForAlignment(4));
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const QString &str)
+{
+    const int size = Telegram::Utf8::encodedSize(str.constData(), str.size());
+    const Telegram::AbridgedLength length(static_cast<quint32>(size));
+    *this << length;
+    const int padding = length.paddingForAlignment(4);
+    char *output = writeRawData(size + padding);
+    if (output) {
+        output = Telegram::Utf8::encode(str.constData(), str.size(), output);
+        memcpy(output, s_nulls, static_cast<size_t>(padding));
+    } else {
+        const QByteArray data = str.toUtf8();
+        write(data.constData(), data.size());
+        write(s_nulls, padding);
+    }
+    return *this;
+}
+
 template CTelegramStream &CTelegramStream::operator>>(TLVector<qint32> &v);
 template CTelegramStream &CTelegramStream::operator>>(TLVector<quint32> &v);
 template CTelegramStream &CTelegramStream::operator>>(TLVector<qint64> &v);
@@ -150,7 +197,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountDaysTTL &accountDaysTTLVal
         break;
     }
 
-    accountDaysTTLValue = result;
+    accountDaysTTLValue = std::move(result);
 
     return *this;
 }
@@ -177,7 +224,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountPassword &accountPasswordV
         break;
     }
 
-    accountPasswordValue = result;
+    accountPasswordValue = std::move(result);
 
     return *this;
 }
@@ -208,7 +255,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordInputSettings &acc
         break;
     }
 
-    accountPasswordInputSettingsValue = result;
+    accountPasswordInputSettingsValue = std::move(result);
 
     return *this;
 }
@@ -227,7 +274,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordSettings &accountP
         break;
     }
 
-    accountPasswordSettingsValue = result;
+    accountPasswordSettingsValue = std::move(result);
 
     return *this;
 }
@@ -247,7 +294,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountTmpPassword &accountTmpPas
         break;
     }
 
-    accountTmpPasswordValue = result;
+    accountTmpPasswordValue = std::move(result);
 
     return *this;
 }
@@ -266,7 +313,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthCheckedPhone &authCheckedPhon
         break;
     }
 
-    authCheckedPhoneValue = result;
+    authCheckedPhoneValue = std::move(result);
 
     return *this;
 }
@@ -286,7 +333,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthCodeType &authCodeTypeValue)
         break;
     }
 
-    authCodeTypeValue = result;
+    authCodeTypeValue = std::move(result);
 
     return *this;
 }
@@ -306,7 +353,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthExportedAuthorization &authEx
         break;
     }
 
-    authExportedAuthorizationValue = result;
+    authExportedAuthorizationValue = std::move(result);
 
     return *this;
 }
@@ -325,7 +372,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthPasswordRecovery &authPasswor
         break;
     }
 
-    authPasswordRecoveryValue = result;
+    authPasswordRecoveryValue = std::move(result);
 
     return *this;
 }
@@ -349,7 +396,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthSentCodeType &authSentCodeTyp
         break;
     }
 
-    authSentCodeTypeValue = result;
+    authSentCodeTypeValue = std::move(result);
 
     return *this;
 }
@@ -380,7 +427,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthorization &authorizationValue
         break;
     }
 
-    authorizationValue = result;
+    authorizationValue = std::move(result);
 
     return *this;
 }
@@ -407,7 +454,7 @@ CTelegramStream &CTelegramStream::operator>>(TLBadMsgNotification &badMsgNotific
         break;
     }
 
-    badMsgNotificationValue = result;
+    badMsgNotificationValue = std::move(result);
 
     return *this;
 }
@@ -427,7 +474,7 @@ CTelegramStream &CTelegramStream::operator>>(TLBotCommand &botCommandValue)
         break;
     }
 
-    botCommandValue = result;
+    botCommandValue = std::move(result);
 
     return *this;
 }
@@ -448,7 +495,7 @@ CTelegramStream &CTelegramStream::operator>>(TLBotInfo &botInfoValue)
         break;
     }
 
-    botInfoValue = result;
+    botInfoValue = std::move(result);
 
     return *this;
 }
@@ -469,7 +516,7 @@ CTelegramStream &CTelegramStream::operator>>(TLCdnFileHash &cdnFileHashValue)
         break;
     }
 
-    cdnFileHashValue = result;
+    cdnFileHashValue = std::move(result);
 
     return *this;
 }
@@ -489,7 +536,7 @@ CTelegramStream &CTelegramStream::operator>>(TLCdnPublicKey &cdnPublicKeyValue)
         break;
     }
 
-    cdnPublicKeyValue = result;
+    cdnPublicKeyValue = std::move(result);
 
     return *this;
 }
@@ -514,7 +561,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelParticipantsFilter &channe
         break;
     }
 
-    channelParticipantsFilterValue = result;
+    channelParticipantsFilterValue = std::move(result);
 
     return *this;
 }
@@ -539,7 +586,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChatParticipant &chatParticipantV
         break;
     }
 
-    chatParticipantValue = result;
+    chatParticipantValue = std::move(result);
 
     return *this;
 }
@@ -567,7 +614,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChatParticipants &chatParticipant
         break;
     }
 
-    chatParticipantsValue = result;
+    chatParticipantsValue = std::move(result);
 
     return *this;
 }
@@ -589,7 +636,7 @@ CTelegramStream &CTelegramStream::operator>>(TLClientDHInnerData &clientDHInnerD
         break;
     }
 
-    clientDHInnerDataValue = result;
+    clientDHInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -609,7 +656,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContact &contactValue)
         break;
     }
 
-    contactValue = result;
+    contactValue = std::move(result);
 
     return *this;
 }
@@ -629,7 +676,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactBlocked &contactBlockedVal
         break;
     }
 
-    contactBlockedValue = result;
+    contactBlockedValue = std::move(result);
 
     return *this;
 }
@@ -650,7 +697,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactLink &contactLinkValue)
         break;
     }
 
-    contactLinkValue = result;
+    contactLinkValue = std::move(result);
 
     return *this;
 }
@@ -669,7 +716,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDataJSON &dataJSONValue)
         break;
     }
 
-    dataJSONValue = result;
+    dataJSONValue = std::move(result);
 
     return *this;
 }
@@ -689,7 +736,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDestroyAuthKeyRes &destroyAuthKey
         break;
     }
 
-    destroyAuthKeyResValue = result;
+    destroyAuthKeyResValue = std::move(result);
 
     return *this;
 }
@@ -709,7 +756,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDestroySessionRes &destroySession
         break;
     }
 
-    destroySessionResValue = result;
+    destroySessionResValue = std::move(result);
 
     return *this;
 }
@@ -729,7 +776,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDisabledFeature &disabledFeatureV
         break;
     }
 
-    disabledFeatureValue = result;
+    disabledFeatureValue = std::move(result);
 
     return *this;
 }
@@ -773,7 +820,7 @@ CTelegramStream &CTelegramStream::operator>>(TLEncryptedChat &encryptedChatValue
         break;
     }
 
-    encryptedChatValue = result;
+    encryptedChatValue = std::move(result);
 
     return *this;
 }
@@ -798,7 +845,7 @@ CTelegramStream &CTelegramStream::operator>>(TLEncryptedFile &encryptedFileValue
         break;
     }
 
-    encryptedFileValue = result;
+    encryptedFileValue = std::move(result);
 
     return *this;
 }
@@ -827,7 +874,7 @@ CTelegramStream &CTelegramStream::operator>>(TLEncryptedMessage &encryptedMessag
         break;
     }
 
-    encryptedMessageValue = result;
+    encryptedMessageValue = std::move(result);
 
     return *this;
 }
@@ -847,7 +894,7 @@ CTelegramStream &CTelegramStream::operator>>(TLError &errorValue)
         break;
     }
 
-    errorValue = result;
+    errorValue = std::move(result);
 
     return *this;
 }
@@ -868,7 +915,7 @@ CTelegramStream &CTelegramStream::operator>>(TLExportedChatInvite &exportedChatI
         break;
     }
 
-    exportedChatInviteValue = result;
+    exportedChatInviteValue = std::move(result);
 
     return *this;
 }
@@ -887,7 +934,7 @@ CTelegramStream &CTelegramStream::operator>>(TLExportedMessageLink &exportedMess
         break;
     }
 
-    exportedMessageLinkValue = result;
+    exportedMessageLinkValue = std::move(result);
 
     return *this;
 }
@@ -914,7 +961,7 @@ CTelegramStream &CTelegramStream::operator>>(TLFileLocation &fileLocationValue)
         break;
     }
 
-    fileLocationValue = result;
+    fileLocationValue = std::move(result);
 
     return *this;
 }
@@ -935,7 +982,7 @@ CTelegramStream &CTelegramStream::operator>>(TLFutureSalt &futureSaltValue)
         break;
     }
 
-    futureSaltValue = result;
+    futureSaltValue = std::move(result);
 
     return *this;
 }
@@ -956,7 +1003,7 @@ CTelegramStream &CTelegramStream::operator>>(TLFutureSalts &futureSaltsValue)
         break;
     }
 
-    futureSaltsValue = result;
+    futureSaltsValue = std::move(result);
 
     return *this;
 }
@@ -978,7 +1025,7 @@ CTelegramStream &CTelegramStream::operator>>(TLGeoPoint &geoPointValue)
         break;
     }
 
-    geoPointValue = result;
+    geoPointValue = std::move(result);
 
     return *this;
 }
@@ -1002,7 +1049,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpAppUpdate &helpAppUpdateValue
         break;
     }
 
-    helpAppUpdateValue = result;
+    helpAppUpdateValue = std::move(result);
 
     return *this;
 }
@@ -1021,7 +1068,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpInviteText &helpInviteTextVal
         break;
     }
 
-    helpInviteTextValue = result;
+    helpInviteTextValue = std::move(result);
 
     return *this;
 }
@@ -1040,7 +1087,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpTermsOfService &helpTermsOfSe
         break;
     }
 
-    helpTermsOfServiceValue = result;
+    helpTermsOfServiceValue = std::move(result);
 
     return *this;
 }
@@ -1061,7 +1108,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHighScore &highScoreValue)
         break;
     }
 
-    highScoreValue = result;
+    highScoreValue = std::move(result);
 
     return *this;
 }
@@ -1082,7 +1129,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHttpWait &httpWaitValue)
         break;
     }
 
-    httpWaitValue = result;
+    httpWaitValue = std::move(result);
 
     return *this;
 }
@@ -1102,7 +1149,7 @@ CTelegramStream &CTelegramStream::operator>>(TLImportedContact &importedContactV
         break;
     }
 
-    importedContactValue = result;
+    importedContactValue = std::move(result);
 
     return *this;
 }
@@ -1122,7 +1169,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInlineBotSwitchPM &inlineBotSwitc
         break;
     }
 
-    inlineBotSwitchPMValue = result;
+    inlineBotSwitchPMValue = std::move(result);
 
     return *this;
 }
@@ -1144,7 +1191,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputAppEvent &inputAppEventValue
         break;
     }
 
-    inputAppEventValue = result;
+    inputAppEventValue = std::move(result);
 
     return *this;
 }
@@ -1165,7 +1212,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputBotInlineMessageID &inputBot
         break;
     }
 
-    inputBotInlineMessageIDValue = result;
+    inputBotInlineMessageIDValue = std::move(result);
 
     return *this;
 }
@@ -1187,7 +1234,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputChannel &inputChannelValue)
         break;
     }
 
-    inputChannelValue = result;
+    inputChannelValue = std::move(result);
 
     return *this;
 }
@@ -1209,7 +1256,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputContact &inputContactValue)
         break;
     }
 
-    inputContactValue = result;
+    inputContactValue = std::move(result);
 
     return *this;
 }
@@ -1231,7 +1278,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputDocument &inputDocumentValue
         break;
     }
 
-    inputDocumentValue = result;
+    inputDocumentValue = std::move(result);
 
     return *this;
 }
@@ -1251,7 +1298,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedChat &inputEncrypte
         break;
     }
 
-    inputEncryptedChatValue = result;
+    inputEncryptedChatValue = std::move(result);
 
     return *this;
 }
@@ -1284,7 +1331,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedFile &inputEncrypte
         break;
     }
 
-    inputEncryptedFileValue = result;
+    inputEncryptedFileValue = std::move(result);
 
     return *this;
 }
@@ -1311,7 +1358,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputFile &inputFileValue)
         break;
     }
 
-    inputFileValue = result;
+    inputFileValue = std::move(result);
 
     return *this;
 }
@@ -1341,7 +1388,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputFileLocation &inputFileLocat
         break;
     }
 
-    inputFileLocationValue = result;
+    inputFileLocationValue = std::move(result);
 
     return *this;
 }
@@ -1363,7 +1410,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputGeoPoint &inputGeoPointValue
         break;
     }
 
-    inputGeoPointValue = result;
+    inputGeoPointValue = std::move(result);
 
     return *this;
 }
@@ -1393,7 +1440,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPeer &inputPeerValue)
         break;
     }
 
-    inputPeerValue = result;
+    inputPeerValue = std::move(result);
 
     return *this;
 }
@@ -1412,7 +1459,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifyEvents &inputPeerN
         break;
     }
 
-    inputPeerNotifyEventsValue = result;
+    inputPeerNotifyEventsValue = std::move(result);
 
     return *this;
 }
@@ -1432,7 +1479,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPhoneCall &inputPhoneCallVal
         break;
     }
 
-    inputPhoneCallValue = result;
+    inputPhoneCallValue = std::move(result);
 
     return *this;
 }
@@ -1454,7 +1501,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPhoto &inputPhotoValue)
         break;
     }
 
-    inputPhotoValue = result;
+    inputPhotoValue = std::move(result);
 
     return *this;
 }
@@ -1474,7 +1521,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyKey &inputPrivacyKeyV
         break;
     }
 
-    inputPrivacyKeyValue = result;
+    inputPrivacyKeyValue = std::move(result);
 
     return *this;
 }
@@ -1499,7 +1546,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputStickerSet &inputStickerSetV
         break;
     }
 
-    inputStickerSetValue = result;
+    inputStickerSetValue = std::move(result);
 
     return *this;
 }
@@ -1521,7 +1568,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputStickeredMedia &inputSticker
         break;
     }
 
-    inputStickeredMediaValue = result;
+    inputStickeredMediaValue = std::move(result);
 
     return *this;
 }
@@ -1544,7 +1591,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputUser &inputUserValue)
         break;
     }
 
-    inputUserValue = result;
+    inputUserValue = std::move(result);
 
     return *this;
 }
@@ -1564,7 +1611,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputWebFileLocation &inputWebFil
         break;
     }
 
-    inputWebFileLocationValue = result;
+    inputWebFileLocationValue = std::move(result);
 
     return *this;
 }
@@ -1584,7 +1631,7 @@ CTelegramStream &CTelegramStream::operator>>(TLIpPort &ipPortValue)
         break;
     }
 
-    ipPortValue = result;
+    ipPortValue = std::move(result);
 
     return *this;
 }
@@ -1604,7 +1651,7 @@ CTelegramStream &CTelegramStream::operator>>(TLLabeledPrice &labeledPriceValue)
         break;
     }
 
-    labeledPriceValue = result;
+    labeledPriceValue = std::move(result);
 
     return *this;
 }
@@ -1625,7 +1672,7 @@ CTelegramStream &CTelegramStream::operator>>(TLLangPackLanguage &langPackLanguag
         break;
     }
 
-    langPackLanguageValue = result;
+    langPackLanguageValue = std::move(result);
 
     return *this;
 }
@@ -1668,7 +1715,7 @@ CTelegramStream &CTelegramStream::operator>>(TLLangPackString &langPackStringVal
         break;
     }
 
-    langPackStringValue = result;
+    langPackStringValue = std::move(result);
 
     return *this;
 }
@@ -1690,7 +1737,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMaskCoords &maskCoordsValue)
         break;
     }
 
-    maskCoordsValue = result;
+    maskCoordsValue = std::move(result);
 
     return *this;
 }
@@ -1738,7 +1785,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageEntity &messageEntityValue
         break;
     }
 
-    messageEntityValue = result;
+    messageEntityValue = std::move(result);
 
     return *this;
 }
@@ -1770,7 +1817,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageFwdHeader &messageFwdHeade
         break;
     }
 
-    messageFwdHeaderValue = result;
+    messageFwdHeaderValue = std::move(result);
 
     return *this;
 }
@@ -1790,7 +1837,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageRange &messageRangeValue)
         break;
     }
 
-    messageRangeValue = result;
+    messageRangeValue = std::move(result);
 
     return *this;
 }
@@ -1811,7 +1858,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedHistory &messages
         break;
     }
 
-    messagesAffectedHistoryValue = result;
+    messagesAffectedHistoryValue = std::move(result);
 
     return *this;
 }
@@ -1831,7 +1878,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedMessages &message
         break;
     }
 
-    messagesAffectedMessagesValue = result;
+    messagesAffectedMessagesValue = std::move(result);
 
     return *this;
 }
@@ -1856,7 +1903,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesDhConfig &messagesDhConfi
         break;
     }
 
-    messagesDhConfigValue = result;
+    messagesDhConfigValue = std::move(result);
 
     return *this;
 }
@@ -1879,7 +1926,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesSentEncryptedMessage &mes
         break;
     }
 
-    messagesSentEncryptedMessageValue = result;
+    messagesSentEncryptedMessageValue = std::move(result);
 
     return *this;
 }
@@ -1906,7 +1953,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMsgDetailedInfo &msgDetailedInfoV
         break;
     }
 
-    msgDetailedInfoValue = result;
+    msgDetailedInfoValue = std::move(result);
 
     return *this;
 }
@@ -1925,7 +1972,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMsgResendReq &msgResendReqValue)
         break;
     }
 
-    msgResendReqValue = result;
+    msgResendReqValue = std::move(result);
 
     return *this;
 }
@@ -1944,7 +1991,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMsgsAck &msgsAckValue)
         break;
     }
 
-    msgsAckValue = result;
+    msgsAckValue = std::move(result);
 
     return *this;
 }
@@ -1964,7 +2011,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMsgsAllInfo &msgsAllInfoValue)
         break;
     }
 
-    msgsAllInfoValue = result;
+    msgsAllInfoValue = std::move(result);
 
     return *this;
 }
@@ -1984,7 +2031,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMsgsStateInfo &msgsStateInfoValue
         break;
     }
 
-    msgsStateInfoValue = result;
+    msgsStateInfoValue = std::move(result);
 
     return *this;
 }
@@ -2003,7 +2050,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMsgsStateReq &msgsStateReqValue)
         break;
     }
 
-    msgsStateReqValue = result;
+    msgsStateReqValue = std::move(result);
 
     return *this;
 }
@@ -2024,7 +2071,7 @@ CTelegramStream &CTelegramStream::operator>>(TLNearestDc &nearestDcValue)
         break;
     }
 
-    nearestDcValue = result;
+    nearestDcValue = std::move(result);
 
     return *this;
 }
@@ -2045,7 +2092,7 @@ CTelegramStream &CTelegramStream::operator>>(TLNewSession &newSessionValue)
         break;
     }
 
-    newSessionValue = result;
+    newSessionValue = std::move(result);
 
     return *this;
 }
@@ -2069,7 +2116,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPQInnerData &pQInnerDataValue)
         break;
     }
 
-    pQInnerDataValue = result;
+    pQInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -2089,7 +2136,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentCharge &paymentChargeValue
         break;
     }
 
-    paymentChargeValue = result;
+    paymentChargeValue = std::move(result);
 
     return *this;
 }
@@ -2109,7 +2156,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentSavedCredentials &paymentS
         break;
     }
 
-    paymentSavedCredentialsValue = result;
+    paymentSavedCredentialsValue = std::move(result);
 
     return *this;
 }
@@ -2134,7 +2181,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPeer &peerValue)
         break;
     }
 
-    peerValue = result;
+    peerValue = std::move(result);
 
     return *this;
 }
@@ -2153,7 +2200,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPeerNotifyEvents &peerNotifyEvent
         break;
     }
 
-    peerNotifyEventsValue = result;
+    peerNotifyEventsValue = std::move(result);
 
     return *this;
 }
@@ -2174,7 +2221,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhoneCallDiscardReason &phoneCall
         break;
     }
 
-    phoneCallDiscardReasonValue = result;
+    phoneCallDiscardReasonValue = std::move(result);
 
     return *this;
 }
@@ -2197,7 +2244,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhoneConnection &phoneConnectionV
         break;
     }
 
-    phoneConnectionValue = result;
+    phoneConnectionValue = std::move(result);
 
     return *this;
 }
@@ -2230,7 +2277,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhotoSize &photoSizeValue)
         break;
     }
 
-    photoSizeValue = result;
+    photoSizeValue = std::move(result);
 
     return *this;
 }
@@ -2250,7 +2297,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPong &pongValue)
         break;
     }
 
-    pongValue = result;
+    pongValue = std::move(result);
 
     return *this;
 }
@@ -2270,7 +2317,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPopularContact &popularContactVal
         break;
     }
 
-    popularContactValue = result;
+    popularContactValue = std::move(result);
 
     return *this;
 }
@@ -2294,7 +2341,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPostAddress &postAddressValue)
         break;
     }
 
-    postAddressValue = result;
+    postAddressValue = std::move(result);
 
     return *this;
 }
@@ -2314,7 +2361,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPrivacyKey &privacyKeyValue)
         break;
     }
 
-    privacyKeyValue = result;
+    privacyKeyValue = std::move(result);
 
     return *this;
 }
@@ -2339,7 +2386,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPrivacyRule &privacyRuleValue)
         break;
     }
 
-    privacyRuleValue = result;
+    privacyRuleValue = std::move(result);
 
     return *this;
 }
@@ -2359,7 +2406,7 @@ CTelegramStream &CTelegramStream::operator>>(TLReceivedNotifyMessage &receivedNo
         break;
     }
 
-    receivedNotifyMessageValue = result;
+    receivedNotifyMessageValue = std::move(result);
 
     return *this;
 }
@@ -2382,7 +2429,7 @@ CTelegramStream &CTelegramStream::operator>>(TLReportReason &reportReasonValue)
         break;
     }
 
-    reportReasonValue = result;
+    reportReasonValue = std::move(result);
 
     return *this;
 }
@@ -2404,7 +2451,7 @@ CTelegramStream &CTelegramStream::operator>>(TLResPQ &resPQValue)
         break;
     }
 
-    resPQValue = result;
+    resPQValue = std::move(result);
 
     return *this;
 }
@@ -2444,7 +2491,7 @@ CTelegramStream &CTelegramStream::operator>>(TLRichText &richTextValue)
         break;
     }
 
-    richTextValue = result;
+    richTextValue = std::move(result);
 
     return *this;
 }
@@ -2468,7 +2515,7 @@ CTelegramStream &CTelegramStream::operator>>(TLRpcDropAnswer &rpcDropAnswerValue
         break;
     }
 
-    rpcDropAnswerValue = result;
+    rpcDropAnswerValue = std::move(result);
 
     return *this;
 }
@@ -2488,7 +2535,7 @@ CTelegramStream &CTelegramStream::operator>>(TLRpcError &rpcErrorValue)
         break;
     }
 
-    rpcErrorValue = result;
+    rpcErrorValue = std::move(result);
 
     return *this;
 }
@@ -2520,7 +2567,7 @@ CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageAct
         break;
     }
 
-    sendMessageActionValue = result;
+    sendMessageActionValue = std::move(result);
 
     return *this;
 }
@@ -2544,7 +2591,7 @@ CTelegramStream &CTelegramStream::operator>>(TLServerDHInnerData &serverDHInnerD
         break;
     }
 
-    serverDHInnerDataValue = result;
+    serverDHInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -2570,7 +2617,7 @@ CTelegramStream &CTelegramStream::operator>>(TLServerDHParams &serverDHParamsVal
         break;
     }
 
-    serverDHParamsValue = result;
+    serverDHParamsValue = std::move(result);
 
     return *this;
 }
@@ -2601,7 +2648,7 @@ CTelegramStream &CTelegramStream::operator>>(TLSetClientDHParamsAnswer &setClien
         break;
     }
 
-    setClientDHParamsAnswerValue = result;
+    setClientDHParamsAnswerValue = std::move(result);
 
     return *this;
 }
@@ -2622,7 +2669,7 @@ CTelegramStream &CTelegramStream::operator>>(TLShippingOption &shippingOptionVal
         break;
     }
 
-    shippingOptionValue = result;
+    shippingOptionValue = std::move(result);
 
     return *this;
 }
@@ -2642,7 +2689,7 @@ CTelegramStream &CTelegramStream::operator>>(TLStickerPack &stickerPackValue)
         break;
     }
 
-    stickerPackValue = result;
+    stickerPackValue = std::move(result);
 
     return *this;
 }
@@ -2669,7 +2716,7 @@ CTelegramStream &CTelegramStream::operator>>(TLStorageFileType &storageFileTypeV
         break;
     }
 
-    storageFileTypeValue = result;
+    storageFileTypeValue = std::move(result);
 
     return *this;
 }
@@ -2689,7 +2736,7 @@ CTelegramStream &CTelegramStream::operator>>(TLTopPeer &topPeerValue)
         break;
     }
 
-    topPeerValue = result;
+    topPeerValue = std::move(result);
 
     return *this;
 }
@@ -2712,7 +2759,7 @@ CTelegramStream &CTelegramStream::operator>>(TLTopPeerCategory &topPeerCategoryV
         break;
     }
 
-    topPeerCategoryValue = result;
+    topPeerCategoryValue = std::move(result);
 
     return *this;
 }
@@ -2733,7 +2780,7 @@ CTelegramStream &CTelegramStream::operator>>(TLTopPeerCategoryPeers &topPeerCate
         break;
     }
 
-    topPeerCategoryPeersValue = result;
+    topPeerCategoryPeersValue = std::move(result);
 
     return *this;
 }
@@ -2756,7 +2803,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdatesState &updatesStateValue)
         break;
     }
 
-    updatesStateValue = result;
+    updatesStateValue = std::move(result);
 
     return *this;
 }
@@ -2778,7 +2825,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUploadCdnFile &uploadCdnFileValue
         break;
     }
 
-    uploadCdnFileValue = result;
+    uploadCdnFileValue = std::move(result);
 
     return *this;
 }
@@ -2806,7 +2853,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUploadFile &uploadFileValue)
         break;
     }
 
-    uploadFileValue = result;
+    uploadFileValue = std::move(result);
 
     return *this;
 }
@@ -2829,7 +2876,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUploadWebFile &uploadWebFileValue
         break;
     }
 
-    uploadWebFileValue = result;
+    uploadWebFileValue = std::move(result);
 
     return *this;
 }
@@ -2852,7 +2899,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUserProfilePhoto &userProfilePhot
         break;
     }
 
-    userProfilePhotoValue = result;
+    userProfilePhotoValue = std::move(result);
 
     return *this;
 }
@@ -2879,7 +2926,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUserStatus &userStatusValue)
         break;
     }
 
-    userStatusValue = result;
+    userStatusValue = std::move(result);
 
     return *this;
 }
@@ -2907,7 +2954,7 @@ CTelegramStream &CTelegramStream::operator>>(TLWallPaper &wallPaperValue)
         break;
     }
 
-    wallPaperValue = result;
+    wallPaperValue = std::move(result);
 
     return *this;
 }
@@ -2926,7 +2973,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountAuthorizations &accountAut
         break;
     }
 
-    accountAuthorizationsValue = result;
+    accountAuthorizationsValue = std::move(result);
 
     return *this;
 }
@@ -2953,7 +3000,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthSentCode &authSentCodeValue)
         break;
     }
 
-    authSentCodeValue = result;
+    authSentCodeValue = std::move(result);
 
     return *this;
 }
@@ -2972,7 +3019,7 @@ CTelegramStream &CTelegramStream::operator>>(TLCdnConfig &cdnConfigValue)
         break;
     }
 
-    cdnConfigValue = result;
+    cdnConfigValue = std::move(result);
 
     return *this;
 }
@@ -2991,7 +3038,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelAdminLogEventsFilter &chan
         break;
     }
 
-    channelAdminLogEventsFilterValue = result;
+    channelAdminLogEventsFilterValue = std::move(result);
 
     return *this;
 }
@@ -3010,7 +3057,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelAdminRights &channelAdminR
         break;
     }
 
-    channelAdminRightsValue = result;
+    channelAdminRightsValue = std::move(result);
 
     return *this;
 }
@@ -3030,7 +3077,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelBannedRights &channelBanne
         break;
     }
 
-    channelBannedRightsValue = result;
+    channelBannedRightsValue = std::move(result);
 
     return *this;
 }
@@ -3052,7 +3099,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelMessagesFilter &channelMes
         break;
     }
 
-    channelMessagesFilterValue = result;
+    channelMessagesFilterValue = std::move(result);
 
     return *this;
 }
@@ -3095,7 +3142,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelParticipant &channelPartic
         break;
     }
 
-    channelParticipantValue = result;
+    channelParticipantValue = std::move(result);
 
     return *this;
 }
@@ -3117,7 +3164,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChatPhoto &chatPhotoValue)
         break;
     }
 
-    chatPhotoValue = result;
+    chatPhotoValue = std::move(result);
 
     return *this;
 }
@@ -3137,7 +3184,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactStatus &contactStatusValue
         break;
     }
 
-    contactStatusValue = result;
+    contactStatusValue = std::move(result);
 
     return *this;
 }
@@ -3159,7 +3206,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDcOption &dcOptionValue)
         break;
     }
 
-    dcOptionValue = result;
+    dcOptionValue = std::move(result);
 
     return *this;
 }
@@ -3212,7 +3259,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDocumentAttribute &documentAttrib
         break;
     }
 
-    documentAttributeValue = result;
+    documentAttributeValue = std::move(result);
 
     return *this;
 }
@@ -3241,7 +3288,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDraftMessage &draftMessageValue)
         break;
     }
 
-    draftMessageValue = result;
+    draftMessageValue = std::move(result);
 
     return *this;
 }
@@ -3263,7 +3310,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpConfigSimple &helpConfigSimpl
         break;
     }
 
-    helpConfigSimpleValue = result;
+    helpConfigSimpleValue = std::move(result);
 
     return *this;
 }
@@ -3287,7 +3334,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputChatPhoto &inputChatPhotoVal
         break;
     }
 
-    inputChatPhotoValue = result;
+    inputChatPhotoValue = std::move(result);
 
     return *this;
 }
@@ -3311,7 +3358,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputGame &inputGameValue)
         break;
     }
 
-    inputGameValue = result;
+    inputGameValue = std::move(result);
 
     return *this;
 }
@@ -3334,7 +3381,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputNotifyPeer &inputNotifyPeerV
         break;
     }
 
-    inputNotifyPeerValue = result;
+    inputNotifyPeerValue = std::move(result);
 
     return *this;
 }
@@ -3364,7 +3411,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPaymentCredentials &inputPay
         break;
     }
 
-    inputPaymentCredentialsValue = result;
+    inputPaymentCredentialsValue = std::move(result);
 
     return *this;
 }
@@ -3385,7 +3432,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifySettings &inputPee
         break;
     }
 
-    inputPeerNotifySettingsValue = result;
+    inputPeerNotifySettingsValue = std::move(result);
 
     return *this;
 }
@@ -3410,7 +3457,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyRule &inputPrivacyRul
         break;
     }
 
-    inputPrivacyRuleValue = result;
+    inputPrivacyRuleValue = std::move(result);
 
     return *this;
 }
@@ -3434,7 +3481,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputStickerSetItem &inputSticker
         break;
     }
 
-    inputStickerSetItemValue = result;
+    inputStickerSetItemValue = std::move(result);
 
     return *this;
 }
@@ -3456,7 +3503,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputWebDocument &inputWebDocumen
         break;
     }
 
-    inputWebDocumentValue = result;
+    inputWebDocumentValue = std::move(result);
 
     return *this;
 }
@@ -3477,7 +3524,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInvoice &invoiceValue)
         break;
     }
 
-    invoiceValue = result;
+    invoiceValue = std::move(result);
 
     return *this;
 }
@@ -3513,7 +3560,7 @@ CTelegramStream &CTelegramStream::operator>>(TLKeyboardButton &keyboardButtonVal
         break;
     }
 
-    keyboardButtonValue = result;
+    keyboardButtonValue = std::move(result);
 
     return *this;
 }
@@ -3532,7 +3579,7 @@ CTelegramStream &CTelegramStream::operator>>(TLKeyboardButtonRow &keyboardButton
         break;
     }
 
-    keyboardButtonRowValue = result;
+    keyboardButtonRowValue = std::move(result);
 
     return *this;
 }
@@ -3554,7 +3601,7 @@ CTelegramStream &CTelegramStream::operator>>(TLLangPackDifference &langPackDiffe
         break;
     }
 
-    langPackDifferenceValue = result;
+    langPackDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -3580,7 +3627,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesBotCallbackAnswer &messag
         break;
     }
 
-    messagesBotCallbackAnswerValue = result;
+    messagesBotCallbackAnswerValue = std::move(result);
 
     return *this;
 }
@@ -3615,7 +3662,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesFilter &messagesFilterVal
         break;
     }
 
-    messagesFilterValue = result;
+    messagesFilterValue = std::move(result);
 
     return *this;
 }
@@ -3634,7 +3681,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesMessageEditData &messages
         break;
     }
 
-    messagesMessageEditDataValue = result;
+    messagesMessageEditDataValue = std::move(result);
 
     return *this;
 }
@@ -3657,7 +3704,7 @@ CTelegramStream &CTelegramStream::operator>>(TLNotifyPeer &notifyPeerValue)
         break;
     }
 
-    notifyPeerValue = result;
+    notifyPeerValue = std::move(result);
 
     return *this;
 }
@@ -3688,7 +3735,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentRequestedInfo &paymentRequ
         break;
     }
 
-    paymentRequestedInfoValue = result;
+    paymentRequestedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3710,7 +3757,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentsSavedInfo &paymentsSavedI
         break;
     }
 
-    paymentsSavedInfoValue = result;
+    paymentsSavedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3735,7 +3782,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentsValidatedRequestedInfo &p
         break;
     }
 
-    paymentsValidatedRequestedInfoValue = result;
+    paymentsValidatedRequestedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3758,7 +3805,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPeerNotifySettings &peerNotifySet
         break;
     }
 
-    peerNotifySettingsValue = result;
+    peerNotifySettingsValue = std::move(result);
 
     return *this;
 }
@@ -3777,7 +3824,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPeerSettings &peerSettingsValue)
         break;
     }
 
-    peerSettingsValue = result;
+    peerSettingsValue = std::move(result);
 
     return *this;
 }
@@ -3798,7 +3845,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhoneCallProtocol &phoneCallProto
         break;
     }
 
-    phoneCallProtocolValue = result;
+    phoneCallProtocolValue = std::move(result);
 
     return *this;
 }
@@ -3824,7 +3871,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhoto &photoValue)
         break;
     }
 
-    photoValue = result;
+    photoValue = std::move(result);
 
     return *this;
 }
@@ -3851,7 +3898,7 @@ CTelegramStream &CTelegramStream::operator>>(TLReplyMarkup &replyMarkupValue)
         break;
     }
 
-    replyMarkupValue = result;
+    replyMarkupValue = std::move(result);
 
     return *this;
 }
@@ -3876,7 +3923,7 @@ CTelegramStream &CTelegramStream::operator>>(TLStickerSet &stickerSetValue)
         break;
     }
 
-    stickerSetValue = result;
+    stickerSetValue = std::move(result);
 
     return *this;
 }
@@ -3932,7 +3979,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUser &userValue)
         break;
     }
 
-    userValue = result;
+    userValue = std::move(result);
 
     return *this;
 }
@@ -3956,7 +4003,7 @@ CTelegramStream &CTelegramStream::operator>>(TLWebDocument &webDocumentValue)
         break;
     }
 
-    webDocumentValue = result;
+    webDocumentValue = std::move(result);
 
     return *this;
 }
@@ -3976,7 +4023,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAccountPrivacyRules &accountPriva
         break;
     }
 
-    accountPrivacyRulesValue = result;
+    accountPrivacyRulesValue = std::move(result);
 
     return *this;
 }
@@ -3999,7 +4046,7 @@ CTelegramStream &CTelegramStream::operator>>(TLAuthAuthorization &authAuthorizat
         break;
     }
 
-    authAuthorizationValue = result;
+    authAuthorizationValue = std::move(result);
 
     return *this;
 }
@@ -4060,7 +4107,7 @@ CTelegramStream &CTelegramStream::operator>>(TLBotInlineMessage &botInlineMessag
         break;
     }
 
-    botInlineMessageValue = result;
+    botInlineMessageValue = std::move(result);
 
     return *this;
 }
@@ -4080,7 +4127,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelsChannelParticipant &chann
         break;
     }
 
-    channelsChannelParticipantValue = result;
+    channelsChannelParticipantValue = std::move(result);
 
     return *this;
 }
@@ -4103,7 +4150,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelsChannelParticipants &chan
         break;
     }
 
-    channelsChannelParticipantsValue = result;
+    channelsChannelParticipantsValue = std::move(result);
 
     return *this;
 }
@@ -4170,7 +4217,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChat &chatValue)
         break;
     }
 
-    chatValue = result;
+    chatValue = std::move(result);
 
     return *this;
 }
@@ -4233,7 +4280,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChatFull &chatFullValue)
         break;
     }
 
-    chatFullValue = result;
+    chatFullValue = std::move(result);
 
     return *this;
 }
@@ -4261,7 +4308,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChatInvite &chatInviteValue)
         break;
     }
 
-    chatInviteValue = result;
+    chatInviteValue = std::move(result);
 
     return *this;
 }
@@ -4319,7 +4366,7 @@ CTelegramStream &CTelegramStream::operator>>(TLConfig &configValue)
         break;
     }
 
-    configValue = result;
+    configValue = std::move(result);
 
     return *this;
 }
@@ -4344,7 +4391,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsBlocked &contactsBlockedV
         break;
     }
 
-    contactsBlockedValue = result;
+    contactsBlockedValue = std::move(result);
 
     return *this;
 }
@@ -4367,7 +4414,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsContacts &contactsContact
         break;
     }
 
-    contactsContactsValue = result;
+    contactsContactsValue = std::move(result);
 
     return *this;
 }
@@ -4388,7 +4435,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsFound &contactsFoundValue
         break;
     }
 
-    contactsFoundValue = result;
+    contactsFoundValue = std::move(result);
 
     return *this;
 }
@@ -4410,7 +4457,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsImportedContacts &contact
         break;
     }
 
-    contactsImportedContactsValue = result;
+    contactsImportedContactsValue = std::move(result);
 
     return *this;
 }
@@ -4431,7 +4478,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsLink &contactsLinkValue)
         break;
     }
 
-    contactsLinkValue = result;
+    contactsLinkValue = std::move(result);
 
     return *this;
 }
@@ -4452,7 +4499,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsResolvedPeer &contactsRes
         break;
     }
 
-    contactsResolvedPeerValue = result;
+    contactsResolvedPeerValue = std::move(result);
 
     return *this;
 }
@@ -4475,7 +4522,7 @@ CTelegramStream &CTelegramStream::operator>>(TLContactsTopPeers &contactsTopPeer
         break;
     }
 
-    contactsTopPeersValue = result;
+    contactsTopPeersValue = std::move(result);
 
     return *this;
 }
@@ -4507,7 +4554,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDialog &dialogValue)
         break;
     }
 
-    dialogValue = result;
+    dialogValue = std::move(result);
 
     return *this;
 }
@@ -4537,7 +4584,7 @@ CTelegramStream &CTelegramStream::operator>>(TLDocument &documentValue)
         break;
     }
 
-    documentValue = result;
+    documentValue = std::move(result);
 
     return *this;
 }
@@ -4566,7 +4613,7 @@ CTelegramStream &CTelegramStream::operator>>(TLFoundGif &foundGifValue)
         break;
     }
 
-    foundGifValue = result;
+    foundGifValue = std::move(result);
 
     return *this;
 }
@@ -4594,7 +4641,7 @@ CTelegramStream &CTelegramStream::operator>>(TLGame &gameValue)
         break;
     }
 
-    gameValue = result;
+    gameValue = std::move(result);
 
     return *this;
 }
@@ -4614,7 +4661,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpSupport &helpSupportValue)
         break;
     }
 
-    helpSupportValue = result;
+    helpSupportValue = std::move(result);
 
     return *this;
 }
@@ -4681,7 +4728,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputBotInlineMessage &inputBotIn
         break;
     }
 
-    inputBotInlineMessageValue = result;
+    inputBotInlineMessageValue = std::move(result);
 
     return *this;
 }
@@ -4754,7 +4801,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputBotInlineResult &inputBotInl
         break;
     }
 
-    inputBotInlineResultValue = result;
+    inputBotInlineResultValue = std::move(result);
 
     return *this;
 }
@@ -4863,7 +4910,7 @@ CTelegramStream &CTelegramStream::operator>>(TLInputMedia &inputMediaValue)
         break;
     }
 
-    inputMediaValue = result;
+    inputMediaValue = std::move(result);
 
     return *this;
 }
@@ -4946,7 +4993,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageAction &messageActionValue
         break;
     }
 
-    messageActionValue = result;
+    messageActionValue = std::move(result);
 
     return *this;
 }
@@ -4968,7 +5015,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesAllStickers &messagesAllS
         break;
     }
 
-    messagesAllStickersValue = result;
+    messagesAllStickersValue = std::move(result);
 
     return *this;
 }
@@ -4989,7 +5036,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesChatFull &messagesChatFul
         break;
     }
 
-    messagesChatFullValue = result;
+    messagesChatFullValue = std::move(result);
 
     return *this;
 }
@@ -5012,7 +5059,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesChats &messagesChatsValue
         break;
     }
 
-    messagesChatsValue = result;
+    messagesChatsValue = std::move(result);
 
     return *this;
 }
@@ -5035,7 +5082,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesFavedStickers &messagesFa
         break;
     }
 
-    messagesFavedStickersValue = result;
+    messagesFavedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5055,7 +5102,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesFoundGifs &messagesFoundG
         break;
     }
 
-    messagesFoundGifsValue = result;
+    messagesFoundGifsValue = std::move(result);
 
     return *this;
 }
@@ -5075,7 +5122,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesHighScores &messagesHighS
         break;
     }
 
-    messagesHighScoresValue = result;
+    messagesHighScoresValue = std::move(result);
 
     return *this;
 }
@@ -5097,7 +5144,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesRecentStickers &messagesR
         break;
     }
 
-    messagesRecentStickersValue = result;
+    messagesRecentStickersValue = std::move(result);
 
     return *this;
 }
@@ -5119,7 +5166,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesSavedGifs &messagesSavedG
         break;
     }
 
-    messagesSavedGifsValue = result;
+    messagesSavedGifsValue = std::move(result);
 
     return *this;
 }
@@ -5140,7 +5187,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesStickerSet &messagesStick
         break;
     }
 
-    messagesStickerSetValue = result;
+    messagesStickerSetValue = std::move(result);
 
     return *this;
 }
@@ -5162,7 +5209,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesStickers &messagesSticker
         break;
     }
 
-    messagesStickersValue = result;
+    messagesStickersValue = std::move(result);
 
     return *this;
 }
@@ -5257,7 +5304,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPageBlock &pageBlockValue)
         break;
     }
 
-    pageBlockValue = result;
+    pageBlockValue = std::move(result);
 
     return *this;
 }
@@ -5293,7 +5340,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentsPaymentForm &paymentsPaym
         break;
     }
 
-    paymentsPaymentFormValue = result;
+    paymentsPaymentFormValue = std::move(result);
 
     return *this;
 }
@@ -5326,7 +5373,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentsPaymentReceipt &paymentsP
         break;
     }
 
-    paymentsPaymentReceiptValue = result;
+    paymentsPaymentReceiptValue = std::move(result);
 
     return *this;
 }
@@ -5398,7 +5445,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhoneCall &phoneCallValue)
         break;
     }
 
-    phoneCallValue = result;
+    phoneCallValue = std::move(result);
 
     return *this;
 }
@@ -5418,7 +5465,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhonePhoneCall &phonePhoneCallVal
         break;
     }
 
-    phonePhoneCallValue = result;
+    phonePhoneCallValue = std::move(result);
 
     return *this;
 }
@@ -5438,7 +5485,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhotosPhoto &photosPhotoValue)
         break;
     }
 
-    photosPhotoValue = result;
+    photosPhotoValue = std::move(result);
 
     return *this;
 }
@@ -5463,7 +5510,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPhotosPhotos &photosPhotosValue)
         break;
     }
 
-    photosPhotosValue = result;
+    photosPhotosValue = std::move(result);
 
     return *this;
 }
@@ -5487,7 +5534,7 @@ CTelegramStream &CTelegramStream::operator>>(TLStickerSetCovered &stickerSetCove
         break;
     }
 
-    stickerSetCoveredValue = result;
+    stickerSetCoveredValue = std::move(result);
 
     return *this;
 }
@@ -5519,7 +5566,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUserFull &userFullValue)
         break;
     }
 
-    userFullValue = result;
+    userFullValue = std::move(result);
 
     return *this;
 }
@@ -5586,7 +5633,7 @@ CTelegramStream &CTelegramStream::operator>>(TLBotInlineResult &botInlineResultV
         break;
     }
 
-    botInlineResultValue = result;
+    botInlineResultValue = std::move(result);
 
     return *this;
 }
@@ -5606,7 +5653,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesArchivedStickers &message
         break;
     }
 
-    messagesArchivedStickersValue = result;
+    messagesArchivedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5635,7 +5682,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesBotResults &messagesBotRe
         break;
     }
 
-    messagesBotResultsValue = result;
+    messagesBotResultsValue = std::move(result);
 
     return *this;
 }
@@ -5658,7 +5705,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesFeaturedStickers &message
         break;
     }
 
-    messagesFeaturedStickersValue = result;
+    messagesFeaturedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5679,7 +5726,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesStickerSetInstallResult &
         break;
     }
 
-    messagesStickerSetInstallResultValue = result;
+    messagesStickerSetInstallResultValue = std::move(result);
 
     return *this;
 }
@@ -5701,7 +5748,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPage &pageValue)
         break;
     }
 
-    pageValue = result;
+    pageValue = std::move(result);
 
     return *this;
 }
@@ -5736,7 +5783,7 @@ CTelegramStream &CTelegramStream::operator>>(TLRecentMeUrl &recentMeUrlValue)
         break;
     }
 
-    recentMeUrlValue = result;
+    recentMeUrlValue = std::move(result);
 
     return *this;
 }
@@ -5807,7 +5854,7 @@ CTelegramStream &CTelegramStream::operator>>(TLWebPage &webPageValue)
         break;
     }
 
-    webPageValue = result;
+    webPageValue = std::move(result);
 
     return *this;
 }
@@ -5828,7 +5875,7 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpRecentMeUrls &helpRecentMeUrl
         break;
     }
 
-    helpRecentMeUrlsValue = result;
+    helpRecentMeUrlsValue = std::move(result);
 
     return *this;
 }
@@ -5846,7 +5893,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
     case TLValue::MessageMediaPhoto:
         *this >> result.flags;
         if (result.flags & 1 << 0) {
-            *this >> result.photo;
+            *this >> *result.photo;
         }
         if (result.flags & 1 << 1) {
             *this >> result.caption;
@@ -5867,7 +5914,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
     case TLValue::MessageMediaDocument:
         *this >> result.flags;
         if (result.flags & 1 << 0) {
-            *this >> result.document;
+            *this >> *result.document;
         }
         if (result.flags & 1 << 1) {
             *this >> result.caption;
@@ -5877,7 +5924,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
         }
         break;
     case TLValue::MessageMediaWebPage:
-        *this >> result.webpage;
+        *this >> *result.webpage;
         break;
     case TLValue::MessageMediaVenue:
         *this >> result.geo;
@@ -5888,14 +5935,14 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
         *this >> result.venueType;
         break;
     case TLValue::MessageMediaGame:
-        *this >> result.game;
+        *this >> *result.game;
         break;
     case TLValue::MessageMediaInvoice:
         *this >> result.flags;
         *this >> result.title;
         *this >> result.description;
         if (result.flags & 1 << 0) {
-            *this >> result.webDocumentPhoto;
+            *this >> *result.webDocumentPhoto;
         }
         if (result.flags & 1 << 2) {
             *this >> result.receiptMsgId;
@@ -5912,7 +5959,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
         break;
     }
 
-    messageMediaValue = result;
+    messageMediaValue = std::move(result);
 
     return *this;
 }
@@ -5935,7 +5982,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessage &messageValue)
         }
         *this >> result.toId;
         if (result.flags & 1 << 2) {
-            *this >> result.fwdFrom;
+            *this >> *result.fwdFrom;
         }
         if (result.flags & 1 << 11) {
             *this >> result.viaBotId;
@@ -5946,10 +5993,10 @@ CTelegramStream &CTelegramStream::operator>>(TLMessage &messageValue)
         *this >> result.date;
         *this >> result.message;
         if (result.flags & 1 << 9) {
-            *this >> result.media;
+            *this >> *result.media;
         }
         if (result.flags & 1 << 6) {
-            *this >> result.replyMarkup;
+            *this >> *result.replyMarkup;
         }
         if (result.flags & 1 << 7) {
             *this >> result.entities;
@@ -5975,13 +6022,13 @@ CTelegramStream &CTelegramStream::operator>>(TLMessage &messageValue)
             *this >> result.replyToMsgId;
         }
         *this >> result.date;
-        *this >> result.action;
+        *this >> *result.action;
         break;
     default:
         break;
     }
 
-    messageValue = result;
+    messageValue = std::move(result);
 
     return *this;
 }
@@ -6010,7 +6057,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesDialogs &messagesDialogsV
         break;
     }
 
-    messagesDialogsValue = result;
+    messagesDialogsValue = std::move(result);
 
     return *this;
 }
@@ -6048,7 +6095,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesMessages &messagesMessage
         break;
     }
 
-    messagesMessagesValue = result;
+    messagesMessagesValue = std::move(result);
 
     return *this;
 }
@@ -6071,7 +6118,7 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesPeerDialogs &messagesPeer
         break;
     }
 
-    messagesPeerDialogsValue = result;
+    messagesPeerDialogsValue = std::move(result);
 
     return *this;
 }
@@ -6087,7 +6134,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
     case TLValue::UpdateNewChannelMessage:
     case TLValue::UpdateEditChannelMessage:
     case TLValue::UpdateEditMessage:
-        *this >> result.message;
+        *this >> *result.message;
         *this >> result.pts;
         *this >> result.ptsCount;
         break;
@@ -6111,7 +6158,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.action;
         break;
     case TLValue::UpdateChatParticipants:
-        *this >> result.participants;
+        *this >> *result.participants;
         break;
     case TLValue::UpdateUserStatus:
         *this >> result.userId;
@@ -6126,7 +6173,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
     case TLValue::UpdateUserPhoto:
         *this >> result.userId;
         *this >> result.date;
-        *this >> result.photo;
+        *this >> *result.photo;
         *this >> result.previous;
         break;
     case TLValue::UpdateContactRegistered:
@@ -6139,14 +6186,14 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.foreignLink;
         break;
     case TLValue::UpdateNewEncryptedMessage:
-        *this >> result.encryptedMessage;
+        *this >> *result.encryptedMessage;
         *this >> result.qts;
         break;
     case TLValue::UpdateEncryptedChatTyping:
         *this >> result.chatId;
         break;
     case TLValue::UpdateEncryption:
-        *this >> result.chat;
+        *this >> *result.chat;
         *this >> result.date;
         break;
     case TLValue::UpdateEncryptedMessagesRead:
@@ -6174,8 +6221,8 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.blocked;
         break;
     case TLValue::UpdateNotifySettings:
-        *this >> result.notifyPeer;
-        *this >> result.notifySettings;
+        *this >> *result.notifyPeer;
+        *this >> *result.notifySettings;
         break;
     case TLValue::UpdateServiceNotification:
         *this >> result.flags;
@@ -6184,7 +6231,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         }
         *this >> result.type;
         *this >> result.stringMessage;
-        *this >> result.media;
+        *this >> *result.media;
         *this >> result.entities;
         break;
     case TLValue::UpdatePrivacy:
@@ -6203,7 +6250,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.ptsCount;
         break;
     case TLValue::UpdateWebPage:
-        *this >> result.webpage;
+        *this >> *result.webpage;
         *this >> result.pts;
         *this >> result.ptsCount;
         break;
@@ -6245,7 +6292,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.version;
         break;
     case TLValue::UpdateNewStickerSet:
-        *this >> result.stickerset;
+        *this >> *result.stickerset;
         break;
     case TLValue::UpdateStickerSetsOrder:
         *this >> result.flags;
@@ -6316,11 +6363,11 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         break;
     case TLValue::UpdateDraftMessage:
         *this >> result.peer;
-        *this >> result.draft;
+        *this >> *result.draft;
         break;
     case TLValue::UpdateChannelWebPage:
         *this >> result.channelId;
-        *this >> result.webpage;
+        *this >> *result.webpage;
         *this >> result.pts;
         *this >> result.ptsCount;
         break;
@@ -6335,18 +6382,18 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         }
         break;
     case TLValue::UpdateBotWebhookJSON:
-        *this >> result.jSONData;
+        *this >> *result.jSONData;
         break;
     case TLValue::UpdateBotWebhookJSONQuery:
         *this >> result.queryId;
-        *this >> result.jSONData;
+        *this >> *result.jSONData;
         *this >> result.timeout;
         break;
     case TLValue::UpdateBotShippingQuery:
         *this >> result.queryId;
         *this >> result.userId;
         *this >> result.payload;
-        *this >> result.shippingAddress;
+        *this >> *result.shippingAddress;
         break;
     case TLValue::UpdateBotPrecheckoutQuery:
         *this >> result.flags;
@@ -6354,7 +6401,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.userId;
         *this >> result.payload;
         if (result.flags & 1 << 0) {
-            *this >> result.info;
+            *this >> *result.info;
         }
         if (result.flags & 1 << 1) {
             *this >> result.shippingOptionId;
@@ -6363,10 +6410,10 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         *this >> result.totalAmount;
         break;
     case TLValue::UpdatePhoneCall:
-        *this >> result.phoneCall;
+        *this >> *result.phoneCall;
         break;
     case TLValue::UpdateLangPack:
-        *this >> result.difference;
+        *this >> *result.difference;
         break;
     case TLValue::UpdateChannelReadMessagesContents:
         *this >> result.channelId;
@@ -6380,7 +6427,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
         break;
     }
 
-    updateValue = result;
+    updateValue = std::move(result);
 
     return *this;
 }
@@ -6473,7 +6520,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdates &updatesValue)
         break;
     }
 
-    updatesValue = result;
+    updatesValue = std::move(result);
 
     return *this;
 }
@@ -6522,7 +6569,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdatesChannelDifference &updates
         break;
     }
 
-    updatesChannelDifferenceValue = result;
+    updatesChannelDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -6561,7 +6608,7 @@ CTelegramStream &CTelegramStream::operator>>(TLUpdatesDifference &updatesDiffere
         break;
     }
 
-    updatesDifferenceValue = result;
+    updatesDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -6615,7 +6662,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelAdminLogEventAction &chann
         break;
     }
 
-    channelAdminLogEventActionValue = result;
+    channelAdminLogEventActionValue = std::move(result);
 
     return *this;
 }
@@ -6637,7 +6684,7 @@ CTelegramStream &CTelegramStream::operator>>(TLPaymentsPaymentResult &paymentsPa
         break;
     }
 
-    paymentsPaymentResultValue = result;
+    paymentsPaymentResultValue = std::move(result);
 
     return *this;
 }
@@ -6659,7 +6706,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelAdminLogEvent &channelAdmi
         break;
     }
 
-    channelAdminLogEventValue = result;
+    channelAdminLogEventValue = std::move(result);
 
     return *this;
 }
@@ -6680,7 +6727,7 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelsAdminLogResults &channels
         break;
     }
 
-    channelsAdminLogResultsValue = result;
+    channelsAdminLogResultsValue = std::move(result);
 
     return *this;
 }
@@ -350,20 +350,6 @@ public:
     // End of generated write operators
 };
 
-inline CTelegramStream &CTelegramStream::operator>>(QString &str)
-{
-    QByteArray data;
-    *this >> data;
-    str = QString::fromUtf8(data);
-    return *this;
-}
-
-inline CTelegramStream &CTelegramStream::operator<<(const QString &str)
-{
-    *this << str.toUtf8();
-    return *this;
-}
-
 inline CTelegramStream &CTelegramStream::operator>>(bool &data)
 {
     TLBool val;
@@ -3377,7 +3377,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessageMedia &messa
     case TLValue::MessageMediaPhoto:
         stream << messageMediaValue.flags;
         if (messageMediaValue.flags & 1 << 0) {
-            stream << messageMediaValue.photo;
+            stream << *messageMediaValue.photo;
         }
         if (messageMediaValue.flags & 1 << 1) {
             stream << messageMediaValue.caption;
@@ -3398,7 +3398,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessageMedia &messa
     case TLValue::MessageMediaDocument:
         stream << messageMediaValue.flags;
         if (messageMediaValue.flags & 1 << 0) {
-            stream << messageMediaValue.document;
+            stream << *messageMediaValue.document;
         }
         if (messageMediaValue.flags & 1 << 1) {
             stream << messageMediaValue.caption;
@@ -3408,7 +3408,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessageMedia &messa
         }
         break;
     case TLValue::MessageMediaWebPage:
-        stream << messageMediaValue.webpage;
+        stream << *messageMediaValue.webpage;
         break;
     case TLValue::MessageMediaVenue:
         stream << messageMediaValue.geo;
@@ -3419,14 +3419,14 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessageMedia &messa
         stream << messageMediaValue.venueType;
         break;
     case TLValue::MessageMediaGame:
-        stream << messageMediaValue.game;
+        stream << *messageMediaValue.game;
         break;
     case TLValue::MessageMediaInvoice:
         stream << messageMediaValue.flags;
         stream << messageMediaValue.title;
         stream << messageMediaValue.description;
         if (messageMediaValue.flags & 1 << 0) {
-            stream << messageMediaValue.webDocumentPhoto;
+            stream << *messageMediaValue.webDocumentPhoto;
         }
         if (messageMediaValue.flags & 1 << 2) {
             stream << messageMediaValue.receiptMsgId;
@@ -3461,7 +3461,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessage &messageVal
         }
         stream << messageValue.toId;
         if (messageValue.flags & 1 << 2) {
-            stream << messageValue.fwdFrom;
+            stream << *messageValue.fwdFrom;
         }
         if (messageValue.flags & 1 << 11) {
             stream << messageValue.viaBotId;
@@ -3472,10 +3472,10 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessage &messageVal
         stream << messageValue.date;
         stream << messageValue.message;
         if (messageValue.flags & 1 << 9) {
-            stream << messageValue.media;
+            stream << *messageValue.media;
         }
         if (messageValue.flags & 1 << 6) {
-            stream << messageValue.replyMarkup;
+            stream << *messageValue.replyMarkup;
         }
         if (messageValue.flags & 1 << 7) {
             stream << messageValue.entities;
@@ -3501,7 +3501,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLMessage &messageVal
             stream << messageValue.replyToMsgId;
         }
         stream << messageValue.date;
-        stream << messageValue.action;
+        stream << *messageValue.action;
         break;
     default:
         break;
@@ -3593,7 +3593,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
     case TLValue::UpdateNewChannelMessage:
     case TLValue::UpdateEditChannelMessage:
     case TLValue::UpdateEditMessage:
-        stream << updateValue.message;
+        stream << *updateValue.message;
         stream << updateValue.pts;
         stream << updateValue.ptsCount;
         break;
@@ -3617,7 +3617,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.action;
         break;
     case TLValue::UpdateChatParticipants:
-        stream << updateValue.participants;
+        stream << *updateValue.participants;
         break;
     case TLValue::UpdateUserStatus:
         stream << updateValue.userId;
@@ -3632,7 +3632,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
     case TLValue::UpdateUserPhoto:
         stream << updateValue.userId;
         stream << updateValue.date;
-        stream << updateValue.photo;
+        stream << *updateValue.photo;
         stream << updateValue.previous;
         break;
     case TLValue::UpdateContactRegistered:
@@ -3645,14 +3645,14 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.foreignLink;
         break;
     case TLValue::UpdateNewEncryptedMessage:
-        stream << updateValue.encryptedMessage;
+        stream << *updateValue.encryptedMessage;
         stream << updateValue.qts;
         break;
     case TLValue::UpdateEncryptedChatTyping:
         stream << updateValue.chatId;
         break;
     case TLValue::UpdateEncryption:
-        stream << updateValue.chat;
+        stream << *updateValue.chat;
         stream << updateValue.date;
         break;
     case TLValue::UpdateEncryptedMessagesRead:
@@ -3680,8 +3680,8 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.blocked;
         break;
     case TLValue::UpdateNotifySettings:
-        stream << updateValue.notifyPeer;
-        stream << updateValue.notifySettings;
+        stream << *updateValue.notifyPeer;
+        stream << *updateValue.notifySettings;
         break;
     case TLValue::UpdateServiceNotification:
         stream << updateValue.flags;
@@ -3690,7 +3690,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         }
         stream << updateValue.type;
         stream << updateValue.stringMessage;
-        stream << updateValue.media;
+        stream << *updateValue.media;
         stream << updateValue.entities;
         break;
     case TLValue::UpdatePrivacy:
@@ -3709,7 +3709,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.ptsCount;
         break;
     case TLValue::UpdateWebPage:
-        stream << updateValue.webpage;
+        stream << *updateValue.webpage;
         stream << updateValue.pts;
         stream << updateValue.ptsCount;
         break;
@@ -3751,7 +3751,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.version;
         break;
     case TLValue::UpdateNewStickerSet:
-        stream << updateValue.stickerset;
+        stream << *updateValue.stickerset;
         break;
     case TLValue::UpdateStickerSetsOrder:
         stream << updateValue.flags;
@@ -3822,11 +3822,11 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         break;
     case TLValue::UpdateDraftMessage:
         stream << updateValue.peer;
-        stream << updateValue.draft;
+        stream << *updateValue.draft;
         break;
     case TLValue::UpdateChannelWebPage:
         stream << updateValue.channelId;
-        stream << updateValue.webpage;
+        stream << *updateValue.webpage;
         stream << updateValue.pts;
         stream << updateValue.ptsCount;
         break;
@@ -3841,18 +3841,18 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         }
         break;
     case TLValue::UpdateBotWebhookJSON:
-        stream << updateValue.jSONData;
+        stream << *updateValue.jSONData;
         break;
     case TLValue::UpdateBotWebhookJSONQuery:
         stream << updateValue.queryId;
-        stream << updateValue.jSONData;
+        stream << *updateValue.jSONData;
         stream << updateValue.timeout;
         break;
     case TLValue::UpdateBotShippingQuery:
         stream << updateValue.queryId;
         stream << updateValue.userId;
         stream << updateValue.payload;
-        stream << updateValue.shippingAddress;
+        stream << *updateValue.shippingAddress;
         break;
     case TLValue::UpdateBotPrecheckoutQuery:
         stream << updateValue.flags;
@@ -3860,7 +3860,7 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.userId;
         stream << updateValue.payload;
         if (updateValue.flags & 1 << 0) {
-            stream << updateValue.info;
+            stream << *updateValue.info;
         }
         if (updateValue.flags & 1 << 1) {
             stream << updateValue.shippingOptionId;
@@ -3869,10 +3869,10 @@ CTelegramStream &operator<<(CTelegramStream &stream, const TLUpdate &updateValue
         stream << updateValue.totalAmount;
         break;
     case TLValue::UpdatePhoneCall:
-        stream << updateValue.phoneCall;
+        stream << *updateValue.phoneCall;
         break;
     case TLValue::UpdateLangPack:
-        stream << updateValue.difference;
+        stream << *updateValue.difference;
         break;
     case TLValue::UpdateChannelReadMessagesContents:
         stream << updateValue.channelId;
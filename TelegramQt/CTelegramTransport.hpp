@@ -34,9 +34,13 @@ public:
     explicit BaseTransport(QObject *parent = nullptr);
     virtual void connectToHost(const QString &ipAddress, quint16 port) = 0;
     virtual void disconnectFromHost() = 0;
+    // Drops the data queued for write and closes the connection without waiting for the peer
+    virtual void abort() { disconnectFromHost(); }
     quint64 getNewMessageId(quint64 supposedId);
 
     virtual QString remoteAddress() const = 0;
+    // The number of bytes queued for write, but not written to the socket yet
+    virtual qint64 bytesToWrite() const { return 0; }
 
     QAbstractSocket::SocketError error() const { return m_error; }
     QAbstractSocket::SocketState state() const { return m_state; }
@@ -187,6 +187,7 @@ bool Backend::syncAccountToStorage()
     m_accountStorage->setDeltaTime(connection->deltaTime());
     m_accountStorage->setSessionData(connection->rpcLayer()->sessionId(),
                                      connection->rpcLayer()->contentRelatedMessagesNumber());
+    m_accountStorage->setServerSalts(connection->rpcLayer()->futureSalts());
     m_accountStorage->sync();
     return true;
 }
@@ -144,6 +144,8 @@ void Connection::onClientDhStateChanged()
         if (!m_rpcLayer->sessionId()) {
             rpcLayer()->startNewSession();
         }
+        // Salts of the previous key (if any) are not valid anymore
+        rpcLayer()->setFutureSalts({});
         rpcLayer()->setServerSalt(m_dhLayer->serverSalt());
         if (!m_queuedOperations.isEmpty()) {
             for (PendingRpcOperation *operation : m_queuedOperations) {
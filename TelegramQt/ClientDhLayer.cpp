@@ -23,6 +23,7 @@
 #include "PendingRpcOperation.hpp"
 #include "RandomGenerator.hpp"
 #include "SendPackageHelper.hpp"
+#include "SslBigNumber.hpp"
 
 #include <QDateTime>
 #include <QLoggingCategory>
@@ -325,6 +326,8 @@ bool DhLayer::processServerDHParamsOK(const QByteArray &encryptedAnswer)
         return false;
     }
 
+    m_dhPrimeContext = Utils::SslMontgomeryContext::fromCache(m_dhPrime);
+
     qCDebug(c_clientDhLayerCategory) << "dhPrime size:" << m_dhPrime.size() << m_dhPrime.toHex();
     qCDebug(c_clientDhLayerCategory) << "gA size:" << m_gA.size() << m_gA.toHex();
 
@@ -370,7 +373,7 @@ PendingRpcOperation *DhLayer::requestDhGenerationResult()
         QByteArray binNumber;
         binNumber.resize(sizeof(m_g));
         qToBigEndian(m_g, (uchar *) binNumber.data());
-        binNumber = Utils::binaryNumberModExp(binNumber, m_dhPrime, m_b);
+        binNumber = Utils::binaryNumberModExp(binNumber, *m_dhPrimeContext, m_b);
         encryptedStream << binNumber;
 
         const QByteArray innerData = encryptedStream.getData();
@@ -421,10 +424,15 @@ bool DhLayer::processServerDhAnswer(const QByteArray &payload)
         return false;
     }
 
+    if (!m_dhPrimeContext) {
+        qCWarning(c_clientDhLayerCategory) << Q_FUNC_INFO << "DH parameters are not received";
+        return false;
+    }
+
     TLNumber128 newNonceHashLower128;
     inputStream >> newNonceHashLower128;
     const QByteArray readedHashPart(newNonceHashLower128.data, newNonceHashLower128.size());
-    const QByteArray newAuthKey = Utils::binaryNumberModExp(m_gA, m_dhPrime, m_b);
+    const QByteArray newAuthKey = Utils::binaryNumberModExp(m_gA, *m_dhPrimeContext, m_b);
     const QByteArray newAuthKeySha = Utils::sha1(newAuthKey);
     QByteArray expectedHashData(m_newNonce.data, m_newNonce.size());
     expectedHashData.append(newAuthKeySha.left(8));
@@ -20,8 +20,16 @@
 
 #include "DhLayer.hpp"
 
+#include <QSharedPointer>
+
 namespace Telegram {
 
+namespace Utils {
+
+class SslMontgomeryContext;
+
+} // Utils namespace
+
 namespace Client {
 
 class PendingRpcOperation;
@@ -53,6 +61,7 @@ protected:
 
     PendingRpcOperation *m_plainOperation = nullptr;
     QByteArray m_b; // Client side
+    QSharedPointer<const Utils::SslMontgomeryContext> m_dhPrimeContext;
 };
 
 } // Client namespace
@@ -24,12 +24,16 @@
 #include "PendingRpcOperation.hpp"
 #include "RandomGenerator.hpp"
 #include "UpdatesLayer.hpp"
+#include "Utils.hpp"
 
 #include "MTProto/MessageHeader.hpp"
 #include "MTProto/Stream.hpp"
 
+#include <QDateTime>
 #include <QLoggingCategory>
 
+#include <algorithm>
+
 Q_LOGGING_CATEGORY(c_clientRpcLayerCategory, "telegram.client.rpclayer", QtWarningMsg)
 Q_LOGGING_CATEGORY(c_clientRpcDumpPackageCategory, "telegram.client.rpclayer.dump", QtWarningMsg)
 
@@ -37,6 +41,13 @@ namespace Telegram {
 
 namespace Client {
 
+// https://core.telegram.org/mtproto/service_messages#request-for-several-future-salts
+static const quint32 c_futureSaltsToRequest = 32;
+static const int c_minFutureSalts = 2;
+// The server accepts the previous salt for a while after the next one becomes valid,
+// so switch to the next salt a bit later to tolerate a clock difference.
+static const quint32 c_serverSaltSwitchDelay = 60; // seconds
+
 RpcLayer::RpcLayer(QObject *parent) :
     BaseRpcLayer(parent)
 {
@@ -52,6 +63,11 @@ void RpcLayer::installUpdatesHandler(UpdatesInternalApi *updatesHandler)
     m_UpdatesInternalApi = updatesHandler;
 }
 
+void RpcLayer::setCompressionThreshold(int bytes)
+{
+    m_compressionThreshold = bytes;
+}
+
 void RpcLayer::setSessionData(quint64 sessionId, quint32 contentRelatedMessagesNumber)
 {
     m_sessionId = sessionId;
@@ -63,6 +79,15 @@ void RpcLayer::setServerSalt(quint64 serverSalt)
     m_serverSalt = serverSalt;
 }
 
+void RpcLayer::setFutureSalts(const QVector<ServerSalt> &salts)
+{
+    m_futureSalts = salts;
+    std::stable_sort(m_futureSalts.begin(), m_futureSalts.end(), [](const ServerSalt &left, const ServerSalt &right) {
+        return left.validSince < right.validSince;
+    });
+    updateServerSalt();
+}
+
 void RpcLayer::startNewSession()
 {
     m_sessionId = RandomGenerator::instance()->generate<quint64>();
@@ -101,9 +126,23 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
         qCWarning(c_clientRpcLayerCategory) << CALL_INFO
                                             << "GzipPacked should be processed in the base class";
         break;
+    case TLValue::FutureSalts:
+    {
+        // The reply to get_future_salts is not wrapped into rpc_result
+        MTProto::Stream stream(message.data());
+        TLFutureSalts futureSalts;
+        stream >> futureSalts;
+        PendingRpcOperation *op = m_operations.take(futureSalts.reqMsgId);
+        if (!op) {
+            qCWarning(c_clientRpcLayerCategory) << "Unexpected future salts" << futureSalts.reqMsgId;
+            return false;
+        }
+        op->setFinishedWithReplyData(message.copyData());
+        return true;
+    }
     case TLValue::Pong:
     {
-        MTProto::Stream stream(message.data);
+        MTProto::Stream stream(message.data());
         TLPong pong;
         stream >> pong;
         PendingRpcOperation *op = m_operations.take(pong.msgId);
@@ -111,7 +150,7 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
             qCWarning(c_clientRpcLayerCategory) << "Unexpected pong?!" << pong.msgId << pong.pingId;
             return false;
         }
-        op->setFinishedWithReplyData(message.data);
+        op->setFinishedWithReplyData(message.copyData());
         return true;
     }
         break;
@@ -124,7 +163,7 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 bool RpcLayer::processRpcResult(const MTProto::Message &message)
 {
     qCDebug(c_clientRpcLayerCategory) << "processRpcQuery(stream);";
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data());
     quint64 messageId = 0;
     stream >> messageId;
     PendingRpcOperation *op = m_operations.take(messageId);
@@ -134,7 +173,8 @@ bool RpcLayer::processRpcResult(const MTProto::Message &message)
                                             << hex << showbase << messageId;
         return false;
     }
-    op->setFinishedWithReplyData(stream.readAll());
+    // The operation keeps the reply, so this is the only place where the payload is copied
+    op->setFinishedWithReplyData(message.skipBytes(sizeof(messageId)).copyData());
 #define DUMP_CLIENT_RPC_PACKETS
 #ifdef DUMP_CLIENT_RPC_PACKETS
     qCDebug(c_clientRpcLayerCategory) << "Client: Answer for message"
@@ -151,16 +191,21 @@ bool RpcLayer::processRpcResult(const MTProto::Message &message)
 bool RpcLayer::processUpdates(const MTProto::Message &message)
 {
     qCDebug(c_clientRpcLayerCategory) << "processUpdates()" << message.firstValue();
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data());
 
     TLUpdates updates;
     stream >> updates;
+    // The updates are applied only after the whole value is decoded, so a truncated packet is just dropped
+    if (stream.error() || !updates.isValid()) {
+        qCWarning(c_clientRpcLayerCategory) << "processUpdates():" << "Drop invalid updates" << message.firstValue();
+        return false;
+    }
     return m_UpdatesInternalApi->processUpdates(updates);
 }
 
 void RpcLayer::processSessionCreated(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data());
     // https://core.telegram.org/mtproto/service_messages#new-session-creation-notification
     quint64 firstMsgId;
     quint64 uniqueId;
@@ -178,7 +223,7 @@ void RpcLayer::processSessionCreated(const MTProto::Message &message)
 
 void RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message)
 {
-    RawStream stream(message.data);
+    RawStream stream(message.data());
     // https://core.telegram.org/mtproto/service_messages_about_messages#notice-of-ignored-error-message
     MTProto::IgnoredMessageNotification notification;
     stream >> notification;
@@ -195,7 +240,11 @@ void RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
     switch (notification.errorCode) {
     case MTProto::IgnoredMessageNotification::IncorrectServerSalt:
         // We sync local serverSalt value in processDecryptedMessageHeader().
-        // Resend message will automatically apply the new salt
+        // Resend message will automatically apply the new salt.
+        // The known future salts are outdated (e.g. the server session is gone),
+        // so drop them to get the new ones with the next request.
+        ++m_serverSaltBounces;
+        m_futureSalts.clear();
         resendIgnoredMessage(notification.messageId);
         break;
     case MTProto::IgnoredMessageNotification::MessageIdTooOld:
@@ -268,6 +317,7 @@ QByteArray RpcLayer::getVerificationKeyPart() const
 quint64 RpcLayer::sendRpc(PendingRpcOperation *operation)
 {
     operation->setConnection(m_sendHelper->getConnection());
+    updateServerSalt();
 
     MTProto::Message *message = new MTProto::Message();
     message->messageId = m_sendHelper->newMessageId(SendMode::Client);
@@ -285,13 +335,17 @@ quint64 RpcLayer::sendRpc(PendingRpcOperation *operation)
     // We have to add InitConnection here because
     // sendPackage() implementation is shared with server
     if (message->sequenceNumber == 1) {
-        message->setData(getInitConnection() + operation->requestData());
+        message->setData(compressRequest(getInitConnection() + operation->requestData()));
     } else {
-        message->setData(operation->requestData());
+        message->setData(compressRequest(operation->requestData()));
     }
     m_operations.insert(message->messageId, operation);
     m_messages.insert(message->messageId, message);
     sendPackage(*message);
+
+    if ((m_futureSalts.count() < c_minFutureSalts) && !m_futureSaltsOperation) {
+        requestFutureSalts();
+    }
     return message->messageId;
 }
 
@@ -312,6 +366,7 @@ bool RpcLayer::resendIgnoredMessage(quint64 messageId)
     message->messageId = m_sendHelper->newMessageId(SendMode::Client);
     m_operations.insert(message->messageId, operation);
     m_messages.insert(message->messageId, message);
+    updateServerSalt();
     sendPackage(*message);
     emit operation->resent(messageId, message->messageId);
     return message->messageId;
@@ -334,6 +389,37 @@ void RpcLayer::acknowledgeMessages()
     sendPackage(*message);
 }
 
+void RpcLayer::onFutureSaltsOperationFinished()
+{
+    PendingRpcOperation *operation = m_futureSaltsOperation;
+    m_futureSaltsOperation = nullptr;
+    operation->deleteLater();
+    if (!operation->isSucceeded()) {
+        qCDebug(c_clientRpcLayerCategory) << CALL_INFO << operation->errorDetails();
+        return;
+    }
+
+    MTProto::Stream stream(operation->replyData());
+    TLFutureSalts futureSalts;
+    stream >> futureSalts;
+    if (!futureSalts.isValid() || stream.error()) {
+        qCWarning(c_clientRpcLayerCategory) << CALL_INFO << "Invalid future salts";
+        return;
+    }
+    QVector<ServerSalt> salts;
+    salts.reserve(futureSalts.salts.count());
+    for (const TLFutureSalt &futureSalt : futureSalts.salts) {
+        ServerSalt salt;
+        salt.salt = futureSalt.salt;
+        salt.validSince = futureSalt.validSince;
+        salt.validUntil = futureSalt.validUntil;
+        salts.append(salt);
+    }
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Got" << salts.count() << "future salts";
+    setFutureSalts(salts);
+    emit futureSaltsReceived();
+}
+
 void RpcLayer::onConnectionFailed()
 {
     for (PendingRpcOperation *op : m_operations) {
@@ -349,6 +435,85 @@ void RpcLayer::onConnectionFailed()
     m_messages.clear();
 }
 
+QByteArray RpcLayer::compressRequest(const QByteArray &data)
+{
+    // Encrypted or already compressed content (e.g. upload.saveFilePart bytes) is not worth to deflate
+    static const double c_maxEntropy = 7.0;
+    if (!m_compressionThreshold || (data.size() <= m_compressionThreshold)) {
+        return data;
+    }
+    if (Utils::estimateEntropy(data) > c_maxEntropy) {
+        ++m_compressionStats.skippedByEntropy;
+        return data;
+    }
+    const QByteArray packedData = Utils::packGZip(data);
+    if (packedData.isEmpty()) {
+        return data;
+    }
+    CTelegramStream stream(CTelegramStream::WriteOnly);
+    stream << TLValue::GzipPacked;
+    stream << packedData;
+    const QByteArray result = stream.getData();
+    if (result.size() >= data.size()) {
+        ++m_compressionStats.rejected;
+        return data;
+    }
+    ++m_compressionStats.compressed;
+    m_compressionStats.savedBytes += static_cast<quint64>(data.size() - result.size());
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Request is gzip packed from"
+                                      << data.size() << "to" << result.size() << "bytes";
+    return result;
+}
+
+quint32 RpcLayer::serverTime() const
+{
+#if QT_VERSION > QT_VERSION_CHECK(5, 8, 0)
+    const qint64 timestamp = QDateTime::currentSecsSinceEpoch();
+#else
+    const qint64 timestamp = QDateTime::currentMSecsSinceEpoch() / 1000;
+#endif
+    return static_cast<quint32>(timestamp + m_sendHelper->deltaTime());
+}
+
+/*!
+  Switches to the most recent known salt which is valid at the moment,
+  so the server does not bounce the messages with bad_server_salt.
+*/
+void RpcLayer::updateServerSalt()
+{
+    const quint32 now = serverTime();
+    while (!m_futureSalts.isEmpty() && (m_futureSalts.constFirst().validUntil <= now)) {
+        m_futureSalts.removeFirst();
+    }
+    if (m_futureSalts.isEmpty()) {
+        return;
+    }
+    quint64 salt = m_futureSalts.constFirst().salt;
+    for (const ServerSalt &futureSalt : m_futureSalts) {
+        if (futureSalt.validSince + c_serverSaltSwitchDelay > now) {
+            break;
+        }
+        salt = futureSalt.salt;
+    }
+    if (salt != m_serverSalt) {
+        qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Switch to the next server salt";
+        setServerSalt(salt);
+    }
+}
+
+void RpcLayer::requestFutureSalts()
+{
+    RawStream outputStream(RawStream::WriteOnly);
+    outputStream << TLValue::GetFutureSalts;
+    outputStream << c_futureSaltsToRequest;
+
+    m_futureSaltsOperation = new PendingRpcOperation(outputStream.getData(), this);
+    m_futureSaltsOperation->setContentRelated(false);
+    connect(m_futureSaltsOperation, &PendingOperation::finished,
+            this, &RpcLayer::onFutureSaltsOperationFinished);
+    sendRpc(m_futureSaltsOperation);
+}
+
 QByteArray RpcLayer::getInitConnection() const
 {
 #ifdef DEVELOPER_BUILD
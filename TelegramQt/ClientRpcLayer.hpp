@@ -19,6 +19,7 @@
 #define TELEGRAM_CLIENT_RPC_HPP
 
 #include "RpcLayer.hpp"
+#include "TelegramNamespace.hpp"
 
 #include <QHash>
 #include <QVector>
@@ -44,6 +45,13 @@ class RpcLayer : public Telegram::BaseRpcLayer
 {
     Q_OBJECT
 public:
+    struct CompressionStats {
+        quint64 compressed = 0; // Requests sent gzip_packed
+        quint64 skippedByEntropy = 0;
+        quint64 rejected = 0; // Compressed, but sent as is because it did not become smaller
+        quint64 savedBytes = 0;
+    };
+
     explicit RpcLayer(QObject *parent = nullptr);
 
     AppInformation *appInformation() const { return m_appInfo; }
@@ -51,12 +59,23 @@ public:
 
     void installUpdatesHandler(UpdatesInternalApi *updatesHandler);
 
+    // See Settings::outgoingCompressionThreshold()
+    int compressionThreshold() const { return m_compressionThreshold; }
+    void setCompressionThreshold(int bytes);
+    const CompressionStats &compressionStats() const { return m_compressionStats; }
+
     quint64 sessionId() const override { return m_sessionId; }
     void setSessionData(quint64 sessionId, quint32 contentRelatedMessagesNumber);
 
     quint64 serverSalt() const override { return m_serverSalt; }
     void setServerSalt(quint64 serverSalt);
 
+    // The known salts sorted by the validity time (see get_future_salts)
+    QVector<ServerSalt> futureSalts() const { return m_futureSalts; }
+    void setFutureSalts(const QVector<ServerSalt> &salts);
+    // The number of the messages bounced with bad_server_salt
+    quint32 serverSaltBounces() const { return m_serverSaltBounces; }
+
     void startNewSession();
 
     bool processMTProtoMessage(const MTProto::Message &message) override;
@@ -70,8 +89,12 @@ public:
 
     void onConnectionFailed() override;
 
+Q_SIGNALS:
+    void futureSaltsReceived();
+
 protected Q_SLOTS:
     void acknowledgeMessages();
+    void onFutureSaltsOperationFinished();
 
 protected:
     bool processDecryptedMessageHeader(const MTProto::FullMessageHeader &header) override;
@@ -82,9 +105,14 @@ protected:
     QByteArray getVerificationKeyPart() const final;
 
     QByteArray getInitConnection() const;
+    QByteArray compressRequest(const QByteArray &data);
 
     void addMessageToAck(quint64 messageId);
 
+    quint32 serverTime() const;
+    void updateServerSalt();
+    void requestFutureSalts();
+
     AppInformation *m_appInfo = nullptr;
     UpdatesInternalApi *m_UpdatesInternalApi = nullptr;
     AuthOperation *m_pendingAuthOperation = nullptr;
@@ -92,7 +120,12 @@ protected:
     QHash<quint64, MTProto::Message*> m_messages; // request message id to MTProto::Message
     quint64 m_sessionId = 0;
     quint64 m_serverSalt = 0;
+    QVector<ServerSalt> m_futureSalts;
+    PendingRpcOperation *m_futureSaltsOperation = nullptr;
     QVector<quint64> m_messagesToAck;
+    int m_compressionThreshold = 0;
+    CompressionStats m_compressionStats;
+    quint32 m_serverSaltBounces = 0;
 };
 
 } // Client namespace
@@ -43,6 +43,11 @@ void Settings::setPingInterval(quint32 interval, quint32 serverDisconnectionAddi
     emit pingIntervalChanged(interval, serverDisconnectionAdditionalTime);
 }
 
+void Settings::setOutgoingCompressionThreshold(int bytes)
+{
+    m_outgoingCompressionThreshold = qMax(0, bytes);
+}
+
 QVector<DcOption> Settings::defaultServerConfiguration()
 {
     static const QVector<DcOption> s_builtInDcs = {
@@ -39,6 +39,11 @@ public:
     quint32 serverDisconnectionAdditionalTime() const { return m_serverDisconnectionAdditionalTime; }
     void setPingInterval(quint32 interval, quint32 serverDisconnectionAdditionalTime = 0);
 
+    // The outgoing requests larger than the threshold are sent gzip_packed if it makes them smaller.
+    // The compression is disabled by default (the threshold is 0).
+    int outgoingCompressionThreshold() const { return m_outgoingCompressionThreshold; }
+    void setOutgoingCompressionThreshold(int bytes);
+
     // void setMediaDataBufferSize(quint32 size);
 
     Q_INVOKABLE static QVector<DcOption> defaultServerConfiguration();
@@ -63,6 +68,7 @@ protected:
     RsaKey m_key;
     quint32 m_pingInterval = 0;
     quint32 m_serverDisconnectionAdditionalTime = 0;
+    int m_outgoingCompressionThreshold = 0;
     SessionType m_preferedSessionType = SessionType::None;
 };
 
@@ -17,12 +17,19 @@
 #include <QLoggingCategory>
 #include <QTimer>
 
+#include <algorithm>
+#include <limits>
+
 Q_LOGGING_CATEGORY(c_connectionApiLoggingCategory, "telegram.client.api.connection", QtInfoMsg)
 
 namespace Telegram {
 
 namespace Client {
 
+// Happy Eyeballs-like connection racing (RFC 8305)
+static const int c_maxRacingConnections = 3;
+static const int c_racingConnectionDelay = 250; // msecs
+
 static const QVector<uint> getIntervals()
 {
     static QVector<uint> intervals;
@@ -124,6 +131,7 @@ void ConnectionApiPrivate::disconnectFromServer()
 {
     qCDebug(c_connectionApiLoggingCategory) << CALL_INFO;
     setStatus(ConnectionApi::StatusDisconnected, ConnectionApi::StatusReasonLocal);
+    abortRacingConnections();
     setInitialConnection(nullptr);
     setMainConnection(nullptr);
     m_initialConnectOperation->deleteLater();
@@ -182,20 +190,71 @@ void ConnectionApiPrivate::connectToNextServer()
     if (!m_connectionQueued) {
         return;
     }
+    m_connectionQueued = false;
 
-    const DcOption dcOption = m_serverConfiguration.at(m_nextServerAddressIndex);
-    ++m_nextServerAddressIndex;
-    if (m_serverConfiguration.count() <= m_nextServerAddressIndex) {
-        m_nextServerAddressIndex = 0;
+    const QVector<DcOption> candidates = getNextServerCandidates();
+    if (candidates.isEmpty()) {
+        qCWarning(c_connectionApiLoggingCategory) << CALL_INFO << "There is no supported DC option";
+        return;
     }
-    if (dcOption.flags & (DcOption::Ipv6|DcOption::MediaOnly)) {
-        qCDebug(c_connectionApiLoggingCategory) << CALL_INFO
-                                                << "dequeued unsupported dc option, go for the next one...";
-        return connectToNextServer();
+
+    abortRacingConnections();
+    setInitialConnection(nullptr, DestroyOldConnection);
+    m_racingCandidates = candidates;
+    m_racingElapsedTimer.start();
+    startNextRacingConnection();
+}
+
+/*!
+  Returns the supported server options of the same DC as the next server address.
+
+  Options with a known round-trip time go first (the fastest first), the number
+  of the options is limited to the number of racing connections.
+*/
+QVector<DcOption> ConnectionApiPrivate::getNextServerCandidates()
+{
+    QVector<DcOption> candidates;
+    const int optionsCount = m_serverConfiguration.count();
+    if (!optionsCount) {
+        return candidates;
     }
+    for (int i = 0; i < optionsCount; ++i) {
+        const DcOption &dcOption = m_serverConfiguration.at((m_nextServerAddressIndex + i) % optionsCount);
+        if (dcOption.flags & (DcOption::Ipv6|DcOption::MediaOnly)) {
+            continue;
+        }
+        if (!candidates.isEmpty() && (candidates.first().id != dcOption.id)) {
+            continue;
+        }
+        candidates.append(dcOption);
+    }
+    m_nextServerAddressIndex = (m_nextServerAddressIndex + 1) % optionsCount;
+
+    const AccountStorage *accountStorage = backend()->accountStorage();
+    const auto roundTripTime = [accountStorage](const DcOption &dcOption) {
+        const int time = accountStorage->endpointRoundTripTime(dcOption);
+        return time < 0 ? std::numeric_limits<int>::max() : time;
+    };
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&roundTripTime](const DcOption &left, const DcOption &right) {
+        return roundTripTime(left) < roundTripTime(right);
+    });
+    if (candidates.count() > c_maxRacingConnections) {
+        candidates.resize(c_maxRacingConnections);
+    }
+    return candidates;
+}
+
+void ConnectionApiPrivate::startNextRacingConnection()
+{
+    if (m_racingCandidates.isEmpty()) {
+        return;
+    }
+    const DcOption dcOption = m_racingCandidates.takeFirst();
+    qCDebug(c_connectionApiLoggingCategory) << CALL_INFO << dcOption.id << dcOption.address << dcOption.port;
 
     Connection *newConnection = createConnection(dcOption);
-    setInitialConnection(newConnection, DestroyOldConnection);
+    m_racingConnections.insert(newConnection, m_racingElapsedTimer.elapsed());
 
     AccountStorage *accountStorage = backend()->accountStorage();
     if (accountStorage && accountStorage->hasMinimalDataSet()) {
@@ -203,13 +262,24 @@ void ConnectionApiPrivate::connectToNextServer()
                                                 << "Use session from account storage for the new initial connection"
                                                 << newConnection;
 
-        m_initialConnection->setAuthKey(accountStorage->authKey());
-        m_initialConnection->rpcLayer()->setSessionData(
+        newConnection->setAuthKey(accountStorage->authKey());
+        newConnection->rpcLayer()->setSessionData(
                     accountStorage->sessionId(),
                     accountStorage->contentRelatedMessagesNumber());
+        newConnection->rpcLayer()->setFutureSalts(accountStorage->serverSalts());
+    }
+
+    if (!m_racingCandidates.isEmpty()) {
+        if (!m_racingTimer) {
+            m_racingTimer = new QTimer(this);
+            m_racingTimer->setSingleShot(true);
+            connect(m_racingTimer, &QTimer::timeout,
+                    this, &ConnectionApiPrivate::startNextRacingConnection);
+        }
+        m_racingTimer->start(c_racingConnectionDelay);
     }
 
-    ConnectOperation *connectionOperation = m_initialConnection->connectToDc();
+    ConnectOperation *connectionOperation = newConnection->connectToDc();
     connect(connectionOperation, &PendingOperation::finished, this, [](PendingOperation *op) {
         if (op->isFailed()) {
             qCInfo(c_connectionApiLoggingCategory) << op << op->errorDetails();
@@ -217,7 +287,19 @@ void ConnectionApiPrivate::connectToNextServer()
             qCDebug(c_connectionApiLoggingCategory) << op << "succeeded";
         }
     });
-    m_connectionQueued = false;
+}
+
+void ConnectionApiPrivate::abortRacingConnections()
+{
+    if (m_racingTimer) {
+        m_racingTimer->stop();
+    }
+    m_racingCandidates.clear();
+    for (Connection *connection : m_racingConnections.keys()) {
+        disconnect(connection, nullptr, this, nullptr);
+        connection->deleteLater();
+    }
+    m_racingConnections.clear();
 }
 
 void ConnectionApiPrivate::queueConnectToNextServer()
@@ -356,6 +438,7 @@ Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
 
     Settings *settings = backend()->m_settings;
     connection->setServerRsaKey(settings->serverRsaKey());
+    connection->rpcLayer()->setCompressionThreshold(settings->outgoingCompressionThreshold());
     TcpTransport *transport = new TcpTransport(connection);
     transport->setProxy(settings->proxy());
 
@@ -378,6 +461,8 @@ Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
             this, &ConnectionApiPrivate::onConnectionStatusChanged);
     connect(connection, &BaseConnection::errorOccured,
             this, &ConnectionApiPrivate::onConnectionError);
+    connect(connection->rpcLayer(), &RpcLayer::futureSaltsReceived,
+            this, &ConnectionApiPrivate::onFutureSaltsReceived);
 
     return connection;
 }
@@ -450,6 +535,49 @@ void ConnectionApiPrivate::onInitialConnectionStatusChanged(BaseConnection::Stat
     }
 }
 
+void ConnectionApiPrivate::onRacingConnectionStatusChanged(Connection *connection,
+                                                           BaseConnection::Status status,
+                                                           BaseConnection::StatusReason reason)
+{
+    qCDebug(c_connectionApiLoggingCategory) << CALL_INFO << connection << status << reason;
+    switch (status) {
+    case BaseConnection::Status::Connecting:
+        setStatus(ConnectionApi::StatusConnecting, ConnectionApi::StatusReasonNone);
+        break;
+    case BaseConnection::Status::Connected:
+    case BaseConnection::Status::HasDhKey:
+    case BaseConnection::Status::Signed:
+    {
+        const qint64 roundTripTime = m_racingElapsedTimer.elapsed() - m_racingConnections.take(connection);
+        const DcOption dcOption = connection->dcOption();
+        qCDebug(c_connectionApiLoggingCategory) << CALL_INFO << "Connected to"
+                                                << dcOption.address << dcOption.port
+                                                << "in" << roundTripTime << "ms";
+        backend()->accountStorage()->setEndpointRoundTripTime(dcOption, static_cast<int>(roundTripTime));
+        abortRacingConnections();
+        setInitialConnection(connection, DestroyOldConnection);
+        onInitialConnectionStatusChanged(status, reason);
+    }
+        break;
+    case BaseConnection::Status::Disconnecting:
+        // Nothing to do; wait for Disconnected
+        break;
+    case BaseConnection::Status::Disconnected:
+    case BaseConnection::Status::Failed:
+        m_racingConnections.remove(connection);
+        disconnect(connection, nullptr, this, nullptr);
+        connection->deleteLater();
+        backend()->accountStorage()->setEndpointRoundTripTime(connection->dcOption(), -1);
+        if (!m_racingCandidates.isEmpty()) {
+            // Do not wait for the delay if the attempt already failed
+            startNextRacingConnection();
+        } else if (m_racingConnections.isEmpty()) {
+            queueConnectToNextServer();
+        }
+        break;
+    }
+}
+
 void ConnectionApiPrivate::onGotDcConfig(PendingOperation *operation)
 {
     if (!operation->isSucceeded()) {
@@ -521,7 +649,10 @@ void ConnectionApiPrivate::onAuthCodeRequired()
 void ConnectionApiPrivate::onConnectionStatusChanged(BaseConnection::Status status,
                                                      BaseConnection::StatusReason reason)
 {
-    if (sender() == m_initialConnection) {
+    Connection *connection = qobject_cast<Connection *>(sender());
+    if (connection && m_racingConnections.contains(connection)) {
+        onRacingConnectionStatusChanged(connection, status, reason);
+    } else if (sender() == m_initialConnection) {
         onInitialConnectionStatusChanged(status, reason);
     } else if (sender() == m_mainConnection) {
         onMainConnectionStatusChanged(status, reason);
@@ -598,6 +729,7 @@ void ConnectionApiPrivate::onMainConnectionLost()
     storage->setDcInfo(m_mainConnection->dcOption());
     storage->setSessionData(m_mainConnection->rpcLayer()->sessionId(),
                             m_mainConnection->rpcLayer()->contentRelatedMessagesNumber());
+    storage->setServerSalts(m_mainConnection->rpcLayer()->futureSalts());
 
     Connection *previousMainConnection = m_mainConnection;
     setMainConnection(nullptr);
@@ -643,6 +775,13 @@ void ConnectionApiPrivate::onPingFailed()
     qCWarning(c_connectionApiLoggingCategory) << CALL_INFO;
 }
 
+void ConnectionApiPrivate::onFutureSaltsReceived()
+{
+    if (m_mainConnection && (sender() == m_mainConnection->rpcLayer())) {
+        backend()->syncAccountToStorage();
+    }
+}
+
 void ConnectionApiPrivate::onConnectionError(const QByteArray &errorBytes)
 {
     const ConnectionError error(errorBytes);
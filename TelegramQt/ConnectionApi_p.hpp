@@ -24,6 +24,7 @@
 
 #include "DcConfiguration.hpp"
 
+#include <QElapsedTimer>
 #include <QHash>
 
 QT_FORWARD_DECLARE_CLASS(QTimer)
@@ -76,9 +77,12 @@ public:
 protected slots:
     void connectToNextServer();
     void queueConnectToNextServer();
+    void startNextRacingConnection();
 
     void onReconnectOperationFinished(PendingOperation *operation);
     void onInitialConnectionStatusChanged(BaseConnection::Status status, BaseConnection::StatusReason reason);
+    void onRacingConnectionStatusChanged(Connection *connection,
+                                         BaseConnection::Status status, BaseConnection::StatusReason reason);
     void onGotDcConfig(PendingOperation *operation);
     void onCheckInFinished(PendingOperation *operation);
     void onNewAuthenticationFinished(PendingOperation *operation);
@@ -90,9 +94,12 @@ protected slots:
     void onSyncFinished(PendingOperation *operation);
     void onPingFailed();
     void onConnectionError(const QByteArray &errorBytes);
+    void onFutureSaltsReceived();
 
 protected:
     void setStatus(ConnectionApi::Status status, ConnectionApi::StatusReason reason);
+    QVector<DcOption> getNextServerCandidates();
+    void abortRacingConnections();
 
     QHash<ConnectionSpec, Connection *> m_connections;
     Connection *m_mainConnection = nullptr;
@@ -108,6 +115,12 @@ protected:
     bool m_connectionQueued = false;
     QTimer *m_queuedConnectionTimer = nullptr;
 
+    // Staggered connections to a few endpoints of the same DC; the first connected one wins
+    QVector<DcOption> m_racingCandidates;
+    QHash<Connection *, qint64> m_racingConnections; // Connection to its start time
+    QElapsedTimer m_racingElapsedTimer;
+    QTimer *m_racingTimer = nullptr;
+
 };
 
 } // Client namespace
@@ -0,0 +1,89 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "AuthKeyContext.hpp"
+
+#include <openssl/crypto.h>
+#include <openssl/sha.h>
+
+#include <cstring>
+
+namespace Telegram {
+
+namespace Crypto {
+
+static void sha256(const char *data1, int size1, const char *data2, int size2, uchar *output)
+{
+    SHA256_CTX context;
+    SHA256_Init(&context);
+    SHA256_Update(&context, data1, static_cast<size_t>(size1));
+    SHA256_Update(&context, data2, static_cast<size_t>(size2));
+    SHA256_Final(output, &context);
+}
+
+void AuthKeyContext::setAuthKey(const QByteArray &authKey)
+{
+    m_authKey = authKey;
+    for (int i = 0; i < 2; ++i) {
+        const int x = i ? ServerToClient : ClientToServer;
+        m_keyParts[i] = authKey.mid(88 + x, 32);
+        m_aesKeyPartsA[i] = authKey.mid(x, 36);
+        m_aesKeyPartsB[i] = authKey.mid(40 + x, 36);
+    }
+}
+
+void AuthKeyContext::messageKey(const QByteArray &keyPart, const char *data, int size, char *messageKey)
+{
+    uchar messageKeyLarge[SHA256_DIGEST_LENGTH];
+    sha256(keyPart.constData(), keyPart.size(), data, size, messageKeyLarge);
+    memcpy(messageKey, messageKeyLarge + 8, MessageKeySize);
+}
+
+bool AuthKeyContext::verifyMessageKey(const QByteArray &keyPart, const char *data, int size, const char *messageKey)
+{
+    char expectedMessageKey[MessageKeySize];
+    AuthKeyContext::messageKey(keyPart, data, size, expectedMessageKey);
+    return CRYPTO_memcmp(expectedMessageKey, messageKey, MessageKeySize) == 0;
+}
+
+SAesKey AuthKeyContext::aesKey(const char *messageKey, int x) const
+{
+    const int i = x ? 1 : 0;
+    uchar sha256_a[SHA256_DIGEST_LENGTH];
+    uchar sha256_b[SHA256_DIGEST_LENGTH];
+    // sha256_a = SHA256(msg_key + substr(auth_key, x, 36))
+    sha256(messageKey, MessageKeySize, m_aesKeyPartsA[i].constData(), m_aesKeyPartsA[i].size(), sha256_a);
+    // sha256_b = SHA256(substr(auth_key, 40 + x, 36) + msg_key)
+    sha256(m_aesKeyPartsB[i].constData(), m_aesKeyPartsB[i].size(), messageKey, MessageKeySize, sha256_b);
+
+    SAesKey result(QByteArray(32, Qt::Uninitialized), QByteArray(32, Qt::Uninitialized));
+    // aes_key = substr(sha256_a, 0, 8) + substr(sha256_b, 8, 16) + substr(sha256_a, 24, 8)
+    char *key = result.key.data();
+    memcpy(key, sha256_a, 8);
+    memcpy(key + 8, sha256_b + 8, 16);
+    memcpy(key + 24, sha256_a + 24, 8);
+    // aes_iv = substr(sha256_b, 0, 8) + substr(sha256_a, 8, 16) + substr(sha256_b, 24, 8)
+    char *iv = result.iv.data();
+    memcpy(iv, sha256_b, 8);
+    memcpy(iv + 8, sha256_a + 8, 16);
+    memcpy(iv + 24, sha256_b + 24, 8);
+    return result;
+}
+
+} // Crypto
+
+} // Telegram
@@ -0,0 +1,66 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_AUTH_KEY_CONTEXT_HPP
+#define TELEGRAM_AUTH_KEY_CONTEXT_HPP
+
+#include "telegramqt_global.h"
+
+#include "crypto-aes.hpp"
+
+#include <QByteArray>
+
+namespace Telegram {
+
+namespace Crypto {
+
+// MTProto 2.0 key derivation for an auth key.
+// The auth key slices are taken once on setAuthKey() and SHA-256 is fed directly
+// from the existing buffers, so the per-packet hashing does not copy the payload.
+// https://core.telegram.org/mtproto/description#defining-aes-key-and-initialization-vector
+class TELEGRAMQT_INTERNAL_EXPORT AuthKeyContext
+{
+public:
+    // 'x' is 0 for messages from client to server and 8 for those from server to client
+    static constexpr int ClientToServer = 0;
+    static constexpr int ServerToClient = 8;
+    static constexpr int MessageKeySize = 16;
+
+    void setAuthKey(const QByteArray &authKey);
+    const QByteArray &authKey() const { return m_authKey; }
+
+    // substr(auth_key, 88 + x, 32)
+    const QByteArray &keyPart(int x) const { return m_keyParts[x ? 1 : 0]; }
+
+    // msg_key = substr(SHA256(keyPart + data), 8, 16)
+    static void messageKey(const QByteArray &keyPart, const char *data, int size, char *messageKey);
+    static bool verifyMessageKey(const QByteArray &keyPart, const char *data, int size, const char *messageKey);
+
+    SAesKey aesKey(const char *messageKey, int x) const;
+
+protected:
+    QByteArray m_authKey;
+    QByteArray m_keyParts[2];
+    QByteArray m_aesKeyPartsA[2]; // substr(auth_key, x, 36)
+    QByteArray m_aesKeyPartsB[2]; // substr(auth_key, 40 + x, 36)
+};
+
+} // Crypto
+
+} // Telegram
+
+#endif // TELEGRAM_AUTH_KEY_CONTEXT_HPP
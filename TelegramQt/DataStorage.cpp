@@ -157,7 +157,7 @@ bool DataStorage::getMessage(Message *message, const Peer &peer, quint32 message
     }
     if (m->flags & TLMessage::FwdFrom) {
         message->flags |= TelegramNamespace::MessageFlagForwarded;
-        if (m->fwdFrom.flags & TLMessageFwdHeader::FromId) {
+        if (m->fwdFrom->flags & TLMessageFwdHeader::FromId) {
             //message->setForwardFromPeer((m->fwdFrom))
         }
     }
@@ -179,6 +179,32 @@ bool DataStorage::getMessageMediaInfo(MessageMediaInfo *info, const Peer &peer,
     return true;
 }
 
+/*!
+    Returns the approximate limit of memory (in bytes) taken by the cached messages.
+
+    \sa setMessageCacheLimit()
+*/
+qint64 DataStorage::messageCacheLimit() const
+{
+    Q_D(const DataStorage);
+    return d->m_api->messageCache()->limit();
+}
+
+/*!
+    Sets the approximate limit of memory (in bytes) taken by the cached messages to \a bytes.
+
+    The least recently used messages are evicted from the cache when the limit is exceeded;
+    getMessage() returns \c false for them and the messages can be fetched again
+    via MessagingApi::getMessages(). The top messages of the dialogs are never evicted.
+
+    The value 0 stands for unlimited cache.
+*/
+void DataStorage::setMessageCacheLimit(qint64 bytes)
+{
+    Q_D(DataStorage);
+    d->m_api->messageCache()->setLimit(bytes);
+}
+
 DataStorage::DataStorage(DataStoragePrivate *priv, QObject *parent)
     : QObject(parent),
       d(priv)
@@ -259,13 +285,9 @@ const TLUser *DataInternalApi::getSelfUser() const
     return m_users.value(m_selfUserId);
 }
 
-const TLMessage *DataInternalApi::getMessage(const Peer &peer, quint32 messageId) const
+const TLMessage *DataInternalApi::getMessage(const Peer &peer, quint32 messageId)
 {
-    if (peer.type == Peer::Channel) {
-        quint64 key = DataInternalApi::channelMessageToKey(peer.id, messageId);
-        return m_channelMessages.value(key);
-    }
-    return m_clientMessages.value(messageId);
+    return m_messages.get(messageToKey(peer, messageId));
 }
 
 /*!
@@ -274,8 +296,6 @@ const TLMessage *DataInternalApi::getMessage(const Peer &peer, quint32 messageId
 */
 bool DataInternalApi::processNewMessage(const TLMessage &message, quint32 pts)
 {
-    processData(message);
-
     const Peer dialogPeer = Utils::getMessageDialogPeer(message, selfUserId());
     int dialogIndex = getDialogIndex(dialogPeer);
     if (dialogIndex < 0) {
@@ -285,33 +305,30 @@ bool DataInternalApi::processNewMessage(const TLMessage &message, quint32 pts)
     }
     TLDialog *dialog = &m_dialogs[dialogIndex];
     if (dialog->topMessage < message.id) {
+        if (dialog->topMessage) {
+            m_messages.unpin(messageToKey(dialogPeer, dialog->topMessage));
+        }
         dialog->topMessage = message.id;
+        // Pin the message before it is cached
+        m_messages.pin(messageToKey(dialogPeer, message.id));
     }
     if (dialog->pts < pts) {
         dialog->pts = pts;
     }
     ++dialog->unreadCount;
 
+    processData(message);
+
     return true;
 }
 
 void DataInternalApi::processData(const TLMessage &message)
 {
-    TLMessage *m = nullptr;
+    quint64 key = message.id;
     if (message.toId.tlType == TLValue::PeerChannel) {
-        const quint64 key = channelMessageToKey(message.toId.channelId, message.id);
-        if (!m_channelMessages.contains(key)) {
-            m_channelMessages.insert(key, new TLMessage());
-        }
-        m = m_channelMessages.value(key);
-    } else {
-        const quint32 key = message.id;
-        if (!m_clientMessages.contains(key)) {
-            m_clientMessages.insert(key, new TLMessage());
-        }
-        m = m_clientMessages.value(key);
+        key = channelMessageToKey(message.toId.channelId, message.id);
     }
-    *m = message;
+    m_messages.insert(key, message);
 }
 
 void DataInternalApi::processData(const TLVector<TLChat> &chats)
@@ -362,6 +379,7 @@ void DataInternalApi::processData(const TLAuthAuthorization &authorization)
 void DataInternalApi::processData(const TLMessagesDialogs &dialogs)
 {
     m_dialogs = dialogs.dialogs;
+    updatePinnedMessages();
     processData(dialogs.users);
     processData(dialogs.chats);
     for (const TLMessage &message : dialogs.messages) {
@@ -532,6 +550,14 @@ quint64 DataInternalApi::channelMessageToKey(quint32 channelId, quint32 messageI
     return (key << 32) + messageId;
 }
 
+quint64 DataInternalApi::messageToKey(const Peer &peer, quint32 messageId)
+{
+    if (peer.type == Peer::Channel) {
+        return channelMessageToKey(peer.id, messageId);
+    }
+    return messageId;
+}
+
 int Telegram::Client::DataInternalApi::getDialogIndex(const Telegram::Peer &peer) const
 {
     for (int i = 0; i < m_dialogs.count(); ++i) {
@@ -542,6 +568,19 @@ int Telegram::Client::DataInternalApi::getDialogIndex(const Telegram::Peer &peer
     return -1;
 }
 
+// Keep the top messages of the dialogs in the message cache
+void DataInternalApi::updatePinnedMessages()
+{
+    QSet<quint64> keys;
+    keys.reserve(m_dialogs.count());
+    for (const TLDialog &dialog : m_dialogs) {
+        if (dialog.topMessage) {
+            keys.insert(messageToKey(Utils::toPublicPeer(dialog.peer), dialog.topMessage));
+        }
+    }
+    m_messages.setPinnedKeys(keys);
+}
+
 DialogState *DataInternalApi::ensureDialogState(const Peer peer)
 {
     if (!m_dialogStates.contains(peer)) {
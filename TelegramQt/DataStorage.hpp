@@ -47,6 +47,9 @@ public:
     bool getMessage(Message *message, const Telegram::Peer &peer, quint32 messageId);
     bool getMessageMediaInfo(MessageMediaInfo *info, const Telegram::Peer &peer, quint32 messageId);
 
+    qint64 messageCacheLimit() const;
+    void setMessageCacheLimit(qint64 bytes); // 0 stands for 'unlimited'
+
 protected:
     explicit DataStorage(QObject *parent = nullptr);
 
@@ -20,6 +20,7 @@
 
 #include "DataStorage.hpp"
 
+#include "MessageCache.hpp"
 #include "TLTypes.hpp"
 
 #include <QHash>
@@ -71,7 +72,8 @@ public:
     static DataInternalApi *get(DataStorage *parent) { return DataStoragePrivate::get(parent)->internalApi(); }
 
     const TLUser *getSelfUser() const;
-    const TLMessage *getMessage(const Telegram::Peer &peer, quint32 messageId) const;
+    // Returns nullptr if the message is unknown or evicted from the cache
+    const TLMessage *getMessage(const Telegram::Peer &peer, quint32 messageId);
 
     bool processNewMessage(const TLMessage &message, quint32 pts);
     void processData(const TLMessage &message);
@@ -101,6 +103,10 @@ public:
     TLInputChannel toInputChannel(quint32 channelId) const;
 
     static quint64 channelMessageToKey(quint32 channelId, quint32 messageId);
+    static quint64 messageToKey(const Telegram::Peer &peer, quint32 messageId);
+
+    MessageCache *messageCache() { return &m_messages; }
+    const MessageCache *messageCache() const { return &m_messages; }
 
     TLVector<TLContact> contactList() const { return m_contactList; }
     const QHash<quint32, TLUser *> &users() const { return m_users; }
@@ -116,12 +122,13 @@ public:
     const DialogState getDialogState(const Peer peer) const;
 
 protected:
+    void updatePinnedMessages();
+
     QHash<Telegram::Peer, DialogState> m_dialogStates;
 
     QHash<quint32, TLUser *> m_users;
     QHash<quint32, TLChat *> m_chats;
-    QHash<quint32, TLMessage *> m_clientMessages;
-    QHash<quint64, TLMessage *> m_channelMessages;
+    MessageCache m_messages;
     TLVector<TLDialog> m_dialogs;
     TLVector<TLContact> m_contactList;
     QQueue<SentMessage> m_queuedMessages;
@@ -59,13 +59,55 @@ CRawStream &operator<<(CRawStream &stream, const FullMessageHeader &header)
     return stream;
 }
 
+Message::Message(const MessageHeader &header, const QByteArray &buffer, int offset, int size) :
+    MessageHeader(header),
+    m_buffer(buffer),
+    m_offset(offset),
+    m_size(size)
+{
+    if ((m_offset < 0) || (m_size < 0) || (m_offset + m_size > buffer.size())) {
+        m_offset = 0;
+        m_size = 0;
+    }
+}
+
+QByteArray Message::data() const
+{
+    if ((m_offset == 0) && (m_size == m_buffer.size())) {
+        return m_buffer;
+    }
+    return QByteArray::fromRawData(m_buffer.constData() + m_offset, m_size);
+}
+
+QByteArray Message::copyData() const
+{
+    if ((m_offset == 0) && (m_size == m_buffer.size())) {
+        return m_buffer;
+    }
+    return QByteArray(m_buffer.constData() + m_offset, m_size);
+}
+
+TLValue Message::firstValue() const
+{
+    return TLValue::firstFromArray(data());
+}
+
 Message Message::skipBytes(int bytes) const
 {
     Message m = *this;
-    m.data = data.mid(bytes);
+    bytes = qBound(0, bytes, m_size);
+    m.m_offset = m_offset + bytes;
+    m.m_size = m_size - bytes;
     return m;
 }
 
+Message Message::innerMessage(const MessageHeader &header, int offset) const
+{
+    offset = qBound(0, offset, m_size);
+    const int size = qMin(static_cast<int>(header.contentLength), m_size - offset);
+    return Message(header, m_buffer, m_offset + offset, size);
+}
+
 } // MTProto
 
 } // Telegram
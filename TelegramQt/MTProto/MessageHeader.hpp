@@ -54,28 +54,45 @@ struct TELEGRAMQT_EXPORT FullMessageHeader : public MessageHeader
             + sizeof(messageId) + sizeof(sequenceNumber) + sizeof(contentLength);
 };
 
+// The message data is a view (offset and size) over an implicitly shared buffer,
+// so unwrapping of nested envelopes (containers, invokeWithLayer, etc) does not copy the payload.
 struct TELEGRAMQT_EXPORT Message : public MessageHeader {
     Message() = default;
     Message(const MessageHeader &header, const QByteArray &data) :
         MessageHeader(header),
-        data(data)
+        m_buffer(data),
+        m_size(data.size())
     {
     }
+    Message(const MessageHeader &header, const QByteArray &buffer, int offset, int size);
 
     Message(const Message &message) = default;
 
+    // The returned array does not own the bytes if the message is a view.
+    // It must not outlive the message; use copyData() to keep the bytes.
+    QByteArray data() const;
+    Q_REQUIRED_RESULT QByteArray copyData() const;
+    int dataSize() const { return m_size; }
     void setData(const QByteArray &data);
 
-    Q_REQUIRED_RESULT TLValue firstValue() const { return TLValue::firstFromArray(data); }
+    Q_REQUIRED_RESULT TLValue firstValue() const;
     Q_REQUIRED_RESULT Message skipTLValue() const { return skipBytes(4); }
     Q_REQUIRED_RESULT Message skipBytes(int bytes) const;
 
-    QByteArray data;
+    // A view of an inner message (e.g. a container item), which starts at the given data offset
+    Q_REQUIRED_RESULT Message innerMessage(const MessageHeader &header, int offset) const;
+
+protected:
+    QByteArray m_buffer;
+    int m_offset = 0;
+    int m_size = 0;
 };
 
 inline void Message::setData(const QByteArray &newData)
 {
-    data = newData;
+    m_buffer = newData;
+    m_offset = 0;
+    m_size = newData.size();
     contentLength = static_cast<quint32>(newData.size());
 }
 
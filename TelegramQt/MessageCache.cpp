@@ -0,0 +1,205 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "MessageCache.hpp"
+
+namespace Telegram {
+
+namespace Client {
+
+// QHash node: next pointer, hash, key and value
+static const qint64 c_hashNodeCost = sizeof(void *) + sizeof(uint) + sizeof(quint64) + sizeof(void *);
+
+static qint64 stringCost(const QString &string)
+{
+    return string.isEmpty() ? 0 : string.capacity() * static_cast<qint64>(sizeof(QChar));
+}
+
+MessageCache::MessageCache(qint64 limit) :
+    m_limit(qMax<qint64>(0, limit))
+{
+}
+
+MessageCache::~MessageCache()
+{
+    qDeleteAll(m_entries);
+}
+
+void MessageCache::setLimit(qint64 bytes)
+{
+    m_limit = qMax<qint64>(0, bytes);
+    evict();
+}
+
+const TLMessage *MessageCache::get(quint64 key)
+{
+    Entry *entry = m_entries.value(key);
+    if (!entry) {
+        return nullptr;
+    }
+    if (!isPinned(key) && (entry != m_head)) {
+        unlink(entry);
+        link(entry);
+    }
+    return &entry->message;
+}
+
+void MessageCache::insert(quint64 key, const TLMessage &message)
+{
+    Entry *entry = m_entries.value(key);
+    if (entry) {
+        m_cost -= entry->cost;
+        if (!isPinned(key)) {
+            unlink(entry);
+        }
+    } else {
+        entry = new Entry();
+        entry->key = key;
+        m_entries.insert(key, entry);
+    }
+    entry->message = message;
+    entry->cost = messageCost(message);
+    m_cost += entry->cost;
+    if (!isPinned(key)) {
+        link(entry);
+    }
+    evict();
+}
+
+void MessageCache::clear()
+{
+    qDeleteAll(m_entries);
+    m_entries.clear();
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_cost = 0;
+}
+
+void MessageCache::setPinnedKeys(const QSet<quint64> &keys)
+{
+    for (const quint64 key : m_pinnedKeys) {
+        if (keys.contains(key)) {
+            continue;
+        }
+        Entry *entry = m_entries.value(key);
+        if (entry) {
+            link(entry);
+        }
+    }
+    for (const quint64 key : keys) {
+        if (m_pinnedKeys.contains(key)) {
+            continue;
+        }
+        Entry *entry = m_entries.value(key);
+        if (entry) {
+            unlink(entry);
+        }
+    }
+    m_pinnedKeys = keys;
+    evict();
+}
+
+void MessageCache::pin(quint64 key)
+{
+    if (isPinned(key)) {
+        return;
+    }
+    m_pinnedKeys.insert(key);
+    Entry *entry = m_entries.value(key);
+    if (entry) {
+        unlink(entry);
+    }
+}
+
+void MessageCache::unpin(quint64 key)
+{
+    if (!m_pinnedKeys.remove(key)) {
+        return;
+    }
+    Entry *entry = m_entries.value(key);
+    if (entry) {
+        link(entry);
+        evict();
+    }
+}
+
+qint64 MessageCache::messageCost(const TLMessage &message)
+{
+    qint64 cost = sizeof(Entry) + c_hashNodeCost;
+    cost += stringCost(message.message);
+    cost += stringCost(message.postAuthor);
+    cost += message.entities.capacity() * static_cast<qint64>(sizeof(TLMessageEntity));
+    if (!message.fwdFrom.isNull()) {
+        cost += sizeof(TLMessageFwdHeader);
+    }
+    if (!message.media.isNull()) {
+        cost += sizeof(TLMessageMedia);
+    }
+    if (!message.replyMarkup.isNull()) {
+        cost += sizeof(TLReplyMarkup);
+    }
+    if (!message.action.isNull()) {
+        cost += sizeof(TLMessageAction);
+    }
+    return cost;
+}
+
+void MessageCache::link(Entry *entry)
+{
+    entry->prev = nullptr;
+    entry->next = m_head;
+    if (m_head) {
+        m_head->prev = entry;
+    } else {
+        m_tail = entry;
+    }
+    m_head = entry;
+}
+
+void MessageCache::unlink(Entry *entry)
+{
+    if (entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        m_head = entry->next;
+    }
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    } else {
+        m_tail = entry->prev;
+    }
+    entry->prev = nullptr;
+    entry->next = nullptr;
+}
+
+void MessageCache::evict()
+{
+    if (!m_limit) {
+        return;
+    }
+    while ((m_cost > m_limit) && m_tail) {
+        Entry *entry = m_tail;
+        unlink(entry);
+        m_entries.remove(entry->key);
+        m_cost -= entry->cost;
+        delete entry;
+    }
+}
+
+} // Client namespace
+
+} // Telegram namespace
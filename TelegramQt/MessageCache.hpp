@@ -0,0 +1,93 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_MESSAGE_CACHE_HPP
+#define TELEGRAM_MESSAGE_CACHE_HPP
+
+#include "telegramqt_global.h"
+
+#include "TLTypes.hpp"
+
+#include <QHash>
+#include <QSet>
+
+namespace Telegram {
+
+namespace Client {
+
+// A byte-bounded LRU cache of the messages.
+// The cost of a message is an estimation of the heap memory held by the cache entry.
+// Pinned messages (e.g. the top messages of the dialogs) count in the cost but are never evicted,
+// so the cost can exceed the limit if the pinned messages take more than that.
+class TELEGRAMQT_INTERNAL_EXPORT MessageCache
+{
+public:
+    static constexpr qint64 c_defaultLimit = 8 * 1024 * 1024;
+
+    explicit MessageCache(qint64 limit = c_defaultLimit);
+    ~MessageCache();
+
+    // 0 stands for 'unlimited'
+    qint64 limit() const { return m_limit; }
+    void setLimit(qint64 bytes);
+
+    qint64 cost() const { return m_cost; }
+    int count() const { return m_entries.count(); }
+    bool contains(quint64 key) const { return m_entries.contains(key); }
+
+    // Returns the message (if cached) and marks it as the most recently used
+    const TLMessage *get(quint64 key);
+    void insert(quint64 key, const TLMessage &message);
+    void clear();
+
+    // The pinned keys are not required to be cached; the messages are pinned on insertion
+    bool isPinned(quint64 key) const { return m_pinnedKeys.contains(key); }
+    void setPinnedKeys(const QSet<quint64> &keys);
+    void pin(quint64 key);
+    // The unpinned message becomes the most recently used one
+    void unpin(quint64 key);
+
+    static qint64 messageCost(const TLMessage &message);
+
+protected:
+    struct Entry {
+        TLMessage message;
+        quint64 key = 0;
+        qint64 cost = 0;
+        // The neighbours in the LRU list; a pinned entry is not in the list
+        Entry *prev = nullptr;
+        Entry *next = nullptr;
+    };
+
+    void link(Entry *entry);
+    void unlink(Entry *entry);
+    void evict();
+
+    QHash<quint64, Entry *> m_entries;
+    QSet<quint64> m_pinnedKeys;
+    // The list head is the most recently used entry
+    Entry *m_head = nullptr;
+    Entry *m_tail = nullptr;
+    qint64 m_limit = 0;
+    qint64 m_cost = 0;
+};
+
+} // Client namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_MESSAGE_CACHE_HPP
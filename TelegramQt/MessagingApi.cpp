@@ -189,6 +189,29 @@ PendingMessages *MessagingApiPrivate::getHistory(const Peer peer, const Telegram
     return apiOp;
 }
 
+PendingMessages *MessagingApiPrivate::getMessages(const Peer peer, const QVector<quint32> &messageIds)
+{
+    if (!peer.isValid()) {
+        return PendingOperation::failOperation<PendingMessages>(QStringLiteral("Invalid peer for getMessages()"), this);
+    }
+    PendingMessages *apiOp = new PendingMessages(this);
+    PendingMessagesPrivate *priv = PendingMessagesPrivate::get(apiOp);
+    priv->m_peer = peer;
+    TLVector<quint32> ids;
+    ids.reserve(messageIds.count());
+    for (const quint32 messageId : messageIds) {
+        ids.append(messageId);
+    }
+    MessagesRpcLayer::PendingMessagesMessages *rpcOp = nullptr;
+    if (peer.type == Peer::Channel) {
+        rpcOp = channelsLayer()->getMessages(dataInternalApi()->toInputChannel(peer.id), ids);
+    } else {
+        rpcOp = messagesLayer()->getMessages(ids);
+    }
+    rpcOp->connectToFinished(this, &MessagingApiPrivate::onGetHistoryFinished, apiOp, rpcOp);
+    return apiOp;
+}
+
 /*!
     \class Telegram::Client::MessagingApi
     \brief Provides an API to work with messages
@@ -341,6 +364,18 @@ PendingMessages *MessagingApi::getHistory(const Telegram::Peer peer, const Messa
     return d->getHistory(peer, options);
 }
 
+/*!
+    Fetches the messages with \a messageIds from the dialog with \a peer.
+
+    The messages are available via DataStorage::getMessage() on the operation succeeded.
+    Use it to get the messages evicted from the cache (see DataStorage::setMessageCacheLimit()).
+*/
+PendingMessages *MessagingApi::getMessages(const Peer peer, const QVector<quint32> &messageIds)
+{
+    Q_D(MessagingApi);
+    return d->getMessages(peer, messageIds);
+}
+
 void MessagingApi::setDraftMessage(const Peer peer, const QString &text)
 {
 
@@ -398,6 +433,10 @@ void MessagingApiPrivate::onGetDialogsFinished(PendingOperation *operation, Mess
 
 void MessagingApiPrivate::onGetHistoryFinished(PendingMessages *operation, MessagesRpcLayer::PendingMessagesMessages *rpcOperation)
 {
+    if (!rpcOperation->isSucceeded()) {
+        operation->setFinishedWithError(rpcOperation->errorDetails());
+        return;
+    }
     TLMessagesMessages messages;
     rpcOperation->getResult(&messages);
 
@@ -95,6 +95,7 @@ public:
 
     DialogList *getDialogList();
     PendingMessages *getHistory(const Telegram::Peer peer, const MessageFetchOptions &options);
+    PendingMessages *getMessages(const Telegram::Peer peer, const QVector<quint32> &messageIds);
 
 public slots:
     void setDraftMessage(const Telegram::Peer peer, const QString &text);
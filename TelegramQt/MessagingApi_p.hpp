@@ -63,6 +63,7 @@ public:
 
     PendingOperation *getDialogs();
     PendingMessages *getHistory(const Telegram::Peer peer, const MessageFetchOptions &options);
+    PendingMessages *getMessages(const Telegram::Peer peer, const QVector<quint32> &messageIds);
 
     DataStorage *dataStorage();
     DataInternalApi *dataInternalApi();
@@ -50,6 +50,7 @@ DeterministicGenerator::DeterministicGenerator() :
 
 int DeterministicGenerator::generate(void *buffer, int count)
 {
+    QMutexLocker locker(&m_lock);
     int processedBytes = 0;
     char *dest = static_cast<char *>(buffer);
     while (processedBytes < count) {
@@ -65,8 +66,15 @@ int DeterministicGenerator::generate(void *buffer, int count)
     return count;
 }
 
+QByteArray DeterministicGenerator::initializationData() const
+{
+    QMutexLocker locker(&m_lock);
+    return m_initializationData;
+}
+
 void DeterministicGenerator::setInitializationData(const QByteArray &data)
 {
+    QMutexLocker locker(&m_lock);
     m_initializationData = data;
 }
 
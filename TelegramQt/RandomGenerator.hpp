@@ -21,6 +21,7 @@
 #include "telegramqt_global.h"
 
 #include <QByteArray>
+#include <QMutex>
 
 namespace Telegram {
 
@@ -60,6 +61,8 @@ public:
     static RandomGenerator *setInstance(RandomGenerator *instance);
 };
 
+// The generator is shared by all threads (e.g. the threaded DCs of LocalCluster and the clients),
+// so the state is guarded by a mutex. The output sequence is deterministic for a single thread only.
 class TELEGRAMQT_EXPORT DeterministicGenerator : public RandomGenerator
 {
 public:
@@ -69,12 +72,13 @@ public:
 
     int generate(void *buffer, int count) override;
 
-    QByteArray initializationData() const { return  m_initializationData; }
+    QByteArray initializationData() const;
     void setInitializationData(const QByteArray &data);
 
 protected:
     void regenerate();
 
+    mutable QMutex m_lock;
     QByteArray m_initializationData;
     QByteArray m_generatedData;
     quint8 m_offset = 0;
@@ -19,6 +19,7 @@
 
 #include "AbridgedLength.hpp"
 #include "CRawStream.hpp"
+#include "Crypto/AuthKeyContext.hpp"
 #include "RandomGenerator.hpp"
 #include "SendPackageHelper.hpp"
 #include "Utils.hpp"
@@ -31,6 +32,7 @@
 #include "Debug_p.hpp"
 #endif
 
+#include <QIODevice>
 #include <QLoggingCategory>
 
 Q_LOGGING_CATEGORY(c_baseRpcLayerCategory, "telegram.base.rpclayer", QtWarningMsg)
@@ -60,7 +62,7 @@ bool BaseRpcLayer::processPackage(const QByteArray &package)
 #ifdef BASE_RPC_IO_DEBUG
     const quint64 *authKeyIdBytes = reinterpret_cast<const quint64*>(package.constData());
 #endif
-    const QByteArray messageKey = package.mid(8, 16);
+    const QByteArray messageKey = QByteArray::fromRawData(package.constData() + 8, 16);
     const QByteArray encryptedData = package.mid(24);
     const SAesKey key = getDecryptionAesKey(messageKey);
     const QByteArray decryptedData = Utils::aesDecrypt(encryptedData, key).left(encryptedData.length());
@@ -90,27 +92,27 @@ bool BaseRpcLayer::processPackage(const QByteArray &package)
         return false;
     }
 #ifdef USE_MTProto_V1
-    QByteArray expectedMessageKey = Utils::sha1(
+    const QByteArray expectedMessageKey = Utils::sha1(
                 decryptedData.left(MTProto::FullMessageHeader::headerLength + messageHeader.contentLength)).mid(4);
+    const bool messageKeyIsValid = messageKey == expectedMessageKey;
 #else // MTProto_V2
-    QByteArray expectedMessageKey = Utils::sha256(getVerificationKeyPart() + decryptedData).mid(8, 16);
+    const bool messageKeyIsValid = Crypto::AuthKeyContext::verifyMessageKey(getVerificationKeyPart(),
+                                                                            decryptedData.constData(),
+                                                                            decryptedData.size(),
+                                                                            messageKey.constData());
 #endif
 
-    if (messageKey != expectedMessageKey) {
+    if (!messageKeyIsValid) {
         qCWarning(c_baseRpcLayerCategoryIn) << this << __func__ << "Invalid message key";
         return false;
     }
 
-    QByteArray innerData = decryptedStream.readBytes(messageHeader.contentLength);
-    if (decryptedStream.error()) {
-        qCWarning(c_baseRpcLayerCategoryIn) << this << __func__ << "Decrypted content read error";
-        return false;
-    }
-    MTProto::Message message(messageHeader, innerData);
+    MTProto::Message message(messageHeader, decryptedData,
+                             MTProto::FullMessageHeader::headerLength, static_cast<int>(messageHeader.contentLength));
     if (message.firstValue() == TLValue::GzipPacked) {
         qCDebug(c_baseRpcLayerCategoryIn) << this << __func__ << "message is GzipPacked";
         QByteArray data;
-        CTelegramStream packedStream(innerData);
+        CTelegramStream packedStream(message.data());
         TLValue gzipValue;
         packedStream >> gzipValue;
         packedStream >> data;
@@ -122,8 +124,8 @@ bool BaseRpcLayer::processPackage(const QByteArray &package)
 
 SAesKey BaseRpcLayer::generateAesKey(const QByteArray &messageKey, int x) const
 {
-    const QByteArray authKey = m_sendHelper->authKey();
 #ifdef USE_MTProto_V1
+    const QByteArray authKey = m_sendHelper->authKey();
     QByteArray sha1_a = Utils::sha1(messageKey + authKey.mid(x, 32));
     QByteArray sha1_b = Utils::sha1(authKey.mid(32 + x, 16) + messageKey + authKey.mid(48 + x, 16));
     QByteArray sha1_c = Utils::sha1(authKey.mid(64 + x, 32) + messageKey);
@@ -131,14 +133,14 @@ SAesKey BaseRpcLayer::generateAesKey(const QByteArray &messageKey, int x) const
 
     const QByteArray key = sha1_a.mid(0, 8) + sha1_b.mid(8, 12) + sha1_c.mid(4, 12);
     const QByteArray iv  = sha1_a.mid(8, 12) + sha1_b.left(8) + sha1_c.mid(16, 4) + sha1_d.left(8);
-#else // MTProto_V2
-    QByteArray sha256_a = Utils::sha256(messageKey + authKey.mid(x, 36));
-    QByteArray sha256_b = Utils::sha256(authKey.mid(40 + x, 36) + messageKey);
-    const QByteArray key = sha256_a.left(8) + sha256_b.mid(8, 16) + sha256_a.mid(24, 8);
-    const QByteArray iv  = sha256_b.left(8) + sha256_a.mid(8, 16) + sha256_b.mid(24, 8);
-#endif
 
     return SAesKey(key, iv);
+#else // MTProto_V2
+    if (messageKey.size() != Crypto::AuthKeyContext::MessageKeySize) {
+        return SAesKey();
+    }
+    return m_sendHelper->authKeyContext().aesKey(messageKey.constData(), x);
+#endif
 }
 
 quint32 BaseRpcLayer::contentRelatedMessagesNumber() const
@@ -165,6 +167,9 @@ bool BaseRpcLayer::sendPackage(const MTProto::Message &message)
     }
     QByteArray encryptedPackage;
     QByteArray messageKey;
+#ifndef USE_MTProto_V1
+    char messageKeyData[Crypto::AuthKeyContext::MessageKeySize];
+#endif
     constexpr int c_alignment = 16;
     constexpr int c_v2_minimumPadding = 12;
     {
@@ -174,7 +179,7 @@ bool BaseRpcLayer::sendPackage(const MTProto::Message &message)
 #endif
         CRawStream stream(CRawStream::WriteOnly);
         stream << messageHeader;
-        stream.writeBytes(message.data);
+        stream.writeBytes(message.data());
 
         int packageLength = stream.getData().length();
         int padding = AbridgedLength::paddingForAlignment(c_alignment, packageLength);
@@ -198,7 +203,9 @@ bool BaseRpcLayer::sendPackage(const MTProto::Message &message)
             packageLength += padding;
         }
         const QByteArray decryptedData = stream.getData();
-        messageKey = Utils::sha256(getEncryptionKeyPart() + decryptedData).mid(8, 16);
+        Crypto::AuthKeyContext::messageKey(getEncryptionKeyPart(), decryptedData.constData(),
+                                           decryptedData.size(), messageKeyData);
+        messageKey = QByteArray::fromRawData(messageKeyData, sizeof(messageKeyData));
 #endif
         const SAesKey key = getEncryptionAesKey(messageKey);
         encryptedPackage = Utils::aesEncrypt(decryptedData, key).left(packageLength);
@@ -261,7 +268,7 @@ bool BaseRpcLayer::processMsgContainer(const MTProto::Message &message)
 {
     // https://core.telegram.org/mtproto/service_messages#simple-container
     quint32 itemsCount;
-    RawStream stream(message.data);
+    RawStream stream(message.data());
     stream >> itemsCount;
     qCDebug(c_baseRpcLayerCategoryIn) << this << __func__ << itemsCount << "items";
 
@@ -269,8 +276,14 @@ bool BaseRpcLayer::processMsgContainer(const MTProto::Message &message)
     for (quint32 i = 0; i < itemsCount; ++i) {
         MTProto::MessageHeader header;
         stream >> header;
-        QByteArray innerData = stream.readBytes(header.contentLength);
-        MTProto::Message innerMessage(header, innerData);
+        if (stream.error() || (int(header.contentLength) > stream.bytesAvailable())) {
+            qCWarning(c_baseRpcLayerCategoryIn) << this << __func__ << "Invalid container item" << i;
+            return false;
+        }
+        const int innerOffset = static_cast<int>(stream.device()->pos());
+        // The inner message is a view into the container data
+        const MTProto::Message innerMessage = message.innerMessage(header, innerOffset);
+        stream.device()->seek(innerOffset + innerMessage.dataSize());
 
         // There is no break and the 'processed' variable goes last,
         // so we process next messages even if something fails.
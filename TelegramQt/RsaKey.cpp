@@ -60,6 +60,12 @@ bool RsaKey::isPrivate() const
     return isValid() && !secretExponent.isEmpty();
 }
 
+bool RsaKey::hasCrtComponents() const
+{
+    return !prime1.isEmpty() && !prime2.isEmpty()
+            && !exponent1.isEmpty() && !exponent2.isEmpty() && !coefficient.isEmpty();
+}
+
 void RsaKey::loadFromFile(const QString &fileName)
 {
     *this = fromFile(fileName);
@@ -111,15 +117,27 @@ RsaKey RsaKey::fromFile(const QString &fileName)
         return result;
     }
     const BIGNUM *n, *e, *d;
+    const BIGNUM *p = nullptr;
+    const BIGNUM *q = nullptr;
+    const BIGNUM *dmp1 = nullptr;
+    const BIGNUM *dmq1 = nullptr;
+    const BIGNUM *iqmp = nullptr;
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
     n=key->n;
     e=key->e;
     if (keyIsPrivate) {
         d=key->d;
+        p=key->p;
+        q=key->q;
+        dmp1=key->dmp1;
+        dmq1=key->dmq1;
+        iqmp=key->iqmp;
     }
 #else
     if (keyIsPrivate) {
         RSA_get0_key(key, &n, &e, &d);
+        RSA_get0_factors(key, &p, &q);
+        RSA_get0_crt_params(key, &dmp1, &dmq1, &iqmp);
     } else {
         RSA_get0_key(key, &n, &e, nullptr);
     }
@@ -129,6 +147,13 @@ RsaKey RsaKey::fromFile(const QString &fileName)
     result.exponent = Utils::SslBigNumber::toByteArray(e);
     if (keyIsPrivate) {
         result.secretExponent = Utils::SslBigNumber::toByteArray(d);
+        if (p && q && dmp1 && dmq1 && iqmp) {
+            result.prime1 = Utils::SslBigNumber::toByteArray(p);
+            result.prime2 = Utils::SslBigNumber::toByteArray(q);
+            result.exponent1 = Utils::SslBigNumber::toByteArray(dmp1);
+            result.exponent2 = Utils::SslBigNumber::toByteArray(dmq1);
+            result.coefficient = Utils::SslBigNumber::toByteArray(iqmp);
+        }
     }
     result.updateFingersprint();
     RSA_free(key);
@@ -29,6 +29,12 @@ struct TELEGRAMQT_EXPORT RsaKey
     QByteArray modulus;
     QByteArray exponent;
     QByteArray secretExponent;
+    // CRT components of the private key (PKCS#1 naming)
+    QByteArray prime1;
+    QByteArray prime2;
+    QByteArray exponent1;
+    QByteArray exponent2;
+    QByteArray coefficient;
     quint64 fingerprint = 0;
 
     RsaKey() = default;
@@ -42,6 +48,11 @@ struct TELEGRAMQT_EXPORT RsaKey
         modulus = otherKey.modulus;
         exponent = otherKey.exponent;
         secretExponent = otherKey.secretExponent;
+        prime1 = otherKey.prime1;
+        prime2 = otherKey.prime2;
+        exponent1 = otherKey.exponent1;
+        exponent2 = otherKey.exponent2;
+        coefficient = otherKey.coefficient;
         fingerprint = otherKey.fingerprint;
         return *this;
     }
@@ -49,6 +60,7 @@ struct TELEGRAMQT_EXPORT RsaKey
     void updateFingersprint();
     bool isValid() const;
     bool isPrivate() const;
+    bool hasCrtComponents() const;
 
     void loadFromFile(const QString &fileName);
 
@@ -28,10 +28,10 @@ void BaseMTProtoSendHelper::setDeltaTime(const qint32 newDt)
 void BaseMTProtoSendHelper::setAuthKey(const QByteArray &authKey)
 {
     if (authKey.isEmpty()) {
-        m_authKey.clear();
+        m_authKeyContext.setAuthKey(QByteArray());
         m_authId = 0;
     } else {
-        m_authKey = authKey;
+        m_authKeyContext.setAuthKey(authKey);
         m_authId = Utils::getFingerprints(authKey, Utils::Lower64Bits);
     }
 }
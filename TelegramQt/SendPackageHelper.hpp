@@ -20,6 +20,8 @@
 
 #include "telegramqt_global.h"
 
+#include "Crypto/AuthKeyContext.hpp"
+
 #include <QObject>
 
 namespace Telegram {
@@ -45,9 +47,10 @@ public:
     void setDeltaTime(const qint32 newDt);
 
     quint64 authId() const { return m_authId; }
-    QByteArray getServerKeyPart() const { return m_authKey.mid(96, 32); }
-    QByteArray getClientKeyPart() const { return m_authKey.mid(88, 32); }
-    QByteArray authKey() const { return m_authKey; }
+    const QByteArray &getServerKeyPart() const { return m_authKeyContext.keyPart(Crypto::AuthKeyContext::ServerToClient); }
+    const QByteArray &getClientKeyPart() const { return m_authKeyContext.keyPart(Crypto::AuthKeyContext::ClientToServer); }
+    QByteArray authKey() const { return m_authKeyContext.authKey(); }
+    const Crypto::AuthKeyContext &authKeyContext() const { return m_authKeyContext; }
     void setAuthKey(const QByteArray &authKey);
 
 protected:
@@ -55,7 +58,7 @@ protected:
     quint64 m_lastMessageId = 0;
 
     quint64 m_authId = 0;
-    QByteArray m_authKey;
+    Crypto::AuthKeyContext m_authKeyContext;
     qint32 m_deltaTime = 0;
 };
 
@@ -2,26 +2,29 @@
 
 #include <openssl/bn.h>
 
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
 namespace Telegram {
 
 namespace Utils {
 
-struct SslBigNumberContext {
-    SslBigNumberContext() :
-        m_context(BN_CTX_new())
-    {
-    }
-
-    ~SslBigNumberContext()
-    {
-        BN_CTX_free(m_context);
-    }
+SslBigNumberContext::SslBigNumberContext() :
+    m_context(BN_CTX_new())
+{
+}
 
-    BN_CTX *context() { return m_context; }
+SslBigNumberContext::~SslBigNumberContext()
+{
+    BN_CTX_free(m_context);
+}
 
-private:
-    BN_CTX *m_context = nullptr;
-};
+BN_CTX *SslBigNumberContext::threadContext()
+{
+    static thread_local SslBigNumberContext context;
+    return context.context();
+}
 
 SslBigNumber::SslBigNumber() :
     m_number(BN_new())
@@ -78,14 +81,76 @@ QByteArray SslBigNumber::toByteArray() const
     return toByteArray(m_number);
 }
 
+bool SslBigNumber::isZero() const
+{
+    return BN_is_zero(m_number);
+}
+
+void SslBigNumber::setConstantTime()
+{
+    BN_set_flags(m_number, BN_FLG_CONSTTIME);
+}
+
 SslBigNumber SslBigNumber::mod_exp(const SslBigNumber &exponent, const SslBigNumber &modulus) const
 {
-    SslBigNumberContext context;
     SslBigNumber result;
-    BN_mod_exp(result.m_number, number(), exponent.number(), modulus.number(), context.context());
+    BN_mod_exp(result.m_number, number(), exponent.number(), modulus.number(), SslBigNumberContext::threadContext());
+    return result;
+}
+
+SslMontgomeryContext::SslMontgomeryContext(const QByteArray &modulus) :
+    m_modulusBytes(modulus),
+    m_modulus(SslBigNumber::fromByteArray(modulus)),
+    m_context(BN_MONT_CTX_new())
+{
+    if (!BN_MONT_CTX_set(m_context, m_modulus.number(), SslBigNumberContext::threadContext())) {
+        BN_MONT_CTX_free(m_context);
+        m_context = nullptr;
+    }
+}
+
+QSharedPointer<const SslMontgomeryContext> SslMontgomeryContext::fromCache(const QByteArray &modulus)
+{
+    // Servers use one (or a few) DH primes, so a tiny cache is enough
+    static const int c_maxCacheSize = 4;
+    static QMutex mutex;
+    static QHash<QByteArray, QSharedPointer<const SslMontgomeryContext>> cache;
+
+    QMutexLocker locker(&mutex);
+    QSharedPointer<const SslMontgomeryContext> context = cache.value(modulus);
+    if (!context) {
+        if (cache.count() >= c_maxCacheSize) {
+            cache.clear();
+        }
+        context = QSharedPointer<const SslMontgomeryContext>(new SslMontgomeryContext(modulus));
+        cache.insert(modulus, context);
+    }
+    return context;
+}
+
+SslMontgomeryContext::~SslMontgomeryContext()
+{
+    if (m_context) {
+        BN_MONT_CTX_free(m_context);
+    }
+}
+
+SslBigNumber SslMontgomeryContext::mod_exp(const SslBigNumber &base, const SslBigNumber &exponent) const
+{
+    SslBigNumber result;
+    BN_mod_exp_mont(result.number(), base.number(), exponent.number(), m_modulus.number(),
+                    SslBigNumberContext::threadContext(), m_context);
     return result;
 }
 
+QByteArray SslMontgomeryContext::modExp(const QByteArray &base, const QByteArray &exponent) const
+{
+    const SslBigNumber baseNumber = SslBigNumber::fromByteArray(base);
+    SslBigNumber exponentNumber = SslBigNumber::fromByteArray(exponent);
+    exponentNumber.setConstantTime();
+    return mod_exp(baseNumber, exponentNumber).toByteArray();
+}
+
 } // Utils namespace
 
 } // Telegram namespace
@@ -15,15 +15,37 @@
 
  */
 
+#ifndef TELEGRAM_SSL_BIG_NUMBER_HPP
+#define TELEGRAM_SSL_BIG_NUMBER_HPP
+
+#include "telegramqt_global.h"
+
 #include <QByteArray>
+#include <QSharedPointer>
 
 typedef struct bignum_st BIGNUM;
+typedef struct bignum_ctx BN_CTX;
+typedef struct bn_mont_ctx_st BN_MONT_CTX;
 
 namespace Telegram {
 
 namespace Utils {
 
-struct SslBigNumber
+struct SslBigNumberContext {
+    SslBigNumberContext();
+    ~SslBigNumberContext();
+
+    BN_CTX *context() { return m_context; }
+
+    // The context is not thread-safe, so each thread gets its own instance
+    static BN_CTX *threadContext();
+
+private:
+    Q_DISABLE_COPY(SslBigNumberContext)
+    BN_CTX *m_context = nullptr;
+};
+
+struct TELEGRAMQT_INTERNAL_EXPORT SslBigNumber
 {
     SslBigNumber();
     SslBigNumber(SslBigNumber &&other);
@@ -37,6 +59,9 @@ struct SslBigNumber
 
     QByteArray toByteArray() const;
 
+    bool isZero() const;
+    void setConstantTime();
+
     SslBigNumber mod_exp(const SslBigNumber &exponent, const SslBigNumber &modulus) const;
 
     const BIGNUM *number() const { return m_number; }
@@ -46,6 +71,33 @@ private:
     BIGNUM *m_number = nullptr;
 };
 
+// Montgomery context precomputed for a fixed modulus (e.g. the DH prime).
+// The precomputed data is read-only after construction, so an instance can be
+// shared between threads.
+class TELEGRAMQT_INTERNAL_EXPORT SslMontgomeryContext
+{
+public:
+    explicit SslMontgomeryContext(const QByteArray &modulus);
+    ~SslMontgomeryContext();
+
+    // Returns a shared context for the modulus from a small process-wide cache
+    static QSharedPointer<const SslMontgomeryContext> fromCache(const QByteArray &modulus);
+
+    bool isValid() const { return m_context; }
+    QByteArray modulus() const { return m_modulusBytes; }
+
+    SslBigNumber mod_exp(const SslBigNumber &base, const SslBigNumber &exponent) const;
+    QByteArray modExp(const QByteArray &base, const QByteArray &exponent) const;
+
+private:
+    Q_DISABLE_COPY(SslMontgomeryContext)
+    QByteArray m_modulusBytes;
+    SslBigNumber m_modulus;
+    BN_MONT_CTX *m_context = nullptr;
+};
+
 } // Utils namespace
 
 } // Telegram namespace
+
+#endif // TELEGRAM_SSL_BIG_NUMBER_HPP
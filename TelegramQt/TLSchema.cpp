@@ -0,0 +1,3133 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "TLSchema.hpp"
+
+#include "TLValues.hpp"
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <iterator>
+
+namespace Telegram {
+
+namespace TLSchema {
+
+namespace {
+
+enum class TypeIndex : quint16 {
+    // Generated TL schema types
+    AccountAuthorizations,
+    AccountDaysTTL,
+    AccountPassword,
+    AccountPasswordInputSettings,
+    AccountPasswordSettings,
+    AccountPrivacyRules,
+    AccountTmpPassword,
+    AuthAuthorization,
+    AuthCheckedPhone,
+    AuthCodeType,
+    AuthExportedAuthorization,
+    AuthPasswordRecovery,
+    AuthSentCode,
+    AuthSentCodeType,
+    Authorization,
+    BadMsgNotification,
+    BotCommand,
+    BotInfo,
+    BotInlineMessage,
+    BotInlineResult,
+    CdnConfig,
+    CdnFileHash,
+    CdnPublicKey,
+    ChannelAdminLogEvent,
+    ChannelAdminLogEventAction,
+    ChannelAdminLogEventsFilter,
+    ChannelAdminRights,
+    ChannelBannedRights,
+    ChannelMessagesFilter,
+    ChannelParticipant,
+    ChannelParticipantsFilter,
+    ChannelsAdminLogResults,
+    ChannelsChannelParticipant,
+    ChannelsChannelParticipants,
+    Chat,
+    ChatFull,
+    ChatInvite,
+    ChatParticipant,
+    ChatParticipants,
+    ChatPhoto,
+    ClientDHInnerData,
+    Config,
+    Contact,
+    ContactBlocked,
+    ContactLink,
+    ContactStatus,
+    ContactsBlocked,
+    ContactsContacts,
+    ContactsFound,
+    ContactsImportedContacts,
+    ContactsLink,
+    ContactsResolvedPeer,
+    ContactsTopPeers,
+    DataJSON,
+    DcOption,
+    DestroyAuthKeyRes,
+    DestroySessionRes,
+    Dialog,
+    DisabledFeature,
+    Document,
+    DocumentAttribute,
+    DraftMessage,
+    EncryptedChat,
+    EncryptedFile,
+    EncryptedMessage,
+    Error,
+    ExportedChatInvite,
+    ExportedMessageLink,
+    FileLocation,
+    FoundGif,
+    FutureSalt,
+    FutureSalts,
+    Game,
+    GeoPoint,
+    HelpAppUpdate,
+    HelpConfigSimple,
+    HelpInviteText,
+    HelpRecentMeUrls,
+    HelpSupport,
+    HelpTermsOfService,
+    HighScore,
+    HttpWait,
+    ImportedContact,
+    InlineBotSwitchPM,
+    InputAppEvent,
+    InputBotInlineMessage,
+    InputBotInlineMessageID,
+    InputBotInlineResult,
+    InputChannel,
+    InputChatPhoto,
+    InputContact,
+    InputDocument,
+    InputEncryptedChat,
+    InputEncryptedFile,
+    InputFile,
+    InputFileLocation,
+    InputGame,
+    InputGeoPoint,
+    InputMedia,
+    InputNotifyPeer,
+    InputPaymentCredentials,
+    InputPeer,
+    InputPeerNotifyEvents,
+    InputPeerNotifySettings,
+    InputPhoneCall,
+    InputPhoto,
+    InputPrivacyKey,
+    InputPrivacyRule,
+    InputStickerSet,
+    InputStickerSetItem,
+    InputStickeredMedia,
+    InputUser,
+    InputWebDocument,
+    InputWebFileLocation,
+    Invoice,
+    IpPort,
+    KeyboardButton,
+    KeyboardButtonRow,
+    LabeledPrice,
+    LangPackDifference,
+    LangPackLanguage,
+    LangPackString,
+    MaskCoords,
+    Message,
+    MessageAction,
+    MessageEntity,
+    MessageFwdHeader,
+    MessageMedia,
+    MessageRange,
+    MessagesAffectedHistory,
+    MessagesAffectedMessages,
+    MessagesAllStickers,
+    MessagesArchivedStickers,
+    MessagesBotCallbackAnswer,
+    MessagesBotResults,
+    MessagesChatFull,
+    MessagesChats,
+    MessagesDhConfig,
+    MessagesDialogs,
+    MessagesFavedStickers,
+    MessagesFeaturedStickers,
+    MessagesFilter,
+    MessagesFoundGifs,
+    MessagesHighScores,
+    MessagesMessageEditData,
+    MessagesMessages,
+    MessagesPeerDialogs,
+    MessagesRecentStickers,
+    MessagesSavedGifs,
+    MessagesSentEncryptedMessage,
+    MessagesStickerSet,
+    MessagesStickerSetInstallResult,
+    MessagesStickers,
+    MsgDetailedInfo,
+    MsgResendReq,
+    MsgsAck,
+    MsgsAllInfo,
+    MsgsStateInfo,
+    MsgsStateReq,
+    NearestDc,
+    NewSession,
+    NotifyPeer,
+    PQInnerData,
+    Page,
+    PageBlock,
+    PaymentCharge,
+    PaymentRequestedInfo,
+    PaymentSavedCredentials,
+    PaymentsPaymentForm,
+    PaymentsPaymentReceipt,
+    PaymentsPaymentResult,
+    PaymentsSavedInfo,
+    PaymentsValidatedRequestedInfo,
+    Peer,
+    PeerNotifyEvents,
+    PeerNotifySettings,
+    PeerSettings,
+    PhoneCall,
+    PhoneCallDiscardReason,
+    PhoneCallProtocol,
+    PhoneConnection,
+    PhonePhoneCall,
+    Photo,
+    PhotoSize,
+    PhotosPhoto,
+    PhotosPhotos,
+    Pong,
+    PopularContact,
+    PostAddress,
+    PrivacyKey,
+    PrivacyRule,
+    ReceivedNotifyMessage,
+    RecentMeUrl,
+    ReplyMarkup,
+    ReportReason,
+    ResPQ,
+    RichText,
+    RpcDropAnswer,
+    RpcError,
+    SendMessageAction,
+    ServerDHInnerData,
+    ServerDHParams,
+    SetClientDHParamsAnswer,
+    ShippingOption,
+    StickerPack,
+    StickerSet,
+    StickerSetCovered,
+    StorageFileType,
+    TopPeer,
+    TopPeerCategory,
+    TopPeerCategoryPeers,
+    Update,
+    Updates,
+    UpdatesChannelDifference,
+    UpdatesDifference,
+    UpdatesState,
+    UploadCdnFile,
+    UploadFile,
+    UploadWebFile,
+    User,
+    UserFull,
+    UserProfilePhoto,
+    UserStatus,
+    WallPaper,
+    WebDocument,
+    WebPage,
+    // End of generated TL schema types
+    Any = 0xffff,
+};
+
+enum class FieldKind : quint8 {
+    Int,
+    Long,
+    Double,
+    Bool,
+    Bytes,
+    Int128,
+    Int256,
+    Flags,
+    Object,
+    IntVector,
+    LongVector,
+    ObjectVector,
+};
+
+constexpr quint8 c_noFlag = 0xff;
+
+struct FieldInfo
+{
+    FieldKind kind;
+    quint8 flagBit; // The field is present only if the bit is set in the last read flags
+    TypeIndex type; // The expected type of Object and ObjectVector fields
+};
+
+struct ConstructorInfo
+{
+    quint32 id;
+    TypeIndex type;
+    quint16 firstField;
+    quint8 fieldCount;
+};
+
+bool operator<(const ConstructorInfo &info, quint32 id)
+{
+    return info.id < id;
+}
+
+constexpr FieldInfo c_fields[] = {
+    // Generated TL schema fields
+    // UserStatusOffline
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdatesDifference
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::EncryptedMessage },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Update },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    { FieldKind::Object, c_noFlag, TypeIndex::UpdatesState },
+    // InputGameID
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // InputStickeredMediaDocument
+    { FieldKind::Object, c_noFlag, TypeIndex::InputDocument },
+    // MsgsStateInfo
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ResPQ
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // KeyboardButtonSwitchInline
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // DcOption
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelParticipantsSearch
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChatForbidden
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateChatParticipants
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatParticipants },
+    // PageBlockCollage
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PageBlock },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // InputMediaPhotoExternal
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    // FutureSalt
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // UploadFile
+    { FieldKind::Object, c_noFlag, TypeIndex::StorageFileType },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // BotInlineMessageMediaAuto
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // InputPaymentCredentialsApplePay
+    { FieldKind::Object, c_noFlag, TypeIndex::DataJSON },
+    // MessageRange
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesMessagesSlice
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateStickerSetsOrder
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // PrivacyValueDisallowUsers
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    // Channel
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, 13, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 6, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatPhoto },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 9, TypeIndex::Any },
+    { FieldKind::Object, 14, TypeIndex::ChannelAdminRights },
+    { FieldKind::Object, 15, TypeIndex::ChannelBannedRights },
+    // HelpRecentMeUrls
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::RecentMeUrl },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // PhotoSizeEmpty
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateBotInlineSend
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::GeoPoint },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 1, TypeIndex::InputBotInlineMessageID },
+    // DocumentAttributeVideo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UserFull
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::User },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ContactsLink },
+    { FieldKind::Object, 2, TypeIndex::Photo },
+    { FieldKind::Object, c_noFlag, TypeIndex::PeerNotifySettings },
+    { FieldKind::Object, 3, TypeIndex::BotInfo },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // LangPackLanguage
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateShortSentMessage
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 9, TypeIndex::MessageMedia },
+    { FieldKind::ObjectVector, 7, TypeIndex::MessageEntity },
+    // AccountAuthorizations
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Authorization },
+    // StickerPack
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // UpdateUserPhone
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateNewEncryptedMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::EncryptedMessage },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PageBlockSlideshow
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PageBlock },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // InputPrivacyValueAllowUsers
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::InputUser },
+    // AuthPasswordRecovery
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // EncryptedChatDiscarded
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelParticipantsBanned
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputFileLocation
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // PhotosPhotosSlice
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Photo },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // DocumentAttributeFilename
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessagesDialogs
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Dialog },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // ChannelParticipant
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // FoundGif
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateShortChatMessage
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::MessageFwdHeader },
+    { FieldKind::Int, 11, TypeIndex::Any },
+    { FieldKind::Int, 3, TypeIndex::Any },
+    { FieldKind::ObjectVector, 7, TypeIndex::MessageEntity },
+    // UpdateEncryptedChatTyping
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputPeerChat
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // HelpSupport
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::User },
+    // BotInlineMediaResult
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::Photo },
+    { FieldKind::Object, 1, TypeIndex::Document },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::BotInlineMessage },
+    // InputDocument
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // HelpInviteText
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ContactsFound
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Peer },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateEditChannelMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionToggleInvites
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // PhoneCallWaiting
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneCallProtocol },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    // UpdateUserStatus
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::UserStatus },
+    // ContactsBlocked
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::ContactBlocked },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // InputPhoneCall
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // PostAddress
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateNewMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ExportedMessageLink
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UserEmpty
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PhotosPhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::Photo },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // GeoPoint
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    // UpdatesChannelDifference
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Update },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // InputMessageEntityMentionName
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputUser },
+    // InputPeerChannel
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // RpcError
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UploadWebFile
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::StorageFileType },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelParticipantBanned
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelBannedRights },
+    // PhotoEmpty
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // EncryptedMessageService
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // SendMessageUploadRoundAction
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateContactRegistered
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // KeyboardButtonUrl
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateReadChannelOutbox
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PageBlockBlockquote
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // ChannelAdminLogEventActionToggleSignatures
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // MessagesMessageEditData
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // MsgDetailedInfo
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelForbidden
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 16, TypeIndex::Any },
+    // MessageEntityCode
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PageBlockEmbedPost
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PageBlock },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // InputBotInlineMessageMediaAuto
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // LangPackStringDeleted
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessagesDhConfig
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputBotInlineResult
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    { FieldKind::Bytes, 4, TypeIndex::Any },
+    { FieldKind::Bytes, 5, TypeIndex::Any },
+    { FieldKind::Bytes, 5, TypeIndex::Any },
+    { FieldKind::Int, 6, TypeIndex::Any },
+    { FieldKind::Int, 6, TypeIndex::Any },
+    { FieldKind::Int, 7, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputBotInlineMessage },
+    // InputBotInlineMessageMediaContact
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // InputEncryptedFileBigUploaded
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChatFull
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatParticipants },
+    { FieldKind::Object, c_noFlag, TypeIndex::Photo },
+    { FieldKind::Object, c_noFlag, TypeIndex::PeerNotifySettings },
+    { FieldKind::Object, c_noFlag, TypeIndex::ExportedChatInvite },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::BotInfo },
+    // MessagesSavedGifs
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // User
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    { FieldKind::Bytes, 4, TypeIndex::Any },
+    { FieldKind::Object, 5, TypeIndex::UserProfilePhoto },
+    { FieldKind::Object, 6, TypeIndex::UserStatus },
+    { FieldKind::Int, 14, TypeIndex::Any },
+    { FieldKind::Bytes, 18, TypeIndex::Any },
+    { FieldKind::Bytes, 19, TypeIndex::Any },
+    { FieldKind::Bytes, 22, TypeIndex::Any },
+    // MessageMediaVenue
+    { FieldKind::Object, c_noFlag, TypeIndex::GeoPoint },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateReadHistoryOutbox
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputMediaUploadedPhoto
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputFile },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 0, TypeIndex::InputDocument },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    // PageBlockAudio
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // MessagesPeerDialogs
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Dialog },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    { FieldKind::Object, c_noFlag, TypeIndex::UpdatesState },
+    // StickerSetMultiCovered
+    { FieldKind::Object, c_noFlag, TypeIndex::StickerSet },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // InputPaymentCredentials
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::DataJSON },
+    // Pong
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // ReplyKeyboardMarkup
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::KeyboardButtonRow },
+    // MessageEntityMentionName
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesStickerSetInstallResultArchive
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::StickerSetCovered },
+    // BotInlineMessageMediaContact
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // MessagesBotCallbackAnswer
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // DocumentEmpty
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // InputPeerNotifySettings
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateEncryptedMessagesRead
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PageBlockCover
+    { FieldKind::Object, c_noFlag, TypeIndex::PageBlock },
+    // PageBlockList
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::RichText },
+    // ContactsLink
+    { FieldKind::Object, c_noFlag, TypeIndex::ContactLink },
+    { FieldKind::Object, c_noFlag, TypeIndex::ContactLink },
+    { FieldKind::Object, c_noFlag, TypeIndex::User },
+    // ChannelAdminLogEvent
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelAdminLogEventAction },
+    // DhGenOk
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    // EncryptedChatWaiting
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InlineBotSwitchPM
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // TextUrl
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // AuthSentCodeTypeApp
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputBotInlineMessageText
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 1, TypeIndex::MessageEntity },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // UpdatesChannelDifferenceEmpty
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    // ChatParticipants
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::ChatParticipant },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PaymentsPaymentForm
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Invoice },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 4, TypeIndex::Any },
+    { FieldKind::Object, 4, TypeIndex::DataJSON },
+    { FieldKind::Object, 0, TypeIndex::PaymentRequestedInfo },
+    { FieldKind::Object, 1, TypeIndex::PaymentSavedCredentials },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // MessageActionPaymentSent
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // UpdateChannelWebPage
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::WebPage },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateReadChannelInbox
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionDeleteMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    // InputDocumentFileLocation
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // BotInlineMessageMediaVenue
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::GeoPoint },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // MessagesFoundGifs
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::FoundGif },
+    // PageBlockParagraph
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // DhGenRetry
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    // RecentMeUrlUnknown
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputMediaGifExternal
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // PageBlockFooter
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // MessageActionChatAddUser
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    // ReplyInlineMarkup
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::KeyboardButtonRow },
+    // EncryptedFile
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputStickeredMediaPhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::InputPhoto },
+    // UpdatesDifferenceTooLong
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputBotInlineMessageGame
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // PrivacyValueAllowUsers
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    // PaymentsPaymentResult
+    { FieldKind::Object, c_noFlag, TypeIndex::Updates },
+    // UpdateMessageID
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // PageBlockPullquote
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // InputBotInlineResultGame
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputBotInlineMessage },
+    // MessagesArchivedStickers
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::StickerSetCovered },
+    // PaymentsPaymentReceipt
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Invoice },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::PaymentRequestedInfo },
+    { FieldKind::Object, 1, TypeIndex::ShippingOption },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // PhoneCallDiscarded
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::PhoneCallDiscardReason },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    // KeyboardButtonGame
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessageActionChatMigrateTo
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // AuthSentCodeTypeCall
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PhoneCallEmpty
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // FileLocation
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // UpdateBotInlineQuery
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::GeoPoint },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionChangeAbout
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // AccountPrivacyRules
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PrivacyRule },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // PageFull
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PageBlock },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Photo },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // UpdateLangPack
+    { FieldKind::Object, c_noFlag, TypeIndex::LangPackDifference },
+    // MessagesSentEncryptedMessage
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ContactBlocked
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageMediaGeo
+    { FieldKind::Object, c_noFlag, TypeIndex::GeoPoint },
+    // CdnConfig
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::CdnPublicKey },
+    // ChannelBannedRights
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // HighScore
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputEncryptedFile
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // ChatInviteAlready
+    { FieldKind::Object, c_noFlag, TypeIndex::Chat },
+    // InputMediaDocument
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputDocument },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    // UpdateUserTyping
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::SendMessageAction },
+    // PopularContact
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesRecentStickers
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // UpdateBotPrecheckoutQuery
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::PaymentRequestedInfo },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // UpdatesDifferenceEmpty
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelAdminRights
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // AuthSentCode
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::AuthSentCodeType },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 1, TypeIndex::AuthCodeType },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    // MessageMediaContact
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // WebPage
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    { FieldKind::Object, 4, TypeIndex::Photo },
+    { FieldKind::Bytes, 5, TypeIndex::Any },
+    { FieldKind::Bytes, 5, TypeIndex::Any },
+    { FieldKind::Int, 6, TypeIndex::Any },
+    { FieldKind::Int, 6, TypeIndex::Any },
+    { FieldKind::Int, 7, TypeIndex::Any },
+    { FieldKind::Bytes, 8, TypeIndex::Any },
+    { FieldKind::Object, 9, TypeIndex::Document },
+    { FieldKind::Object, 10, TypeIndex::Page },
+    // ChannelAdminLogEventActionTogglePreHistoryHidden
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // ChatPhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::FileLocation },
+    { FieldKind::Object, c_noFlag, TypeIndex::FileLocation },
+    // UpdateNewChannelMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // DestroySessionNone
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // MsgsAck
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // WallPaperSolid
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // DocumentAttributeSticker
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputStickerSet },
+    { FieldKind::Object, 0, TypeIndex::MaskCoords },
+    // StickerSetCovered
+    { FieldKind::Object, c_noFlag, TypeIndex::StickerSet },
+    { FieldKind::Object, c_noFlag, TypeIndex::Document },
+    // InputEncryptedFileUploaded
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageEntityEmail
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesChats
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    // ClientDHInnerData
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // TextBold
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // KeyboardButtonCallback
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateNewStickerSet
+    { FieldKind::Object, c_noFlag, TypeIndex::MessagesStickerSet },
+    // UpdateReadMessagesContents
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionChangeUsername
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdatesChannelDifferenceTooLong
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // PaymentsPaymentVerficationNeeded
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // DocumentAttributeImageSize
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // TextFixed
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // LangPackStringPluralized
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    { FieldKind::Bytes, 4, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessageEntityBotCommand
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PhoneCallAccepted
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneCallProtocol },
+    // UpdateChatParticipantDelete
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateChatAdmins
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageEntityUrl
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageEntityHashtag
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionEditMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    // PageBlockTitle
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // ContactsTopPeers
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::TopPeerCategoryPeers },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateChannelAvailableMessages
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesDialogsSlice
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Dialog },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdatesCombined
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Update },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageEntityPre
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // TextPlain
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessagesMessagesNotModified
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // Updates
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Update },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageEntityTextUrl
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelFull
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Photo },
+    { FieldKind::Object, c_noFlag, TypeIndex::PeerNotifySettings },
+    { FieldKind::Object, c_noFlag, TypeIndex::ExportedChatInvite },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::BotInfo },
+    { FieldKind::Int, 4, TypeIndex::Any },
+    { FieldKind::Int, 4, TypeIndex::Any },
+    { FieldKind::Int, 5, TypeIndex::Any },
+    { FieldKind::Object, 8, TypeIndex::StickerSet },
+    { FieldKind::Int, 9, TypeIndex::Any },
+    // InputAppEvent
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // KeyboardButtonRow
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::KeyboardButton },
+    // PhotoSize
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::FileLocation },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ContactsImportedContacts
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::ImportedContact },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PopularContact },
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // CdnFileHash
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateShort
+    { FieldKind::Object, c_noFlag, TypeIndex::Update },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputPaymentCredentialsAndroidPay
+    { FieldKind::Object, c_noFlag, TypeIndex::DataJSON },
+    // ServerDHParamsFail
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    // InputMediaGeoLive
+    { FieldKind::Object, c_noFlag, TypeIndex::InputGeoPoint },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputPeerUser
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // Authorization
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // AccountPassword
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessageMediaGeoLive
+    { FieldKind::Object, c_noFlag, TypeIndex::GeoPoint },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageMediaDocument
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::Document },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    // FileLocationUnavailable
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // DataJSON
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MsgResendReq
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // TextConcat
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::RichText },
+    // ContactsResolvedPeer
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateWebPage
+    { FieldKind::Object, c_noFlag, TypeIndex::WebPage },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageActionChatEditPhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::Photo },
+    // MsgNewDetailedInfo
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputMessagesFilterPhoneCalls
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // MessageActionPhoneCall
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::PhoneCallDiscardReason },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    // UpdateUserBlocked
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // AuthCheckedPhone
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // PeerSettings
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // InputMediaPhoto
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputPhoto },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    // MessageEntityItalic
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateBotWebhookJSON
+    { FieldKind::Object, c_noFlag, TypeIndex::DataJSON },
+    // PhoneCallRequested
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneCallProtocol },
+    // PQInnerData
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int256, c_noFlag, TypeIndex::Any },
+    // MessageEmpty
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageMediaInvoice
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::WebDocument },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessagesAffectedMessages
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputStickerSetShortName
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // AccountPasswordInputSettings
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    // Document
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PhotoSize },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DocumentAttribute },
+    // InputBotInlineMessageID
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // InputChatPhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::InputPhoto },
+    // HelpAppUpdate
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateChannelReadMessagesContents
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    // MessagesStickers
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // MessagesMessages
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // BotInlineMessageText
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 1, TypeIndex::MessageEntity },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // MsgsAllInfo
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // RecentMeUrlUser
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PhotosPhotos
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Photo },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // NearestDc
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PagePart
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PageBlock },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Photo },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // UpdateDcOptions
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DcOption },
+    // MessageActionPaymentSentMe
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::PaymentRequestedInfo },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PaymentCharge },
+    // PageBlockSubtitle
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // ContactsBlockedSlice
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::ContactBlocked },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // InputPrivacyValueDisallowUsers
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::InputUser },
+    // PaymentRequestedInfo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Object, 3, TypeIndex::PostAddress },
+    // Message
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 8, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Object, 2, TypeIndex::MessageFwdHeader },
+    { FieldKind::Int, 11, TypeIndex::Any },
+    { FieldKind::Int, 3, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 9, TypeIndex::MessageMedia },
+    { FieldKind::Object, 6, TypeIndex::ReplyMarkup },
+    { FieldKind::ObjectVector, 7, TypeIndex::MessageEntity },
+    { FieldKind::Int, 10, TypeIndex::Any },
+    { FieldKind::Int, 15, TypeIndex::Any },
+    { FieldKind::Bytes, 16, TypeIndex::Any },
+    // UpdateShortMessage
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::MessageFwdHeader },
+    { FieldKind::Int, 11, TypeIndex::Any },
+    { FieldKind::Int, 3, TypeIndex::Any },
+    { FieldKind::ObjectVector, 7, TypeIndex::MessageEntity },
+    // InputMediaInvoice
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::InputWebDocument },
+    { FieldKind::Object, c_noFlag, TypeIndex::Invoice },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputChatUploadedPhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::InputFile },
+    // Photo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PhotoSize },
+    // HttpWait
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageActionGameScore
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesBotResults
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::InlineBotSwitchPM },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::BotInlineResult },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // MessagesSentEncryptedFile
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::EncryptedFile },
+    // UpdateUserPhoto
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::UserProfilePhoto },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // MessageActionChannelCreate
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // AccountNoPassword
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // DocumentAttributeAudio
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    // UpdateChannelPinnedMessage
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateChannelMessageViews
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // BotInfo
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::BotCommand },
+    // MessagesChannelMessages
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateReadHistoryInbox
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesHighScores
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::HighScore },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateChatUserTyping
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::SendMessageAction },
+    // PeerNotifySettings
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateBotWebhookJSONQuery
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::DataJSON },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChatEmpty
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // BotInlineResult
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    { FieldKind::Bytes, 4, TypeIndex::Any },
+    { FieldKind::Bytes, 5, TypeIndex::Any },
+    { FieldKind::Bytes, 5, TypeIndex::Any },
+    { FieldKind::Int, 6, TypeIndex::Any },
+    { FieldKind::Int, 6, TypeIndex::Any },
+    { FieldKind::Int, 7, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::BotInlineMessage },
+    // InputWebDocument
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DocumentAttribute },
+    // TextStrike
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // FoundGifCached
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Photo },
+    { FieldKind::Object, c_noFlag, TypeIndex::Document },
+    // Config
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DcOption },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DisabledFeature },
+    // MessagesChatsSlice
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    // UpdateContactLink
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ContactLink },
+    { FieldKind::Object, c_noFlag, TypeIndex::ContactLink },
+    // PhoneConnection
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // PeerUser
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputStickerSetID
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // MessageService
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 8, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Int, 3, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::MessageAction },
+    // NewSessionCreated
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // NotifyPeer
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    // RecentMeUrlChat
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ReplyKeyboardHide
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // UpdateDeleteMessages
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PhoneCallProtocol
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // KeyboardButton
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelParticipantSelf
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageMediaWebPage
+    { FieldKind::Object, c_noFlag, TypeIndex::WebPage },
+    // ReceivedNotifyMessage
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // ChannelParticipantsKicked
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // RpcAnswerDropped
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdatesState
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageActionChatCreate
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    // DhGenFail
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    // InputMediaContact
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateUserName
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // BadMsgNotification
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelParticipantAdmin
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelAdminRights },
+    // InputBotInlineResultPhoto
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputPhoto },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputBotInlineMessage },
+    // UpdatesDifferenceSlice
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Message },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::EncryptedMessage },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Update },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    { FieldKind::Object, c_noFlag, TypeIndex::UpdatesState },
+    // UploadCdnFile
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // SendMessageUploadDocumentAction
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputBotInlineMessageMediaVenue
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputGeoPoint },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // AuthSentCodeTypeFlashCall
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdatePhoneCall
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneCall },
+    // EncryptedChatEmpty
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // FutureSalts
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::FutureSalt },
+    // DisabledFeature
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MaskCoords
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    // KeyboardButtonBuy
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputChannel
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // MessageActionChannelMigrateFrom
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // KeyboardButtonRequestPhone
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionChangeStickerSet
+    { FieldKind::Object, c_noFlag, TypeIndex::InputStickerSet },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputStickerSet },
+    // MessageActionChatDeleteUser
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesAffectedHistory
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateEncryption
+    { FieldKind::Object, c_noFlag, TypeIndex::EncryptedChat },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageMediaPhoto
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::Photo },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    // ServerDHInnerData
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageActionChatEditTitle
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessagesStickerSet
+    { FieldKind::Object, c_noFlag, TypeIndex::StickerSet },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::StickerPack },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // ShippingOption
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::LabeledPrice },
+    // UpdateChatParticipantAdmin
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateChannel
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputMediaDocumentExternal
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    // BotInlineMessageMediaGeo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::GeoPoint },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // AccountPasswordSettings
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionChangePhoto
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatPhoto },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatPhoto },
+    // InputNotifyPeer
+    { FieldKind::Object, c_noFlag, TypeIndex::InputPeer },
+    // AccountDaysTTL
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PageBlockAuthorDate
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PeerChat
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageEntityUnknown
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // RecentMeUrlStickerSet
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::StickerSetCovered },
+    // MessageEntityBold
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PeerChannel
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // Game
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Photo },
+    { FieldKind::Object, 0, TypeIndex::Document },
+    // UpdateNotifySettings
+    { FieldKind::Object, c_noFlag, TypeIndex::NotifyPeer },
+    { FieldKind::Object, c_noFlag, TypeIndex::PeerNotifySettings },
+    // PageBlockHeader
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // AuthSentCodeTypeSms
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PageBlockPreformatted
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // MessagesDhConfigNotModified
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputPaymentCredentialsSaved
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // TextUnderline
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // InputMediaVenue
+    { FieldKind::Object, c_noFlag, TypeIndex::InputGeoPoint },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputBotInlineMessageMediaGeo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputGeoPoint },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 2, TypeIndex::ReplyMarkup },
+    // InputWebFileLocation
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // BotCommand
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // Invoice
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::LabeledPrice },
+    // InputGameShortName
+    { FieldKind::Object, c_noFlag, TypeIndex::InputUser },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateDeleteChannelMessages
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::IntVector, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // Error
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // WebPagePending
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // WebDocument
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DocumentAttribute },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // EncryptedChatRequested
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChatParticipant
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // CdnPublicKey
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // LangPackString
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // LabeledPrice
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // WallPaper
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PhotoSize },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // AuthAuthorization
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::User },
+    // StickerSet
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelMessagesFilter
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::MessageRange },
+    // PaymentSavedCredentialsCard
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // PageBlockEmbed
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Long, 4, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // PageBlockAnchor
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ImportedContact
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // ChannelsChannelParticipant
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelParticipant },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // ServerDHParamsOk
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int128, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // PaymentsValidatedRequestedInfo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::ObjectVector, 1, TypeIndex::ShippingOption },
+    // SendMessageUploadPhotoAction
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputMediaGame
+    { FieldKind::Object, c_noFlag, TypeIndex::InputGame },
+    // ContactStatus
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::UserStatus },
+    // IpPort
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UserProfilePhoto
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::FileLocation },
+    { FieldKind::Object, c_noFlag, TypeIndex::FileLocation },
+    // ChannelAdminLogEventActionParticipantToggleAdmin
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelParticipant },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelParticipant },
+    // UpdateDialogPinned
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    // InputUser
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // UpdatePinnedDialogs
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 0, TypeIndex::Peer },
+    // TextItalic
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // Chat
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatPhoto },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 6, TypeIndex::InputChannel },
+    // HelpConfigSimple
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::IpPort },
+    // PageBlockVideo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // ChatParticipantCreator
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MsgsStateReq
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // AccountTmpPassword
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChatInvite
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatPhoto },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 4, TypeIndex::User },
+    // TextEmail
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // AuthExportedAuthorization
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateBotShippingQuery
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PostAddress },
+    // InputReportReasonOther
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // DestroySessionOk
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // ChatParticipantAdmin
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventActionParticipantInvite
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelParticipant },
+    // InputMediaUploadedDocument
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputFile },
+    { FieldKind::Object, 2, TypeIndex::InputFile },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::DocumentAttribute },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 0, TypeIndex::InputDocument },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    // ChannelParticipantCreator
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UpdateEditMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // Dialog
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PeerNotifySettings },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    { FieldKind::Object, 1, TypeIndex::DraftMessage },
+    // MessagesChatFull
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatFull },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // ChannelAdminLogEventActionParticipantToggleBan
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelParticipant },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChannelParticipant },
+    // ChannelAdminLogEventActionChangeTitle
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // UpdateBotCallbackQuery
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    // SendMessageUploadVideoAction
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // PhotoCachedSize
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::FileLocation },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // PageBlockPhoto
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // ChannelAdminLogEventActionUpdatePinned
+    { FieldKind::Object, c_noFlag, TypeIndex::Message },
+    // PaymentCharge
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelAdminLogEventsFilter
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // UpdateChatParticipantAdd
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // UploadFileCdnRedirect
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::CdnFileHash },
+    // ContactsContacts
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Contact },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // UpdateChannelTooLong
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    // WebPageEmpty
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // RecentMeUrlChatInvite
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::ChatInvite },
+    // UpdateServiceNotification
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::MessageMedia },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::MessageEntity },
+    // PhonePhoneCall
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneCall },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // EncryptedMessage
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::EncryptedFile },
+    // ChannelsAdminLogResults
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::ChannelAdminLogEvent },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Chat },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // BadServerSalt
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // UserStatusOnline
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // TopPeer
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    // MessagesAllStickers
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::StickerSet },
+    // UpdateDraftMessage
+    { FieldKind::Object, c_noFlag, TypeIndex::Peer },
+    { FieldKind::Object, c_noFlag, TypeIndex::DraftMessage },
+    // UpdatePrivacy
+    { FieldKind::Object, c_noFlag, TypeIndex::PrivacyKey },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PrivacyRule },
+    // UploadCdnFileReuploadNeeded
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // PageBlockChannel
+    { FieldKind::Object, c_noFlag, TypeIndex::Chat },
+    // PageBlockSubheader
+    { FieldKind::Object, c_noFlag, TypeIndex::RichText },
+    // InputEncryptedChat
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // HelpTermsOfService
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // SendMessageUploadAudioAction
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesFavedStickers
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::StickerPack },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::Document },
+    // LangPackDifference
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::LangPackString },
+    // InputPhoneContact
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // InputGeoPoint
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    { FieldKind::Double, c_noFlag, TypeIndex::Any },
+    // ReplyKeyboardForceReply
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    // InputEncryptedFileLocation
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // InputFile
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChannelsChannelParticipants
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::ChannelParticipant },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::User },
+    // MessageActionChatJoinedByLink
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessagesFeaturedStickers
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::StickerSetCovered },
+    { FieldKind::LongVector, c_noFlag, TypeIndex::Any },
+    // Contact
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bool, c_noFlag, TypeIndex::Any },
+    // InputMediaGeoPoint
+    { FieldKind::Object, c_noFlag, TypeIndex::InputGeoPoint },
+    // UpdateInlineBotCallbackQuery
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputBotInlineMessageID },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 0, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    // MessageEntityMention
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputFileBig
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // EncryptedChat
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // MessageFwdHeader
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 1, TypeIndex::Any },
+    { FieldKind::Int, 2, TypeIndex::Any },
+    { FieldKind::Bytes, 3, TypeIndex::Any },
+    // MessageActionCustomAction
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // TopPeerCategoryPeers
+    { FieldKind::Object, c_noFlag, TypeIndex::TopPeerCategory },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::TopPeer },
+    // PaymentsSavedInfo
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::PaymentRequestedInfo },
+    // InputPhoto
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    // ChatInviteExported
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // KeyboardButtonRequestGeoLocation
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    // ChatParticipantsForbidden
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::ChatParticipant },
+    // DraftMessage
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, 0, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::ObjectVector, 3, TypeIndex::MessageEntity },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // MessageMediaGame
+    { FieldKind::Object, c_noFlag, TypeIndex::Game },
+    // InputStickerSetItem
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputDocument },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, 0, TypeIndex::MaskCoords },
+    // PhoneCall
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Long, c_noFlag, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneCallProtocol },
+    { FieldKind::Object, c_noFlag, TypeIndex::PhoneConnection },
+    { FieldKind::ObjectVector, c_noFlag, TypeIndex::PhoneConnection },
+    { FieldKind::Int, c_noFlag, TypeIndex::Any },
+    // InputBotInlineResultDocument
+    { FieldKind::Flags, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, c_noFlag, TypeIndex::Any },
+    { FieldKind::Bytes, 1, TypeIndex::Any },
+    { FieldKind::Bytes, 2, TypeIndex::Any },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputDocument },
+    { FieldKind::Object, c_noFlag, TypeIndex::InputBotInlineMessage },
+    // End of generated TL schema fields
+};
+
+// The table is sorted by the constructor id (the generator takes care of it)
+constexpr ConstructorInfo c_constructors[] = {
+    // Generated TL schema constructors
+    { TLValue::StorageFileJpeg, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::UserStatusOffline, TypeIndex::UserStatus, 0, 1 },
+    { TLValue::UpdatesDifference, TypeIndex::UpdatesDifference, 1, 6 },
+    { TLValue::InputGameID, TypeIndex::InputGame, 7, 2 },
+    { TLValue::InputStickeredMediaDocument, TypeIndex::InputStickeredMedia, 9, 1 },
+    { TLValue::MsgsStateInfo, TypeIndex::MsgsStateInfo, 10, 2 },
+    { TLValue::MessagesFeaturedStickersNotModified, TypeIndex::MessagesFeaturedStickers, 0, 0 },
+    { TLValue::ResPQ, TypeIndex::ResPQ, 12, 4 },
+    { TLValue::KeyboardButtonSwitchInline, TypeIndex::KeyboardButton, 16, 3 },
+    { TLValue::DcOption, TypeIndex::DcOption, 19, 4 },
+    { TLValue::TopPeerCategoryCorrespondents, TypeIndex::TopPeerCategory, 0, 0 },
+    { TLValue::ChannelParticipantsSearch, TypeIndex::ChannelParticipantsFilter, 23, 1 },
+    { TLValue::ChatForbidden, TypeIndex::Chat, 24, 2 },
+    { TLValue::UpdateChatParticipants, TypeIndex::Update, 26, 1 },
+    { TLValue::UserStatusLastWeek, TypeIndex::UserStatus, 0, 0 },
+    { TLValue::PageBlockCollage, TypeIndex::PageBlock, 27, 2 },
+    { TLValue::InputMediaPhotoExternal, TypeIndex::InputMedia, 29, 4 },
+    { TLValue::FutureSalt, TypeIndex::FutureSalt, 33, 3 },
+    { TLValue::UploadFile, TypeIndex::UploadFile, 36, 3 },
+    { TLValue::UserStatusEmpty, TypeIndex::UserStatus, 0, 0 },
+    { TLValue::StorageFilePng, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::BotInlineMessageMediaAuto, TypeIndex::BotInlineMessage, 39, 3 },
+    { TLValue::DestroyAuthKeyNone, TypeIndex::DestroyAuthKeyRes, 0, 0 },
+    { TLValue::InputPaymentCredentialsApplePay, TypeIndex::InputPaymentCredentials, 42, 1 },
+    { TLValue::MessageRange, TypeIndex::MessageRange, 43, 2 },
+    { TLValue::MessagesRecentStickersNotModified, TypeIndex::MessagesRecentStickers, 0, 0 },
+    { TLValue::MessagesMessagesSlice, TypeIndex::MessagesMessages, 45, 4 },
+    { TLValue::InputPrivacyValueDisallowContacts, TypeIndex::InputPrivacyRule, 0, 0 },
+    { TLValue::UpdateStickerSetsOrder, TypeIndex::Update, 49, 2 },
+    { TLValue::PrivacyValueDisallowUsers, TypeIndex::PrivacyRule, 51, 1 },
+    { TLValue::Channel, TypeIndex::Chat, 52, 11 },
+    { TLValue::InputPrivacyValueAllowContacts, TypeIndex::InputPrivacyRule, 0, 0 },
+    { TLValue::HelpRecentMeUrls, TypeIndex::HelpRecentMeUrls, 63, 3 },
+    { TLValue::PhotoSizeEmpty, TypeIndex::PhotoSize, 66, 1 },
+    { TLValue::UpdateBotInlineSend, TypeIndex::Update, 67, 6 },
+    { TLValue::DocumentAttributeVideo, TypeIndex::DocumentAttribute, 73, 4 },
+    { TLValue::UserFull, TypeIndex::UserFull, 77, 8 },
+    { TLValue::StorageFileWebp, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::UpdateLangPackTooLong, TypeIndex::Update, 0, 0 },
+    { TLValue::GeoPointEmpty, TypeIndex::GeoPoint, 0, 0 },
+    { TLValue::LangPackLanguage, TypeIndex::LangPackLanguage, 85, 3 },
+    { TLValue::DocumentAttributeAnimated, TypeIndex::DocumentAttribute, 0, 0 },
+    { TLValue::UpdateShortSentMessage, TypeIndex::Updates, 88, 7 },
+    { TLValue::AccountAuthorizations, TypeIndex::AccountAuthorizations, 95, 1 },
+    { TLValue::StickerPack, TypeIndex::StickerPack, 96, 2 },
+    { TLValue::UpdateUserPhone, TypeIndex::Update, 98, 2 },
+    { TLValue::UpdateNewEncryptedMessage, TypeIndex::Update, 100, 2 },
+    { TLValue::PageBlockSlideshow, TypeIndex::PageBlock, 102, 2 },
+    { TLValue::InputPrivacyValueAllowUsers, TypeIndex::InputPrivacyRule, 104, 1 },
+    { TLValue::PageBlockUnsupported, TypeIndex::PageBlock, 0, 0 },
+    { TLValue::AuthPasswordRecovery, TypeIndex::AuthPasswordRecovery, 105, 1 },
+    { TLValue::EncryptedChatDiscarded, TypeIndex::EncryptedChat, 106, 1 },
+    { TLValue::ChannelParticipantsBanned, TypeIndex::ChannelParticipantsFilter, 107, 1 },
+    { TLValue::InputFileLocation, TypeIndex::InputFileLocation, 108, 3 },
+    { TLValue::TopPeerCategoryBotsInline, TypeIndex::TopPeerCategory, 0, 0 },
+    { TLValue::PhotosPhotosSlice, TypeIndex::PhotosPhotos, 111, 3 },
+    { TLValue::DocumentAttributeFilename, TypeIndex::DocumentAttribute, 114, 1 },
+    { TLValue::MessagesDialogs, TypeIndex::MessagesDialogs, 115, 4 },
+    { TLValue::ChannelParticipant, TypeIndex::ChannelParticipant, 119, 2 },
+    { TLValue::TopPeerCategoryChannels, TypeIndex::TopPeerCategory, 0, 0 },
+    { TLValue::FoundGif, TypeIndex::FoundGif, 121, 6 },
+    { TLValue::UpdateShortChatMessage, TypeIndex::Updates, 127, 12 },
+    { TLValue::SendMessageTypingAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::UpdateEncryptedChatTyping, TypeIndex::Update, 139, 1 },
+    { TLValue::SendMessageGeoLocationAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::InputPeerChat, TypeIndex::InputPeer, 140, 1 },
+    { TLValue::HelpSupport, TypeIndex::HelpSupport, 141, 2 },
+    { TLValue::BotInlineMediaResult, TypeIndex::BotInlineResult, 143, 8 },
+    { TLValue::ChannelAdminLogEventActionParticipantJoin, TypeIndex::ChannelAdminLogEventAction, 0, 0 },
+    { TLValue::InputEncryptedFileEmpty, TypeIndex::InputEncryptedFile, 0, 0 },
+    { TLValue::InputPrivacyValueAllowAll, TypeIndex::InputPrivacyRule, 0, 0 },
+    { TLValue::InputDocument, TypeIndex::InputDocument, 151, 2 },
+    { TLValue::HelpInviteText, TypeIndex::HelpInviteText, 153, 1 },
+    { TLValue::InputNotifyUsers, TypeIndex::InputNotifyPeer, 0, 0 },
+    { TLValue::ContactsFound, TypeIndex::ContactsFound, 154, 3 },
+    { TLValue::UpdateEditChannelMessage, TypeIndex::Update, 157, 3 },
+    { TLValue::ChannelAdminLogEventActionToggleInvites, TypeIndex::ChannelAdminLogEventAction, 160, 1 },
+    { TLValue::PhoneCallWaiting, TypeIndex::PhoneCall, 161, 8 },
+    { TLValue::UpdateUserStatus, TypeIndex::Update, 169, 2 },
+    { TLValue::ContactsBlocked, TypeIndex::ContactsBlocked, 171, 2 },
+    { TLValue::InputChatPhotoEmpty, TypeIndex::InputChatPhoto, 0, 0 },
+    { TLValue::InputPhotoEmpty, TypeIndex::InputPhoto, 0, 0 },
+    { TLValue::InputReportReasonViolence, TypeIndex::ReportReason, 0, 0 },
+    { TLValue::InputPhoneCall, TypeIndex::InputPhoneCall, 173, 2 },
+    { TLValue::TopPeerCategoryPhoneCalls, TypeIndex::TopPeerCategory, 0, 0 },
+    { TLValue::PostAddress, TypeIndex::PostAddress, 175, 6 },
+    { TLValue::UpdateNewMessage, TypeIndex::Update, 181, 3 },
+    { TLValue::ExportedMessageLink, TypeIndex::ExportedMessageLink, 184, 1 },
+    { TLValue::UserEmpty, TypeIndex::User, 185, 1 },
+    { TLValue::PhotosPhoto, TypeIndex::PhotosPhoto, 186, 2 },
+    { TLValue::GeoPoint, TypeIndex::GeoPoint, 188, 2 },
+    { TLValue::UpdatesChannelDifference, TypeIndex::UpdatesChannelDifference, 190, 7 },
+    { TLValue::InputMessageEntityMentionName, TypeIndex::MessageEntity, 197, 3 },
+    { TLValue::InputPeerChannel, TypeIndex::InputPeer, 200, 2 },
+    { TLValue::RpcError, TypeIndex::RpcError, 202, 2 },
+    { TLValue::UploadWebFile, TypeIndex::UploadWebFile, 204, 5 },
+    { TLValue::ChannelParticipantBanned, TypeIndex::ChannelParticipant, 209, 5 },
+    { TLValue::AuthCodeTypeFlashCall, TypeIndex::AuthCodeType, 0, 0 },
+    { TLValue::PhotoEmpty, TypeIndex::Photo, 214, 1 },
+    { TLValue::EncryptedMessageService, TypeIndex::EncryptedMessage, 215, 4 },
+    { TLValue::SendMessageUploadRoundAction, TypeIndex::SendMessageAction, 219, 1 },
+    { TLValue::UpdateContactRegistered, TypeIndex::Update, 220, 2 },
+    { TLValue::KeyboardButtonUrl, TypeIndex::KeyboardButton, 222, 2 },
+    { TLValue::UpdateReadChannelOutbox, TypeIndex::Update, 224, 2 },
+    { TLValue::PageBlockBlockquote, TypeIndex::PageBlock, 226, 2 },
+    { TLValue::ContactLinkHasPhone, TypeIndex::ContactLink, 0, 0 },
+    { TLValue::ChannelAdminLogEventActionToggleSignatures, TypeIndex::ChannelAdminLogEventAction, 228, 1 },
+    { TLValue::MessagesMessageEditData, TypeIndex::MessagesMessageEditData, 229, 1 },
+    { TLValue::MsgDetailedInfo, TypeIndex::MsgDetailedInfo, 230, 4 },
+    { TLValue::ChannelForbidden, TypeIndex::Chat, 234, 5 },
+    { TLValue::MessageEntityCode, TypeIndex::MessageEntity, 239, 2 },
+    { TLValue::PageBlockEmbedPost, TypeIndex::PageBlock, 241, 7 },
+    { TLValue::InputBotInlineMessageMediaAuto, TypeIndex::InputBotInlineMessage, 248, 3 },
+    { TLValue::LangPackStringDeleted, TypeIndex::LangPackString, 251, 1 },
+    { TLValue::MessagesDhConfig, TypeIndex::MessagesDhConfig, 252, 4 },
+    { TLValue::InputBotInlineResult, TypeIndex::InputBotInlineResult, 256, 13 },
+    { TLValue::InputBotInlineMessageMediaContact, TypeIndex::InputBotInlineMessage, 269, 5 },
+    { TLValue::InputEncryptedFileBigUploaded, TypeIndex::InputEncryptedFile, 274, 3 },
+    { TLValue::ChatFull, TypeIndex::ChatFull, 277, 6 },
+    { TLValue::MessagesSavedGifs, TypeIndex::MessagesSavedGifs, 283, 2 },
+    { TLValue::User, TypeIndex::User, 285, 13 },
+    { TLValue::InputReportReasonPornography, TypeIndex::ReportReason, 0, 0 },
+    { TLValue::MessageMediaVenue, TypeIndex::MessageMedia, 298, 6 },
+    { TLValue::UpdateReadHistoryOutbox, TypeIndex::Update, 304, 4 },
+    { TLValue::InputMediaUploadedPhoto, TypeIndex::InputMedia, 308, 5 },
+    { TLValue::PageBlockAudio, TypeIndex::PageBlock, 313, 2 },
+    { TLValue::UpdatePtsChanged, TypeIndex::Update, 0, 0 },
+    { TLValue::MessagesPeerDialogs, TypeIndex::MessagesPeerDialogs, 315, 5 },
+    { TLValue::StickerSetMultiCovered, TypeIndex::StickerSetCovered, 320, 2 },
+    { TLValue::InputPaymentCredentials, TypeIndex::InputPaymentCredentials, 322, 2 },
+    { TLValue::Pong, TypeIndex::Pong, 324, 2 },
+    { TLValue::ReplyKeyboardMarkup, TypeIndex::ReplyMarkup, 326, 2 },
+    { TLValue::MessageEntityMentionName, TypeIndex::MessageEntity, 328, 3 },
+    { TLValue::MessagesStickerSetInstallResultArchive, TypeIndex::MessagesStickerSetInstallResult, 331, 1 },
+    { TLValue::BotInlineMessageMediaContact, TypeIndex::BotInlineMessage, 332, 5 },
+    { TLValue::MessagesBotCallbackAnswer, TypeIndex::MessagesBotCallbackAnswer, 337, 4 },
+    { TLValue::DocumentEmpty, TypeIndex::Document, 341, 1 },
+    { TLValue::InputMessagesFilterMusic, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::ChatPhotoEmpty, TypeIndex::ChatPhoto, 0, 0 },
+    { TLValue::MessagesStickerSetInstallResultSuccess, TypeIndex::MessagesStickerSetInstallResult, 0, 0 },
+    { TLValue::InputPeerNotifySettings, TypeIndex::InputPeerNotifySettings, 342, 3 },
+    { TLValue::UpdateEncryptedMessagesRead, TypeIndex::Update, 345, 3 },
+    { TLValue::PageBlockCover, TypeIndex::PageBlock, 348, 1 },
+    { TLValue::InputMessagesFilterChatPhotos, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::PageBlockList, TypeIndex::PageBlock, 349, 2 },
+    { TLValue::ContactsLink, TypeIndex::ContactsLink, 351, 3 },
+    { TLValue::ChannelAdminLogEvent, TypeIndex::ChannelAdminLogEvent, 354, 4 },
+    { TLValue::DhGenOk, TypeIndex::SetClientDHParamsAnswer, 358, 3 },
+    { TLValue::EncryptedChatWaiting, TypeIndex::EncryptedChat, 361, 5 },
+    { TLValue::InlineBotSwitchPM, TypeIndex::InlineBotSwitchPM, 366, 2 },
+    { TLValue::TextUrl, TypeIndex::RichText, 368, 3 },
+    { TLValue::PrivacyKeyPhoneCall, TypeIndex::PrivacyKey, 0, 0 },
+    { TLValue::AuthSentCodeTypeApp, TypeIndex::AuthSentCodeType, 371, 1 },
+    { TLValue::InputBotInlineMessageText, TypeIndex::InputBotInlineMessage, 372, 4 },
+    { TLValue::MessageMediaEmpty, TypeIndex::MessageMedia, 0, 0 },
+    { TLValue::UpdatesChannelDifferenceEmpty, TypeIndex::UpdatesChannelDifference, 376, 3 },
+    { TLValue::ChatParticipants, TypeIndex::ChatParticipants, 379, 3 },
+    { TLValue::PaymentsPaymentForm, TypeIndex::PaymentsPaymentForm, 382, 10 },
+    { TLValue::MessageActionPaymentSent, TypeIndex::MessageAction, 392, 2 },
+    { TLValue::UpdateChannelWebPage, TypeIndex::Update, 394, 4 },
+    { TLValue::StorageFilePartial, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::UpdateReadChannelInbox, TypeIndex::Update, 398, 2 },
+    { TLValue::ChannelAdminLogEventActionDeleteMessage, TypeIndex::ChannelAdminLogEventAction, 400, 1 },
+    { TLValue::InputDocumentFileLocation, TypeIndex::InputFileLocation, 401, 3 },
+    { TLValue::BotInlineMessageMediaVenue, TypeIndex::BotInlineMessage, 404, 7 },
+    { TLValue::UpdateStickerSets, TypeIndex::Update, 0, 0 },
+    { TLValue::MessagesFoundGifs, TypeIndex::MessagesFoundGifs, 411, 2 },
+    { TLValue::PageBlockParagraph, TypeIndex::PageBlock, 413, 1 },
+    { TLValue::DhGenRetry, TypeIndex::SetClientDHParamsAnswer, 414, 3 },
+    { TLValue::RecentMeUrlUnknown, TypeIndex::RecentMeUrl, 417, 1 },
+    { TLValue::MessageActionScreenshotTaken, TypeIndex::MessageAction, 0, 0 },
+    { TLValue::InputMediaGifExternal, TypeIndex::InputMedia, 418, 2 },
+    { TLValue::PageBlockFooter, TypeIndex::PageBlock, 420, 1 },
+    { TLValue::MessageActionChatAddUser, TypeIndex::MessageAction, 421, 1 },
+    { TLValue::ReplyInlineMarkup, TypeIndex::ReplyMarkup, 422, 1 },
+    { TLValue::EncryptedFile, TypeIndex::EncryptedFile, 423, 5 },
+    { TLValue::InputNotifyChats, TypeIndex::InputNotifyPeer, 0, 0 },
+    { TLValue::InputStickeredMediaPhoto, TypeIndex::InputStickeredMedia, 428, 1 },
+    { TLValue::UpdatesDifferenceTooLong, TypeIndex::UpdatesDifference, 429, 1 },
+    { TLValue::StorageFileMov, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::InputBotInlineMessageGame, TypeIndex::InputBotInlineMessage, 430, 2 },
+    { TLValue::PrivacyValueAllowUsers, TypeIndex::PrivacyRule, 432, 1 },
+    { TLValue::PaymentsPaymentResult, TypeIndex::PaymentsPaymentResult, 433, 1 },
+    { TLValue::UpdateMessageID, TypeIndex::Update, 434, 2 },
+    { TLValue::UserProfilePhotoEmpty, TypeIndex::UserProfilePhoto, 0, 0 },
+    { TLValue::PageBlockPullquote, TypeIndex::PageBlock, 436, 2 },
+    { TLValue::InputPrivacyKeyStatusTimestamp, TypeIndex::InputPrivacyKey, 0, 0 },
+    { TLValue::InputBotInlineResultGame, TypeIndex::InputBotInlineResult, 438, 3 },
+    { TLValue::MessagesArchivedStickers, TypeIndex::MessagesArchivedStickers, 441, 2 },
+    { TLValue::PaymentsPaymentReceipt, TypeIndex::PaymentsPaymentReceipt, 443, 11 },
+    { TLValue::PrivacyKeyChatInvite, TypeIndex::PrivacyKey, 0, 0 },
+    { TLValue::PhoneCallDiscarded, TypeIndex::PhoneCall, 454, 4 },
+    { TLValue::KeyboardButtonGame, TypeIndex::KeyboardButton, 458, 1 },
+    { TLValue::InputMessagesFilterVoice, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::MessageActionChatMigrateTo, TypeIndex::MessageAction, 459, 1 },
+    { TLValue::StorageFileMp3, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::AuthSentCodeTypeCall, TypeIndex::AuthSentCodeType, 460, 1 },
+    { TLValue::PhoneCallEmpty, TypeIndex::PhoneCall, 461, 1 },
+    { TLValue::FileLocation, TypeIndex::FileLocation, 462, 4 },
+    { TLValue::UpdateBotInlineQuery, TypeIndex::Update, 466, 6 },
+    { TLValue::ChannelAdminLogEventActionChangeAbout, TypeIndex::ChannelAdminLogEventAction, 472, 2 },
+    { TLValue::AccountPrivacyRules, TypeIndex::AccountPrivacyRules, 474, 2 },
+    { TLValue::PageFull, TypeIndex::Page, 476, 3 },
+    { TLValue::UpdateLangPack, TypeIndex::Update, 479, 1 },
+    { TLValue::MessagesSentEncryptedMessage, TypeIndex::MessagesSentEncryptedMessage, 480, 1 },
+    { TLValue::ContactBlocked, TypeIndex::ContactBlocked, 481, 2 },
+    { TLValue::MessageMediaGeo, TypeIndex::MessageMedia, 483, 1 },
+    { TLValue::InputMessagesFilterPhotoVideo, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::UpdateReadFeaturedStickers, TypeIndex::Update, 0, 0 },
+    { TLValue::CdnConfig, TypeIndex::CdnConfig, 484, 1 },
+    { TLValue::PhoneCallDiscardReasonHangup, TypeIndex::PhoneCallDiscardReason, 0, 0 },
+    { TLValue::InputMessagesFilterEmpty, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::ChannelBannedRights, TypeIndex::ChannelBannedRights, 485, 2 },
+    { TLValue::InputReportReasonSpam, TypeIndex::ReportReason, 0, 0 },
+    { TLValue::HighScore, TypeIndex::HighScore, 487, 3 },
+    { TLValue::InputEncryptedFile, TypeIndex::InputEncryptedFile, 490, 2 },
+    { TLValue::ChatInviteAlready, TypeIndex::ChatInvite, 492, 1 },
+    { TLValue::InputMediaDocument, TypeIndex::InputMedia, 493, 4 },
+    { TLValue::UpdateUserTyping, TypeIndex::Update, 497, 2 },
+    { TLValue::PopularContact, TypeIndex::PopularContact, 499, 2 },
+    { TLValue::MessagesRecentStickers, TypeIndex::MessagesRecentStickers, 501, 2 },
+    { TLValue::UpdateBotPrecheckoutQuery, TypeIndex::Update, 503, 8 },
+    { TLValue::UpdatesDifferenceEmpty, TypeIndex::UpdatesDifference, 511, 2 },
+    { TLValue::ChannelAdminRights, TypeIndex::ChannelAdminRights, 513, 1 },
+    { TLValue::AuthSentCode, TypeIndex::AuthSentCode, 514, 5 },
+    { TLValue::RpcAnswerUnknown, TypeIndex::RpcDropAnswer, 0, 0 },
+    { TLValue::MessageMediaContact, TypeIndex::MessageMedia, 519, 4 },
+    { TLValue::WebPage, TypeIndex::WebPage, 523, 18 },
+    { TLValue::ContactLinkUnknown, TypeIndex::ContactLink, 0, 0 },
+    { TLValue::ChannelAdminLogEventActionTogglePreHistoryHidden, TypeIndex::ChannelAdminLogEventAction, 541, 1 },
+    { TLValue::ChatPhoto, TypeIndex::ChatPhoto, 542, 2 },
+    { TLValue::SendMessageChooseContactAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::UpdateNewChannelMessage, TypeIndex::Update, 544, 3 },
+    { TLValue::DestroySessionNone, TypeIndex::DestroySessionRes, 547, 1 },
+    { TLValue::MsgsAck, TypeIndex::MsgsAck, 548, 1 },
+    { TLValue::WallPaperSolid, TypeIndex::WallPaper, 549, 4 },
+    { TLValue::DocumentAttributeSticker, TypeIndex::DocumentAttribute, 553, 4 },
+    { TLValue::StickerSetCovered, TypeIndex::StickerSetCovered, 557, 2 },
+    { TLValue::InputEncryptedFileUploaded, TypeIndex::InputEncryptedFile, 559, 4 },
+    { TLValue::MessageEntityEmail, TypeIndex::MessageEntity, 563, 2 },
+    { TLValue::MessagesChats, TypeIndex::MessagesChats, 565, 1 },
+    { TLValue::PrivacyValueAllowAll, TypeIndex::PrivacyRule, 0, 0 },
+    { TLValue::ClientDHInnerData, TypeIndex::ClientDHInnerData, 566, 4 },
+    { TLValue::TextBold, TypeIndex::RichText, 570, 1 },
+    { TLValue::KeyboardButtonCallback, TypeIndex::KeyboardButton, 571, 2 },
+    { TLValue::UpdateNewStickerSet, TypeIndex::Update, 573, 1 },
+    { TLValue::UpdateReadMessagesContents, TypeIndex::Update, 574, 3 },
+    { TLValue::ChatInviteEmpty, TypeIndex::ExportedChatInvite, 0, 0 },
+    { TLValue::ChannelAdminLogEventActionChangeUsername, TypeIndex::ChannelAdminLogEventAction, 577, 2 },
+    { TLValue::UpdatesChannelDifferenceTooLong, TypeIndex::UpdatesChannelDifference, 579, 11 },
+    { TLValue::PaymentsPaymentVerficationNeeded, TypeIndex::PaymentsPaymentResult, 590, 1 },
+    { TLValue::DocumentAttributeImageSize, TypeIndex::DocumentAttribute, 591, 2 },
+    { TLValue::TextFixed, TypeIndex::RichText, 593, 1 },
+    { TLValue::LangPackStringPluralized, TypeIndex::LangPackString, 594, 8 },
+    { TLValue::MessageEntityBotCommand, TypeIndex::MessageEntity, 602, 2 },
+    { TLValue::PhoneCallAccepted, TypeIndex::PhoneCall, 604, 7 },
+    { TLValue::PeerNotifyEventsAll, TypeIndex::PeerNotifyEvents, 0, 0 },
+    { TLValue::UpdateChatParticipantDelete, TypeIndex::Update, 611, 3 },
+    { TLValue::UpdateChatAdmins, TypeIndex::Update, 614, 3 },
+    { TLValue::MessageEntityUrl, TypeIndex::MessageEntity, 617, 2 },
+    { TLValue::MessageEntityHashtag, TypeIndex::MessageEntity, 619, 2 },
+    { TLValue::UpdateContactsReset, TypeIndex::Update, 0, 0 },
+    { TLValue::ChannelAdminLogEventActionEditMessage, TypeIndex::ChannelAdminLogEventAction, 621, 2 },
+    { TLValue::PeerNotifySettingsEmpty, TypeIndex::PeerNotifySettings, 0, 0 },
+    { TLValue::PageBlockTitle, TypeIndex::PageBlock, 623, 1 },
+    { TLValue::ContactsTopPeers, TypeIndex::ContactsTopPeers, 624, 3 },
+    { TLValue::UpdateChannelAvailableMessages, TypeIndex::Update, 627, 2 },
+    { TLValue::MessagesDialogsSlice, TypeIndex::MessagesDialogs, 629, 5 },
+    { TLValue::UpdatesCombined, TypeIndex::Updates, 634, 6 },
+    { TLValue::AuthCodeTypeSms, TypeIndex::AuthCodeType, 0, 0 },
+    { TLValue::InputDocumentEmpty, TypeIndex::InputDocument, 0, 0 },
+    { TLValue::MessageEntityPre, TypeIndex::MessageEntity, 640, 3 },
+    { TLValue::AuthCodeTypeCall, TypeIndex::AuthCodeType, 0, 0 },
+    { TLValue::TextPlain, TypeIndex::RichText, 643, 1 },
+    { TLValue::MessagesMessagesNotModified, TypeIndex::MessagesMessages, 644, 1 },
+    { TLValue::Updates, TypeIndex::Updates, 645, 5 },
+    { TLValue::NotifyAll, TypeIndex::NotifyPeer, 0, 0 },
+    { TLValue::MessageEntityTextUrl, TypeIndex::MessageEntity, 650, 3 },
+    { TLValue::ChannelFull, TypeIndex::ChatFull, 653, 19 },
+    { TLValue::InputAppEvent, TypeIndex::InputAppEvent, 672, 4 },
+    { TLValue::KeyboardButtonRow, TypeIndex::KeyboardButtonRow, 676, 1 },
+    { TLValue::PhotoSize, TypeIndex::PhotoSize, 677, 5 },
+    { TLValue::ContactsImportedContacts, TypeIndex::ContactsImportedContacts, 682, 4 },
+    { TLValue::UserStatusLastMonth, TypeIndex::UserStatus, 0, 0 },
+    { TLValue::CdnFileHash, TypeIndex::CdnFileHash, 686, 3 },
+    { TLValue::UpdateShort, TypeIndex::Updates, 689, 2 },
+    { TLValue::InputPaymentCredentialsAndroidPay, TypeIndex::InputPaymentCredentials, 691, 1 },
+    { TLValue::ServerDHParamsFail, TypeIndex::ServerDHParams, 692, 3 },
+    { TLValue::InputMessagesFilterRoundVoice, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::InputMediaGeoLive, TypeIndex::InputMedia, 695, 2 },
+    { TLValue::InputPeerUser, TypeIndex::InputPeer, 697, 2 },
+    { TLValue::Authorization, TypeIndex::Authorization, 699, 13 },
+    { TLValue::AccountPassword, TypeIndex::AccountPassword, 712, 5 },
+    { TLValue::MessageMediaGeoLive, TypeIndex::MessageMedia, 717, 2 },
+    { TLValue::MessageMediaDocument, TypeIndex::MessageMedia, 719, 4 },
+    { TLValue::FileLocationUnavailable, TypeIndex::FileLocation, 723, 3 },
+    { TLValue::DataJSON, TypeIndex::DataJSON, 726, 1 },
+    { TLValue::MsgResendReq, TypeIndex::MsgResendReq, 727, 1 },
+    { TLValue::InputPeerSelf, TypeIndex::InputPeer, 0, 0 },
+    { TLValue::TextConcat, TypeIndex::RichText, 728, 1 },
+    { TLValue::InputMessagesFilterUrl, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::ContactsResolvedPeer, TypeIndex::ContactsResolvedPeer, 729, 3 },
+    { TLValue::InputPeerEmpty, TypeIndex::InputPeer, 0, 0 },
+    { TLValue::UpdateWebPage, TypeIndex::Update, 732, 3 },
+    { TLValue::MessageActionChatEditPhoto, TypeIndex::MessageAction, 735, 1 },
+    { TLValue::MsgNewDetailedInfo, TypeIndex::MsgDetailedInfo, 736, 3 },
+    { TLValue::InputMessagesFilterPhoneCalls, TypeIndex::MessagesFilter, 739, 1 },
+    { TLValue::MessageActionPhoneCall, TypeIndex::MessageAction, 740, 4 },
+    { TLValue::UpdateUserBlocked, TypeIndex::Update, 744, 2 },
+    { TLValue::AuthCheckedPhone, TypeIndex::AuthCheckedPhone, 746, 1 },
+    { TLValue::PeerSettings, TypeIndex::PeerSettings, 747, 1 },
+    { TLValue::InputMediaPhoto, TypeIndex::InputMedia, 748, 4 },
+    { TLValue::MessageEntityItalic, TypeIndex::MessageEntity, 752, 2 },
+    { TLValue::UpdateBotWebhookJSON, TypeIndex::Update, 754, 1 },
+    { TLValue::PhoneCallRequested, TypeIndex::PhoneCall, 755, 7 },
+    { TLValue::PQInnerData, TypeIndex::PQInnerData, 762, 6 },
+    { TLValue::MessageEmpty, TypeIndex::Message, 768, 1 },
+    { TLValue::MessageMediaInvoice, TypeIndex::MessageMedia, 769, 8 },
+    { TLValue::MessagesAffectedMessages, TypeIndex::MessagesAffectedMessages, 777, 2 },
+    { TLValue::WebPageNotModified, TypeIndex::WebPage, 0, 0 },
+    { TLValue::PhoneCallDiscardReasonMissed, TypeIndex::PhoneCallDiscardReason, 0, 0 },
+    { TLValue::InputStickerSetShortName, TypeIndex::InputStickerSet, 779, 1 },
+    { TLValue::AccountPasswordInputSettings, TypeIndex::AccountPasswordInputSettings, 780, 5 },
+    { TLValue::Document, TypeIndex::Document, 785, 9 },
+    { TLValue::SendMessageRecordRoundAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::InputBotInlineMessageID, TypeIndex::InputBotInlineMessageID, 794, 3 },
+    { TLValue::InputChatPhoto, TypeIndex::InputChatPhoto, 797, 1 },
+    { TLValue::HelpAppUpdate, TypeIndex::HelpAppUpdate, 798, 4 },
+    { TLValue::UpdateChannelReadMessagesContents, TypeIndex::Update, 802, 2 },
+    { TLValue::MessagesStickers, TypeIndex::MessagesStickers, 804, 2 },
+    { TLValue::PrivacyValueDisallowAll, TypeIndex::PrivacyRule, 0, 0 },
+    { TLValue::MessagesMessages, TypeIndex::MessagesMessages, 806, 3 },
+    { TLValue::BotInlineMessageText, TypeIndex::BotInlineMessage, 809, 4 },
+    { TLValue::MsgsAllInfo, TypeIndex::MsgsAllInfo, 813, 2 },
+    { TLValue::RecentMeUrlUser, TypeIndex::RecentMeUrl, 815, 2 },
+    { TLValue::PhotosPhotos, TypeIndex::PhotosPhotos, 817, 2 },
+    { TLValue::NearestDc, TypeIndex::NearestDc, 819, 3 },
+    { TLValue::PagePart, TypeIndex::Page, 822, 3 },
+    { TLValue::UpdateDcOptions, TypeIndex::Update, 825, 1 },
+    { TLValue::MessageActionPaymentSentMe, TypeIndex::MessageAction, 826, 7 },
+    { TLValue::PageBlockSubtitle, TypeIndex::PageBlock, 833, 1 },
+    { TLValue::ContactsBlockedSlice, TypeIndex::ContactsBlocked, 834, 3 },
+    { TLValue::InputPrivacyValueDisallowUsers, TypeIndex::InputPrivacyRule, 837, 1 },
+    { TLValue::PaymentRequestedInfo, TypeIndex::PaymentRequestedInfo, 838, 5 },
+    { TLValue::Message, TypeIndex::Message, 843, 15 },
+    { TLValue::UpdateShortMessage, TypeIndex::Updates, 858, 11 },
+    { TLValue::InputMediaInvoice, TypeIndex::InputMedia, 869, 8 },
+    { TLValue::InputChatUploadedPhoto, TypeIndex::InputChatPhoto, 877, 1 },
+    { TLValue::Photo, TypeIndex::Photo, 878, 5 },
+    { TLValue::HttpWait, TypeIndex::HttpWait, 883, 3 },
+    { TLValue::MessageActionGameScore, TypeIndex::MessageAction, 886, 2 },
+    { TLValue::UpdateSavedGifs, TypeIndex::Update, 0, 0 },
+    { TLValue::MessagesBotResults, TypeIndex::MessagesBotResults, 888, 7 },
+    { TLValue::MessagesSentEncryptedFile, TypeIndex::MessagesSentEncryptedMessage, 895, 2 },
+    { TLValue::MessageActionPinMessage, TypeIndex::MessageAction, 0, 0 },
+    { TLValue::ChannelMessagesFilterEmpty, TypeIndex::ChannelMessagesFilter, 0, 0 },
+    { TLValue::UpdateUserPhoto, TypeIndex::Update, 897, 4 },
+    { TLValue::MessageActionChannelCreate, TypeIndex::MessageAction, 901, 1 },
+    { TLValue::MessageActionChatDeletePhoto, TypeIndex::MessageAction, 0, 0 },
+    { TLValue::InputMessagesFilterPhotos, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::InputMediaEmpty, TypeIndex::InputMedia, 0, 0 },
+    { TLValue::AccountNoPassword, TypeIndex::AccountPassword, 902, 2 },
+    { TLValue::DocumentAttributeHasStickers, TypeIndex::DocumentAttribute, 0, 0 },
+    { TLValue::DocumentAttributeAudio, TypeIndex::DocumentAttribute, 904, 5 },
+    { TLValue::UpdateChannelPinnedMessage, TypeIndex::Update, 909, 2 },
+    { TLValue::UpdateChannelMessageViews, TypeIndex::Update, 911, 3 },
+    { TLValue::BotInfo, TypeIndex::BotInfo, 914, 3 },
+    { TLValue::MessagesChannelMessages, TypeIndex::MessagesMessages, 917, 6 },
+    { TLValue::UpdateReadHistoryInbox, TypeIndex::Update, 923, 4 },
+    { TLValue::MessagesHighScores, TypeIndex::MessagesHighScores, 927, 2 },
+    { TLValue::UpdateRecentStickers, TypeIndex::Update, 0, 0 },
+    { TLValue::UpdateChatUserTyping, TypeIndex::Update, 929, 3 },
+    { TLValue::PeerNotifySettings, TypeIndex::PeerNotifySettings, 932, 3 },
+    { TLValue::UpdateBotWebhookJSONQuery, TypeIndex::Update, 935, 3 },
+    { TLValue::ChatEmpty, TypeIndex::Chat, 938, 1 },
+    { TLValue::BotInlineResult, TypeIndex::BotInlineResult, 939, 13 },
+    { TLValue::InputWebDocument, TypeIndex::InputWebDocument, 952, 4 },
+    { TLValue::TextStrike, TypeIndex::RichText, 956, 1 },
+    { TLValue::FoundGifCached, TypeIndex::FoundGif, 957, 3 },
+    { TLValue::Config, TypeIndex::Config, 960, 34 },
+    { TLValue::MessagesChatsSlice, TypeIndex::MessagesChats, 994, 2 },
+    { TLValue::UpdateContactLink, TypeIndex::Update, 996, 3 },
+    { TLValue::PhoneConnection, TypeIndex::PhoneConnection, 999, 5 },
+    { TLValue::PeerUser, TypeIndex::Peer, 1004, 1 },
+    { TLValue::InputStickerSetID, TypeIndex::InputStickerSet, 1005, 2 },
+    { TLValue::MessageService, TypeIndex::Message, 1007, 7 },
+    { TLValue::MessagesFavedStickersNotModified, TypeIndex::MessagesFavedStickers, 0, 0 },
+    { TLValue::NewSessionCreated, TypeIndex::NewSession, 1014, 3 },
+    { TLValue::InputMessagesFilterDocument, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::MessageMediaUnsupported, TypeIndex::MessageMedia, 0, 0 },
+    { TLValue::MessageActionHistoryClear, TypeIndex::MessageAction, 0, 0 },
+    { TLValue::InputMessagesFilterVideo, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::NotifyPeer, TypeIndex::NotifyPeer, 1017, 1 },
+    { TLValue::RecentMeUrlChat, TypeIndex::RecentMeUrl, 1018, 2 },
+    { TLValue::ReplyKeyboardHide, TypeIndex::ReplyMarkup, 1020, 1 },
+    { TLValue::SendMessageRecordVideoAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::UpdateDeleteMessages, TypeIndex::Update, 1021, 3 },
+    { TLValue::UpdateConfig, TypeIndex::Update, 0, 0 },
+    { TLValue::PhoneCallProtocol, TypeIndex::PhoneCallProtocol, 1024, 3 },
+    { TLValue::KeyboardButton, TypeIndex::KeyboardButton, 1027, 1 },
+    { TLValue::ChannelParticipantSelf, TypeIndex::ChannelParticipant, 1028, 3 },
+    { TLValue::MessageMediaWebPage, TypeIndex::MessageMedia, 1031, 1 },
+    { TLValue::ReceivedNotifyMessage, TypeIndex::ReceivedNotifyMessage, 1032, 2 },
+    { TLValue::ChannelParticipantsKicked, TypeIndex::ChannelParticipantsFilter, 1034, 1 },
+    { TLValue::InputNotifyAll, TypeIndex::InputNotifyPeer, 0, 0 },
+    { TLValue::RpcAnswerDropped, TypeIndex::RpcDropAnswer, 1035, 3 },
+    { TLValue::UpdatesState, TypeIndex::UpdatesState, 1038, 5 },
+    { TLValue::MessageActionChatCreate, TypeIndex::MessageAction, 1043, 2 },
+    { TLValue::DhGenFail, TypeIndex::SetClientDHParamsAnswer, 1045, 3 },
+    { TLValue::InputMediaContact, TypeIndex::InputMedia, 1048, 3 },
+    { TLValue::UpdateUserName, TypeIndex::Update, 1051, 4 },
+    { TLValue::BadMsgNotification, TypeIndex::BadMsgNotification, 1055, 3 },
+    { TLValue::ChannelParticipantAdmin, TypeIndex::ChannelParticipant, 1058, 6 },
+    { TLValue::InputBotInlineResultPhoto, TypeIndex::InputBotInlineResult, 1064, 4 },
+    { TLValue::UpdatesDifferenceSlice, TypeIndex::UpdatesDifference, 1068, 6 },
+    { TLValue::UploadCdnFile, TypeIndex::UploadCdnFile, 1074, 1 },
+    { TLValue::SendMessageUploadDocumentAction, TypeIndex::SendMessageAction, 1075, 1 },
+    { TLValue::StorageFileUnknown, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::InputBotInlineMessageMediaVenue, TypeIndex::InputBotInlineMessage, 1076, 7 },
+    { TLValue::AuthSentCodeTypeFlashCall, TypeIndex::AuthSentCodeType, 1083, 1 },
+    { TLValue::UpdatePhoneCall, TypeIndex::Update, 1084, 1 },
+    { TLValue::TopPeerCategoryBotsPM, TypeIndex::TopPeerCategory, 0, 0 },
+    { TLValue::EncryptedChatEmpty, TypeIndex::EncryptedChat, 1085, 1 },
+    { TLValue::PeerNotifyEventsEmpty, TypeIndex::PeerNotifyEvents, 0, 0 },
+    { TLValue::StorageFilePdf, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::FutureSalts, TypeIndex::FutureSalts, 1086, 3 },
+    { TLValue::DisabledFeature, TypeIndex::DisabledFeature, 1089, 2 },
+    { TLValue::MaskCoords, TypeIndex::MaskCoords, 1091, 4 },
+    { TLValue::KeyboardButtonBuy, TypeIndex::KeyboardButton, 1095, 1 },
+    { TLValue::InputChannel, TypeIndex::InputChannel, 1096, 2 },
+    { TLValue::MessageActionChannelMigrateFrom, TypeIndex::MessageAction, 1098, 2 },
+    { TLValue::ChannelParticipantsBots, TypeIndex::ChannelParticipantsFilter, 0, 0 },
+    { TLValue::KeyboardButtonRequestPhone, TypeIndex::KeyboardButton, 1100, 1 },
+    { TLValue::ChannelAdminLogEventActionChangeStickerSet, TypeIndex::ChannelAdminLogEventAction, 1101, 2 },
+    { TLValue::MessageActionChatDeleteUser, TypeIndex::MessageAction, 1103, 1 },
+    { TLValue::StorageFileMp4, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::MessagesAffectedHistory, TypeIndex::MessagesAffectedHistory, 1104, 3 },
+    { TLValue::ChannelParticipantsAdmins, TypeIndex::ChannelParticipantsFilter, 0, 0 },
+    { TLValue::UpdateEncryption, TypeIndex::Update, 1107, 2 },
+    { TLValue::NotifyUsers, TypeIndex::NotifyPeer, 0, 0 },
+    { TLValue::MessageMediaPhoto, TypeIndex::MessageMedia, 1109, 4 },
+    { TLValue::InputMessagesFilterRoundVideo, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::ServerDHInnerData, TypeIndex::ServerDHInnerData, 1113, 6 },
+    { TLValue::MessageActionChatEditTitle, TypeIndex::MessageAction, 1119, 1 },
+    { TLValue::MessagesStickerSet, TypeIndex::MessagesStickerSet, 1120, 3 },
+    { TLValue::ShippingOption, TypeIndex::ShippingOption, 1123, 3 },
+    { TLValue::UpdateChatParticipantAdmin, TypeIndex::Update, 1126, 4 },
+    { TLValue::MessageActionEmpty, TypeIndex::MessageAction, 0, 0 },
+    { TLValue::UpdateChannel, TypeIndex::Update, 1130, 1 },
+    { TLValue::InputMediaDocumentExternal, TypeIndex::InputMedia, 1131, 4 },
+    { TLValue::BotInlineMessageMediaGeo, TypeIndex::BotInlineMessage, 1135, 4 },
+    { TLValue::ContactsContactsNotModified, TypeIndex::ContactsContacts, 0, 0 },
+    { TLValue::AccountPasswordSettings, TypeIndex::AccountPasswordSettings, 1139, 1 },
+    { TLValue::ChannelAdminLogEventActionChangePhoto, TypeIndex::ChannelAdminLogEventAction, 1140, 2 },
+    { TLValue::InputNotifyPeer, TypeIndex::InputNotifyPeer, 1142, 1 },
+    { TLValue::AccountDaysTTL, TypeIndex::AccountDaysTTL, 1143, 1 },
+    { TLValue::InputUserEmpty, TypeIndex::InputUser, 0, 0 },
+    { TLValue::DraftMessageEmpty, TypeIndex::DraftMessage, 0, 0 },
+    { TLValue::PageBlockAuthorDate, TypeIndex::PageBlock, 1144, 2 },
+    { TLValue::PeerChat, TypeIndex::Peer, 1146, 1 },
+    { TLValue::MessageEntityUnknown, TypeIndex::MessageEntity, 1147, 2 },
+    { TLValue::RecentMeUrlStickerSet, TypeIndex::RecentMeUrl, 1149, 2 },
+    { TLValue::PrivacyKeyStatusTimestamp, TypeIndex::PrivacyKey, 0, 0 },
+    { TLValue::TopPeerCategoryGroups, TypeIndex::TopPeerCategory, 0, 0 },
+    { TLValue::MessageEntityBold, TypeIndex::MessageEntity, 1151, 2 },
+    { TLValue::PeerChannel, TypeIndex::Peer, 1153, 1 },
+    { TLValue::Game, TypeIndex::Game, 1154, 8 },
+    { TLValue::InputPrivacyKeyChatInvite, TypeIndex::InputPrivacyKey, 0, 0 },
+    { TLValue::UpdateNotifySettings, TypeIndex::Update, 1162, 2 },
+    { TLValue::PageBlockHeader, TypeIndex::PageBlock, 1164, 1 },
+    { TLValue::AuthSentCodeTypeSms, TypeIndex::AuthSentCodeType, 1165, 1 },
+    { TLValue::NotifyChats, TypeIndex::NotifyPeer, 0, 0 },
+    { TLValue::PageBlockPreformatted, TypeIndex::PageBlock, 1166, 2 },
+    { TLValue::MessagesDhConfigNotModified, TypeIndex::MessagesDhConfig, 1168, 1 },
+    { TLValue::InputPaymentCredentialsSaved, TypeIndex::InputPaymentCredentials, 1169, 2 },
+    { TLValue::TextUnderline, TypeIndex::RichText, 1171, 1 },
+    { TLValue::InputMediaVenue, TypeIndex::InputMedia, 1172, 6 },
+    { TLValue::InputBotInlineMessageMediaGeo, TypeIndex::InputBotInlineMessage, 1178, 4 },
+    { TLValue::InputMessagesFilterMyMentions, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::EncryptedFileEmpty, TypeIndex::EncryptedFile, 0, 0 },
+    { TLValue::InputWebFileLocation, TypeIndex::InputWebFileLocation, 1182, 2 },
+    { TLValue::BotCommand, TypeIndex::BotCommand, 1184, 2 },
+    { TLValue::Invoice, TypeIndex::Invoice, 1186, 3 },
+    { TLValue::InputGameShortName, TypeIndex::InputGame, 1189, 2 },
+    { TLValue::UpdateDeleteChannelMessages, TypeIndex::Update, 1191, 4 },
+    { TLValue::HelpNoAppUpdate, TypeIndex::HelpAppUpdate, 0, 0 },
+    { TLValue::Error, TypeIndex::Error, 1195, 2 },
+    { TLValue::WebPagePending, TypeIndex::WebPage, 1197, 2 },
+    { TLValue::WebDocument, TypeIndex::WebDocument, 1199, 6 },
+    { TLValue::EncryptedChatRequested, TypeIndex::EncryptedChat, 1205, 6 },
+    { TLValue::ChatParticipant, TypeIndex::ChatParticipant, 1211, 3 },
+    { TLValue::CdnPublicKey, TypeIndex::CdnPublicKey, 1214, 2 },
+    { TLValue::LangPackString, TypeIndex::LangPackString, 1216, 2 },
+    { TLValue::StorageFileGif, TypeIndex::StorageFileType, 0, 0 },
+    { TLValue::LabeledPrice, TypeIndex::LabeledPrice, 1218, 2 },
+    { TLValue::WallPaper, TypeIndex::WallPaper, 1220, 4 },
+    { TLValue::AuthAuthorization, TypeIndex::AuthAuthorization, 1224, 3 },
+    { TLValue::StickerSet, TypeIndex::StickerSet, 1227, 7 },
+    { TLValue::ChannelMessagesFilter, TypeIndex::ChannelMessagesFilter, 1234, 2 },
+    { TLValue::RpcAnswerDroppedRunning, TypeIndex::RpcDropAnswer, 0, 0 },
+    { TLValue::PaymentSavedCredentialsCard, TypeIndex::PaymentSavedCredentials, 1236, 2 },
+    { TLValue::PageBlockEmbed, TypeIndex::PageBlock, 1238, 7 },
+    { TLValue::PageBlockAnchor, TypeIndex::PageBlock, 1245, 1 },
+    { TLValue::ImportedContact, TypeIndex::ImportedContact, 1246, 2 },
+    { TLValue::ChannelsChannelParticipant, TypeIndex::ChannelsChannelParticipant, 1248, 2 },
+    { TLValue::ServerDHParamsOk, TypeIndex::ServerDHParams, 1250, 3 },
+    { TLValue::PaymentsValidatedRequestedInfo, TypeIndex::PaymentsValidatedRequestedInfo, 1253, 3 },
+    { TLValue::SendMessageUploadPhotoAction, TypeIndex::SendMessageAction, 1256, 1 },
+    { TLValue::InputMediaGame, TypeIndex::InputMedia, 1257, 1 },
+    { TLValue::ContactStatus, TypeIndex::ContactStatus, 1258, 2 },
+    { TLValue::IpPort, TypeIndex::IpPort, 1260, 2 },
+    { TLValue::ContactLinkContact, TypeIndex::ContactLink, 0, 0 },
+    { TLValue::SendMessageRecordAudioAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::UserProfilePhoto, TypeIndex::UserProfilePhoto, 1262, 3 },
+    { TLValue::ChannelAdminLogEventActionParticipantToggleAdmin, TypeIndex::ChannelAdminLogEventAction, 1265, 2 },
+    { TLValue::InputPrivacyValueDisallowAll, TypeIndex::InputPrivacyRule, 0, 0 },
+    { TLValue::UpdateDialogPinned, TypeIndex::Update, 1267, 2 },
+    { TLValue::InputUser, TypeIndex::InputUser, 1269, 2 },
+    { TLValue::UpdatePinnedDialogs, TypeIndex::Update, 1271, 2 },
+    { TLValue::TextItalic, TypeIndex::RichText, 1273, 1 },
+    { TLValue::Chat, TypeIndex::Chat, 1274, 8 },
+    { TLValue::HelpConfigSimple, TypeIndex::HelpConfigSimple, 1282, 4 },
+    { TLValue::PageBlockVideo, TypeIndex::PageBlock, 1286, 3 },
+    { TLValue::ChatParticipantCreator, TypeIndex::ChatParticipant, 1289, 1 },
+    { TLValue::MsgsStateReq, TypeIndex::MsgsStateReq, 1290, 1 },
+    { TLValue::PageBlockDivider, TypeIndex::PageBlock, 0, 0 },
+    { TLValue::AccountTmpPassword, TypeIndex::AccountTmpPassword, 1291, 2 },
+    { TLValue::ChatInvite, TypeIndex::ChatInvite, 1293, 5 },
+    { TLValue::TextEmpty, TypeIndex::RichText, 0, 0 },
+    { TLValue::SendMessageGamePlayAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::ContactsTopPeersNotModified, TypeIndex::ContactsTopPeers, 0, 0 },
+    { TLValue::ChannelParticipantsRecent, TypeIndex::ChannelParticipantsFilter, 0, 0 },
+    { TLValue::TextEmail, TypeIndex::RichText, 1298, 2 },
+    { TLValue::AuthExportedAuthorization, TypeIndex::AuthExportedAuthorization, 1300, 2 },
+    { TLValue::InputMessagesFilterContacts, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::PhoneCallDiscardReasonDisconnect, TypeIndex::PhoneCallDiscardReason, 0, 0 },
+    { TLValue::UpdateBotShippingQuery, TypeIndex::Update, 1302, 4 },
+    { TLValue::InputReportReasonOther, TypeIndex::ReportReason, 1306, 1 },
+    { TLValue::DestroySessionOk, TypeIndex::DestroySessionRes, 1307, 1 },
+    { TLValue::UserStatusRecently, TypeIndex::UserStatus, 0, 0 },
+    { TLValue::ChatParticipantAdmin, TypeIndex::ChatParticipant, 1308, 3 },
+    { TLValue::UpdatesTooLong, TypeIndex::Updates, 0, 0 },
+    { TLValue::ChannelAdminLogEventActionParticipantInvite, TypeIndex::ChannelAdminLogEventAction, 1311, 1 },
+    { TLValue::InputMediaUploadedDocument, TypeIndex::InputMedia, 1312, 8 },
+    { TLValue::ChannelParticipantCreator, TypeIndex::ChannelParticipant, 1320, 1 },
+    { TLValue::UpdateEditMessage, TypeIndex::Update, 1321, 3 },
+    { TLValue::InputGeoPointEmpty, TypeIndex::InputGeoPoint, 0, 0 },
+    { TLValue::Dialog, TypeIndex::Dialog, 1324, 10 },
+    { TLValue::UpdateFavedStickers, TypeIndex::Update, 0, 0 },
+    { TLValue::MessagesChatFull, TypeIndex::MessagesChatFull, 1334, 3 },
+    { TLValue::ChannelAdminLogEventActionParticipantToggleBan, TypeIndex::ChannelAdminLogEventAction, 1337, 2 },
+    { TLValue::ChannelAdminLogEventActionChangeTitle, TypeIndex::ChannelAdminLogEventAction, 1339, 2 },
+    { TLValue::InputMessagesFilterGeo, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::UpdateBotCallbackQuery, TypeIndex::Update, 1341, 8 },
+    { TLValue::MessagesSavedGifsNotModified, TypeIndex::MessagesSavedGifs, 0, 0 },
+    { TLValue::MessagesAllStickersNotModified, TypeIndex::MessagesAllStickers, 0, 0 },
+    { TLValue::InputPeerNotifyEventsAll, TypeIndex::InputPeerNotifyEvents, 0, 0 },
+    { TLValue::SendMessageUploadVideoAction, TypeIndex::SendMessageAction, 1349, 1 },
+    { TLValue::PhotoCachedSize, TypeIndex::PhotoSize, 1350, 5 },
+    { TLValue::PageBlockPhoto, TypeIndex::PageBlock, 1355, 2 },
+    { TLValue::ChannelAdminLogEventActionUpdatePinned, TypeIndex::ChannelAdminLogEventAction, 1357, 1 },
+    { TLValue::PaymentCharge, TypeIndex::PaymentCharge, 1358, 2 },
+    { TLValue::ChannelAdminLogEventsFilter, TypeIndex::ChannelAdminLogEventsFilter, 1360, 1 },
+    { TLValue::DestroyAuthKeyFail, TypeIndex::DestroyAuthKeyRes, 0, 0 },
+    { TLValue::UpdateChatParticipantAdd, TypeIndex::Update, 1361, 5 },
+    { TLValue::UploadFileCdnRedirect, TypeIndex::UploadFile, 1366, 5 },
+    { TLValue::ContactsContacts, TypeIndex::ContactsContacts, 1371, 3 },
+    { TLValue::UpdateChannelTooLong, TypeIndex::Update, 1374, 3 },
+    { TLValue::WebPageEmpty, TypeIndex::WebPage, 1377, 1 },
+    { TLValue::RecentMeUrlChatInvite, TypeIndex::RecentMeUrl, 1378, 2 },
+    { TLValue::UpdateServiceNotification, TypeIndex::Update, 1380, 6 },
+    { TLValue::PhonePhoneCall, TypeIndex::PhonePhoneCall, 1386, 2 },
+    { TLValue::EncryptedMessage, TypeIndex::EncryptedMessage, 1388, 5 },
+    { TLValue::ChannelsAdminLogResults, TypeIndex::ChannelsAdminLogResults, 1393, 3 },
+    { TLValue::BadServerSalt, TypeIndex::BadMsgNotification, 1396, 4 },
+    { TLValue::UserStatusOnline, TypeIndex::UserStatus, 1400, 1 },
+    { TLValue::TopPeer, TypeIndex::TopPeer, 1401, 2 },
+    { TLValue::MessagesAllStickers, TypeIndex::MessagesAllStickers, 1403, 2 },
+    { TLValue::UpdateDraftMessage, TypeIndex::Update, 1405, 2 },
+    { TLValue::UpdatePrivacy, TypeIndex::Update, 1407, 2 },
+    { TLValue::InputChannelEmpty, TypeIndex::InputChannel, 0, 0 },
+    { TLValue::UploadCdnFileReuploadNeeded, TypeIndex::UploadCdnFile, 1409, 1 },
+    { TLValue::PageBlockChannel, TypeIndex::PageBlock, 1410, 1 },
+    { TLValue::ChannelsChannelParticipantsNotModified, TypeIndex::ChannelsChannelParticipants, 0, 0 },
+    { TLValue::InputPeerNotifyEventsEmpty, TypeIndex::InputPeerNotifyEvents, 0, 0 },
+    { TLValue::PageBlockSubheader, TypeIndex::PageBlock, 1411, 1 },
+    { TLValue::InputEncryptedChat, TypeIndex::InputEncryptedChat, 1412, 2 },
+    { TLValue::MessagesStickersNotModified, TypeIndex::MessagesStickers, 0, 0 },
+    { TLValue::HelpTermsOfService, TypeIndex::HelpTermsOfService, 1414, 1 },
+    { TLValue::SendMessageUploadAudioAction, TypeIndex::SendMessageAction, 1415, 1 },
+    { TLValue::MessagesFavedStickers, TypeIndex::MessagesFavedStickers, 1416, 3 },
+    { TLValue::LangPackDifference, TypeIndex::LangPackDifference, 1419, 4 },
+    { TLValue::InputPhoneContact, TypeIndex::InputContact, 1423, 4 },
+    { TLValue::InputGeoPoint, TypeIndex::InputGeoPoint, 1427, 2 },
+    { TLValue::ReplyKeyboardForceReply, TypeIndex::ReplyMarkup, 1429, 1 },
+    { TLValue::InputEncryptedFileLocation, TypeIndex::InputFileLocation, 1430, 2 },
+    { TLValue::InputFile, TypeIndex::InputFile, 1432, 4 },
+    { TLValue::ChannelsChannelParticipants, TypeIndex::ChannelsChannelParticipants, 1436, 3 },
+    { TLValue::DestroyAuthKeyOk, TypeIndex::DestroyAuthKeyRes, 0, 0 },
+    { TLValue::InputUserSelf, TypeIndex::InputUser, 0, 0 },
+    { TLValue::PrivacyValueDisallowContacts, TypeIndex::PrivacyRule, 0, 0 },
+    { TLValue::ChannelAdminLogEventActionParticipantLeave, TypeIndex::ChannelAdminLogEventAction, 0, 0 },
+    { TLValue::MessageActionChatJoinedByLink, TypeIndex::MessageAction, 1439, 1 },
+    { TLValue::MessagesFeaturedStickers, TypeIndex::MessagesFeaturedStickers, 1440, 3 },
+    { TLValue::Contact, TypeIndex::Contact, 1443, 2 },
+    { TLValue::InputMediaGeoPoint, TypeIndex::InputMedia, 1445, 1 },
+    { TLValue::UpdateInlineBotCallbackQuery, TypeIndex::Update, 1446, 7 },
+    { TLValue::MessageEntityMention, TypeIndex::MessageEntity, 1453, 2 },
+    { TLValue::InputFileBig, TypeIndex::InputFile, 1455, 3 },
+    { TLValue::EncryptedChat, TypeIndex::EncryptedChat, 1458, 7 },
+    { TLValue::InputPrivacyKeyPhoneCall, TypeIndex::InputPrivacyKey, 0, 0 },
+    { TLValue::MessageFwdHeader, TypeIndex::MessageFwdHeader, 1465, 6 },
+    { TLValue::MessageActionCustomAction, TypeIndex::MessageAction, 1471, 1 },
+    { TLValue::PhoneCallDiscardReasonBusy, TypeIndex::PhoneCallDiscardReason, 0, 0 },
+    { TLValue::TopPeerCategoryPeers, TypeIndex::TopPeerCategoryPeers, 1472, 3 },
+    { TLValue::PaymentsSavedInfo, TypeIndex::PaymentsSavedInfo, 1475, 2 },
+    { TLValue::InputPhoto, TypeIndex::InputPhoto, 1477, 2 },
+    { TLValue::ChatInviteExported, TypeIndex::ExportedChatInvite, 1479, 1 },
+    { TLValue::KeyboardButtonRequestGeoLocation, TypeIndex::KeyboardButton, 1480, 1 },
+    { TLValue::ChatParticipantsForbidden, TypeIndex::ChatParticipants, 1481, 3 },
+    { TLValue::SendMessageCancelAction, TypeIndex::SendMessageAction, 0, 0 },
+    { TLValue::DraftMessage, TypeIndex::DraftMessage, 1484, 5 },
+    { TLValue::MessageMediaGame, TypeIndex::MessageMedia, 1489, 1 },
+    { TLValue::ContactLinkNone, TypeIndex::ContactLink, 0, 0 },
+    { TLValue::InputStickerSetItem, TypeIndex::InputStickerSetItem, 1490, 4 },
+    { TLValue::InputStickerSetEmpty, TypeIndex::InputStickerSet, 0, 0 },
+    { TLValue::InputMessagesFilterGif, TypeIndex::MessagesFilter, 0, 0 },
+    { TLValue::PhoneCall, TypeIndex::PhoneCall, 1494, 11 },
+    { TLValue::InputBotInlineResultDocument, TypeIndex::InputBotInlineResult, 1505, 7 },
+    { TLValue::PrivacyValueAllowContacts, TypeIndex::PrivacyRule, 0, 0 },
+    // End of generated TL schema constructors
+};
+
+const ConstructorInfo *findConstructor(quint32 id)
+{
+    const ConstructorInfo *end = std::end(c_constructors);
+    const ConstructorInfo *info = std::lower_bound(std::begin(c_constructors), end, id);
+    if ((info == end) || (info->id != id)) {
+        return nullptr;
+    }
+    return info;
+}
+
+// Guards the stack against maliciously nested values (e.g. TLRichText or TLPageBlock)
+constexpr int c_maxDepth = 64;
+
+class Skipper
+{
+public:
+    Skipper(const char *data, int size) :
+        m_data(data),
+        m_size(size)
+    {
+    }
+
+    int position() const { return m_position; }
+
+    bool skipObject(TypeIndex expectedType, int depth, quint32 *constructor = nullptr);
+
+protected:
+    bool readUInt(quint32 *value);
+    bool skipRaw(int bytes);
+    bool skipBytes();
+    bool skipVector(int itemSize);
+    bool skipField(const FieldInfo &field, quint32 flags, int depth);
+
+    const char *m_data;
+    int m_size;
+    int m_position = 0;
+};
+
+bool Skipper::readUInt(quint32 *value)
+{
+    if (m_size - m_position < 4) {
+        return false;
+    }
+    *value = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(m_data + m_position));
+    m_position += 4;
+    return true;
+}
+
+bool Skipper::skipRaw(int bytes)
+{
+    if (m_size - m_position < bytes) {
+        return false;
+    }
+    m_position += bytes;
+    return true;
+}
+
+bool Skipper::skipBytes()
+{
+    if (m_position >= m_size) {
+        return false;
+    }
+    const quint8 firstByte = static_cast<quint8>(m_data[m_position]);
+    int headerSize = 1;
+    int length = firstByte;
+    if (firstByte == 0xfe) {
+        if (m_size - m_position < 4) {
+            return false;
+        }
+        const uchar *lengthData = reinterpret_cast<const uchar *>(m_data + m_position + 1);
+        length = lengthData[0] | (lengthData[1] << 8) | (lengthData[2] << 16);
+        headerSize = 4;
+    } else if (firstByte == 0xff) {
+        return false;
+    }
+    // The bytes are padded to 4
+    return skipRaw((headerSize + length + 3) & ~3);
+}
+
+bool Skipper::skipVector(int itemSize)
+{
+    quint32 id = 0;
+    quint32 count = 0;
+    if (!readUInt(&id) || (id != TLValue::Vector) || !readUInt(&count)) {
+        return false;
+    }
+    if (count > static_cast<quint32>(m_size - m_position) / itemSize) {
+        return false;
+    }
+    return skipRaw(static_cast<int>(count) * itemSize);
+}
+
+bool Skipper::skipField(const FieldInfo &field, quint32 flags, int depth)
+{
+    if ((field.flagBit != c_noFlag) && !(flags & (1u << field.flagBit))) {
+        return true;
+    }
+
+    switch (field.kind) {
+    case FieldKind::Int:
+    case FieldKind::Flags:
+        return skipRaw(4);
+    case FieldKind::Long:
+    case FieldKind::Double:
+        return skipRaw(8);
+    case FieldKind::Bool:
+    {
+        quint32 value = 0;
+        return readUInt(&value) && ((value == TLValue::BoolTrue) || (value == TLValue::BoolFalse));
+    }
+    case FieldKind::Bytes:
+        return skipBytes();
+    case FieldKind::Int128:
+        return skipRaw(16);
+    case FieldKind::Int256:
+        return skipRaw(32);
+    case FieldKind::Object:
+        return skipObject(field.type, depth + 1);
+    case FieldKind::IntVector:
+        return skipVector(4);
+    case FieldKind::LongVector:
+        return skipVector(8);
+    case FieldKind::ObjectVector:
+    {
+        quint32 id = 0;
+        quint32 count = 0;
+        if (!readUInt(&id) || (id != TLValue::Vector) || !readUInt(&count)) {
+            return false;
+        }
+        // Each item takes at least 4 bytes (the constructor)
+        if (count > static_cast<quint32>(m_size - m_position) / 4) {
+            return false;
+        }
+        for (quint32 i = 0; i < count; ++i) {
+            if (!skipObject(field.type, depth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    }
+    return false;
+}
+
+bool Skipper::skipObject(TypeIndex expectedType, int depth, quint32 *constructor)
+{
+    if (depth > c_maxDepth) {
+        return false;
+    }
+    quint32 id = 0;
+    if (!readUInt(&id)) {
+        return false;
+    }
+    if (constructor) {
+        *constructor = id;
+    }
+    const ConstructorInfo *info = findConstructor(id);
+    if (!info) {
+        return false;
+    }
+    if ((expectedType != TypeIndex::Any) && (info->type != expectedType)) {
+        return false;
+    }
+    quint32 flags = 0;
+    const FieldInfo *fields = c_fields + info->firstField;
+    for (int i = 0; i < info->fieldCount; ++i) {
+        const FieldInfo &field = fields[i];
+        if (field.kind == FieldKind::Flags) {
+            if (!readUInt(&flags)) {
+                return false;
+            }
+            continue;
+        }
+        if (!skipField(field, flags, depth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+int skipValue(const char *data, int size, quint32 *constructor)
+{
+    Skipper skipper(data, size);
+    if (!skipper.skipObject(TypeIndex::Any, 0, constructor)) {
+        return -1;
+    }
+    return skipper.position();
+}
+
+} // TLSchema namespace
+
+} // Telegram namespace
@@ -0,0 +1,58 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_TL_SCHEMA_HPP
+#define TELEGRAM_TL_SCHEMA_HPP
+
+#include "telegramqt_global.h"
+
+#include <QByteArray>
+
+namespace Telegram {
+
+namespace TLSchema {
+
+// Validates the boxed TL value at the beginning of the data and returns its serialized size
+// without decoding it. Returns -1 if the data is truncated, malformed or has an unknown
+// constructor (at any nesting level). The first constructor is written to the 'constructor'.
+TELEGRAMQT_INTERNAL_EXPORT int skipValue(const char *data, int size, quint32 *constructor = nullptr);
+
+template <typename TLType>
+int skip(const char *data, int size)
+{
+    quint32 constructor = 0;
+    const int valueSize = skipValue(data, size, &constructor);
+    if ((valueSize < 0) || !TLType::hasType(constructor)) {
+        return -1;
+    }
+    return valueSize;
+}
+
+template <typename TLType>
+int skip(const QByteArray &data, int offset = 0)
+{
+    if ((offset < 0) || (offset > data.size())) {
+        return -1;
+    }
+    return skip<TLType>(data.constData() + offset, data.size() - offset);
+}
+
+} // TLSchema namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_TL_SCHEMA_HPP
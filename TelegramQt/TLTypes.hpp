@@ -30,6 +30,9 @@
 template <typename TL>
 using TLPtr = Telegram::UniqueLazyPointer<TL>;
 
+template <typename TL>
+using TLLazy = Telegram::LazyValue<TL>;
+
 struct TLBool
 {
     constexpr TLBool() = default;
@@ -5000,7 +5003,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLMessageMedia {
     bool shippingAddressRequested() const { return flags & ShippingAddressRequested; }
     bool test() const { return flags & Test; }
     quint32 flags = 0;
-    TLPhoto photo;
+    TLLazy<TLPhoto> photo;
     QString caption;
     quint32 ttlSeconds = 0;
     TLGeoPoint geo;
@@ -5008,16 +5011,16 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLMessageMedia {
     QString firstName;
     QString lastName;
     quint32 userId = 0;
-    TLDocument document;
-    TLWebPage webpage;
+    TLLazy<TLDocument> document;
+    TLLazy<TLWebPage> webpage;
     QString title;
     QString address;
     QString provider;
     QString venueId;
     QString venueType;
-    TLGame game;
+    TLLazy<TLGame> game;
     QString description;
-    TLWebDocument webDocumentPhoto;
+    TLLazy<TLWebDocument> webDocumentPhoto;
     quint32 receiptMsgId = 0;
     QString currency;
     quint64 totalAmount = 0;
@@ -5066,18 +5069,18 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLMessage {
     quint32 flags = 0;
     quint32 fromId = 0;
     TLPeer toId;
-    TLMessageFwdHeader fwdFrom;
+    TLLazy<TLMessageFwdHeader> fwdFrom;
     quint32 viaBotId = 0;
     quint32 replyToMsgId = 0;
     quint32 date = 0;
     QString message;
-    TLMessageMedia media;
-    TLReplyMarkup replyMarkup;
+    TLLazy<TLMessageMedia> media;
+    TLLazy<TLReplyMarkup> replyMarkup;
     TLVector<TLMessageEntity> entities;
     quint32 views = 0;
     quint32 editDate = 0;
     QString postAuthor;
-    TLMessageAction action;
+    TLLazy<TLMessageAction> action;
     TLValue tlType = TLValue::MessageEmpty;
 };
 
@@ -5239,7 +5242,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     bool popup() const { return flags & Popup; }
     bool masks() const { return flags & Masks; }
     bool pinned() const { return flags & Pinned; }
-    TLMessage message;
+    TLLazy<TLMessage> message;
     quint32 pts = 0;
     quint32 ptsCount = 0;
     quint32 quint32Id = 0;
@@ -5248,43 +5251,43 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     quint32 userId = 0;
     TLSendMessageAction action;
     quint32 chatId = 0;
-    TLChatParticipants participants;
+    TLLazy<TLChatParticipants> participants;
     TLUserStatus status;
     QString firstName;
     QString lastName;
     QString username;
     quint32 date = 0;
-    TLUserProfilePhoto photo;
+    TLLazy<TLUserProfilePhoto> photo;
     bool previous = false;
     TLContactLink myLink;
     TLContactLink foreignLink;
-    TLEncryptedMessage encryptedMessage;
+    TLLazy<TLEncryptedMessage> encryptedMessage;
     quint32 qts = 0;
-    TLEncryptedChat chat;
+    TLLazy<TLEncryptedChat> chat;
     quint32 maxDate = 0;
     quint32 inviterId = 0;
     quint32 version = 0;
     TLVector<TLDcOption> dcOptions;
     bool blocked = false;
-    TLNotifyPeer notifyPeer;
-    TLPeerNotifySettings notifySettings;
+    TLLazy<TLNotifyPeer> notifyPeer;
+    TLLazy<TLPeerNotifySettings> notifySettings;
     quint32 flags = 0;
     quint32 inboxDate = 0;
     QString type;
     QString stringMessage;
-    TLMessageMedia media;
+    TLLazy<TLMessageMedia> media;
     TLVector<TLMessageEntity> entities;
     TLPrivacyKey key;
     TLVector<TLPrivacyRule> rules;
     QString phone;
     TLPeer peer;
     quint32 maxId = 0;
-    TLWebPage webpage;
+    TLLazy<TLWebPage> webpage;
     quint32 channelId = 0;
     quint32 views = 0;
     bool enabled = false;
     bool isAdmin = false;
-    TLMessagesStickerSet stickerset;
+    TLLazy<TLMessagesStickerSet> stickerset;
     TLVector<quint64> quint64OrderVector;
     quint64 queryId = 0;
     QString query;
@@ -5296,18 +5299,18 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     quint64 chatInstance = 0;
     QByteArray byteArrayData;
     QString gameShortName;
-    TLDraftMessage draft;
+    TLLazy<TLDraftMessage> draft;
     TLVector<TLPeer> peerOrderVector;
-    TLDataJSON jSONData;
+    TLLazy<TLDataJSON> jSONData;
     quint32 timeout = 0;
     QByteArray payload;
-    TLPostAddress shippingAddress;
-    TLPaymentRequestedInfo info;
+    TLLazy<TLPostAddress> shippingAddress;
+    TLLazy<TLPaymentRequestedInfo> info;
     QString shippingOptionId;
     QString currency;
     quint64 totalAmount = 0;
-    TLPhoneCall phoneCall;
-    TLLangPackDifference difference;
+    TLLazy<TLPhoneCall> phoneCall;
+    TLLazy<TLLangPackDifference> difference;
     quint32 availableMinId = 0;
     TLValue tlType = TLValue::UpdateNewMessage;
 };
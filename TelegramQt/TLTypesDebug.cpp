@@ -6826,7 +6826,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         d << "\n";
         d << spacer.innerSpaces() << "flags: " << type.flags <<"\n";
         if (type.flags & 1 << 0) {
-            d << spacer.innerSpaces() << "photo: " << type.photo <<"\n";
+            d << spacer.innerSpaces() << "photo: " << *type.photo <<"\n";
         }
         if (type.flags & 1 << 1) {
             d << spacer.innerSpaces() << "caption: " << type.caption <<"\n";
@@ -6850,7 +6850,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         d << "\n";
         d << spacer.innerSpaces() << "flags: " << type.flags <<"\n";
         if (type.flags & 1 << 0) {
-            d << spacer.innerSpaces() << "document: " << type.document <<"\n";
+            d << spacer.innerSpaces() << "document: " << *type.document <<"\n";
         }
         if (type.flags & 1 << 1) {
             d << spacer.innerSpaces() << "caption: " << type.caption <<"\n";
@@ -6861,7 +6861,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         break;
     case TLValue::MessageMediaWebPage:
         d << "\n";
-        d << spacer.innerSpaces() << "webpage: " << type.webpage <<"\n";
+        d << spacer.innerSpaces() << "webpage: " << *type.webpage <<"\n";
         break;
     case TLValue::MessageMediaVenue:
         d << "\n";
@@ -6874,7 +6874,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         break;
     case TLValue::MessageMediaGame:
         d << "\n";
-        d << spacer.innerSpaces() << "game: " << type.game <<"\n";
+        d << spacer.innerSpaces() << "game: " << *type.game <<"\n";
         break;
     case TLValue::MessageMediaInvoice:
         d << "\n";
@@ -6883,7 +6883,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         d << spacer.innerSpaces() << "title: " << type.title <<"\n";
         d << spacer.innerSpaces() << "description: " << type.description <<"\n";
         if (type.flags & 1 << 0) {
-            d << spacer.innerSpaces() << "webDocumentPhoto: " << type.webDocumentPhoto <<"\n";
+            d << spacer.innerSpaces() << "webDocumentPhoto: " << *type.webDocumentPhoto <<"\n";
         }
         if (type.flags & 1 << 2) {
             d << spacer.innerSpaces() << "receiptMsgId: " << type.receiptMsgId <<"\n";
@@ -6926,7 +6926,7 @@ QDebug operator<<(QDebug d, const TLMessage &type)
         }
         d << spacer.innerSpaces() << "toId: " << type.toId <<"\n";
         if (type.flags & 1 << 2) {
-            d << spacer.innerSpaces() << "fwdFrom: " << type.fwdFrom <<"\n";
+            d << spacer.innerSpaces() << "fwdFrom: " << *type.fwdFrom <<"\n";
         }
         if (type.flags & 1 << 11) {
             d << spacer.innerSpaces() << "viaBotId: " << type.viaBotId <<"\n";
@@ -6937,10 +6937,10 @@ QDebug operator<<(QDebug d, const TLMessage &type)
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
         d << spacer.innerSpaces() << "message: " << type.message <<"\n";
         if (type.flags & 1 << 9) {
-            d << spacer.innerSpaces() << "media: " << type.media <<"\n";
+            d << spacer.innerSpaces() << "media: " << *type.media <<"\n";
         }
         if (type.flags & 1 << 6) {
-            d << spacer.innerSpaces() << "replyMarkup: " << type.replyMarkup <<"\n";
+            d << spacer.innerSpaces() << "replyMarkup: " << *type.replyMarkup <<"\n";
         }
         if (type.flags & 1 << 7) {
             d << spacer.innerSpaces() << "entities: " << type.entities <<"\n";
@@ -6968,7 +6968,7 @@ QDebug operator<<(QDebug d, const TLMessage &type)
             d << spacer.innerSpaces() << "replyToMsgId: " << type.replyToMsgId <<"\n";
         }
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
-        d << spacer.innerSpaces() << "action: " << type.action <<"\n";
+        d << spacer.innerSpaces() << "action: " << *type.action <<"\n";
         break;
     default:
         break;
@@ -7084,7 +7084,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
     case TLValue::UpdateEditChannelMessage:
     case TLValue::UpdateEditMessage:
         d << "\n";
-        d << spacer.innerSpaces() << "message: " << type.message <<"\n";
+        d << spacer.innerSpaces() << "message: " << *type.message <<"\n";
         d << spacer.innerSpaces() << "pts: " << type.pts <<"\n";
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         break;
@@ -7113,7 +7113,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateChatParticipants:
         d << "\n";
-        d << spacer.innerSpaces() << "participants: " << type.participants <<"\n";
+        d << spacer.innerSpaces() << "participants: " << *type.participants <<"\n";
         break;
     case TLValue::UpdateUserStatus:
         d << "\n";
@@ -7131,7 +7131,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         d << "\n";
         d << spacer.innerSpaces() << "userId: " << type.userId <<"\n";
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
-        d << spacer.innerSpaces() << "photo: " << type.photo <<"\n";
+        d << spacer.innerSpaces() << "photo: " << *type.photo <<"\n";
         d << spacer.innerSpaces() << "previous: " << type.previous <<"\n";
         break;
     case TLValue::UpdateContactRegistered:
@@ -7147,7 +7147,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateNewEncryptedMessage:
         d << "\n";
-        d << spacer.innerSpaces() << "encryptedMessage: " << type.encryptedMessage <<"\n";
+        d << spacer.innerSpaces() << "encryptedMessage: " << *type.encryptedMessage <<"\n";
         d << spacer.innerSpaces() << "qts: " << type.qts <<"\n";
         break;
     case TLValue::UpdateEncryptedChatTyping:
@@ -7156,7 +7156,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateEncryption:
         d << "\n";
-        d << spacer.innerSpaces() << "chat: " << type.chat <<"\n";
+        d << spacer.innerSpaces() << "chat: " << *type.chat <<"\n";
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
         break;
     case TLValue::UpdateEncryptedMessagesRead:
@@ -7190,8 +7190,8 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateNotifySettings:
         d << "\n";
-        d << spacer.innerSpaces() << "notifyPeer: " << type.notifyPeer <<"\n";
-        d << spacer.innerSpaces() << "notifySettings: " << type.notifySettings <<"\n";
+        d << spacer.innerSpaces() << "notifyPeer: " << *type.notifyPeer <<"\n";
+        d << spacer.innerSpaces() << "notifySettings: " << *type.notifySettings <<"\n";
         break;
     case TLValue::UpdateServiceNotification:
         d << "\n";
@@ -7202,7 +7202,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         }
         d << spacer.innerSpaces() << "type: " << type.type <<"\n";
         d << spacer.innerSpaces() << "stringMessage: " << type.stringMessage <<"\n";
-        d << spacer.innerSpaces() << "media: " << type.media <<"\n";
+        d << spacer.innerSpaces() << "media: " << *type.media <<"\n";
         d << spacer.innerSpaces() << "entities: " << type.entities <<"\n";
         break;
     case TLValue::UpdatePrivacy:
@@ -7225,7 +7225,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateWebPage:
         d << "\n";
-        d << spacer.innerSpaces() << "webpage: " << type.webpage <<"\n";
+        d << spacer.innerSpaces() << "webpage: " << *type.webpage <<"\n";
         d << spacer.innerSpaces() << "pts: " << type.pts <<"\n";
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         break;
@@ -7275,7 +7275,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateNewStickerSet:
         d << "\n";
-        d << spacer.innerSpaces() << "stickerset: " << type.stickerset <<"\n";
+        d << spacer.innerSpaces() << "stickerset: " << *type.stickerset <<"\n";
         break;
     case TLValue::UpdateStickerSetsOrder:
         d << "\n";
@@ -7355,12 +7355,12 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
     case TLValue::UpdateDraftMessage:
         d << "\n";
         d << spacer.innerSpaces() << "peer: " << type.peer <<"\n";
-        d << spacer.innerSpaces() << "draft: " << type.draft <<"\n";
+        d << spacer.innerSpaces() << "draft: " << *type.draft <<"\n";
         break;
     case TLValue::UpdateChannelWebPage:
         d << "\n";
         d << spacer.innerSpaces() << "channelId: " << type.channelId <<"\n";
-        d << spacer.innerSpaces() << "webpage: " << type.webpage <<"\n";
+        d << spacer.innerSpaces() << "webpage: " << *type.webpage <<"\n";
         d << spacer.innerSpaces() << "pts: " << type.pts <<"\n";
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         break;
@@ -7379,12 +7379,12 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateBotWebhookJSON:
         d << "\n";
-        d << spacer.innerSpaces() << "jSONData: " << type.jSONData <<"\n";
+        d << spacer.innerSpaces() << "jSONData: " << *type.jSONData <<"\n";
         break;
     case TLValue::UpdateBotWebhookJSONQuery:
         d << "\n";
         d << spacer.innerSpaces() << "queryId: " << type.queryId <<"\n";
-        d << spacer.innerSpaces() << "jSONData: " << type.jSONData <<"\n";
+        d << spacer.innerSpaces() << "jSONData: " << *type.jSONData <<"\n";
         d << spacer.innerSpaces() << "timeout: " << type.timeout <<"\n";
         break;
     case TLValue::UpdateBotShippingQuery:
@@ -7392,7 +7392,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         d << spacer.innerSpaces() << "queryId: " << type.queryId <<"\n";
         d << spacer.innerSpaces() << "userId: " << type.userId <<"\n";
         d << spacer.innerSpaces() << "payload: " << type.payload.toHex() <<"\n";
-        d << spacer.innerSpaces() << "shippingAddress: " << type.shippingAddress <<"\n";
+        d << spacer.innerSpaces() << "shippingAddress: " << *type.shippingAddress <<"\n";
         break;
     case TLValue::UpdateBotPrecheckoutQuery:
         d << "\n";
@@ -7401,7 +7401,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         d << spacer.innerSpaces() << "userId: " << type.userId <<"\n";
         d << spacer.innerSpaces() << "payload: " << type.payload.toHex() <<"\n";
         if (type.flags & 1 << 0) {
-            d << spacer.innerSpaces() << "info: " << type.info <<"\n";
+            d << spacer.innerSpaces() << "info: " << *type.info <<"\n";
         }
         if (type.flags & 1 << 1) {
             d << spacer.innerSpaces() << "shippingOptionId: " << type.shippingOptionId <<"\n";
@@ -7411,11 +7411,11 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdatePhoneCall:
         d << "\n";
-        d << spacer.innerSpaces() << "phoneCall: " << type.phoneCall <<"\n";
+        d << spacer.innerSpaces() << "phoneCall: " << *type.phoneCall <<"\n";
         break;
     case TLValue::UpdateLangPack:
         d << "\n";
-        d << spacer.innerSpaces() << "difference: " << type.difference <<"\n";
+        d << spacer.innerSpaces() << "difference: " << *type.difference <<"\n";
         break;
     case TLValue::UpdateChannelReadMessagesContents:
         d << "\n";
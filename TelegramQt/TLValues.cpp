@@ -17,19 +17,956 @@
 
 #include "TLValues.hpp"
 
-#include <QMetaEnum>
+#include <algorithm>
+#include <iterator>
 
-static const int ValueTypeEnumeratorIndex = TLValue::staticMetaObject.indexOfEnumerator("Value");
-static const QMetaEnum enumerator = TLValue::staticMetaObject.enumerator(ValueTypeEnumeratorIndex);
+namespace {
+
+struct TLValueInfo
+{
+    quint32 value;
+    const char *name;
+    const char *typeName;
+    TLValue::Kind kind;
+};
+
+bool operator<(const TLValueInfo &info, quint32 value)
+{
+    return info.value < value;
+}
+
+// The table is sorted by the value (the generator takes care of it)
+constexpr TLValueInfo c_valueInfos[] = {
+    // Generated TLValues table
+    { TLValue::StorageFileJpeg, "StorageFileJpeg", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::UserStatusOffline, "UserStatusOffline", "TLUserStatus", TLValue::Kind::Type },
+    { TLValue::UpdatesDifference, "UpdatesDifference", "TLUpdatesDifference", TLValue::Kind::Type },
+    { TLValue::UpdatesGetChannelDifference, "UpdatesGetChannelDifference", "TLUpdatesChannelDifference", TLValue::Kind::Function },
+    { TLValue::InputGameID, "InputGameID", "TLInputGame", TLValue::Kind::Type },
+    { TLValue::MessagesSearch, "MessagesSearch", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::InputStickeredMediaDocument, "InputStickeredMediaDocument", "TLInputStickeredMedia", TLValue::Kind::Type },
+    { TLValue::MsgsStateInfo, "MsgsStateInfo", "TLMsgsStateInfo", TLValue::Kind::Type },
+    { TLValue::MessagesFeaturedStickersNotModified, "MessagesFeaturedStickersNotModified", "TLMessagesFeaturedStickers", TLValue::Kind::Type },
+    { TLValue::ResPQ, "ResPQ", "TLResPQ", TLValue::Kind::Type },
+    { TLValue::KeyboardButtonSwitchInline, "KeyboardButtonSwitchInline", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::MessagesReceivedMessages, "MessagesReceivedMessages", "TLVector<TLReceivedNotifyMessage>", TLValue::Kind::Function },
+    { TLValue::MessagesEditMessage, "MessagesEditMessage", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::DcOption, "DcOption", "TLDcOption", TLValue::Kind::Type },
+    { TLValue::TopPeerCategoryCorrespondents, "TopPeerCategoryCorrespondents", "TLTopPeerCategory", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantsSearch, "ChannelParticipantsSearch", "TLChannelParticipantsFilter", TLValue::Kind::Type },
+    { TLValue::ChatForbidden, "ChatForbidden", "TLChat", TLValue::Kind::Type },
+    { TLValue::UpdateChatParticipants, "UpdateChatParticipants", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UserStatusLastWeek, "UserStatusLastWeek", "TLUserStatus", TLValue::Kind::Type },
+    { TLValue::ChannelsGetFullChannel, "ChannelsGetFullChannel", "TLMessagesChatFull", TLValue::Kind::Function },
+    { TLValue::PageBlockCollage, "PageBlockCollage", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::AccountSendChangePhoneCode, "AccountSendChangePhoneCode", "TLAuthSentCode", TLValue::Kind::Function },
+    { TLValue::AccountGetAccountTTL, "AccountGetAccountTTL", "TLAccountDaysTTL", TLValue::Kind::Function },
+    { TLValue::InputMediaPhotoExternal, "InputMediaPhotoExternal", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::FutureSalt, "FutureSalt", "TLFutureSalt", TLValue::Kind::Type },
+    { TLValue::UploadFile, "UploadFile", "TLUploadFile", TLValue::Kind::Type },
+    { TLValue::MessagesSetBotPrecheckoutResults, "MessagesSetBotPrecheckoutResults", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesCreateChat, "MessagesCreateChat", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::UserStatusEmpty, "UserStatusEmpty", "TLUserStatus", TLValue::Kind::Type },
+    { TLValue::StorageFilePng, "StorageFilePng", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::AuthCheckPassword, "AuthCheckPassword", "TLAuthAuthorization", TLValue::Kind::Function },
+    { TLValue::BotInlineMessageMediaAuto, "BotInlineMessageMediaAuto", "TLBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::ChannelsGetChannels, "ChannelsGetChannels", "TLMessagesChats", TLValue::Kind::Function },
+    { TLValue::DestroyAuthKeyNone, "DestroyAuthKeyNone", "TLDestroyAuthKeyRes", TLValue::Kind::Type },
+    { TLValue::InputPaymentCredentialsApplePay, "InputPaymentCredentialsApplePay", "TLInputPaymentCredentials", TLValue::Kind::Type },
+    { TLValue::MessageRange, "MessageRange", "TLMessageRange", TLValue::Kind::Type },
+    { TLValue::MessagesRecentStickersNotModified, "MessagesRecentStickersNotModified", "TLMessagesRecentStickers", TLValue::Kind::Type },
+    { TLValue::LangpackGetDifference, "LangpackGetDifference", "TLLangPackDifference", TLValue::Kind::Function },
+    { TLValue::MessagesMessagesSlice, "MessagesMessagesSlice", "TLMessagesMessages", TLValue::Kind::Type },
+    { TLValue::InputPrivacyValueDisallowContacts, "InputPrivacyValueDisallowContacts", "TLInputPrivacyRule", TLValue::Kind::Type },
+    { TLValue::UpdateStickerSetsOrder, "UpdateStickerSetsOrder", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::PrivacyValueDisallowUsers, "PrivacyValueDisallowUsers", "TLPrivacyRule", TLValue::Kind::Type },
+    { TLValue::Channel, "Channel", "TLChat", TLValue::Kind::Type },
+    { TLValue::InputPrivacyValueAllowContacts, "InputPrivacyValueAllowContacts", "TLInputPrivacyRule", TLValue::Kind::Type },
+    { TLValue::MessagesGetCommonChats, "MessagesGetCommonChats", "TLMessagesChats", TLValue::Kind::Function },
+    { TLValue::UsersGetUsers, "UsersGetUsers", "TLVector<TLUser>", TLValue::Kind::Function },
+    { TLValue::HelpRecentMeUrls, "HelpRecentMeUrls", "TLHelpRecentMeUrls", TLValue::Kind::Type },
+    { TLValue::PhotoSizeEmpty, "PhotoSizeEmpty", "TLPhotoSize", TLValue::Kind::Type },
+    { TLValue::MessagesReadHistory, "MessagesReadHistory", "TLMessagesAffectedMessages", TLValue::Kind::Function },
+    { TLValue::UpdateBotInlineSend, "UpdateBotInlineSend", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::DocumentAttributeVideo, "DocumentAttributeVideo", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::MessagesReadMentions, "MessagesReadMentions", "TLMessagesAffectedHistory", TLValue::Kind::Function },
+    { TLValue::UserFull, "UserFull", "TLUserFull", TLValue::Kind::Type },
+    { TLValue::MessagesGetInlineGameHighScores, "MessagesGetInlineGameHighScores", "TLMessagesHighScores", TLValue::Kind::Function },
+    { TLValue::StorageFileWebp, "StorageFileWebp", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::UpdateLangPackTooLong, "UpdateLangPackTooLong", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ChannelsCheckUsername, "ChannelsCheckUsername", "TLBool", TLValue::Kind::Function },
+    { TLValue::GeoPointEmpty, "GeoPointEmpty", "TLGeoPoint", TLValue::Kind::Type },
+    { TLValue::LangPackLanguage, "LangPackLanguage", "TLLangPackLanguage", TLValue::Kind::Type },
+    { TLValue::DocumentAttributeAnimated, "DocumentAttributeAnimated", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::UpdateShortSentMessage, "UpdateShortSentMessage", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::ContactsSearch, "ContactsSearch", "TLContactsFound", TLValue::Kind::Function },
+    { TLValue::ChannelsGetParticipants, "ChannelsGetParticipants", "TLChannelsChannelParticipants", TLValue::Kind::Function },
+    { TLValue::AccountAuthorizations, "AccountAuthorizations", "TLAccountAuthorizations", TLValue::Kind::Type },
+    { TLValue::StickerPack, "StickerPack", "TLStickerPack", TLValue::Kind::Type },
+    { TLValue::AccountGetNotifySettings, "AccountGetNotifySettings", "TLPeerNotifySettings", TLValue::Kind::Function },
+    { TLValue::UpdateUserPhone, "UpdateUserPhone", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdateNewEncryptedMessage, "UpdateNewEncryptedMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::PageBlockSlideshow, "PageBlockSlideshow", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::InputPrivacyValueAllowUsers, "InputPrivacyValueAllowUsers", "TLInputPrivacyRule", TLValue::Kind::Type },
+    { TLValue::PageBlockUnsupported, "PageBlockUnsupported", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::AuthPasswordRecovery, "AuthPasswordRecovery", "TLAuthPasswordRecovery", TLValue::Kind::Type },
+    { TLValue::EncryptedChatDiscarded, "EncryptedChatDiscarded", "TLEncryptedChat", TLValue::Kind::Type },
+    { TLValue::ChannelsEditAbout, "ChannelsEditAbout", "TLBool", TLValue::Kind::Function },
+    { TLValue::ChannelParticipantsBanned, "ChannelParticipantsBanned", "TLChannelParticipantsFilter", TLValue::Kind::Type },
+    { TLValue::InputFileLocation, "InputFileLocation", "TLInputFileLocation", TLValue::Kind::Type },
+    { TLValue::TopPeerCategoryBotsInline, "TopPeerCategoryBotsInline", "TLTopPeerCategory", TLValue::Kind::Type },
+    { TLValue::PhotosPhotosSlice, "PhotosPhotosSlice", "TLPhotosPhotos", TLValue::Kind::Type },
+    { TLValue::AccountSendConfirmPhoneCode, "AccountSendConfirmPhoneCode", "TLAuthSentCode", TLValue::Kind::Function },
+    { TLValue::DocumentAttributeFilename, "DocumentAttributeFilename", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::MessagesMigrateChat, "MessagesMigrateChat", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::MessagesSetInlineGameScore, "MessagesSetInlineGameScore", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesDialogs, "MessagesDialogs", "TLMessagesDialogs", TLValue::Kind::Type },
+    { TLValue::ChannelParticipant, "ChannelParticipant", "TLChannelParticipant", TLValue::Kind::Type },
+    { TLValue::TopPeerCategoryChannels, "TopPeerCategoryChannels", "TLTopPeerCategory", TLValue::Kind::Type },
+    { TLValue::FoundGif, "FoundGif", "TLFoundGif", TLValue::Kind::Type },
+    { TLValue::UpdateShortChatMessage, "UpdateShortChatMessage", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::SendMessageTypingAction, "SendMessageTypingAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateEncryptedChatTyping, "UpdateEncryptedChatTyping", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::SendMessageGeoLocationAction, "SendMessageGeoLocationAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::InputPeerChat, "InputPeerChat", "TLInputPeer", TLValue::Kind::Type },
+    { TLValue::HelpSupport, "HelpSupport", "TLHelpSupport", TLValue::Kind::Type },
+    { TLValue::PhoneReceivedCall, "PhoneReceivedCall", "TLBool", TLValue::Kind::Function },
+    { TLValue::BotInlineMediaResult, "BotInlineMediaResult", "TLBotInlineResult", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionParticipantJoin, "ChannelAdminLogEventActionParticipantJoin", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::InputEncryptedFileEmpty, "InputEncryptedFileEmpty", "TLInputEncryptedFile", TLValue::Kind::Type },
+    { TLValue::InputPrivacyValueAllowAll, "InputPrivacyValueAllowAll", "TLInputPrivacyRule", TLValue::Kind::Type },
+    { TLValue::InputDocument, "InputDocument", "TLInputDocument", TLValue::Kind::Type },
+    { TLValue::HelpInviteText, "HelpInviteText", "TLHelpInviteText", TLValue::Kind::Type },
+    { TLValue::MessagesGetDialogs, "MessagesGetDialogs", "TLMessagesDialogs", TLValue::Kind::Function },
+    { TLValue::InputNotifyUsers, "InputNotifyUsers", "TLInputNotifyPeer", TLValue::Kind::Type },
+    { TLValue::ChannelsInviteToChannel, "ChannelsInviteToChannel", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ContactsFound, "ContactsFound", "TLContactsFound", TLValue::Kind::Type },
+    { TLValue::ContactsResetTopPeerRating, "ContactsResetTopPeerRating", "TLBool", TLValue::Kind::Function },
+    { TLValue::UploadReuploadCdnFile, "UploadReuploadCdnFile", "TLVector<TLCdnFileHash>", TLValue::Kind::Function },
+    { TLValue::AuthSignUp, "AuthSignUp", "TLAuthAuthorization", TLValue::Kind::Function },
+    { TLValue::UpdateEditChannelMessage, "UpdateEditChannelMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionToggleInvites, "ChannelAdminLogEventActionToggleInvites", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::PhoneCallWaiting, "PhoneCallWaiting", "TLPhoneCall", TLValue::Kind::Type },
+    { TLValue::UpdateUserStatus, "UpdateUserStatus", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesDeleteHistory, "MessagesDeleteHistory", "TLMessagesAffectedHistory", TLValue::Kind::Function },
+    { TLValue::ContactsBlocked, "ContactsBlocked", "TLContactsBlocked", TLValue::Kind::Type },
+    { TLValue::PhoneSetCallRating, "PhoneSetCallRating", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::MessagesGetAllStickers, "MessagesGetAllStickers", "TLMessagesAllStickers", TLValue::Kind::Function },
+    { TLValue::InputChatPhotoEmpty, "InputChatPhotoEmpty", "TLInputChatPhoto", TLValue::Kind::Type },
+    { TLValue::Vector, "Vector", "TLVector t", TLValue::Kind::Type },
+    { TLValue::InputPhotoEmpty, "InputPhotoEmpty", "TLInputPhoto", TLValue::Kind::Type },
+    { TLValue::InputReportReasonViolence, "InputReportReasonViolence", "TLReportReason", TLValue::Kind::Type },
+    { TLValue::InputPhoneCall, "InputPhoneCall", "TLInputPhoneCall", TLValue::Kind::Type },
+    { TLValue::TopPeerCategoryPhoneCalls, "TopPeerCategoryPhoneCalls", "TLTopPeerCategory", TLValue::Kind::Type },
+    { TLValue::PostAddress, "PostAddress", "TLPostAddress", TLValue::Kind::Type },
+    { TLValue::AuthCancelCode, "AuthCancelCode", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateNewMessage, "UpdateNewMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ExportedMessageLink, "ExportedMessageLink", "TLExportedMessageLink", TLValue::Kind::Type },
+    { TLValue::ChannelsToggleSignatures, "ChannelsToggleSignatures", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::HelpGetNearestDc, "HelpGetNearestDc", "TLNearestDc", TLValue::Kind::Function },
+    { TLValue::UploadGetCdnFile, "UploadGetCdnFile", "TLUploadCdnFile", TLValue::Kind::Function },
+    { TLValue::UserEmpty, "UserEmpty", "TLUser", TLValue::Kind::Type },
+    { TLValue::PhotosPhoto, "PhotosPhoto", "TLPhotosPhoto", TLValue::Kind::Type },
+    { TLValue::GeoPoint, "GeoPoint", "TLGeoPoint", TLValue::Kind::Type },
+    { TLValue::UpdatesChannelDifference, "UpdatesChannelDifference", "TLUpdatesChannelDifference", TLValue::Kind::Type },
+    { TLValue::InputMessageEntityMentionName, "InputMessageEntityMentionName", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::InputPeerChannel, "InputPeerChannel", "TLInputPeer", TLValue::Kind::Type },
+    { TLValue::ChannelsEditAdmin, "ChannelsEditAdmin", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::RpcError, "RpcError", "TLRpcError", TLValue::Kind::Type },
+    { TLValue::MessagesGetFavedStickers, "MessagesGetFavedStickers", "TLMessagesFavedStickers", TLValue::Kind::Function },
+    { TLValue::UploadWebFile, "UploadWebFile", "TLUploadWebFile", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantBanned, "ChannelParticipantBanned", "TLChannelParticipant", TLValue::Kind::Type },
+    { TLValue::AuthCodeTypeFlashCall, "AuthCodeTypeFlashCall", "TLAuthCodeType", TLValue::Kind::Type },
+    { TLValue::PaymentsGetSavedInfo, "PaymentsGetSavedInfo", "TLPaymentsSavedInfo", TLValue::Kind::Function },
+    { TLValue::PhotoEmpty, "PhotoEmpty", "TLPhoto", TLValue::Kind::Type },
+    { TLValue::EncryptedMessageService, "EncryptedMessageService", "TLEncryptedMessage", TLValue::Kind::Type },
+    { TLValue::SendMessageUploadRoundAction, "SendMessageUploadRoundAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::AccountSetAccountTTL, "AccountSetAccountTTL", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesGetRecentLocations, "MessagesGetRecentLocations", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::ChannelsJoinChannel, "ChannelsJoinChannel", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::UploadGetWebFile, "UploadGetWebFile", "TLUploadWebFile", TLValue::Kind::Function },
+    { TLValue::MessagesGetWebPagePreview, "MessagesGetWebPagePreview", "TLMessageMedia", TLValue::Kind::Function },
+    { TLValue::UpdateContactRegistered, "UpdateContactRegistered", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::KeyboardButtonUrl, "KeyboardButtonUrl", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::UpdatesGetDifference, "UpdatesGetDifference", "TLUpdatesDifference", TLValue::Kind::Function },
+    { TLValue::UpdateReadChannelOutbox, "UpdateReadChannelOutbox", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesGetStickerSet, "MessagesGetStickerSet", "TLMessagesStickerSet", TLValue::Kind::Function },
+    { TLValue::PageBlockBlockquote, "PageBlockBlockquote", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ContactLinkHasPhone, "ContactLinkHasPhone", "TLContactLink", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionToggleSignatures, "ChannelAdminLogEventActionToggleSignatures", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::MessagesMessageEditData, "MessagesMessageEditData", "TLMessagesMessageEditData", TLValue::Kind::Type },
+    { TLValue::MessagesGetDhConfig, "MessagesGetDhConfig", "TLMessagesDhConfig", TLValue::Kind::Function },
+    { TLValue::AccountCheckUsername, "AccountCheckUsername", "TLBool", TLValue::Kind::Function },
+    { TLValue::MsgDetailedInfo, "MsgDetailedInfo", "TLMsgDetailedInfo", TLValue::Kind::Type },
+    { TLValue::PhoneSaveCallDebug, "PhoneSaveCallDebug", "TLBool", TLValue::Kind::Function },
+    { TLValue::ChannelForbidden, "ChannelForbidden", "TLChat", TLValue::Kind::Type },
+    { TLValue::MessageEntityCode, "MessageEntityCode", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::PageBlockEmbedPost, "PageBlockEmbedPost", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::InputBotInlineMessageMediaAuto, "InputBotInlineMessageMediaAuto", "TLInputBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::LangPackStringDeleted, "LangPackStringDeleted", "TLLangPackString", TLValue::Kind::Type },
+    { TLValue::PaymentsSendPaymentForm, "PaymentsSendPaymentForm", "TLPaymentsPaymentResult", TLValue::Kind::Function },
+    { TLValue::MessagesDhConfig, "MessagesDhConfig", "TLMessagesDhConfig", TLValue::Kind::Type },
+    { TLValue::ContactsImportContacts, "ContactsImportContacts", "TLContactsImportedContacts", TLValue::Kind::Function },
+    { TLValue::InputBotInlineResult, "InputBotInlineResult", "TLInputBotInlineResult", TLValue::Kind::Type },
+    { TLValue::MessagesGetPeerDialogs, "MessagesGetPeerDialogs", "TLMessagesPeerDialogs", TLValue::Kind::Function },
+    { TLValue::MessagesGetFeaturedStickers, "MessagesGetFeaturedStickers", "TLMessagesFeaturedStickers", TLValue::Kind::Function },
+    { TLValue::InputBotInlineMessageMediaContact, "InputBotInlineMessageMediaContact", "TLInputBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::InputEncryptedFileBigUploaded, "InputEncryptedFileBigUploaded", "TLInputEncryptedFile", TLValue::Kind::Type },
+    { TLValue::ChatFull, "ChatFull", "TLChatFull", TLValue::Kind::Type },
+    { TLValue::MessagesSavedGifs, "MessagesSavedGifs", "TLMessagesSavedGifs", TLValue::Kind::Type },
+    { TLValue::User, "User", "TLUser", TLValue::Kind::Type },
+    { TLValue::LangpackGetStrings, "LangpackGetStrings", "TLVector<TLLangPackString>", TLValue::Kind::Function },
+    { TLValue::InputReportReasonPornography, "InputReportReasonPornography", "TLReportReason", TLValue::Kind::Type },
+    { TLValue::MessageMediaVenue, "MessageMediaVenue", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::PhoneConfirmCall, "PhoneConfirmCall", "TLPhonePhoneCall", TLValue::Kind::Function },
+    { TLValue::UpdateReadHistoryOutbox, "UpdateReadHistoryOutbox", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::InputMediaUploadedPhoto, "InputMediaUploadedPhoto", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::GzipPacked, "GzipPacked", "TLObject", TLValue::Kind::Type },
+    { TLValue::PageBlockAudio, "PageBlockAudio", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::MessagesSaveGif, "MessagesSaveGif", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesToggleDialogPin, "MessagesToggleDialogPin", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesGetWebPage, "MessagesGetWebPage", "TLWebPage", TLValue::Kind::Function },
+    { TLValue::MessagesSendEncryptedService, "MessagesSendEncryptedService", "TLMessagesSentEncryptedMessage", TLValue::Kind::Function },
+    { TLValue::ContactsBlock, "ContactsBlock", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdatePtsChanged, "UpdatePtsChanged", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesPeerDialogs, "MessagesPeerDialogs", "TLMessagesPeerDialogs", TLValue::Kind::Type },
+    { TLValue::MessagesGetDocumentByHash, "MessagesGetDocumentByHash", "TLDocument", TLValue::Kind::Function },
+    { TLValue::MessagesForwardMessage, "MessagesForwardMessage", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ChannelsGetAdminLog, "ChannelsGetAdminLog", "TLChannelsAdminLogResults", TLValue::Kind::Function },
+    { TLValue::StickerSetMultiCovered, "StickerSetMultiCovered", "TLStickerSetCovered", TLValue::Kind::Type },
+    { TLValue::InputPaymentCredentials, "InputPaymentCredentials", "TLInputPaymentCredentials", TLValue::Kind::Type },
+    { TLValue::Pong, "Pong", "TLPong", TLValue::Kind::Type },
+    { TLValue::HelpGetTermsOfService, "HelpGetTermsOfService", "TLHelpTermsOfService", TLValue::Kind::Function },
+    { TLValue::ReplyKeyboardMarkup, "ReplyKeyboardMarkup", "TLReplyMarkup", TLValue::Kind::Type },
+    { TLValue::ChannelsUpdateUsername, "ChannelsUpdateUsername", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessageEntityMentionName, "MessageEntityMentionName", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::MessagesStickerSetInstallResultArchive, "MessagesStickerSetInstallResultArchive", "TLMessagesStickerSetInstallResult", TLValue::Kind::Type },
+    { TLValue::BotInlineMessageMediaContact, "BotInlineMessageMediaContact", "TLBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::MessagesBotCallbackAnswer, "MessagesBotCallbackAnswer", "TLMessagesBotCallbackAnswer", TLValue::Kind::Type },
+    { TLValue::MessagesGetPeerSettings, "MessagesGetPeerSettings", "TLPeerSettings", TLValue::Kind::Function },
+    { TLValue::MessagesReadMessageContents, "MessagesReadMessageContents", "TLMessagesAffectedMessages", TLValue::Kind::Function },
+    { TLValue::DocumentEmpty, "DocumentEmpty", "TLDocument", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterMusic, "InputMessagesFilterMusic", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::ChatPhotoEmpty, "ChatPhotoEmpty", "TLChatPhoto", TLValue::Kind::Type },
+    { TLValue::MessagesStickerSetInstallResultSuccess, "MessagesStickerSetInstallResultSuccess", "TLMessagesStickerSetInstallResult", TLValue::Kind::Type },
+    { TLValue::InputPeerNotifySettings, "InputPeerNotifySettings", "TLInputPeerNotifySettings", TLValue::Kind::Type },
+    { TLValue::AccountUpdateDeviceLocked, "AccountUpdateDeviceLocked", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateEncryptedMessagesRead, "UpdateEncryptedMessagesRead", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesSaveRecentSticker, "MessagesSaveRecentSticker", "TLBool", TLValue::Kind::Function },
+    { TLValue::PageBlockCover, "PageBlockCover", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterChatPhotos, "InputMessagesFilterChatPhotos", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::PageBlockList, "PageBlockList", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ContactsLink, "ContactsLink", "TLContactsLink", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEvent, "ChannelAdminLogEvent", "TLChannelAdminLogEvent", TLValue::Kind::Type },
+    { TLValue::MessagesGetFullChat, "MessagesGetFullChat", "TLMessagesChatFull", TLValue::Kind::Function },
+    { TLValue::DhGenOk, "DhGenOk", "TLSetClientDHParamsAnswer", TLValue::Kind::Type },
+    { TLValue::PhoneAcceptCall, "PhoneAcceptCall", "TLPhonePhoneCall", TLValue::Kind::Function },
+    { TLValue::EncryptedChatWaiting, "EncryptedChatWaiting", "TLEncryptedChat", TLValue::Kind::Type },
+    { TLValue::InlineBotSwitchPM, "InlineBotSwitchPM", "TLInlineBotSwitchPM", TLValue::Kind::Type },
+    { TLValue::TextUrl, "TextUrl", "TLRichText", TLValue::Kind::Type },
+    { TLValue::MessagesGetChats, "MessagesGetChats", "TLMessagesChats", TLValue::Kind::Function },
+    { TLValue::PrivacyKeyPhoneCall, "PrivacyKeyPhoneCall", "TLPrivacyKey", TLValue::Kind::Type },
+    { TLValue::AuthSentCodeTypeApp, "AuthSentCodeTypeApp", "TLAuthSentCodeType", TLValue::Kind::Type },
+    { TLValue::MessagesAcceptEncryption, "MessagesAcceptEncryption", "TLEncryptedChat", TLValue::Kind::Function },
+    { TLValue::HelpGetRecentMeUrls, "HelpGetRecentMeUrls", "TLHelpRecentMeUrls", TLValue::Kind::Function },
+    { TLValue::InvokeAfterMsgs, "InvokeAfterMsgs", "TLX", TLValue::Kind::Function },
+    { TLValue::InputBotInlineMessageText, "InputBotInlineMessageText", "TLInputBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::MessageMediaEmpty, "MessageMediaEmpty", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::AccountUpdateUsername, "AccountUpdateUsername", "TLUser", TLValue::Kind::Function },
+    { TLValue::UpdatesChannelDifferenceEmpty, "UpdatesChannelDifferenceEmpty", "TLUpdatesChannelDifference", TLValue::Kind::Type },
+    { TLValue::MessagesCheckChatInvite, "MessagesCheckChatInvite", "TLChatInvite", TLValue::Kind::Function },
+    { TLValue::AuthResendCode, "AuthResendCode", "TLAuthSentCode", TLValue::Kind::Function },
+    { TLValue::ChatParticipants, "ChatParticipants", "TLChatParticipants", TLValue::Kind::Type },
+    { TLValue::PaymentsPaymentForm, "PaymentsPaymentForm", "TLPaymentsPaymentForm", TLValue::Kind::Type },
+    { TLValue::True, "True", "TLTrue", TLValue::Kind::Type },
+    { TLValue::MessageActionPaymentSent, "MessageActionPaymentSent", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateChannelWebPage, "UpdateChannelWebPage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::StorageFilePartial, "StorageFilePartial", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::AccountDeleteAccount, "AccountDeleteAccount", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateReadChannelInbox, "UpdateReadChannelInbox", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesGetMessages, "MessagesGetMessages", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionDeleteMessage, "ChannelAdminLogEventActionDeleteMessage", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::InputDocumentFileLocation, "InputDocumentFileLocation", "TLInputFileLocation", TLValue::Kind::Type },
+    { TLValue::BotInlineMessageMediaVenue, "BotInlineMessageMediaVenue", "TLBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::UpdateStickerSets, "UpdateStickerSets", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesFoundGifs, "MessagesFoundGifs", "TLMessagesFoundGifs", TLValue::Kind::Type },
+    { TLValue::MessagesGetUnreadMentions, "MessagesGetUnreadMentions", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::PageBlockParagraph, "PageBlockParagraph", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::DhGenRetry, "DhGenRetry", "TLSetClientDHParamsAnswer", TLValue::Kind::Type },
+    { TLValue::RecentMeUrlUnknown, "RecentMeUrlUnknown", "TLRecentMeUrl", TLValue::Kind::Type },
+    { TLValue::MessageActionScreenshotTaken, "MessageActionScreenshotTaken", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::InputMediaGifExternal, "InputMediaGifExternal", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::PageBlockFooter, "PageBlockFooter", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::MessageActionChatAddUser, "MessageActionChatAddUser", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::ReplyInlineMarkup, "ReplyInlineMarkup", "TLReplyMarkup", TLValue::Kind::Type },
+    { TLValue::ChannelsToggleInvites, "ChannelsToggleInvites", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::EncryptedFile, "EncryptedFile", "TLEncryptedFile", TLValue::Kind::Type },
+    { TLValue::AccountGetTmpPassword, "AccountGetTmpPassword", "TLAccountTmpPassword", TLValue::Kind::Function },
+    { TLValue::InputNotifyChats, "InputNotifyChats", "TLInputNotifyPeer", TLValue::Kind::Type },
+    { TLValue::InputStickeredMediaPhoto, "InputStickeredMediaPhoto", "TLInputStickeredMedia", TLValue::Kind::Type },
+    { TLValue::UpdatesDifferenceTooLong, "UpdatesDifferenceTooLong", "TLUpdatesDifference", TLValue::Kind::Type },
+    { TLValue::StorageFileMov, "StorageFileMov", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::MessagesReportEncryptedSpam, "MessagesReportEncryptedSpam", "TLBool", TLValue::Kind::Function },
+    { TLValue::InputBotInlineMessageGame, "InputBotInlineMessageGame", "TLInputBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::HelpGetInviteText, "HelpGetInviteText", "TLHelpInviteText", TLValue::Kind::Function },
+    { TLValue::PrivacyValueAllowUsers, "PrivacyValueAllowUsers", "TLPrivacyRule", TLValue::Kind::Type },
+    { TLValue::PaymentsPaymentResult, "PaymentsPaymentResult", "TLPaymentsPaymentResult", TLValue::Kind::Type },
+    { TLValue::UpdateMessageID, "UpdateMessageID", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::AuthRecoverPassword, "AuthRecoverPassword", "TLAuthAuthorization", TLValue::Kind::Function },
+    { TLValue::UserProfilePhotoEmpty, "UserProfilePhotoEmpty", "TLUserProfilePhoto", TLValue::Kind::Type },
+    { TLValue::PhotosUploadProfilePhoto, "PhotosUploadProfilePhoto", "TLPhotosPhoto", TLValue::Kind::Function },
+    { TLValue::PageBlockPullquote, "PageBlockPullquote", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::InputPrivacyKeyStatusTimestamp, "InputPrivacyKeyStatusTimestamp", "TLInputPrivacyKey", TLValue::Kind::Type },
+    { TLValue::InputBotInlineResultGame, "InputBotInlineResultGame", "TLInputBotInlineResult", TLValue::Kind::Type },
+    { TLValue::MessagesArchivedStickers, "MessagesArchivedStickers", "TLMessagesArchivedStickers", TLValue::Kind::Type },
+    { TLValue::ContactsImportCard, "ContactsImportCard", "TLUser", TLValue::Kind::Function },
+    { TLValue::PaymentsPaymentReceipt, "PaymentsPaymentReceipt", "TLPaymentsPaymentReceipt", TLValue::Kind::Type },
+    { TLValue::PrivacyKeyChatInvite, "PrivacyKeyChatInvite", "TLPrivacyKey", TLValue::Kind::Type },
+    { TLValue::PhoneCallDiscarded, "PhoneCallDiscarded", "TLPhoneCall", TLValue::Kind::Type },
+    { TLValue::KeyboardButtonGame, "KeyboardButtonGame", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterVoice, "InputMessagesFilterVoice", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::MessagesGetInlineBotResults, "MessagesGetInlineBotResults", "TLMessagesBotResults", TLValue::Kind::Function },
+    { TLValue::MessagesUploadMedia, "MessagesUploadMedia", "TLMessageMedia", TLValue::Kind::Function },
+    { TLValue::MessageActionChatMigrateTo, "MessageActionChatMigrateTo", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::HelpGetCdnConfig, "HelpGetCdnConfig", "TLCdnConfig", TLValue::Kind::Function },
+    { TLValue::StorageFileMp3, "StorageFileMp3", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::AuthSentCodeTypeCall, "AuthSentCodeTypeCall", "TLAuthSentCodeType", TLValue::Kind::Type },
+    { TLValue::PhoneCallEmpty, "PhoneCallEmpty", "TLPhoneCall", TLValue::Kind::Type },
+    { TLValue::FileLocation, "FileLocation", "TLFileLocation", TLValue::Kind::Type },
+    { TLValue::ChannelsGetParticipant, "ChannelsGetParticipant", "TLChannelsChannelParticipant", TLValue::Kind::Function },
+    { TLValue::UpdateBotInlineQuery, "UpdateBotInlineQuery", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::AccountGetPassword, "AccountGetPassword", "TLAccountPassword", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionChangeAbout, "ChannelAdminLogEventActionChangeAbout", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::PhoneGetCallConfig, "PhoneGetCallConfig", "TLDataJSON", TLValue::Kind::Function },
+    { TLValue::AccountPrivacyRules, "AccountPrivacyRules", "TLAccountPrivacyRules", TLValue::Kind::Type },
+    { TLValue::PageFull, "PageFull", "TLPage", TLValue::Kind::Type },
+    { TLValue::MessagesReceivedQueue, "MessagesReceivedQueue", "TLVector<quint64>", TLValue::Kind::Function },
+    { TLValue::UpdateLangPack, "UpdateLangPack", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesSentEncryptedMessage, "MessagesSentEncryptedMessage", "TLMessagesSentEncryptedMessage", TLValue::Kind::Type },
+    { TLValue::ContactBlocked, "ContactBlocked", "TLContactBlocked", TLValue::Kind::Type },
+    { TLValue::ChannelsEditTitle, "ChannelsEditTitle", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::Null, "Null", "TLNull", TLValue::Kind::Type },
+    { TLValue::MessageMediaGeo, "MessageMediaGeo", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterPhotoVideo, "InputMessagesFilterPhotoVideo", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::AuthLogOut, "AuthLogOut", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateReadFeaturedStickers, "UpdateReadFeaturedStickers", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::CdnConfig, "CdnConfig", "TLCdnConfig", TLValue::Kind::Type },
+    { TLValue::PhoneCallDiscardReasonHangup, "PhoneCallDiscardReasonHangup", "TLPhoneCallDiscardReason", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterEmpty, "InputMessagesFilterEmpty", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::MessagesGetArchivedStickers, "MessagesGetArchivedStickers", "TLMessagesArchivedStickers", TLValue::Kind::Function },
+    { TLValue::ChannelBannedRights, "ChannelBannedRights", "TLChannelBannedRights", TLValue::Kind::Type },
+    { TLValue::InputReportReasonSpam, "InputReportReasonSpam", "TLReportReason", TLValue::Kind::Type },
+    { TLValue::RpcDropAnswer, "RpcDropAnswer", "TLRpcDropAnswer", TLValue::Kind::Function },
+    { TLValue::HighScore, "HighScore", "TLHighScore", TLValue::Kind::Type },
+    { TLValue::ContactsDeleteContacts, "ContactsDeleteContacts", "TLBool", TLValue::Kind::Function },
+    { TLValue::InputEncryptedFile, "InputEncryptedFile", "TLInputEncryptedFile", TLValue::Kind::Type },
+    { TLValue::ChatInviteAlready, "ChatInviteAlready", "TLChatInvite", TLValue::Kind::Type },
+    { TLValue::InputMediaDocument, "InputMediaDocument", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::MessagesReadFeaturedStickers, "MessagesReadFeaturedStickers", "TLBool", TLValue::Kind::Function },
+    { TLValue::PhoneRequestCall, "PhoneRequestCall", "TLPhonePhoneCall", TLValue::Kind::Function },
+    { TLValue::UpdateUserTyping, "UpdateUserTyping", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::PopularContact, "PopularContact", "TLPopularContact", TLValue::Kind::Type },
+    { TLValue::MessagesRecentStickers, "MessagesRecentStickers", "TLMessagesRecentStickers", TLValue::Kind::Type },
+    { TLValue::UpdateBotPrecheckoutQuery, "UpdateBotPrecheckoutQuery", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdatesDifferenceEmpty, "UpdatesDifferenceEmpty", "TLUpdatesDifference", TLValue::Kind::Type },
+    { TLValue::ChannelAdminRights, "ChannelAdminRights", "TLChannelAdminRights", TLValue::Kind::Type },
+    { TLValue::AuthSentCode, "AuthSentCode", "TLAuthSentCode", TLValue::Kind::Type },
+    { TLValue::RpcAnswerUnknown, "RpcAnswerUnknown", "TLRpcDropAnswer", TLValue::Kind::Type },
+    { TLValue::MessageMediaContact, "MessageMediaContact", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::MessagesGetRecentStickers, "MessagesGetRecentStickers", "TLMessagesRecentStickers", TLValue::Kind::Function },
+    { TLValue::WebPage, "WebPage", "TLWebPage", TLValue::Kind::Type },
+    { TLValue::AccountConfirmPhone, "AccountConfirmPhone", "TLBool", TLValue::Kind::Function },
+    { TLValue::ContactLinkUnknown, "ContactLinkUnknown", "TLContactLink", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionTogglePreHistoryHidden, "ChannelAdminLogEventActionTogglePreHistoryHidden", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::ReqPq, "ReqPq", "TLResPQ", TLValue::Kind::Function },
+    { TLValue::ChatPhoto, "ChatPhoto", "TLChatPhoto", TLValue::Kind::Type },
+    { TLValue::SendMessageChooseContactAction, "SendMessageChooseContactAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateNewChannelMessage, "UpdateNewChannelMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::DestroySessionNone, "DestroySessionNone", "TLDestroySessionRes", TLValue::Kind::Type },
+    { TLValue::MsgsAck, "MsgsAck", "TLMsgsAck", TLValue::Kind::Type },
+    { TLValue::WallPaperSolid, "WallPaperSolid", "TLWallPaper", TLValue::Kind::Type },
+    { TLValue::DocumentAttributeSticker, "DocumentAttributeSticker", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::AccountRegisterDevice, "AccountRegisterDevice", "TLBool", TLValue::Kind::Function },
+    { TLValue::StickerSetCovered, "StickerSetCovered", "TLStickerSetCovered", TLValue::Kind::Type },
+    { TLValue::InputEncryptedFileUploaded, "InputEncryptedFileUploaded", "TLInputEncryptedFile", TLValue::Kind::Type },
+    { TLValue::MessageEntityEmail, "MessageEntityEmail", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::MessagesChats, "MessagesChats", "TLMessagesChats", TLValue::Kind::Type },
+    { TLValue::PrivacyValueAllowAll, "PrivacyValueAllowAll", "TLPrivacyRule", TLValue::Kind::Type },
+    { TLValue::MessagesGetMaskStickers, "MessagesGetMaskStickers", "TLMessagesAllStickers", TLValue::Kind::Function },
+    { TLValue::AccountUnregisterDevice, "AccountUnregisterDevice", "TLBool", TLValue::Kind::Function },
+    { TLValue::AccountUpdateStatus, "AccountUpdateStatus", "TLBool", TLValue::Kind::Function },
+    { TLValue::ClientDHInnerData, "ClientDHInnerData", "TLClientDHInnerData", TLValue::Kind::Type },
+    { TLValue::TextBold, "TextBold", "TLRichText", TLValue::Kind::Type },
+    { TLValue::AuthImportBotAuthorization, "AuthImportBotAuthorization", "TLAuthAuthorization", TLValue::Kind::Function },
+    { TLValue::KeyboardButtonCallback, "KeyboardButtonCallback", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::UpdateNewStickerSet, "UpdateNewStickerSet", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdateReadMessagesContents, "UpdateReadMessagesContents", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ChatInviteEmpty, "ChatInviteEmpty", "TLExportedChatInvite", TLValue::Kind::Type },
+    { TLValue::MessagesGetAllDrafts, "MessagesGetAllDrafts", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionChangeUsername, "ChannelAdminLogEventActionChangeUsername", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::UpdatesChannelDifferenceTooLong, "UpdatesChannelDifferenceTooLong", "TLUpdatesChannelDifference", TLValue::Kind::Type },
+    { TLValue::PaymentsPaymentVerficationNeeded, "PaymentsPaymentVerficationNeeded", "TLPaymentsPaymentResult", TLValue::Kind::Type },
+    { TLValue::DocumentAttributeImageSize, "DocumentAttributeImageSize", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::TextFixed, "TextFixed", "TLRichText", TLValue::Kind::Type },
+    { TLValue::LangPackStringPluralized, "LangPackStringPluralized", "TLLangPackString", TLValue::Kind::Type },
+    { TLValue::MessagesImportChatInvite, "MessagesImportChatInvite", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::MessageEntityBotCommand, "MessageEntityBotCommand", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::PhoneCallAccepted, "PhoneCallAccepted", "TLPhoneCall", TLValue::Kind::Type },
+    { TLValue::PeerNotifyEventsAll, "PeerNotifyEventsAll", "TLPeerNotifyEvents", TLValue::Kind::Type },
+    { TLValue::UpdateChatParticipantDelete, "UpdateChatParticipantDelete", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdateChatAdmins, "UpdateChatAdmins", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessageEntityUrl, "MessageEntityUrl", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::HelpSaveAppLog, "HelpSaveAppLog", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessageEntityHashtag, "MessageEntityHashtag", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::AuthCheckPhone, "AuthCheckPhone", "TLAuthCheckedPhone", TLValue::Kind::Function },
+    { TLValue::UpdateContactsReset, "UpdateContactsReset", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesForwardMessages, "MessagesForwardMessages", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionEditMessage, "ChannelAdminLogEventActionEditMessage", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::PeerNotifySettingsEmpty, "PeerNotifySettingsEmpty", "TLPeerNotifySettings", TLValue::Kind::Type },
+    { TLValue::PageBlockTitle, "PageBlockTitle", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ContactsTopPeers, "ContactsTopPeers", "TLContactsTopPeers", TLValue::Kind::Type },
+    { TLValue::AccountChangePhone, "AccountChangePhone", "TLUser", TLValue::Kind::Function },
+    { TLValue::UpdateChannelAvailableMessages, "UpdateChannelAvailableMessages", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesDialogsSlice, "MessagesDialogsSlice", "TLMessagesDialogs", TLValue::Kind::Type },
+    { TLValue::UpdatesCombined, "UpdatesCombined", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::AuthCodeTypeSms, "AuthCodeTypeSms", "TLAuthCodeType", TLValue::Kind::Type },
+    { TLValue::InputDocumentEmpty, "InputDocumentEmpty", "TLInputDocument", TLValue::Kind::Type },
+    { TLValue::MessageEntityPre, "MessageEntityPre", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::MsgContainer, "MsgContainer", "TLMessageContainer", TLValue::Kind::Type },
+    { TLValue::AuthCodeTypeCall, "AuthCodeTypeCall", "TLAuthCodeType", TLValue::Kind::Type },
+    { TLValue::TextPlain, "TextPlain", "TLRichText", TLValue::Kind::Type },
+    { TLValue::MessagesMessagesNotModified, "MessagesMessagesNotModified", "TLMessagesMessages", TLValue::Kind::Type },
+    { TLValue::Updates, "Updates", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::NotifyAll, "NotifyAll", "TLNotifyPeer", TLValue::Kind::Type },
+    { TLValue::MessageEntityTextUrl, "MessageEntityTextUrl", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::ChannelFull, "ChannelFull", "TLChatFull", TLValue::Kind::Type },
+    { TLValue::InputAppEvent, "InputAppEvent", "TLInputAppEvent", TLValue::Kind::Type },
+    { TLValue::PaymentsValidateRequestedInfo, "PaymentsValidateRequestedInfo", "TLPaymentsValidatedRequestedInfo", TLValue::Kind::Function },
+    { TLValue::AuthSendInvites, "AuthSendInvites", "TLBool", TLValue::Kind::Function },
+    { TLValue::KeyboardButtonRow, "KeyboardButtonRow", "TLKeyboardButtonRow", TLValue::Kind::Type },
+    { TLValue::PhotoSize, "PhotoSize", "TLPhotoSize", TLValue::Kind::Type },
+    { TLValue::ContactsImportedContacts, "ContactsImportedContacts", "TLContactsImportedContacts", TLValue::Kind::Type },
+    { TLValue::UserStatusLastMonth, "UserStatusLastMonth", "TLUserStatus", TLValue::Kind::Type },
+    { TLValue::CdnFileHash, "CdnFileHash", "TLCdnFileHash", TLValue::Kind::Type },
+    { TLValue::MessagesReorderStickerSets, "MessagesReorderStickerSets", "TLBool", TLValue::Kind::Function },
+    { TLValue::AccountUpdateProfile, "AccountUpdateProfile", "TLUser", TLValue::Kind::Function },
+    { TLValue::PhoneDiscardCall, "PhoneDiscardCall", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::UpdateShort, "UpdateShort", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::MessagesSetEncryptedTyping, "MessagesSetEncryptedTyping", "TLBool", TLValue::Kind::Function },
+    { TLValue::InputPaymentCredentialsAndroidPay, "InputPaymentCredentialsAndroidPay", "TLInputPaymentCredentials", TLValue::Kind::Type },
+    { TLValue::ServerDHParamsFail, "ServerDHParamsFail", "TLServerDHParams", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterRoundVoice, "InputMessagesFilterRoundVoice", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::Ping, "Ping", "TLPong", TLValue::Kind::Function },
+    { TLValue::InputMediaGeoLive, "InputMediaGeoLive", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::InputPeerUser, "InputPeerUser", "TLInputPeer", TLValue::Kind::Type },
+    { TLValue::Authorization, "Authorization", "TLAuthorization", TLValue::Kind::Type },
+    { TLValue::AccountPassword, "AccountPassword", "TLAccountPassword", TLValue::Kind::Type },
+    { TLValue::MessageMediaGeoLive, "MessageMediaGeoLive", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::MessageMediaDocument, "MessageMediaDocument", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::FileLocationUnavailable, "FileLocationUnavailable", "TLFileLocation", TLValue::Kind::Type },
+    { TLValue::DataJSON, "DataJSON", "TLDataJSON", TLValue::Kind::Type },
+    { TLValue::MsgResendReq, "MsgResendReq", "TLMsgResendReq", TLValue::Kind::Type },
+    { TLValue::MessagesExportChatInvite, "MessagesExportChatInvite", "TLExportedChatInvite", TLValue::Kind::Function },
+    { TLValue::InputPeerSelf, "InputPeerSelf", "TLInputPeer", TLValue::Kind::Type },
+    { TLValue::TextConcat, "TextConcat", "TLRichText", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterUrl, "InputMessagesFilterUrl", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::ContactsResolvedPeer, "ContactsResolvedPeer", "TLContactsResolvedPeer", TLValue::Kind::Type },
+    { TLValue::InputPeerEmpty, "InputPeerEmpty", "TLInputPeer", TLValue::Kind::Type },
+    { TLValue::MessagesReadEncryptedHistory, "MessagesReadEncryptedHistory", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateWebPage, "UpdateWebPage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessageActionChatEditPhoto, "MessageActionChatEditPhoto", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::LangpackGetLanguages, "LangpackGetLanguages", "TLVector<TLLangPackLanguage>", TLValue::Kind::Function },
+    { TLValue::MsgNewDetailedInfo, "MsgNewDetailedInfo", "TLMsgDetailedInfo", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterPhoneCalls, "InputMessagesFilterPhoneCalls", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::MessageActionPhoneCall, "MessageActionPhoneCall", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateUserBlocked, "UpdateUserBlocked", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesGetBotCallbackAnswer, "MessagesGetBotCallbackAnswer", "TLMessagesBotCallbackAnswer", TLValue::Kind::Function },
+    { TLValue::AuthCheckedPhone, "AuthCheckedPhone", "TLAuthCheckedPhone", TLValue::Kind::Type },
+    { TLValue::PeerSettings, "PeerSettings", "TLPeerSettings", TLValue::Kind::Type },
+    { TLValue::InputMediaPhoto, "InputMediaPhoto", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::MessageEntityItalic, "MessageEntityItalic", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::UpdateBotWebhookJSON, "UpdateBotWebhookJSON", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::PhoneCallRequested, "PhoneCallRequested", "TLPhoneCall", TLValue::Kind::Type },
+    { TLValue::MessagesGetSavedGifs, "MessagesGetSavedGifs", "TLMessagesSavedGifs", TLValue::Kind::Function },
+    { TLValue::PQInnerData, "PQInnerData", "TLPQInnerData", TLValue::Kind::Type },
+    { TLValue::MessageEmpty, "MessageEmpty", "TLMessage", TLValue::Kind::Type },
+    { TLValue::MessageMediaInvoice, "MessageMediaInvoice", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::AccountUpdateNotifySettings, "AccountUpdateNotifySettings", "TLBool", TLValue::Kind::Function },
+    { TLValue::ChannelsDeleteMessages, "ChannelsDeleteMessages", "TLMessagesAffectedMessages", TLValue::Kind::Function },
+    { TLValue::MessagesAffectedMessages, "MessagesAffectedMessages", "TLMessagesAffectedMessages", TLValue::Kind::Type },
+    { TLValue::ContactsExportCard, "ContactsExportCard", "TLVector<quint32>", TLValue::Kind::Function },
+    { TLValue::WebPageNotModified, "WebPageNotModified", "TLWebPage", TLValue::Kind::Type },
+    { TLValue::PhoneCallDiscardReasonMissed, "PhoneCallDiscardReasonMissed", "TLPhoneCallDiscardReason", TLValue::Kind::Type },
+    { TLValue::InputStickerSetShortName, "InputStickerSetShortName", "TLInputStickerSet", TLValue::Kind::Type },
+    { TLValue::StickersAddStickerToSet, "StickersAddStickerToSet", "TLMessagesStickerSet", TLValue::Kind::Function },
+    { TLValue::AccountPasswordInputSettings, "AccountPasswordInputSettings", "TLAccountPasswordInputSettings", TLValue::Kind::Type },
+    { TLValue::AuthSendCode, "AuthSendCode", "TLAuthSentCode", TLValue::Kind::Function },
+    { TLValue::Document, "Document", "TLDocument", TLValue::Kind::Type },
+    { TLValue::ContactsResetSaved, "ContactsResetSaved", "TLBool", TLValue::Kind::Function },
+    { TLValue::PhotosDeletePhotos, "PhotosDeletePhotos", "TLVector<quint64>", TLValue::Kind::Function },
+    { TLValue::SendMessageRecordRoundAction, "SendMessageRecordRoundAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::InputBotInlineMessageID, "InputBotInlineMessageID", "TLInputBotInlineMessageID", TLValue::Kind::Type },
+    { TLValue::InputChatPhoto, "InputChatPhoto", "TLInputChatPhoto", TLValue::Kind::Type },
+    { TLValue::HelpAppUpdate, "HelpAppUpdate", "TLHelpAppUpdate", TLValue::Kind::Type },
+    { TLValue::UpdateChannelReadMessagesContents, "UpdateChannelReadMessagesContents", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesClearRecentStickers, "MessagesClearRecentStickers", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesStickers, "MessagesStickers", "TLMessagesStickers", TLValue::Kind::Type },
+    { TLValue::PrivacyValueDisallowAll, "PrivacyValueDisallowAll", "TLPrivacyRule", TLValue::Kind::Type },
+    { TLValue::MessagesMessages, "MessagesMessages", "TLMessagesMessages", TLValue::Kind::Type },
+    { TLValue::BotInlineMessageText, "BotInlineMessageText", "TLBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::MsgsAllInfo, "MsgsAllInfo", "TLMsgsAllInfo", TLValue::Kind::Type },
+    { TLValue::ChannelsGetAdminedPublicChannels, "ChannelsGetAdminedPublicChannels", "TLMessagesChats", TLValue::Kind::Function },
+    { TLValue::RecentMeUrlUser, "RecentMeUrlUser", "TLRecentMeUrl", TLValue::Kind::Type },
+    { TLValue::PhotosPhotos, "PhotosPhotos", "TLPhotosPhotos", TLValue::Kind::Type },
+    { TLValue::NearestDc, "NearestDc", "TLNearestDc", TLValue::Kind::Type },
+    { TLValue::PagePart, "PagePart", "TLPage", TLValue::Kind::Type },
+    { TLValue::AuthDropTempAuthKeys, "AuthDropTempAuthKeys", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateDcOptions, "UpdateDcOptions", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ContactsDeleteContact, "ContactsDeleteContact", "TLContactsLink", TLValue::Kind::Function },
+    { TLValue::MessagesSetGameScore, "MessagesSetGameScore", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::MessageActionPaymentSentMe, "MessageActionPaymentSentMe", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::PageBlockSubtitle, "PageBlockSubtitle", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ContactsBlockedSlice, "ContactsBlockedSlice", "TLContactsBlocked", TLValue::Kind::Type },
+    { TLValue::HelpGetAppChangelog, "HelpGetAppChangelog", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::InputPrivacyValueDisallowUsers, "InputPrivacyValueDisallowUsers", "TLInputPrivacyRule", TLValue::Kind::Type },
+    { TLValue::PaymentRequestedInfo, "PaymentRequestedInfo", "TLPaymentRequestedInfo", TLValue::Kind::Type },
+    { TLValue::Message, "Message", "TLMessage", TLValue::Kind::Type },
+    { TLValue::UpdateShortMessage, "UpdateShortMessage", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::PhotosGetUserPhotos, "PhotosGetUserPhotos", "TLPhotosPhotos", TLValue::Kind::Function },
+    { TLValue::InputMediaInvoice, "InputMediaInvoice", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::InputChatUploadedPhoto, "InputChatUploadedPhoto", "TLInputChatPhoto", TLValue::Kind::Type },
+    { TLValue::Photo, "Photo", "TLPhoto", TLValue::Kind::Type },
+    { TLValue::HttpWait, "HttpWait", "TLHttpWait", TLValue::Kind::Type },
+    { TLValue::MessageActionGameScore, "MessageActionGameScore", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateSavedGifs, "UpdateSavedGifs", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ChannelsGetMessages, "ChannelsGetMessages", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::MessagesBotResults, "MessagesBotResults", "TLMessagesBotResults", TLValue::Kind::Type },
+    { TLValue::MessagesSentEncryptedFile, "MessagesSentEncryptedFile", "TLMessagesSentEncryptedMessage", TLValue::Kind::Type },
+    { TLValue::MessageActionPinMessage, "MessageActionPinMessage", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::ChannelMessagesFilterEmpty, "ChannelMessagesFilterEmpty", "TLChannelMessagesFilter", TLValue::Kind::Type },
+    { TLValue::UpdateUserPhoto, "UpdateUserPhoto", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesReorderPinnedDialogs, "MessagesReorderPinnedDialogs", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessageActionChannelCreate, "MessageActionChannelCreate", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::MessageActionChatDeletePhoto, "MessageActionChatDeletePhoto", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterPhotos, "InputMessagesFilterPhotos", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::InputMediaEmpty, "InputMediaEmpty", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::AccountNoPassword, "AccountNoPassword", "TLAccountPassword", TLValue::Kind::Type },
+    { TLValue::DocumentAttributeHasStickers, "DocumentAttributeHasStickers", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::DocumentAttributeAudio, "DocumentAttributeAudio", "TLDocumentAttribute", TLValue::Kind::Type },
+    { TLValue::UpdateChannelPinnedMessage, "UpdateChannelPinnedMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdateChannelMessageViews, "UpdateChannelMessageViews", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::BotInfo, "BotInfo", "TLBotInfo", TLValue::Kind::Type },
+    { TLValue::MessagesChannelMessages, "MessagesChannelMessages", "TLMessagesMessages", TLValue::Kind::Type },
+    { TLValue::UpdateReadHistoryInbox, "UpdateReadHistoryInbox", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::BoolTrue, "BoolTrue", "TLBool", TLValue::Kind::Type },
+    { TLValue::PaymentsGetPaymentForm, "PaymentsGetPaymentForm", "TLPaymentsPaymentForm", TLValue::Kind::Function },
+    { TLValue::MessagesHighScores, "MessagesHighScores", "TLMessagesHighScores", TLValue::Kind::Type },
+    { TLValue::UpdateRecentStickers, "UpdateRecentStickers", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ContestSaveDeveloperInfo, "ContestSaveDeveloperInfo", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdateChatUserTyping, "UpdateChatUserTyping", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessagesSendEncryptedFile, "MessagesSendEncryptedFile", "TLMessagesSentEncryptedMessage", TLValue::Kind::Function },
+    { TLValue::LangpackGetLangPack, "LangpackGetLangPack", "TLLangPackDifference", TLValue::Kind::Function },
+    { TLValue::PeerNotifySettings, "PeerNotifySettings", "TLPeerNotifySettings", TLValue::Kind::Type },
+    { TLValue::UpdateBotWebhookJSONQuery, "UpdateBotWebhookJSONQuery", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ChatEmpty, "ChatEmpty", "TLChat", TLValue::Kind::Type },
+    { TLValue::StickersCreateStickerSet, "StickersCreateStickerSet", "TLMessagesStickerSet", TLValue::Kind::Function },
+    { TLValue::BotInlineResult, "BotInlineResult", "TLBotInlineResult", TLValue::Kind::Type },
+    { TLValue::InputWebDocument, "InputWebDocument", "TLInputWebDocument", TLValue::Kind::Type },
+    { TLValue::TextStrike, "TextStrike", "TLRichText", TLValue::Kind::Type },
+    { TLValue::FoundGifCached, "FoundGifCached", "TLFoundGif", TLValue::Kind::Type },
+    { TLValue::Config, "Config", "TLConfig", TLValue::Kind::Type },
+    { TLValue::MessagesChatsSlice, "MessagesChatsSlice", "TLMessagesChats", TLValue::Kind::Type },
+    { TLValue::HelpGetSupport, "HelpGetSupport", "TLHelpSupport", TLValue::Kind::Function },
+    { TLValue::UpdateContactLink, "UpdateContactLink", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::PhoneConnection, "PhoneConnection", "TLPhoneConnection", TLValue::Kind::Type },
+    { TLValue::PeerUser, "PeerUser", "TLPeer", TLValue::Kind::Type },
+    { TLValue::InputStickerSetID, "InputStickerSetID", "TLInputStickerSet", TLValue::Kind::Type },
+    { TLValue::MessageService, "MessageService", "TLMessage", TLValue::Kind::Type },
+    { TLValue::MessagesSearchGlobal, "MessagesSearchGlobal", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::MessagesFavedStickersNotModified, "MessagesFavedStickersNotModified", "TLMessagesFavedStickers", TLValue::Kind::Type },
+    { TLValue::NewSessionCreated, "NewSessionCreated", "TLNewSession", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterDocument, "InputMessagesFilterDocument", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::MessageMediaUnsupported, "MessageMediaUnsupported", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::AuthResetAuthorizations, "AuthResetAuthorizations", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessageActionHistoryClear, "MessageActionHistoryClear", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterVideo, "InputMessagesFilterVideo", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::NotifyPeer, "NotifyPeer", "TLNotifyPeer", TLValue::Kind::Type },
+    { TLValue::RecentMeUrlChat, "RecentMeUrlChat", "TLRecentMeUrl", TLValue::Kind::Type },
+    { TLValue::ReplyKeyboardHide, "ReplyKeyboardHide", "TLReplyMarkup", TLValue::Kind::Type },
+    { TLValue::PaymentsGetPaymentReceipt, "PaymentsGetPaymentReceipt", "TLPaymentsPaymentReceipt", TLValue::Kind::Function },
+    { TLValue::SendMessageRecordVideoAction, "SendMessageRecordVideoAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateDeleteMessages, "UpdateDeleteMessages", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdateConfig, "UpdateConfig", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::PhoneCallProtocol, "PhoneCallProtocol", "TLPhoneCallProtocol", TLValue::Kind::Type },
+    { TLValue::KeyboardButton, "KeyboardButton", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantSelf, "ChannelParticipantSelf", "TLChannelParticipant", TLValue::Kind::Type },
+    { TLValue::MessageMediaWebPage, "MessageMediaWebPage", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::MessagesSetTyping, "MessagesSetTyping", "TLBool", TLValue::Kind::Function },
+    { TLValue::ReceivedNotifyMessage, "ReceivedNotifyMessage", "TLReceivedNotifyMessage", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantsKicked, "ChannelParticipantsKicked", "TLChannelParticipantsFilter", TLValue::Kind::Type },
+    { TLValue::InputNotifyAll, "InputNotifyAll", "TLInputNotifyPeer", TLValue::Kind::Type },
+    { TLValue::RpcAnswerDropped, "RpcAnswerDropped", "TLRpcDropAnswer", TLValue::Kind::Type },
+    { TLValue::UpdatesState, "UpdatesState", "TLUpdatesState", TLValue::Kind::Type },
+    { TLValue::MessageActionChatCreate, "MessageActionChatCreate", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::DhGenFail, "DhGenFail", "TLSetClientDHParamsAnswer", TLValue::Kind::Type },
+    { TLValue::InputMediaContact, "InputMediaContact", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::ChannelsUpdatePinnedMessage, "ChannelsUpdatePinnedMessage", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::UpdateUserName, "UpdateUserName", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::BadMsgNotification, "BadMsgNotification", "TLBadMsgNotification", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantAdmin, "ChannelParticipantAdmin", "TLChannelParticipant", TLValue::Kind::Type },
+    { TLValue::InputBotInlineResultPhoto, "InputBotInlineResultPhoto", "TLInputBotInlineResult", TLValue::Kind::Type },
+    { TLValue::MessagesHideReportSpam, "MessagesHideReportSpam", "TLBool", TLValue::Kind::Function },
+    { TLValue::UpdatesDifferenceSlice, "UpdatesDifferenceSlice", "TLUpdatesDifference", TLValue::Kind::Type },
+    { TLValue::MessagesSendEncrypted, "MessagesSendEncrypted", "TLMessagesSentEncryptedMessage", TLValue::Kind::Function },
+    { TLValue::UploadCdnFile, "UploadCdnFile", "TLUploadCdnFile", TLValue::Kind::Type },
+    { TLValue::MessagesEditChatAdmin, "MessagesEditChatAdmin", "TLBool", TLValue::Kind::Function },
+    { TLValue::SendMessageUploadDocumentAction, "SendMessageUploadDocumentAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::BotsSendCustomRequest, "BotsSendCustomRequest", "TLDataJSON", TLValue::Kind::Function },
+    { TLValue::StorageFileUnknown, "StorageFileUnknown", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::InputBotInlineMessageMediaVenue, "InputBotInlineMessageMediaVenue", "TLInputBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::AuthSentCodeTypeFlashCall, "AuthSentCodeTypeFlashCall", "TLAuthSentCodeType", TLValue::Kind::Type },
+    { TLValue::UpdatePhoneCall, "UpdatePhoneCall", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::TopPeerCategoryBotsPM, "TopPeerCategoryBotsPM", "TLTopPeerCategory", TLValue::Kind::Type },
+    { TLValue::EncryptedChatEmpty, "EncryptedChatEmpty", "TLEncryptedChat", TLValue::Kind::Type },
+    { TLValue::PeerNotifyEventsEmpty, "PeerNotifyEventsEmpty", "TLPeerNotifyEvents", TLValue::Kind::Type },
+    { TLValue::AccountReportPeer, "AccountReportPeer", "TLBool", TLValue::Kind::Function },
+    { TLValue::StorageFilePdf, "StorageFilePdf", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::HelpGetAppUpdate, "HelpGetAppUpdate", "TLHelpAppUpdate", TLValue::Kind::Function },
+    { TLValue::FutureSalts, "FutureSalts", "TLFutureSalts", TLValue::Kind::Type },
+    { TLValue::DisabledFeature, "DisabledFeature", "TLDisabledFeature", TLValue::Kind::Type },
+    { TLValue::MaskCoords, "MaskCoords", "TLMaskCoords", TLValue::Kind::Type },
+    { TLValue::ChannelsDeleteHistory, "ChannelsDeleteHistory", "TLBool", TLValue::Kind::Function },
+    { TLValue::KeyboardButtonBuy, "KeyboardButtonBuy", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::InputChannel, "InputChannel", "TLInputChannel", TLValue::Kind::Type },
+    { TLValue::MessageActionChannelMigrateFrom, "MessageActionChannelMigrateFrom", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantsBots, "ChannelParticipantsBots", "TLChannelParticipantsFilter", TLValue::Kind::Type },
+    { TLValue::MessagesEditInlineBotMessage, "MessagesEditInlineBotMessage", "TLBool", TLValue::Kind::Function },
+    { TLValue::KeyboardButtonRequestPhone, "KeyboardButtonRequestPhone", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::MessagesSendInlineBotResult, "MessagesSendInlineBotResult", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionChangeStickerSet, "ChannelAdminLogEventActionChangeStickerSet", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::MessageActionChatDeleteUser, "MessageActionChatDeleteUser", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::UploadSaveFilePart, "UploadSaveFilePart", "TLBool", TLValue::Kind::Function },
+    { TLValue::StorageFileMp4, "StorageFileMp4", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::MessagesAffectedHistory, "MessagesAffectedHistory", "TLMessagesAffectedHistory", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantsAdmins, "ChannelParticipantsAdmins", "TLChannelParticipantsFilter", TLValue::Kind::Type },
+    { TLValue::UpdateEncryption, "UpdateEncryption", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::NotifyUsers, "NotifyUsers", "TLNotifyPeer", TLValue::Kind::Type },
+    { TLValue::MessageMediaPhoto, "MessageMediaPhoto", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterRoundVideo, "InputMessagesFilterRoundVideo", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::ServerDHInnerData, "ServerDHInnerData", "TLServerDHInnerData", TLValue::Kind::Type },
+    { TLValue::MessageActionChatEditTitle, "MessageActionChatEditTitle", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::MessagesStickerSet, "MessagesStickerSet", "TLMessagesStickerSet", TLValue::Kind::Type },
+    { TLValue::ShippingOption, "ShippingOption", "TLShippingOption", TLValue::Kind::Type },
+    { TLValue::UpdateChatParticipantAdmin, "UpdateChatParticipantAdmin", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessageActionEmpty, "MessageActionEmpty", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::UpdateChannel, "UpdateChannel", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::InputMediaDocumentExternal, "InputMediaDocumentExternal", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::BotInlineMessageMediaGeo, "BotInlineMessageMediaGeo", "TLBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::ContactsContactsNotModified, "ContactsContactsNotModified", "TLContactsContacts", TLValue::Kind::Type },
+    { TLValue::AccountPasswordSettings, "AccountPasswordSettings", "TLAccountPasswordSettings", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionChangePhoto, "ChannelAdminLogEventActionChangePhoto", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::InputNotifyPeer, "InputNotifyPeer", "TLInputNotifyPeer", TLValue::Kind::Type },
+    { TLValue::AccountDaysTTL, "AccountDaysTTL", "TLAccountDaysTTL", TLValue::Kind::Type },
+    { TLValue::GetFutureSalts, "GetFutureSalts", "TLFutureSalts", TLValue::Kind::Function },
+    { TLValue::InputUserEmpty, "InputUserEmpty", "TLInputUser", TLValue::Kind::Type },
+    { TLValue::MessagesFaveSticker, "MessagesFaveSticker", "TLBool", TLValue::Kind::Function },
+    { TLValue::DraftMessageEmpty, "DraftMessageEmpty", "TLDraftMessage", TLValue::Kind::Type },
+    { TLValue::PageBlockAuthorDate, "PageBlockAuthorDate", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::PeerChat, "PeerChat", "TLPeer", TLValue::Kind::Type },
+    { TLValue::MessageEntityUnknown, "MessageEntityUnknown", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::RecentMeUrlStickerSet, "RecentMeUrlStickerSet", "TLRecentMeUrl", TLValue::Kind::Type },
+    { TLValue::PrivacyKeyStatusTimestamp, "PrivacyKeyStatusTimestamp", "TLPrivacyKey", TLValue::Kind::Type },
+    { TLValue::MessagesSaveDraft, "MessagesSaveDraft", "TLBool", TLValue::Kind::Function },
+    { TLValue::BoolFalse, "BoolFalse", "TLBool", TLValue::Kind::Type },
+    { TLValue::AccountGetPasswordSettings, "AccountGetPasswordSettings", "TLAccountPasswordSettings", TLValue::Kind::Function },
+    { TLValue::AuthSignIn, "AuthSignIn", "TLAuthAuthorization", TLValue::Kind::Function },
+    { TLValue::TopPeerCategoryGroups, "TopPeerCategoryGroups", "TLTopPeerCategory", TLValue::Kind::Type },
+    { TLValue::MessageEntityBold, "MessageEntityBold", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::PeerChannel, "PeerChannel", "TLPeer", TLValue::Kind::Type },
+    { TLValue::Game, "Game", "TLGame", TLValue::Kind::Type },
+    { TLValue::InputPrivacyKeyChatInvite, "InputPrivacyKeyChatInvite", "TLInputPrivacyKey", TLValue::Kind::Type },
+    { TLValue::UpdateNotifySettings, "UpdateNotifySettings", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::InvokeWithoutUpdates, "InvokeWithoutUpdates", "TLX", TLValue::Kind::Function },
+    { TLValue::MessagesSearchGifs, "MessagesSearchGifs", "TLMessagesFoundGifs", TLValue::Kind::Function },
+    { TLValue::PageBlockHeader, "PageBlockHeader", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ChannelsEditBanned, "ChannelsEditBanned", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::AuthSentCodeTypeSms, "AuthSentCodeTypeSms", "TLAuthSentCodeType", TLValue::Kind::Type },
+    { TLValue::NotifyChats, "NotifyChats", "TLNotifyPeer", TLValue::Kind::Type },
+    { TLValue::ChannelsDeleteChannel, "ChannelsDeleteChannel", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ContactsGetContacts, "ContactsGetContacts", "TLContactsContacts", TLValue::Kind::Function },
+    { TLValue::AccountGetWallPapers, "AccountGetWallPapers", "TLVector<TLWallPaper>", TLValue::Kind::Function },
+    { TLValue::PageBlockPreformatted, "PageBlockPreformatted", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::MessagesDhConfigNotModified, "MessagesDhConfigNotModified", "TLMessagesDhConfig", TLValue::Kind::Type },
+    { TLValue::InputPaymentCredentialsSaved, "InputPaymentCredentialsSaved", "TLInputPaymentCredentials", TLValue::Kind::Type },
+    { TLValue::TextUnderline, "TextUnderline", "TLRichText", TLValue::Kind::Type },
+    { TLValue::InputMediaVenue, "InputMediaVenue", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::InputBotInlineMessageMediaGeo, "InputBotInlineMessageMediaGeo", "TLInputBotInlineMessage", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterMyMentions, "InputMessagesFilterMyMentions", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::EncryptedFileEmpty, "EncryptedFileEmpty", "TLEncryptedFile", TLValue::Kind::Type },
+    { TLValue::InputWebFileLocation, "InputWebFileLocation", "TLInputWebFileLocation", TLValue::Kind::Type },
+    { TLValue::BotCommand, "BotCommand", "TLBotCommand", TLValue::Kind::Type },
+    { TLValue::Invoice, "Invoice", "TLInvoice", TLValue::Kind::Type },
+    { TLValue::InputGameShortName, "InputGameShortName", "TLInputGame", TLValue::Kind::Type },
+    { TLValue::UpdateDeleteChannelMessages, "UpdateDeleteChannelMessages", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::HelpNoAppUpdate, "HelpNoAppUpdate", "TLHelpAppUpdate", TLValue::Kind::Type },
+    { TLValue::ContactsGetStatuses, "ContactsGetStatuses", "TLVector<TLContactStatus>", TLValue::Kind::Function },
+    { TLValue::Error, "Error", "TLError", TLValue::Kind::Type },
+    { TLValue::MessagesGetMessagesViews, "MessagesGetMessagesViews", "TLVector<quint32>", TLValue::Kind::Function },
+    { TLValue::HelpGetConfig, "HelpGetConfig", "TLConfig", TLValue::Kind::Function },
+    { TLValue::WebPagePending, "WebPagePending", "TLWebPage", TLValue::Kind::Type },
+    { TLValue::WebDocument, "WebDocument", "TLWebDocument", TLValue::Kind::Type },
+    { TLValue::InitConnection, "InitConnection", "TLX", TLValue::Kind::Function },
+    { TLValue::ChannelsExportInvite, "ChannelsExportInvite", "TLExportedChatInvite", TLValue::Kind::Function },
+    { TLValue::MessagesInstallStickerSet, "MessagesInstallStickerSet", "TLMessagesStickerSetInstallResult", TLValue::Kind::Function },
+    { TLValue::ChannelsExportMessageLink, "ChannelsExportMessageLink", "TLExportedMessageLink", TLValue::Kind::Function },
+    { TLValue::EncryptedChatRequested, "EncryptedChatRequested", "TLEncryptedChat", TLValue::Kind::Type },
+    { TLValue::ChatParticipant, "ChatParticipant", "TLChatParticipant", TLValue::Kind::Type },
+    { TLValue::MessagesSendMedia, "MessagesSendMedia", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::MessagesSendScreenshotNotification, "MessagesSendScreenshotNotification", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::CdnPublicKey, "CdnPublicKey", "TLCdnPublicKey", TLValue::Kind::Type },
+    { TLValue::AccountSetPrivacy, "AccountSetPrivacy", "TLAccountPrivacyRules", TLValue::Kind::Function },
+    { TLValue::UsersGetFullUser, "UsersGetFullUser", "TLUserFull", TLValue::Kind::Function },
+    { TLValue::MessagesEditChatPhoto, "MessagesEditChatPhoto", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::LangPackString, "LangPackString", "TLLangPackString", TLValue::Kind::Type },
+    { TLValue::StorageFileGif, "StorageFileGif", "TLStorageFileType", TLValue::Kind::Type },
+    { TLValue::LabeledPrice, "LabeledPrice", "TLLabeledPrice", TLValue::Kind::Type },
+    { TLValue::InvokeAfterMsg, "InvokeAfterMsg", "TLX", TLValue::Kind::Function },
+    { TLValue::ChannelsReadHistory, "ChannelsReadHistory", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesGetAttachedStickers, "MessagesGetAttachedStickers", "TLVector<TLStickerSetCovered>", TLValue::Kind::Function },
+    { TLValue::WallPaper, "WallPaper", "TLWallPaper", TLValue::Kind::Type },
+    { TLValue::AuthAuthorization, "AuthAuthorization", "TLAuthAuthorization", TLValue::Kind::Type },
+    { TLValue::StickerSet, "StickerSet", "TLStickerSet", TLValue::Kind::Type },
+    { TLValue::ChannelMessagesFilter, "ChannelMessagesFilter", "TLChannelMessagesFilter", TLValue::Kind::Type },
+    { TLValue::RpcAnswerDroppedRunning, "RpcAnswerDroppedRunning", "TLRpcDropAnswer", TLValue::Kind::Type },
+    { TLValue::PaymentSavedCredentialsCard, "PaymentSavedCredentialsCard", "TLPaymentSavedCredentials", TLValue::Kind::Type },
+    { TLValue::AuthBindTempAuthKey, "AuthBindTempAuthKey", "TLBool", TLValue::Kind::Function },
+    { TLValue::PageBlockEmbed, "PageBlockEmbed", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::PageBlockAnchor, "PageBlockAnchor", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::MessagesReportSpam, "MessagesReportSpam", "TLBool", TLValue::Kind::Function },
+    { TLValue::ImportedContact, "ImportedContact", "TLImportedContact", TLValue::Kind::Type },
+    { TLValue::ChannelsChannelParticipant, "ChannelsChannelParticipant", "TLChannelsChannelParticipant", TLValue::Kind::Type },
+    { TLValue::ServerDHParamsOk, "ServerDHParamsOk", "TLServerDHParams", TLValue::Kind::Type },
+    { TLValue::ChannelsDeleteUserHistory, "ChannelsDeleteUserHistory", "TLMessagesAffectedHistory", TLValue::Kind::Function },
+    { TLValue::DestroyAuthKey, "DestroyAuthKey", "TLDestroyAuthKeyRes", TLValue::Kind::Function },
+    { TLValue::PaymentsValidatedRequestedInfo, "PaymentsValidatedRequestedInfo", "TLPaymentsValidatedRequestedInfo", TLValue::Kind::Type },
+    { TLValue::SendMessageUploadPhotoAction, "SendMessageUploadPhotoAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::InputMediaGame, "InputMediaGame", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::ContactStatus, "ContactStatus", "TLContactStatus", TLValue::Kind::Type },
+    { TLValue::IpPort, "IpPort", "TLIpPort", TLValue::Kind::Type },
+    { TLValue::ContactsGetTopPeers, "ContactsGetTopPeers", "TLContactsTopPeers", TLValue::Kind::Function },
+    { TLValue::ContactLinkContact, "ContactLinkContact", "TLContactLink", TLValue::Kind::Type },
+    { TLValue::SendMessageRecordAudioAction, "SendMessageRecordAudioAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::UserProfilePhoto, "UserProfilePhoto", "TLUserProfilePhoto", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionParticipantToggleAdmin, "ChannelAdminLogEventActionParticipantToggleAdmin", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::MessagesSetBotCallbackAnswer, "MessagesSetBotCallbackAnswer", "TLBool", TLValue::Kind::Function },
+    { TLValue::InputPrivacyValueDisallowAll, "InputPrivacyValueDisallowAll", "TLInputPrivacyRule", TLValue::Kind::Type },
+    { TLValue::UpdateDialogPinned, "UpdateDialogPinned", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ReqDHParams, "ReqDHParams", "TLServerDHParams", TLValue::Kind::Function },
+    { TLValue::InputUser, "InputUser", "TLInputUser", TLValue::Kind::Type },
+    { TLValue::PaymentsClearSavedInfo, "PaymentsClearSavedInfo", "TLBool", TLValue::Kind::Function },
+    { TLValue::AuthRequestPasswordRecovery, "AuthRequestPasswordRecovery", "TLAuthPasswordRecovery", TLValue::Kind::Function },
+    { TLValue::UpdatePinnedDialogs, "UpdatePinnedDialogs", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::TextItalic, "TextItalic", "TLRichText", TLValue::Kind::Type },
+    { TLValue::Chat, "Chat", "TLChat", TLValue::Kind::Type },
+    { TLValue::HelpConfigSimple, "HelpConfigSimple", "TLHelpConfigSimple", TLValue::Kind::Type },
+    { TLValue::PageBlockVideo, "PageBlockVideo", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ChatParticipantCreator, "ChatParticipantCreator", "TLChatParticipant", TLValue::Kind::Type },
+    { TLValue::MsgsStateReq, "MsgsStateReq", "TLMsgsStateReq", TLValue::Kind::Type },
+    { TLValue::InvokeWithLayer, "InvokeWithLayer", "TLX", TLValue::Kind::Function },
+    { TLValue::AccountGetPrivacy, "AccountGetPrivacy", "TLAccountPrivacyRules", TLValue::Kind::Function },
+    { TLValue::PageBlockDivider, "PageBlockDivider", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::AccountTmpPassword, "AccountTmpPassword", "TLAccountTmpPassword", TLValue::Kind::Type },
+    { TLValue::ChatInvite, "ChatInvite", "TLChatInvite", TLValue::Kind::Type },
+    { TLValue::AccountResetNotifySettings, "AccountResetNotifySettings", "TLBool", TLValue::Kind::Function },
+    { TLValue::TextEmpty, "TextEmpty", "TLRichText", TLValue::Kind::Type },
+    { TLValue::MessagesEditChatTitle, "MessagesEditChatTitle", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::MessagesGetHistory, "MessagesGetHistory", "TLMessagesMessages", TLValue::Kind::Function },
+    { TLValue::SendMessageGamePlayAction, "SendMessageGamePlayAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::ContactsTopPeersNotModified, "ContactsTopPeersNotModified", "TLContactsTopPeers", TLValue::Kind::Type },
+    { TLValue::ChannelParticipantsRecent, "ChannelParticipantsRecent", "TLChannelParticipantsFilter", TLValue::Kind::Type },
+    { TLValue::TextEmail, "TextEmail", "TLRichText", TLValue::Kind::Type },
+    { TLValue::UploadSaveBigFilePart, "UploadSaveBigFilePart", "TLBool", TLValue::Kind::Function },
+    { TLValue::AccountResetAuthorization, "AccountResetAuthorization", "TLBool", TLValue::Kind::Function },
+    { TLValue::AuthExportedAuthorization, "AuthExportedAuthorization", "TLAuthExportedAuthorization", TLValue::Kind::Type },
+    { TLValue::MsgCopy, "MsgCopy", "TLMessageCopy", TLValue::Kind::Type },
+    { TLValue::MessagesDeleteChatUser, "MessagesDeleteChatUser", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::InputMessagesFilterContacts, "InputMessagesFilterContacts", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::PhoneCallDiscardReasonDisconnect, "PhoneCallDiscardReasonDisconnect", "TLPhoneCallDiscardReason", TLValue::Kind::Type },
+    { TLValue::UpdateBotShippingQuery, "UpdateBotShippingQuery", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::InputReportReasonOther, "InputReportReasonOther", "TLReportReason", TLValue::Kind::Type },
+    { TLValue::DestroySessionOk, "DestroySessionOk", "TLDestroySessionRes", TLValue::Kind::Type },
+    { TLValue::MessagesGetPinnedDialogs, "MessagesGetPinnedDialogs", "TLMessagesPeerDialogs", TLValue::Kind::Function },
+    { TLValue::UserStatusRecently, "UserStatusRecently", "TLUserStatus", TLValue::Kind::Type },
+    { TLValue::ChatParticipantAdmin, "ChatParticipantAdmin", "TLChatParticipant", TLValue::Kind::Type },
+    { TLValue::UpdatesTooLong, "UpdatesTooLong", "TLUpdates", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionParticipantInvite, "ChannelAdminLogEventActionParticipantInvite", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::AccountGetAuthorizations, "AccountGetAuthorizations", "TLAccountAuthorizations", TLValue::Kind::Function },
+    { TLValue::InputMediaUploadedDocument, "InputMediaUploadedDocument", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::UploadGetFile, "UploadGetFile", "TLUploadFile", TLValue::Kind::Function },
+    { TLValue::ChannelParticipantCreator, "ChannelParticipantCreator", "TLChannelParticipant", TLValue::Kind::Type },
+    { TLValue::AuthImportAuthorization, "AuthImportAuthorization", "TLAuthAuthorization", TLValue::Kind::Function },
+    { TLValue::UpdateEditMessage, "UpdateEditMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::InputGeoPointEmpty, "InputGeoPointEmpty", "TLInputGeoPoint", TLValue::Kind::Type },
+    { TLValue::Dialog, "Dialog", "TLDialog", TLValue::Kind::Type },
+    { TLValue::UpdateFavedStickers, "UpdateFavedStickers", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::ContactsUnblock, "ContactsUnblock", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesDeleteMessages, "MessagesDeleteMessages", "TLMessagesAffectedMessages", TLValue::Kind::Function },
+    { TLValue::AuthExportAuthorization, "AuthExportAuthorization", "TLAuthExportedAuthorization", TLValue::Kind::Function },
+    { TLValue::MessagesChatFull, "MessagesChatFull", "TLMessagesChatFull", TLValue::Kind::Type },
+    { TLValue::MessagesSetBotShippingResults, "MessagesSetBotShippingResults", "TLBool", TLValue::Kind::Function },
+    { TLValue::BotsAnswerWebhookJSONQuery, "BotsAnswerWebhookJSONQuery", "TLBool", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionParticipantToggleBan, "ChannelAdminLogEventActionParticipantToggleBan", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::MessagesStartBot, "MessagesStartBot", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ChannelAdminLogEventActionChangeTitle, "ChannelAdminLogEventActionChangeTitle", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::InputMessagesFilterGeo, "InputMessagesFilterGeo", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::UpdateBotCallbackQuery, "UpdateBotCallbackQuery", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::DestroySession, "DestroySession", "TLDestroySessionRes", TLValue::Kind::Function },
+    { TLValue::MessagesSavedGifsNotModified, "MessagesSavedGifsNotModified", "TLMessagesSavedGifs", TLValue::Kind::Type },
+    { TLValue::MessagesGetGameHighScores, "MessagesGetGameHighScores", "TLMessagesHighScores", TLValue::Kind::Function },
+    { TLValue::MessagesAllStickersNotModified, "MessagesAllStickersNotModified", "TLMessagesAllStickers", TLValue::Kind::Type },
+    { TLValue::InputPeerNotifyEventsAll, "InputPeerNotifyEventsAll", "TLInputPeerNotifyEvents", TLValue::Kind::Type },
+    { TLValue::SendMessageUploadVideoAction, "SendMessageUploadVideoAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::PhotoCachedSize, "PhotoCachedSize", "TLPhotoSize", TLValue::Kind::Type },
+    { TLValue::PageBlockPhoto, "PageBlockPhoto", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionUpdatePinned, "ChannelAdminLogEventActionUpdatePinned", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::PaymentCharge, "PaymentCharge", "TLPaymentCharge", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventsFilter, "ChannelAdminLogEventsFilter", "TLChannelAdminLogEventsFilter", TLValue::Kind::Type },
+    { TLValue::DestroyAuthKeyFail, "DestroyAuthKeyFail", "TLDestroyAuthKeyRes", TLValue::Kind::Type },
+    { TLValue::UpdateChatParticipantAdd, "UpdateChatParticipantAdd", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UploadFileCdnRedirect, "UploadFileCdnRedirect", "TLUploadFile", TLValue::Kind::Type },
+    { TLValue::ChannelsSetStickers, "ChannelsSetStickers", "TLBool", TLValue::Kind::Function },
+    { TLValue::ChannelsReadMessageContents, "ChannelsReadMessageContents", "TLBool", TLValue::Kind::Function },
+    { TLValue::ChannelsTogglePreHistoryHidden, "ChannelsTogglePreHistoryHidden", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::ContactsContacts, "ContactsContacts", "TLContactsContacts", TLValue::Kind::Type },
+    { TLValue::UpdateChannelTooLong, "UpdateChannelTooLong", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::WebPageEmpty, "WebPageEmpty", "TLWebPage", TLValue::Kind::Type },
+    { TLValue::RecentMeUrlChatInvite, "RecentMeUrlChatInvite", "TLRecentMeUrl", TLValue::Kind::Type },
+    { TLValue::MessagesSetInlineBotResults, "MessagesSetInlineBotResults", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesGetAllChats, "MessagesGetAllChats", "TLMessagesChats", TLValue::Kind::Function },
+    { TLValue::UpdateServiceNotification, "UpdateServiceNotification", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::HelpSetBotUpdatesStatus, "HelpSetBotUpdatesStatus", "TLBool", TLValue::Kind::Function },
+    { TLValue::PhonePhoneCall, "PhonePhoneCall", "TLPhonePhoneCall", TLValue::Kind::Type },
+    { TLValue::MessagesToggleChatAdmins, "MessagesToggleChatAdmins", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::EncryptedMessage, "EncryptedMessage", "TLEncryptedMessage", TLValue::Kind::Type },
+    { TLValue::ChannelsAdminLogResults, "ChannelsAdminLogResults", "TLChannelsAdminLogResults", TLValue::Kind::Type },
+    { TLValue::BadServerSalt, "BadServerSalt", "TLBadMsgNotification", TLValue::Kind::Type },
+    { TLValue::UserStatusOnline, "UserStatusOnline", "TLUserStatus", TLValue::Kind::Type },
+    { TLValue::TopPeer, "TopPeer", "TLTopPeer", TLValue::Kind::Type },
+    { TLValue::UpdatesGetState, "UpdatesGetState", "TLUpdatesState", TLValue::Kind::Function },
+    { TLValue::MessagesDiscardEncryption, "MessagesDiscardEncryption", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesAllStickers, "MessagesAllStickers", "TLMessagesAllStickers", TLValue::Kind::Type },
+    { TLValue::UpdateDraftMessage, "UpdateDraftMessage", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::UpdatePrivacy, "UpdatePrivacy", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::InputChannelEmpty, "InputChannelEmpty", "TLInputChannel", TLValue::Kind::Type },
+    { TLValue::UploadCdnFileReuploadNeeded, "UploadCdnFileReuploadNeeded", "TLUploadCdnFile", TLValue::Kind::Type },
+    { TLValue::PageBlockChannel, "PageBlockChannel", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ChannelsChannelParticipantsNotModified, "ChannelsChannelParticipantsNotModified", "TLChannelsChannelParticipants", TLValue::Kind::Type },
+    { TLValue::InputPeerNotifyEventsEmpty, "InputPeerNotifyEventsEmpty", "TLInputPeerNotifyEvents", TLValue::Kind::Type },
+    { TLValue::PhotosUpdateProfilePhoto, "PhotosUpdateProfilePhoto", "TLUserProfilePhoto", TLValue::Kind::Function },
+    { TLValue::PageBlockSubheader, "PageBlockSubheader", "TLPageBlock", TLValue::Kind::Type },
+    { TLValue::ChannelsEditPhoto, "ChannelsEditPhoto", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::InputEncryptedChat, "InputEncryptedChat", "TLInputEncryptedChat", TLValue::Kind::Type },
+    { TLValue::MessagesStickersNotModified, "MessagesStickersNotModified", "TLMessagesStickers", TLValue::Kind::Type },
+    { TLValue::HelpTermsOfService, "HelpTermsOfService", "TLHelpTermsOfService", TLValue::Kind::Type },
+    { TLValue::PingDelayDisconnect, "PingDelayDisconnect", "TLPong", TLValue::Kind::Function },
+    { TLValue::SendMessageUploadAudioAction, "SendMessageUploadAudioAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::RpcResult, "RpcResult", "TLRpcResult", TLValue::Kind::Type },
+    { TLValue::MessagesFavedStickers, "MessagesFavedStickers", "TLMessagesFavedStickers", TLValue::Kind::Type },
+    { TLValue::LangPackDifference, "LangPackDifference", "TLLangPackDifference", TLValue::Kind::Type },
+    { TLValue::InputPhoneContact, "InputPhoneContact", "TLInputContact", TLValue::Kind::Type },
+    { TLValue::InputGeoPoint, "InputGeoPoint", "TLInputGeoPoint", TLValue::Kind::Type },
+    { TLValue::ReplyKeyboardForceReply, "ReplyKeyboardForceReply", "TLReplyMarkup", TLValue::Kind::Type },
+    { TLValue::ChannelsCreateChannel, "ChannelsCreateChannel", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::SetClientDHParams, "SetClientDHParams", "TLSetClientDHParamsAnswer", TLValue::Kind::Function },
+    { TLValue::InputEncryptedFileLocation, "InputEncryptedFileLocation", "TLInputFileLocation", TLValue::Kind::Type },
+    { TLValue::InputFile, "InputFile", "TLInputFile", TLValue::Kind::Type },
+    { TLValue::ChannelsChannelParticipants, "ChannelsChannelParticipants", "TLChannelsChannelParticipants", TLValue::Kind::Type },
+    { TLValue::ContactsGetBlocked, "ContactsGetBlocked", "TLContactsBlocked", TLValue::Kind::Function },
+    { TLValue::MessagesRequestEncryption, "MessagesRequestEncryption", "TLEncryptedChat", TLValue::Kind::Function },
+    { TLValue::DestroyAuthKeyOk, "DestroyAuthKeyOk", "TLDestroyAuthKeyRes", TLValue::Kind::Type },
+    { TLValue::UploadGetCdnFileHashes, "UploadGetCdnFileHashes", "TLVector<TLCdnFileHash>", TLValue::Kind::Function },
+    { TLValue::StickersRemoveStickerFromSet, "StickersRemoveStickerFromSet", "TLMessagesStickerSet", TLValue::Kind::Function },
+    { TLValue::InputUserSelf, "InputUserSelf", "TLInputUser", TLValue::Kind::Type },
+    { TLValue::ChannelsLeaveChannel, "ChannelsLeaveChannel", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::PrivacyValueDisallowContacts, "PrivacyValueDisallowContacts", "TLPrivacyRule", TLValue::Kind::Type },
+    { TLValue::ChannelAdminLogEventActionParticipantLeave, "ChannelAdminLogEventActionParticipantLeave", "TLChannelAdminLogEventAction", TLValue::Kind::Type },
+    { TLValue::MessageActionChatJoinedByLink, "MessageActionChatJoinedByLink", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::MessagesFeaturedStickers, "MessagesFeaturedStickers", "TLMessagesFeaturedStickers", TLValue::Kind::Type },
+    { TLValue::Contact, "Contact", "TLContact", TLValue::Kind::Type },
+    { TLValue::ContactsResolveUsername, "ContactsResolveUsername", "TLContactsResolvedPeer", TLValue::Kind::Function },
+    { TLValue::MessagesUninstallStickerSet, "MessagesUninstallStickerSet", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesAddChatUser, "MessagesAddChatUser", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::InputMediaGeoPoint, "InputMediaGeoPoint", "TLInputMedia", TLValue::Kind::Type },
+    { TLValue::UpdateInlineBotCallbackQuery, "UpdateInlineBotCallbackQuery", "TLUpdate", TLValue::Kind::Type },
+    { TLValue::MessageEntityMention, "MessageEntityMention", "TLMessageEntity", TLValue::Kind::Type },
+    { TLValue::InputFileBig, "InputFileBig", "TLInputFile", TLValue::Kind::Type },
+    { TLValue::EncryptedChat, "EncryptedChat", "TLEncryptedChat", TLValue::Kind::Type },
+    { TLValue::AccountUpdatePasswordSettings, "AccountUpdatePasswordSettings", "TLBool", TLValue::Kind::Function },
+    { TLValue::MessagesSendMessage, "MessagesSendMessage", "TLUpdates", TLValue::Kind::Function },
+    { TLValue::InputPrivacyKeyPhoneCall, "InputPrivacyKeyPhoneCall", "TLInputPrivacyKey", TLValue::Kind::Type },
+    { TLValue::MessageFwdHeader, "MessageFwdHeader", "TLMessageFwdHeader", TLValue::Kind::Type },
+    { TLValue::MessageActionCustomAction, "MessageActionCustomAction", "TLMessageAction", TLValue::Kind::Type },
+    { TLValue::PhoneCallDiscardReasonBusy, "PhoneCallDiscardReasonBusy", "TLPhoneCallDiscardReason", TLValue::Kind::Type },
+    { TLValue::TopPeerCategoryPeers, "TopPeerCategoryPeers", "TLTopPeerCategoryPeers", TLValue::Kind::Type },
+    { TLValue::PaymentsSavedInfo, "PaymentsSavedInfo", "TLPaymentsSavedInfo", TLValue::Kind::Type },
+    { TLValue::InputPhoto, "InputPhoto", "TLInputPhoto", TLValue::Kind::Type },
+    { TLValue::ChatInviteExported, "ChatInviteExported", "TLExportedChatInvite", TLValue::Kind::Type },
+    { TLValue::KeyboardButtonRequestGeoLocation, "KeyboardButtonRequestGeoLocation", "TLKeyboardButton", TLValue::Kind::Type },
+    { TLValue::ChatParticipantsForbidden, "ChatParticipantsForbidden", "TLChatParticipants", TLValue::Kind::Type },
+    { TLValue::SendMessageCancelAction, "SendMessageCancelAction", "TLSendMessageAction", TLValue::Kind::Type },
+    { TLValue::DraftMessage, "DraftMessage", "TLDraftMessage", TLValue::Kind::Type },
+    { TLValue::MessagesGetMessageEditData, "MessagesGetMessageEditData", "TLMessagesMessageEditData", TLValue::Kind::Function },
+    { TLValue::MessageMediaGame, "MessageMediaGame", "TLMessageMedia", TLValue::Kind::Type },
+    { TLValue::ChannelsReportSpam, "ChannelsReportSpam", "TLBool", TLValue::Kind::Function },
+    { TLValue::ContactLinkNone, "ContactLinkNone", "TLContactLink", TLValue::Kind::Type },
+    { TLValue::InputStickerSetItem, "InputStickerSetItem", "TLInputStickerSetItem", TLValue::Kind::Type },
+    { TLValue::InputStickerSetEmpty, "InputStickerSetEmpty", "TLInputStickerSet", TLValue::Kind::Type },
+    { TLValue::StickersChangeStickerPosition, "StickersChangeStickerPosition", "TLMessagesStickerSet", TLValue::Kind::Function },
+    { TLValue::InputMessagesFilterGif, "InputMessagesFilterGif", "TLMessagesFilter", TLValue::Kind::Type },
+    { TLValue::PhoneCall, "PhoneCall", "TLPhoneCall", TLValue::Kind::Type },
+    { TLValue::InputBotInlineResultDocument, "InputBotInlineResultDocument", "TLInputBotInlineResult", TLValue::Kind::Type },
+    { TLValue::PrivacyValueAllowContacts, "PrivacyValueAllowContacts", "TLPrivacyRule", TLValue::Kind::Type },
+    // End of generated TLValues table
+};
+
+const TLValueInfo *findValueInfo(quint32 value)
+{
+    const TLValueInfo *end = std::end(c_valueInfos);
+    const TLValueInfo *info = std::lower_bound(std::begin(c_valueInfos), end, value);
+    if ((info == end) || (info->value != value)) {
+        return nullptr;
+    }
+    return info;
+}
+
+} // anonymous namespace
 
 bool TLValue::isValid() const
 {
-    return enumerator.valueToKey(m_value);
+    return findValueInfo(m_value);
+}
+
+TLValue::Kind TLValue::kind() const
+{
+    const TLValueInfo *info = findValueInfo(m_value);
+    return info ? info->kind : Kind::Invalid;
+}
+
+const char *TLValue::typeOf() const
+{
+    const TLValueInfo *info = findValueInfo(m_value);
+    return info ? info->typeName : nullptr;
+}
+
+const char *TLValue::name() const
+{
+    const TLValueInfo *info = findValueInfo(m_value);
+    return info ? info->name : nullptr;
 }
 
 QString TLValue::toString() const
 {
-    const char *value = enumerator.valueToKey(m_value);
+    const char *value = name();
     if (value) {
         return QString::fromLatin1(value);
     } else {
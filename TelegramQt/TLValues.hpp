@@ -946,7 +946,16 @@ public:
         return m_value;
     }
 
+    enum class Kind : quint8 {
+        Invalid,
+        Type,
+        Function,
+    };
+
     bool isValid() const;
+    Kind kind() const;
+    // Name of the TL type of the constructor or of the function result (e.g. "TLUser")
+    const char *typeOf() const;
 
     TLValue &operator=(TLValue::Value v)
     {
@@ -961,6 +970,7 @@ public:
     }
 
     QString toString() const;
+    const char *name() const;
     static TLValue firstFromArray(const QByteArray &data);
 
 private:
@@ -0,0 +1,150 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "TcpFramer.hpp"
+
+#include "RandomGenerator.hpp"
+
+#include <QtEndian>
+
+namespace Telegram {
+
+TcpFramer *TcpFramer::fromProtocolTag(quint32 tag)
+{
+    switch (tag) {
+    case AbridgedTag:
+        return new AbridgedTcpFramer();
+    case IntermediateTag:
+        return new IntermediateTcpFramer();
+    case PaddedIntermediateTag:
+        return new PaddedIntermediateTcpFramer();
+    default:
+        return nullptr;
+    }
+}
+
+void AbridgedTcpFramer::writeFrame(QByteArray *output, const QByteArray &payload) const
+{
+    // quint8: 0xef (once per session)
+    // DataLength / 4 < 0x7f ?
+    //      (quint8: Packet length / 4) :
+    //      (quint8: 0x7f, quint24: Packet length / 4)
+    // Payload
+    output->reserve(output->size() + payload.size() + 4);
+    const quint32 length = payload.length() / 4;
+    if (length < 0x7f) {
+        output->append(char(length));
+    } else {
+        const quint32 header = qToLittleEndian<quint32>((length << 8) | 0x7fu);
+        output->append(reinterpret_cast<const char *>(&header), 4);
+    }
+    output->append(payload);
+}
+
+TcpFramer::ReadStatus AbridgedTcpFramer::readHeader(const QByteArray &data, int *headerSize, quint32 *frameSize) const
+{
+    if (data.isEmpty()) {
+        return ReadStatus::NeedMoreData;
+    }
+    const quint8 *bytes = reinterpret_cast<const quint8 *>(data.constData());
+    const quint8 length_t1 = bytes[0];
+    if (length_t1 < 0x7fu) {
+        *headerSize = 1;
+        *frameSize = length_t1 * 4u;
+    } else if (length_t1 == 0x7fu) {
+        if (data.size() < 4) {
+            return ReadStatus::NeedMoreData;
+        }
+        *headerSize = 4;
+        *frameSize = (bytes[1] + bytes[2] * 256u + bytes[3] * 256u * 256u) * 4u;
+    } else {
+        return ReadStatus::Error;
+    }
+    return *frameSize ? ReadStatus::Ready : ReadStatus::Error;
+}
+
+void IntermediateTcpFramer::writeFrame(QByteArray *output, const QByteArray &payload) const
+{
+    // quint32: 0xeeeeeeee (once per session)
+    // quint32: Payload length
+    // Payload
+    output->reserve(output->size() + payload.size() + 4);
+    const quint32 length = qToLittleEndian<quint32>(static_cast<quint32>(payload.size()));
+    output->append(reinterpret_cast<const char *>(&length), 4);
+    output->append(payload);
+}
+
+TcpFramer::ReadStatus IntermediateTcpFramer::readHeader(const QByteArray &data, int *headerSize, quint32 *frameSize) const
+{
+    if (data.size() < 4) {
+        return ReadStatus::NeedMoreData;
+    }
+    *headerSize = 4;
+    *frameSize = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data.constData()));
+    // The highest bit is the quick ack flag, which we do not support
+    if ((*frameSize == 0) || (*frameSize & 0x80000000u)) {
+        return ReadStatus::Error;
+    }
+    return ReadStatus::Ready;
+}
+
+void PaddedIntermediateTcpFramer::writeFrame(QByteArray *output, const QByteArray &payload) const
+{
+    // quint32: 0xdddddddd (once per session)
+    // quint32: Payload + padding length
+    // Payload
+    // Random padding (0-15 bytes)
+    const int paddingSize = RandomGenerator::instance()->generate<quint8>() % 16;
+    output->reserve(output->size() + payload.size() + paddingSize + 4);
+    const quint32 length = qToLittleEndian<quint32>(static_cast<quint32>(payload.size() + paddingSize));
+    output->append(reinterpret_cast<const char *>(&length), 4);
+    output->append(payload);
+    if (paddingSize) {
+        QByteArray padding(paddingSize, Qt::Uninitialized);
+        RandomGenerator::instance()->generate(&padding);
+        output->append(padding);
+    }
+}
+
+QByteArray PaddedIntermediateTcpFramer::payloadFromFrame(const QByteArray &frame) const
+{
+    // The padding is not a part of the MTProto packet, so use the packet structure to strip it:
+    // an encrypted packet is auth_key_id (8) + msg_key (16) + data aligned to 16 bytes,
+    // a plain packet is auth_key_id (8, zero) + message_id (8) + message_data_length (4) + data.
+    constexpr int c_authKeyIdSize = 8;
+    constexpr int c_encryptedHeaderSize = c_authKeyIdSize + 16;
+    constexpr int c_plainHeaderSize = c_authKeyIdSize + 8 + 4;
+    if (frame.size() < c_authKeyIdSize) {
+        return frame;
+    }
+    const quint64 authKeyId = qFromLittleEndian<quint64>(reinterpret_cast<const uchar *>(frame.constData()));
+    int packetSize = frame.size();
+    if (authKeyId) {
+        if (frame.size() >= c_encryptedHeaderSize) {
+            packetSize = c_encryptedHeaderSize + (frame.size() - c_encryptedHeaderSize) / 16 * 16;
+        }
+    } else if (frame.size() >= c_plainHeaderSize) {
+        const quint32 dataLength = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(frame.constData() + 16));
+        packetSize = static_cast<int>(qMin<quint32>(c_plainHeaderSize + dataLength, frame.size()));
+    }
+    if (packetSize == frame.size()) {
+        return frame;
+    }
+    return frame.left(packetSize);
+}
+
+} // Telegram namespace
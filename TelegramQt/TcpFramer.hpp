@@ -0,0 +1,87 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_TCP_FRAMER_HPP
+#define TELEGRAM_TCP_FRAMER_HPP
+
+#include "telegramqt_global.h"
+
+#include <QByteArray>
+
+namespace Telegram {
+
+// https://core.telegram.org/mtproto/mtproto-transports
+class TELEGRAMQT_INTERNAL_EXPORT TcpFramer
+{
+public:
+    enum class ReadStatus {
+        NeedMoreData,
+        Ready,
+        Error,
+    };
+
+    enum ProtocolTag : quint32 {
+        AbridgedTag = 0xefefefefu,
+        IntermediateTag = 0xeeeeeeeeu,
+        PaddedIntermediateTag = 0xddddddddu,
+    };
+
+    virtual ~TcpFramer() = default;
+
+    // The tag sent at the beginning of a plain session (or within the obfuscated session header)
+    virtual quint32 protocolTag() const = 0;
+
+    // Append the framed payload to the output
+    virtual void writeFrame(QByteArray *output, const QByteArray &payload) const = 0;
+
+    // Parse the frame header at the beginning of the data.
+    // On success headerSize is the number of the header bytes and frameSize is the number of the following frame bytes.
+    virtual ReadStatus readHeader(const QByteArray &data, int *headerSize, quint32 *frameSize) const = 0;
+
+    // Extract the payload from the frame bytes (e.g. strip the padding)
+    virtual QByteArray payloadFromFrame(const QByteArray &frame) const { return frame; }
+
+    static TcpFramer *fromProtocolTag(quint32 tag);
+};
+
+class TELEGRAMQT_INTERNAL_EXPORT AbridgedTcpFramer : public TcpFramer
+{
+public:
+    quint32 protocolTag() const override { return AbridgedTag; }
+    void writeFrame(QByteArray *output, const QByteArray &payload) const override;
+    ReadStatus readHeader(const QByteArray &data, int *headerSize, quint32 *frameSize) const override;
+};
+
+class TELEGRAMQT_INTERNAL_EXPORT IntermediateTcpFramer : public TcpFramer
+{
+public:
+    quint32 protocolTag() const override { return IntermediateTag; }
+    void writeFrame(QByteArray *output, const QByteArray &payload) const override;
+    ReadStatus readHeader(const QByteArray &data, int *headerSize, quint32 *frameSize) const override;
+};
+
+class TELEGRAMQT_INTERNAL_EXPORT PaddedIntermediateTcpFramer : public IntermediateTcpFramer
+{
+public:
+    quint32 protocolTag() const override { return PaddedIntermediateTag; }
+    void writeFrame(QByteArray *output, const QByteArray &payload) const override;
+    QByteArray payloadFromFrame(const QByteArray &frame) const override;
+};
+
+} // Telegram namespace
+
+#endif // TELEGRAM_TCP_FRAMER_HPP
@@ -193,20 +193,20 @@ bool MessageMediaInfo::getRemoteFileInfo(RemoteFile *file) const
     RemoteFile::Private *filePrivate = RemoteFile::Private::get(file);
     switch (d->tlType) {
     case TLValue::MessageMediaPhoto:
-        if (d->photo.sizes.isEmpty()) {
+        if (d->photo->sizes.isEmpty()) {
             return false;
         } else {
-            const TLPhotoSize s = d->photo.sizes.last();
+            const TLPhotoSize s = d->photo->sizes.last();
             filePrivate->m_size = s.size;
             return filePrivate->setFileLocation(&s.location);
         }
     case TLValue::MessageMediaDocument:
         inputLocation.tlType = TLValue::InputDocumentFileLocation;
-        inputLocation.id = d->document.id;
-        inputLocation.accessHash = d->document.accessHash;
+        inputLocation.id = d->document->id;
+        inputLocation.accessHash = d->document->accessHash;
         filePrivate->setInputFileLocation(&inputLocation);
-        filePrivate->m_size = d->document.size;
-        filePrivate->m_dcId = d->document.dcId;
+        filePrivate->m_size = d->document->size;
+        filePrivate->m_dcId = d->document->dcId;
         return true;
     default:
         return false;
@@ -226,12 +226,12 @@ quint32 MessageMediaInfo::size() const
 
     switch (d->tlType) {
     case TLValue::MessageMediaPhoto:
-        if (d->photo.sizes.isEmpty()) {
+        if (d->photo->sizes.isEmpty()) {
             return 0;
         }
-        return d->photo.sizes.last().size;
+        return d->photo->sizes.last().size;
     case TLValue::MessageMediaDocument:
-        return d->document.size;
+        return d->document->size;
     default:
         return 0;
     }
@@ -261,7 +261,7 @@ QString MessageMediaInfo::documentFileName() const
         return QString();
     }
 
-    for (const TLDocumentAttribute &attribute : d->document.attributes) {
+    for (const TLDocumentAttribute &attribute : d->document->attributes) {
         if (attribute.tlType == TLValue::DocumentAttributeFilename) {
             return attribute.fileName;
         }
@@ -276,16 +276,17 @@ bool MessageMediaInfo::setDocumentFileName(const QString &fileName)
         return false;
     }
 
+    TLDocument &document = *d->document;
     TLDocumentAttribute *nameAttribute = nullptr;
-    for (int i = 0; i < d->document.attributes.count(); ++i) {
-        if (d->document.attributes.at(i).tlType == TLValue::DocumentAttributeFilename) {
-            nameAttribute = &d->document.attributes[i];
+    for (int i = 0; i < document.attributes.count(); ++i) {
+        if (document.attributes.at(i).tlType == TLValue::DocumentAttributeFilename) {
+            nameAttribute = &document.attributes[i];
             break;
         }
     }
     if (!nameAttribute) {
-        d->document.attributes.append(TLDocumentAttribute());
-        nameAttribute = &d->document.attributes.last();
+        document.attributes.append(TLDocumentAttribute());
+        nameAttribute = &document.attributes.last();
         nameAttribute->tlType = TLValue::DocumentAttributeFilename;
     }
 
@@ -313,7 +314,7 @@ QByteArray MessageMediaInfo::getCachedPhoto() const
     const TLVector<TLPhotoSize> *sizes = nullptr;
     switch (d->tlType) {
     case TLValue::MessageMediaPhoto:
-        sizes = &d->photo.sizes;
+        sizes = &d->photo->sizes;
         break;
     default:
         return QByteArray();
@@ -330,7 +331,7 @@ QString MessageMediaInfo::mimeType() const
 {
     switch (d->tlType) {
     case TLValue::MessageMediaDocument:
-        return d->document.mimeType;
+        return d->document->mimeType;
     default:
         break;
     }
@@ -341,7 +342,7 @@ bool MessageMediaInfo::setMimeType(const QString &mimeType)
 {
     switch (d->tlType) {
     case TLValue::MessageMediaDocument:
-        d->document.mimeType = mimeType;
+        (*d->document).mimeType = mimeType;
         return true;
     default:
         break;
@@ -394,7 +395,7 @@ QString MessageMediaInfo::alt() const
         return QString();
     }
     case TLValue::MessageMediaDocument:
-        for (const TLDocumentAttribute &attribute : d->document.attributes) {
+        for (const TLDocumentAttribute &attribute : d->document->attributes) {
             if (attribute.tlType == TLValue::DocumentAttributeSticker) {
                 return attribute.alt;
             }
@@ -429,7 +430,7 @@ QString MessageMediaInfo::url() const
     if (d->tlType != TLValue::MessageMediaWebPage) {
         return QString();
     }
-    return d->webpage.url;
+    return d->webpage->url;
 }
 
 QString MessageMediaInfo::displayUrl() const
@@ -437,7 +438,7 @@ QString MessageMediaInfo::displayUrl() const
     if (d->tlType != TLValue::MessageMediaWebPage) {
         return QString();
     }
-    return d->webpage.displayUrl;
+    return d->webpage->displayUrl;
 }
 
 QString MessageMediaInfo::siteName() const
@@ -446,7 +447,7 @@ QString MessageMediaInfo::siteName() const
         return QString();
     }
 
-    return d->webpage.siteName;
+    return d->webpage->siteName;
 }
 
 QString MessageMediaInfo::title() const
@@ -455,7 +456,7 @@ QString MessageMediaInfo::title() const
         return QString();
     }
 
-    return d->webpage.title;
+    return d->webpage->title;
 }
 
 QString MessageMediaInfo::description() const
@@ -464,7 +465,7 @@ QString MessageMediaInfo::description() const
         return QString();
     }
 
-    return d->webpage.description;
+    return d->webpage->description;
 }
 
 TLInputFileLocation RemoteFile::Private::getInputFileLocation() const
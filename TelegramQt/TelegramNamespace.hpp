@@ -240,6 +240,13 @@ inline bool DcOption::operator==(const DcOption &option) const
     return (option.id == id) && (option.port == port) && (option.address == address) && (option.flags == flags);
 }
 
+struct TELEGRAMQT_EXPORT ServerSalt
+{
+    quint64 salt = 0;
+    quint32 validSince = 0;
+    quint32 validUntil = 0;
+};
+
 struct TELEGRAMQT_EXPORT Message
 {
     Message() = default;
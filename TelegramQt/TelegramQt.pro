@@ -60,6 +60,7 @@ SOURCES += \
     ContactsApi.cpp \
     DataStorage.cpp \
     IgnoredMessageNotification.cpp \
+    MessageCache.cpp \
     RpcError.cpp \
     RpcLayer.cpp \
     RsaKey.cpp \
@@ -70,10 +71,12 @@ SOURCES += \
     CTelegramStreamExtraOperators.cpp \
     Debug.cpp \
     Utils.cpp \
+    Utf8.cpp \
     FileRequestDescriptor.cpp \
     CTelegramTransport.cpp \
     CTcpTransport.cpp \
     CClientTcpTransport.cpp \
+    TcpFramer.cpp \
     TelegramNamespace.cpp \
     LegacySecretReader.cpp \
     MessagingApi.cpp \
@@ -83,6 +86,7 @@ SOURCES += \
     RandomGenerator.cpp \
     SendPackageHelper.cpp \
     SslBigNumber.cpp \
+    TLSchema.cpp \
     TLValues.cpp \
     UpdatesLayer.cpp
 
@@ -145,12 +149,16 @@ HEADERS += \
     CTelegramStreamExtraOperators.hpp \
     CTelegramStream_p.hpp \
     CRawStream.hpp \
+    MessageCache.hpp \
     UniqueLazyPointer.hpp \
     Utils.hpp \
+    Utf8.hpp \
     FileRequestDescriptor.hpp \
     CTelegramTransport.hpp \
     CTcpTransport.hpp \
     CClientTcpTransport.hpp \
+    TcpFramer.hpp \
+    TLSchema.hpp \
     TLFunctions.hpp \
     TLTypes.hpp \
     TLNumbers.hpp \
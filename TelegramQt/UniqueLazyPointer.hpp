@@ -18,6 +18,8 @@
 #ifndef TELEGRAM_QT_UNIQUE_LAZY_POINTER_HPP
 #define TELEGRAM_QT_UNIQUE_LAZY_POINTER_HPP
 
+#include <utility>
+
 namespace Telegram {
 
 template<typename TL>
@@ -109,6 +111,50 @@ protected:
     }
 };
 
+// A value with lazily allocated storage for rarely used (e.g. optional) members.
+// The reads (operator-> and the const operator*) return a shared default-constructed
+// instance if the value is not allocated, so reading a member never allocates.
+// The non-const operator* is the write access and allocates the value on demand.
+template<typename TL>
+struct LazyValue : public UniqueLazyPointer<TL>
+{
+    using Base = UniqueLazyPointer<TL>;
+
+    LazyValue() = default;
+    LazyValue(const TL &value) : Base(new TL(value)) { }
+    LazyValue(TL &&value) : Base(new TL(std::move(value))) { }
+
+    LazyValue &operator=(const TL &value)
+    {
+        Base::operator*() = value;
+        return *this;
+    }
+
+    LazyValue &operator=(TL &&value)
+    {
+        Base::operator*() = std::move(value);
+        return *this;
+    }
+
+    // Hides the implicit Base conversion, which is ambiguous with the conversion to TL
+    explicit operator bool() const { return this->data; }
+    operator const TL &() const { return **this; }
+
+    const TL &operator*() const
+    {
+        return this->data ? *this->data : defaultValue();
+    }
+    TL &operator*() { return Base::operator*(); }
+
+    const TL *operator->() const { return &**this; }
+
+    static const TL &defaultValue()
+    {
+        static const TL value;
+        return value;
+    }
+};
+
 } // Telegram namespace
 
 #endif // TELEGRAM_QT_UNIQUE_LAZY_POINTER_HPP
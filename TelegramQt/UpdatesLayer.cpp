@@ -42,28 +42,31 @@ bool UpdatesInternalApi::processUpdates(const TLUpdates &updates)
     switch (updates.tlType) {
     case TLValue::UpdatesTooLong:
         qCDebug(c_updatesLoggingCategory) << "Updates too long!";
-        break;
+        getDifference();
+        return true;
     case TLValue::UpdateShortMessage:
     case TLValue::UpdateShortChatMessage:
     {
         // Reconstruct full update from this short update.
         TLUpdate update;
 
-        if (update.message.toId.channelId) {
+        if (update.message->toId.channelId) {
             update.tlType = TLValue::UpdateNewChannelMessage;
         } else {
             update.tlType = TLValue::UpdateNewMessage;
         }
         update.pts = updates.pts;
         update.ptsCount = updates.ptsCount;
-        TLMessage &shortMessage = update.message;
+        TLMessage &shortMessage = *update.message;
         shortMessage.tlType = TLValue::Message;
         shortMessage.id = updates.id;
         shortMessage.flags = updates.flags;
         shortMessage.message = updates.message;
         shortMessage.date = updates.date;
-        shortMessage.media.tlType = TLValue::MessageMediaEmpty;
-        shortMessage.fwdFrom = updates.fwdFrom;
+        // The media is MessageMediaEmpty by default and stays unallocated
+        if (updates.flags & TLUpdates::FwdFrom) {
+            shortMessage.fwdFrom = updates.fwdFrom;
+        }
         shortMessage.replyToMsgId = updates.replyToMsgId;
 
         if (updates.tlType == TLValue::UpdateShortMessage) {
@@ -125,6 +128,7 @@ bool UpdatesInternalApi::processUpdates(const TLUpdates &updates)
         break;
     case TLValue::UpdateShortSentMessage:
     {
+        updatePts(updates.pts);
         MessagingApiPrivate *messaging = MessagingApiPrivate::get(messagingApi());
         messaging->onSentMessageIdResolved(0, updates.id);
         // TODO: Check that the follow state update is the right thing to do.
@@ -151,6 +155,11 @@ bool UpdatesInternalApi::processUpdate(const TLUpdate &update)
         messaging->onSentMessageIdResolved(update.randomId, update.quint32Id);
         return true;
     case TLValue::UpdateNewMessage:
+        updatePts(update.pts);
+        if (dataInternalApi()->processNewMessage(update.message, update.pts)) {
+            messaging->onMessageReceived(update.message);
+        }
+        return true;
     case TLValue::UpdateNewChannelMessage:
         if (dataInternalApi()->processNewMessage(update.message, update.pts)) {
             messaging->onMessageReceived(update.message);
@@ -158,6 +167,7 @@ bool UpdatesInternalApi::processUpdate(const TLUpdate &update)
         return true;
     case TLValue::UpdateReadHistoryInbox:
     {
+        updatePts(update.pts);
         const Peer peer = Utils::toPublicPeer(update.peer);
         if (dataInternalApi()->updateInboxRead(peer, update.maxId)) {
             messaging->onMessageInboxRead(peer, update.maxId);
@@ -166,6 +176,7 @@ bool UpdatesInternalApi::processUpdate(const TLUpdate &update)
         return true;
     case TLValue::UpdateReadHistoryOutbox:
     {
+        updatePts(update.pts);
         const Peer peer = Utils::toPublicPeer(update.peer);
         if (dataInternalApi()->updateOutboxRead(peer, update.maxId)) {
             messaging->onMessageOutboxRead(peer, update.maxId);
@@ -179,6 +190,80 @@ bool UpdatesInternalApi::processUpdate(const TLUpdate &update)
     return false;
 }
 
+void UpdatesInternalApi::getDifference()
+{
+    if (m_differenceInProgress) {
+        // The running request can be processed by the server before the updates are dropped
+        m_differenceRequested = true;
+        return;
+    }
+    qCDebug(c_updatesLoggingCategory) << Q_FUNC_INFO << "from pts" << m_pts;
+    m_differenceInProgress = true;
+    m_differenceRequested = false;
+    UpdatesRpcLayer::PendingUpdatesDifference *operation
+            = updatesLayer()->getDifference(0, m_pts, 0, Telegram::Utils::getCurrentTime(), 0);
+    operation->connectToFinished(this, &UpdatesInternalApi::onGetDifferenceFinished, operation);
+}
+
+void UpdatesInternalApi::updatePts(quint32 pts)
+{
+    if (pts > m_pts) {
+        m_pts = pts;
+    }
+}
+
+void UpdatesInternalApi::onGetDifferenceFinished(UpdatesRpcLayer::PendingUpdatesDifference *operation)
+{
+    m_differenceInProgress = false;
+    if (!operation->isSucceeded()) {
+        qCWarning(c_updatesLoggingCategory) << Q_FUNC_INFO << "Unable to get the difference:"
+                                            << operation->errorDetails();
+        return;
+    }
+
+    TLUpdatesDifference difference;
+    operation->getResult(&difference);
+
+    DataInternalApi *internal = dataInternalApi();
+    switch (difference.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        break;
+    case TLValue::UpdatesDifference:
+    case TLValue::UpdatesDifferenceSlice:
+    {
+        internal->processData(difference.users);
+        internal->processData(difference.chats);
+        for (const TLMessage &message : difference.newMessages) {
+            TLUpdate update;
+            update.tlType = TLValue::UpdateNewMessage;
+            update.message = message;
+            processUpdate(update);
+        }
+        for (const TLUpdate &update : difference.otherUpdates) {
+            processUpdate(update);
+        }
+        if (difference.tlType == TLValue::UpdatesDifferenceSlice) {
+            updatePts(difference.intermediateState.pts);
+            // Fetch the next slice
+            m_differenceRequested = true;
+        } else {
+            updatePts(difference.state.pts);
+        }
+    }
+        break;
+    case TLValue::UpdatesDifferenceTooLong:
+        qCWarning(c_updatesLoggingCategory) << Q_FUNC_INFO << "The difference is too long; skip to pts" << difference.pts;
+        updatePts(difference.pts);
+        break;
+    default:
+        break;
+    }
+
+    if (m_differenceRequested) {
+        getDifference();
+    }
+}
+
 MessagingApi *UpdatesInternalApi::messagingApi()
 {
     return m_backend->messagingApi();
@@ -194,6 +279,11 @@ DataInternalApi *UpdatesInternalApi::dataInternalApi()
     return DataInternalApi::get(dataStorage());
 }
 
+UpdatesRpcLayer *UpdatesInternalApi::updatesLayer()
+{
+    return m_backend->updatesLayer();
+}
+
 } // Client namespace
 
 } // Telegram namespace
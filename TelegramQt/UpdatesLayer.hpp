@@ -21,6 +21,7 @@
 #include <QObject>
 
 #include "TLTypes.hpp"
+#include "RpcLayers/ClientRpcUpdatesLayer.hpp"
 
 namespace Telegram {
 
@@ -42,12 +43,26 @@ public:
     bool processUpdates(const TLUpdates &updates);
     bool processUpdate(const TLUpdate &update);
 
+    // The pts of the common message box known to the client
+    quint32 pts() const { return m_pts; }
+
+    // Fetch the updates missed by the client (e.g. on updatesTooLong)
+    void getDifference();
+
 protected:
+    void updatePts(quint32 pts);
+    void onGetDifferenceFinished(UpdatesRpcLayer::PendingUpdatesDifference *operation);
+
     MessagingApi *messagingApi();
     DataStorage *dataStorage();
     DataInternalApi *dataInternalApi();
+    UpdatesRpcLayer *updatesLayer();
 
     Backend *m_backend = nullptr;
+    quint32 m_pts = 0;
+    bool m_differenceInProgress = false;
+    // The difference is requested again after the current request finished
+    bool m_differenceRequested = false;
 
 };
 
@@ -0,0 +1,205 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "Utf8.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define TELEGRAMQT_UTF8_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Telegram {
+
+namespace Utf8 {
+
+#ifdef TELEGRAMQT_UTF8_SSE2
+// Checks if 16 UTF-16 code units are all ASCII
+static inline bool isAsciiChunk(__m128i first, __m128i second)
+{
+    const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xff80));
+    const __m128i nonAsciiBits = _mm_and_si128(_mm_or_si128(first, second), nonAsciiMask);
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(nonAsciiBits, _mm_setzero_si128())) == 0xffff;
+}
+#endif
+
+static inline bool isContinuation(uchar byte)
+{
+    return (byte & 0xc0) == 0x80;
+}
+
+static inline bool isNonCharacter(uint codePoint)
+{
+    return ((codePoint >= 0xfdd0) && (codePoint <= 0xfdef)) || ((codePoint & 0xfffe) == 0xfffe);
+}
+
+int encodedSize(const QChar *data, int size)
+{
+    const ushort *src = reinterpret_cast<const ushort *>(data);
+    const ushort *end = src + size;
+    int result = 0;
+#ifdef TELEGRAMQT_UTF8_SSE2
+    while (end - src >= 16) {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8));
+        if (!isAsciiChunk(first, second)) {
+            break;
+        }
+        src += 16;
+        result += 16;
+    }
+#endif
+    while (src < end) {
+        const ushort u = *src++;
+        if (u < 0x80) {
+            result += 1;
+        } else if (u < 0x800) {
+            result += 2;
+        } else if (QChar::isHighSurrogate(u) && (src < end) && QChar::isLowSurrogate(*src)) {
+            ++src;
+            result += 4;
+        } else if (QChar::isSurrogate(u)) {
+            result += 1;
+        } else {
+            result += 3;
+        }
+    }
+    return result;
+}
+
+char *encode(const QChar *data, int size, char *output)
+{
+    const ushort *src = reinterpret_cast<const ushort *>(data);
+    const ushort *end = src + size;
+    uchar *dst = reinterpret_cast<uchar *>(output);
+    while (src < end) {
+#ifdef TELEGRAMQT_UTF8_SSE2
+        while (end - src >= 16) {
+            const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8));
+            if (!isAsciiChunk(first, second)) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(first, second));
+            src += 16;
+            dst += 16;
+        }
+        if (src == end) {
+            break;
+        }
+#endif
+        const ushort u = *src++;
+        if (u < 0x80) {
+            *dst++ = static_cast<uchar>(u);
+        } else if (u < 0x800) {
+            *dst++ = static_cast<uchar>(0xc0 | (u >> 6));
+            *dst++ = static_cast<uchar>(0x80 | (u & 0x3f));
+        } else if (QChar::isHighSurrogate(u) && (src < end) && QChar::isLowSurrogate(*src)) {
+            const uint codePoint = QChar::surrogateToUcs4(u, *src++);
+            *dst++ = static_cast<uchar>(0xf0 | (codePoint >> 18));
+            *dst++ = static_cast<uchar>(0x80 | ((codePoint >> 12) & 0x3f));
+            *dst++ = static_cast<uchar>(0x80 | ((codePoint >> 6) & 0x3f));
+            *dst++ = static_cast<uchar>(0x80 | (codePoint & 0x3f));
+        } else if (QChar::isSurrogate(u)) {
+            *dst++ = '?';
+        } else {
+            *dst++ = static_cast<uchar>(0xe0 | (u >> 12));
+            *dst++ = static_cast<uchar>(0x80 | ((u >> 6) & 0x3f));
+            *dst++ = static_cast<uchar>(0x80 | (u & 0x3f));
+        }
+    }
+    return reinterpret_cast<char *>(dst);
+}
+
+int decode(const char *data, int size, QChar *output)
+{
+    const uchar *src = reinterpret_cast<const uchar *>(data);
+    const uchar *end = src + size;
+    ushort *dst = reinterpret_cast<ushort *>(output);
+
+    if ((size >= 3) && (src[0] == 0xef) && (src[1] == 0xbb) && (src[2] == 0xbf)) {
+        return -1;
+    }
+
+#ifdef TELEGRAMQT_UTF8_SSE2
+    const __m128i zero = _mm_setzero_si128();
+#endif
+    while (src < end) {
+#ifdef TELEGRAMQT_UTF8_SSE2
+        // The output never outruns the input, so there is room for 16 characters
+        while (end - src >= 16) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            if (_mm_movemask_epi8(chunk)) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi8(chunk, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8), _mm_unpackhi_epi8(chunk, zero));
+            src += 16;
+            dst += 16;
+        }
+        if (src == end) {
+            break;
+        }
+#endif
+        const uchar b = *src++;
+        if (b < 0x80) {
+            *dst++ = b;
+            continue;
+        }
+        if ((b >= 0xc2) && (b <= 0xdf)) {
+            if ((src == end) || !isContinuation(src[0])) {
+                return -1;
+            }
+            *dst++ = static_cast<ushort>(((b & 0x1f) << 6) | (src[0] & 0x3f));
+            src += 1;
+        } else if ((b >= 0xe0) && (b <= 0xef)) {
+            if ((end - src < 2) || !isContinuation(src[0]) || !isContinuation(src[1])) {
+                return -1;
+            }
+            if (((b == 0xe0) && (src[0] < 0xa0)) || ((b == 0xed) && (src[0] >= 0xa0))) {
+                return -1; // Overlong sequence or a surrogate
+            }
+            const uint codePoint = (uint(b & 0x0f) << 12) | (uint(src[0] & 0x3f) << 6) | (src[1] & 0x3f);
+            if (isNonCharacter(codePoint)) {
+                return -1;
+            }
+            *dst++ = static_cast<ushort>(codePoint);
+            src += 2;
+        } else if ((b >= 0xf0) && (b <= 0xf4)) {
+            if ((end - src < 3) || !isContinuation(src[0]) || !isContinuation(src[1]) || !isContinuation(src[2])) {
+                return -1;
+            }
+            if (((b == 0xf0) && (src[0] < 0x90)) || ((b == 0xf4) && (src[0] >= 0x90))) {
+                return -1; // Overlong sequence or out of the Unicode range
+            }
+            const uint codePoint = (uint(b & 0x07) << 18) | (uint(src[0] & 0x3f) << 12)
+                    | (uint(src[1] & 0x3f) << 6) | (src[2] & 0x3f);
+            if (isNonCharacter(codePoint)) {
+                return -1;
+            }
+            *dst++ = QChar::highSurrogate(codePoint);
+            *dst++ = QChar::lowSurrogate(codePoint);
+            src += 3;
+        } else {
+            return -1;
+        }
+    }
+    return static_cast<int>(dst - reinterpret_cast<ushort *>(output));
+}
+
+} // Utf8 namespace
+
+} // Telegram namespace
@@ -0,0 +1,46 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_UTF8_HPP
+#define TELEGRAM_UTF8_HPP
+
+#include "telegramqt_global.h"
+
+#include <QChar>
+
+namespace Telegram {
+
+namespace Utf8 {
+
+// Returns the size of UTF-8 representation of the UTF-16 data.
+// Unpaired surrogates are counted as '?', the same way as QString::toUtf8() encodes them.
+TELEGRAMQT_INTERNAL_EXPORT int encodedSize(const QChar *data, int size);
+
+// Writes exactly encodedSize(data, size) bytes to the output and returns the end of the written data.
+TELEGRAMQT_INTERNAL_EXPORT char *encode(const QChar *data, int size, char *output);
+
+// Decodes the UTF-8 data to the output, which must have room for at least 'size' characters.
+// Returns the number of written characters or -1 if the data is not a strict UTF-8
+// (invalid or overlong sequence, encoded surrogate, noncharacter or a leading BOM).
+// The caller is expected to fall back to QString::fromUtf8() to handle such input exactly as Qt does.
+TELEGRAMQT_INTERNAL_EXPORT int decode(const char *data, int size, QChar *output);
+
+} // Utf8 namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_UTF8_HPP
@@ -29,94 +29,12 @@
 #include <QCryptographicHash>
 #include <QDebug>
 #include <QFileInfo>
+#include <QtEndian>
 
-#include "RandomGenerator.hpp"
-
-struct SslBigNumberContext {
-    SslBigNumberContext() :
-        m_context(BN_CTX_new())
-    {
-    }
-    ~SslBigNumberContext()
-    {
-        BN_CTX_free(m_context);
-    }
-    BN_CTX *context() { return m_context; }
-
-private:
-    BN_CTX *m_context;
-};
-
-struct SslBigNumber {
-    SslBigNumber() :
-        m_number(BN_new())
-    {
-    }
-
-    SslBigNumber(SslBigNumber &&number) :
-        m_number(number.m_number)
-    {
-        number.m_number = nullptr;
-    }
-
-    SslBigNumber(const SslBigNumber &number) :
-        m_number(BN_new())
-    {
-        BN_copy(m_number, number.m_number);
-    }
-
-    ~SslBigNumber()
-    {
-        if (m_number) {
-            BN_free(m_number);
-        }
-    }
-
-    static SslBigNumber fromHex(const QByteArray &hex)
-    {
-        SslBigNumber result;
-        if (BN_hex2bn(&result.m_number, hex.constData()) != 0) {
-            return result;
-        }
-        return SslBigNumber();
-    }
+#include <cmath>
 
-    static SslBigNumber fromByteArray(const QByteArray &bin)
-    {
-        SslBigNumber result;
-        if (BN_bin2bn((uchar *) bin.constData(), bin.length(), result.m_number) != 0) {
-            return result;
-        }
-        return SslBigNumber();
-    }
-
-    static QByteArray toByteArray(const BIGNUM *number)
-    {
-        QByteArray result;
-        result.resize(BN_num_bytes(number));
-        BN_bn2bin(number, (uchar *) result.data());
-        return result;
-    }
-
-    QByteArray toByteArray() const
-    {
-        return toByteArray(m_number);
-    }
-
-    SslBigNumber mod_exp(const SslBigNumber &exponent, const SslBigNumber &modulus) const
-    {
-        SslBigNumberContext context;
-        SslBigNumber result;
-        BN_mod_exp(result.m_number, number(), exponent.number(), modulus.number(), context.context());
-        return result;
-    }
-
-    const BIGNUM *number() const { return m_number; }
-    BIGNUM *number() { return m_number; }
-
-private:
-    BIGNUM *m_number;
-};
+#include "RandomGenerator.hpp"
+#include "SslBigNumber.hpp"
 
 namespace Telegram {
 
@@ -140,53 +58,138 @@ quint64 Utils::greatestCommonOddDivisor(quint64 a, quint64 b)
     return b == 0 ? a : b;
 }
 
-// Yet another copy of some unknown pq-solver algorithm.
-// Links (join lines):
-// https://github.com/DrKLO/Telegram/blob/433f59c5b9ed17543d8e206c83f0bc7c7edb43a6
-// /TMessagesProj/jni/jni.c#L86
-// https://github.com/ex3ndr/telegram-mt/blob/91b1186e567b0484d6f371b8e5c61c425daf867e
-// /src/main/java/org/telegram/mtproto/secure/pq/PQLopatin.java#L35
-// https://github.com/vysheng/tg/blob/1dad2e89933085ea1e3d9fb1becb1907ce5de55f
-// /mtproto-client.c#L296
-quint64 Utils::findDivider(quint64 number)
+static quint64 mulMod(quint64 a, quint64 b, quint64 modulo)
 {
-    int it = 0;
-    quint64 g = 0;
-    for (int i = 0; i < 3 || it < 10000; i++) {
-        const quint64 q = ((rand() & 15) + 17) % number;
-        quint64 x = (quint64) rand() % (number - 1) + 1;
-        quint64 y = x;
-        const quint32 lim = 1 << (i + 18);
-        for (quint32 j = 1; j < lim; j++) {
-            ++it;
-            quint64 a = x;
-            quint64 b = x;
-            quint64 c = q;
-            while (b) {
-                if (b & 1) {
-                    c += a;
-                    if (c >= number) {
-                        c -= number;
-                    }
-                }
-                a += a;
-                if (a >= number) {
-                    a -= number;
-                }
-                b >>= 1;
+#ifdef __SIZEOF_INT128__
+    return static_cast<quint64>((static_cast<unsigned __int128>(a) * b) % modulo);
+#else
+    quint64 result = 0;
+    a %= modulo;
+    while (b) {
+        if (b & 1) {
+            result = result >= modulo - a ? result - (modulo - a) : result + a;
+        }
+        a = a >= modulo - a ? a - (modulo - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+static quint64 powMod(quint64 base, quint64 exponent, quint64 modulo)
+{
+    quint64 result = 1;
+    base %= modulo;
+    while (exponent) {
+        if (exponent & 1) {
+            result = mulMod(result, base, modulo);
+        }
+        base = mulMod(base, base, modulo);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// Miller-Rabin test; the bases are enough for a deterministic answer for all 64-bit numbers
+static bool isPrime(quint64 number)
+{
+    static const quint64 c_bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+    for (const quint64 base : c_bases) {
+        if (number % base == 0) {
+            return number == base;
+        }
+    }
+    quint64 d = number - 1;
+    int s = 0;
+    while (!(d & 1)) {
+        d >>= 1;
+        ++s;
+    }
+    for (const quint64 base : c_bases) {
+        quint64 x = powMod(base, d, number);
+        if ((x == 1) || (x == number - 1)) {
+            continue;
+        }
+        bool composite = true;
+        for (int i = 1; i < s; ++i) {
+            x = mulMod(x, x, number);
+            if (x == number - 1) {
+                composite = false;
+                break;
+            }
+        }
+        if (composite) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Pollard's rho algorithm with Brent's cycle detection and batched gcd.
+// https://maths-people.anu.edu.au/~brent/pd/rpb051i.pdf
+// Returns 1 if the number is prime or the divisor is not found within the step limit.
+// The number of the sequence steps spent on the search is written to the 'steps'.
+quint64 Utils::findDivider(quint64 number, quint64 *steps)
+{
+    if (steps) {
+        *steps = 0;
+    }
+    if (number < 4) {
+        return 1;
+    }
+    if (!(number & 1)) {
+        return 2;
+    }
+    if (isPrime(number)) {
+        return 1;
+    }
+    constexpr quint64 c_batchSize = 128;
+    // The work is bounded for a malformed pq from a broken server (a product of two
+    // 32-bit primes takes about 2^16 steps)
+    constexpr quint64 c_maxSteps = 1ull << 21;
+    quint64 stepsLeft = c_maxSteps;
+    // The polynomial constant is changed if the sequence collapsed without a divisor found
+    for (quint64 c = 1; c < 64; ++c) {
+        const auto f = [number, c](quint64 value) {
+            const quint64 square = mulMod(value, value, number);
+            return square >= number - c ? square - (number - c) : square + c;
+        };
+        quint64 y = 2;
+        quint64 x = y;
+        quint64 ys = y;
+        quint64 q = 1;
+        quint64 g = 1;
+        for (quint64 r = 1; g == 1; r <<= 1) {
+            // Each round advances the sequence by r and then checks up to r values
+            if (stepsLeft < 2 * r) {
+                return 1;
+            }
+            stepsLeft -= 2 * r;
+            if (steps) {
+                *steps = c_maxSteps - stepsLeft;
             }
-            x = c;
-            const quint64 z = x < y ? number + x - y : x - y;
-            g = greatestCommonOddDivisor(z, number);
-            if (g != 1) {
-                return g;
+            x = y;
+            for (quint64 i = 0; i < r; ++i) {
+                y = f(y);
             }
-            if (!(j & (j - 1))) {
-                y = x;
+            for (quint64 k = 0; (k < r) && (g == 1); k += c_batchSize) {
+                ys = y;
+                const quint64 steps = qMin(c_batchSize, r - k);
+                for (quint64 i = 0; i < steps; ++i) {
+                    y = f(y);
+                    q = mulMod(q, x > y ? x - y : y - x, number);
+                }
+                g = greatestCommonOddDivisor(q, number);
             }
         }
-
-        if (g > 1 && g < number) {
+        if (g == number) {
+            // The batch overshot; step back and check the values one by one
+            do {
+                ys = f(ys);
+                g = greatestCommonOddDivisor(x > ys ? x - ys : ys - x, number);
+            } while (g == 1);
+        }
+        if (g != number) {
             return g;
         }
     }
@@ -225,6 +228,11 @@ quint64 Utils::getFingerprints(const QByteArray &data, const BitsOrder64 order)
     }
 }
 
+QByteArray Utils::binaryNumberModExp(const QByteArray &data, const SslMontgomeryContext &context, const QByteArray &exp)
+{
+    return context.modExp(data, exp);
+}
+
 QByteArray Utils::binaryNumberModExp(const QByteArray &data, const QByteArray &mod, const QByteArray &exp)
 {
     const SslBigNumber dataNum = SslBigNumber::fromByteArray(data);
@@ -234,6 +242,42 @@ QByteArray Utils::binaryNumberModExp(const QByteArray &data, const QByteArray &m
     return resultNum.toByteArray();
 }
 
+// RSA private key operation using the Chinese Remainder Theorem:
+// m1 = c^dP mod p, m2 = c^dQ mod q, h = qInv * (m1 - m2) mod p, m = m2 + h * q
+// Two half-size exponentiations are about four times cheaper than a full-size one.
+QByteArray Utils::rsaDecrypt(const QByteArray &data, const RsaKey &key)
+{
+    if (!key.hasCrtComponents()) {
+        return binaryNumberModExp(data, key.modulus, key.secretExponent);
+    }
+    BN_CTX *context = SslBigNumberContext::threadContext();
+    const SslBigNumber c = SslBigNumber::fromByteArray(data);
+    const SslBigNumber p = SslBigNumber::fromByteArray(key.prime1);
+    const SslBigNumber q = SslBigNumber::fromByteArray(key.prime2);
+    SslBigNumber dP = SslBigNumber::fromByteArray(key.exponent1);
+    SslBigNumber dQ = SslBigNumber::fromByteArray(key.exponent2);
+    const SslBigNumber qInv = SslBigNumber::fromByteArray(key.coefficient);
+    dP.setConstantTime();
+    dQ.setConstantTime();
+
+    SslBigNumber reduced;
+    SslBigNumber m1;
+    SslBigNumber m2;
+    SslBigNumber h;
+    SslBigNumber result;
+
+    BN_nnmod(reduced.number(), c.number(), p.number(), context);
+    BN_mod_exp(m1.number(), reduced.number(), dP.number(), p.number(), context);
+    BN_nnmod(reduced.number(), c.number(), q.number(), context);
+    BN_mod_exp(m2.number(), reduced.number(), dQ.number(), q.number(), context);
+
+    BN_mod_sub(h.number(), m1.number(), m2.number(), p.number(), context);
+    BN_mod_mul(h.number(), h.number(), qInv.number(), p.number(), context);
+    BN_mul(result.number(), h.number(), q.number(), context);
+    BN_add(result.number(), result.number(), m2.number());
+    return result.toByteArray();
+}
+
 QByteArray Utils::aesDecrypt(const QByteArray &data, const SAesKey &key)
 {
     if (data.length() % AES_BLOCK_SIZE) {
@@ -265,38 +309,170 @@ QByteArray Utils::aesEncrypt(const QByteArray &data, const SAesKey &key)
     return result;
 }
 
-QByteArray Utils::packGZip(const QByteArray &data)
+namespace {
+
+// The entropy is estimated on a few chunks spread over the data
+constexpr int c_entropySampleChunks = 8;
+constexpr int c_entropySampleChunkSize = 128;
+constexpr int c_entropySampleSize = c_entropySampleChunks * c_entropySampleChunkSize;
+
+// The z_stream state is about 256 KiB for deflate with MAX_MEM_LEVEL, so the contexts
+// are initialized once per thread and reset for each next package.
+class GZipDeflateContext
 {
-    z_stream stream;
-    stream.zalloc = nullptr;
-    stream.zfree = nullptr;
-    stream.opaque = nullptr;
-    stream.avail_in = static_cast<uInt>(data.size());
-    stream.next_in = reinterpret_cast<z_const Bytef*>(data.constData());
-
-    constexpr int compressionLevel = 6; // It seems that Telegram uses this compression level
-    int deflateResult = deflateInit2(&stream,
-                                     compressionLevel,
-                                     Z_DEFLATED,
-                                     MAX_WBITS + 16, // (8 to 15) + 16 for gzip
-                                     MAX_MEM_LEVEL,
-                                     Z_DEFAULT_STRATEGY);
-    if (deflateResult != Z_OK) {
-        return QByteArray(); // deflate init failed
+public:
+    GZipDeflateContext()
+    {
+        m_stream.zalloc = nullptr;
+        m_stream.zfree = nullptr;
+        m_stream.opaque = nullptr;
+        m_valid = deflateInit2(&m_stream,
+                               m_level,
+                               Z_DEFLATED,
+                               MAX_WBITS + 16, // (8 to 15) + 16 for gzip
+                               MAX_MEM_LEVEL,
+                               Z_DEFAULT_STRATEGY) == Z_OK;
     }
 
-    char buffer[c_gzipBufferSize];
-    QByteArray result;
+    ~GZipDeflateContext()
+    {
+        if (m_valid) {
+            deflateEnd(&m_stream);
+        }
+    }
 
-    do {
-        stream.avail_out = c_gzipBufferSize;
-        stream.next_out = reinterpret_cast<Bytef*>(buffer);
-        deflate(&stream, Z_FINISH); // Z_FINISH
-        result.append(buffer, static_cast<int>(c_gzipBufferSize - stream.avail_out));
-    } while (stream.avail_out == 0);
+    z_stream *prepare(int level)
+    {
+        if (!m_valid || (deflateReset(&m_stream) != Z_OK)) {
+            return nullptr;
+        }
+        if (level != m_level) {
+            if (deflateParams(&m_stream, level, Z_DEFAULT_STRATEGY) != Z_OK) {
+                return nullptr;
+            }
+            m_level = level;
+        }
+        return &m_stream;
+    }
+
+    static GZipDeflateContext *threadContext()
+    {
+        static thread_local GZipDeflateContext context;
+        return &context;
+    }
+
+private:
+    z_stream m_stream;
+    int m_level = Utils::c_gzipDefaultCompressionLevel;
+    bool m_valid = false;
+};
+
+class GZipInflateContext
+{
+public:
+    GZipInflateContext()
+    {
+        m_stream.zalloc = nullptr;
+        m_stream.zfree = nullptr;
+        m_stream.opaque = nullptr;
+        m_stream.avail_in = 0;
+        m_stream.next_in = nullptr;
+        m_valid = inflateInit2(&m_stream, MAX_WBITS + 32) == Z_OK; // gzip decoding
+    }
+
+    ~GZipInflateContext()
+    {
+        if (m_valid) {
+            inflateEnd(&m_stream);
+        }
+    }
+
+    z_stream *prepare()
+    {
+        if (!m_valid || (inflateReset(&m_stream) != Z_OK)) {
+            return nullptr;
+        }
+        return &m_stream;
+    }
+
+    static GZipInflateContext *threadContext()
+    {
+        static thread_local GZipInflateContext context;
+        return &context;
+    }
 
-    deflateEnd(&stream);
+private:
+    z_stream m_stream;
+    bool m_valid = false;
+};
 
+// The gzip trailer ends with ISIZE (the size of the original data modulo 2^32).
+// The value comes from the network, so it is only used as a (bounded) hint.
+int gzipUnpackedSizeHint(const QByteArray &data)
+{
+    // Deflate can not compress better than ~1032:1
+    static const qint64 c_maxRatio = 1032;
+    static const qint64 c_maxHint = 64 * 1024 * 1024;
+    const uchar *trailer = reinterpret_cast<const uchar *>(data.constData() + data.size() - 4);
+    const qint64 size = qFromLittleEndian<quint32>(trailer);
+    const qint64 limit = qMin(c_maxHint, data.size() * c_maxRatio);
+    return static_cast<int>(qBound<qint64>(Utils::c_gzipBufferSize, size, limit));
+}
+
+} // anonymous namespace
+
+double Utils::estimateEntropy(const QByteArray &data)
+{
+    if (data.isEmpty()) {
+        return 0;
+    }
+    quint32 histogram[256] = { };
+    int sampleSize = 0;
+    if (data.size() <= c_entropySampleSize) {
+        for (const char c : data) {
+            ++histogram[static_cast<quint8>(c)];
+        }
+        sampleSize = data.size();
+    } else {
+        const int step = (data.size() - c_entropySampleChunkSize) / (c_entropySampleChunks - 1);
+        for (int chunk = 0; chunk < c_entropySampleChunks; ++chunk) {
+            const char *chunkData = data.constData() + chunk * step;
+            for (int i = 0; i < c_entropySampleChunkSize; ++i) {
+                ++histogram[static_cast<quint8>(chunkData[i])];
+            }
+        }
+        sampleSize = c_entropySampleSize;
+    }
+
+    double entropy = 0;
+    for (const quint32 count : histogram) {
+        if (count) {
+            const double p = static_cast<double>(count) / sampleSize;
+            entropy -= p * std::log2(p);
+        }
+    }
+    return entropy;
+}
+
+QByteArray Utils::packGZip(const QByteArray &data, int compressionLevel)
+{
+    z_stream *stream = GZipDeflateContext::threadContext()->prepare(compressionLevel);
+    if (!stream) {
+        return QByteArray(); // deflate init failed
+    }
+    stream->avail_in = static_cast<uInt>(data.size());
+    stream->next_in = reinterpret_cast<z_const Bytef*>(data.constData());
+
+    // The bound is enough to finish the stream in one call
+    QByteArray result;
+    result.resize(static_cast<int>(deflateBound(stream, static_cast<uLong>(data.size()))));
+    stream->avail_out = static_cast<uInt>(result.size());
+    stream->next_out = reinterpret_cast<Bytef*>(result.data());
+
+    if (deflate(stream, Z_FINISH) != Z_STREAM_END) {
+        return QByteArray();
+    }
+    result.resize(static_cast<int>(stream->total_out));
     return result;
 }
 
@@ -307,40 +483,43 @@ QByteArray Utils::unpackGZip(const QByteArray &data)
         return QByteArray();
     }
 
-    z_stream stream;
-    stream.zalloc = nullptr;
-    stream.zfree = nullptr;
-    stream.opaque = nullptr;
-    stream.avail_in = static_cast<uInt>(data.size());
-    stream.next_in = reinterpret_cast<z_const Bytef*>(data.constData());
-
-    int inflateResult = inflateInit2(&stream, MAX_WBITS + 32); // gzip decoding
-    if (inflateResult != Z_OK) {
+    z_stream *stream = GZipInflateContext::threadContext()->prepare();
+    if (!stream) {
         return QByteArray(); // inflate init failed
     }
+    stream->avail_in = static_cast<uInt>(data.size());
+    stream->next_in = reinterpret_cast<z_const Bytef*>(data.constData());
 
-    char buffer[c_gzipBufferSize];
     QByteArray result;
+    result.resize(gzipUnpackedSizeHint(data));
 
+    int inflateResult = Z_OK;
     do {
-        stream.avail_out = c_gzipBufferSize;
-        stream.next_out = reinterpret_cast<Bytef*>(buffer);
-        inflateResult = inflate(&stream, Z_NO_FLUSH);
+        if (stream->total_out == static_cast<uLong>(result.size())) {
+            // The hint was wrong (e.g. the original size exceeds 4 GiB); grow the buffer
+            result.resize(result.size() * 2);
+        }
+        stream->avail_out = static_cast<uInt>(static_cast<uLong>(result.size()) - stream->total_out);
+        stream->next_out = reinterpret_cast<Bytef*>(result.data()) + stream->total_out;
+        inflateResult = inflate(stream, Z_NO_FLUSH);
         switch (inflateResult) {
         case Z_NEED_DICT:
         case Z_DATA_ERROR:
         case Z_MEM_ERROR:
         case Z_STREAM_ERROR:
-            inflateEnd(&stream);
             return QByteArray();
+        case Z_BUF_ERROR:
+            if (stream->avail_out) {
+                // No progress is possible: the input is truncated
+                return QByteArray();
+            }
+            break;
         default:
             break;
         }
-        result.append(buffer, static_cast<int>(c_gzipBufferSize - stream.avail_out));
-    } while (stream.avail_out == 0);
-
-    inflateEnd(&stream);
+    } while (inflateResult != Z_STREAM_END);
 
+    result.resize(static_cast<int>(stream->total_out));
     return result;
 }
 
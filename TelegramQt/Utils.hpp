@@ -27,24 +27,32 @@ namespace Telegram {
 
 namespace Utils TELEGRAMQT_INTERNAL_EXPORT {
 
+class SslMontgomeryContext;
+
 enum BitsOrder64 {
     Higher64Bits,
     Lower64Bits,
 };
 
 quint64 greatestCommonOddDivisor(quint64 a, quint64 b);
-quint64 findDivider(quint64 number);
+quint64 findDivider(quint64 number, quint64 *steps = nullptr);
 QByteArray sha1(const QByteArray &data);
 QByteArray sha256(const QByteArray &data);
 quint64 getFingerprints(const QByteArray &data, const BitsOrder64 order);
 QByteArray binaryNumberModExp(const QByteArray &data, const QByteArray &mod, const QByteArray &exp);
+QByteArray binaryNumberModExp(const QByteArray &data, const SslMontgomeryContext &context, const QByteArray &exp);
 QByteArray rsa(const QByteArray &data, const Telegram::RsaKey &key);
+QByteArray rsaDecrypt(const QByteArray &data, const Telegram::RsaKey &key);
 QByteArray aesDecrypt(const QByteArray &data, const SAesKey &key);
 QByteArray aesEncrypt(const QByteArray &data, const SAesKey &key);
-QByteArray packGZip(const QByteArray &data);
-QByteArray unpackGZip(const QByteArray &data);
 
 constexpr quint32 c_gzipBufferSize = 1024;
+constexpr int c_gzipDefaultCompressionLevel = 6; // It seems that Telegram uses this compression level
+
+// Shannon entropy (bits per byte) of a sample of the data; about 8 for compressed or encrypted data
+double estimateEntropy(const QByteArray &data);
+QByteArray packGZip(const QByteArray &data, int compressionLevel = c_gzipDefaultCompressionLevel);
+QByteArray unpackGZip(const QByteArray &data);
 
 }
 
@@ -6,6 +6,7 @@ SUBDIRS += tst_CTelegramStream
 SUBDIRS += tst_TelegramRemoteFile
 #SUBDIRS += tst_CTelegramDispatcher
 SUBDIRS += tst_UniqueLazyPointer
+SUBDIRS += tst_MessageCache
 SUBDIRS += tst_utils
 SUBDIRS += tst_RpcError
 SUBDIRS += tst_RpcLayer
@@ -19,8 +19,10 @@
 
 #include "CTelegramStream_p.hpp"
 #include "CTelegramStreamExtraOperators.hpp"
+#include "TLSchema.hpp"
 
 #include <QBuffer>
+#include <QHash>
 #include <QTest>
 #include <QDebug>
 
@@ -223,8 +225,21 @@ private slots:
     void tlNumbersSerialization();
     void tlDcOptionDeserialization();
     void recursiveTypeWriteRead();
+    void compactTypeWriteRead();
+    void skipValidation();
+    void updatesSkipAndDecode_data();
+    void updatesSkipAndDecode();
+    void benchmarkMessageCache();
     void readError();
     void byteArrays();
+    void utf8Strings_data();
+    void utf8Strings();
+    void utf8InvalidData_data();
+    void utf8InvalidData();
+    void benchmarkDecodeString_data();
+    void benchmarkDecodeString();
+    void benchmarkEncodeString_data();
+    void benchmarkEncodeString();
     void reqPqData();
 
 };
@@ -853,6 +868,281 @@ void tst_CTelegramStream::recursiveTypeWriteRead()
     QCOMPARE(text2.stringText, text.stringText);
 }
 
+void tst_CTelegramStream::compactTypeWriteRead()
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.id = 1;
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 2;
+    message.date = 3;
+    message.message = QStringLiteral("text");
+
+    {
+        CTelegramStream outputStream(CTelegramStream::WriteOnly);
+        outputStream << message;
+        CTelegramStream inputStream(outputStream.getData());
+        TLMessage readMessage;
+        inputStream >> readMessage;
+        QCOMPARE(readMessage.message, message.message);
+        QCOMPARE(readMessage.toId.userId, message.toId.userId);
+        // The optional members of a text message are not allocated
+        QVERIFY(readMessage.media.isNull());
+        QVERIFY(readMessage.fwdFrom.isNull());
+        QVERIFY(readMessage.action.isNull());
+
+        const TLMessage &constMessage = readMessage;
+        QCOMPARE(constMessage.media->tlType, TLValue::MessageMediaEmpty);
+        QVERIFY(readMessage.media.isNull());
+        // Reading via a non-const object does not allocate either
+        QCOMPARE(readMessage.media->tlType, TLValue::MessageMediaEmpty);
+        QCOMPARE(readMessage.fwdFrom->fromId, 0u);
+        QVERIFY(readMessage.media.isNull());
+        QVERIFY(readMessage.fwdFrom.isNull());
+        QVERIFY(!readMessage.media);
+    }
+
+    message.flags |= TLMessage::Media;
+    {
+        TLMessageMedia &media = *message.media;
+        media.tlType = TLValue::MessageMediaGeo;
+        media.geo.tlType = TLValue::GeoPoint;
+        media.geo.latitude = 1.5;
+    }
+    QVERIFY(message.media);
+    {
+        CTelegramStream outputStream(CTelegramStream::WriteOnly);
+        outputStream << message;
+        CTelegramStream inputStream(outputStream.getData());
+        TLMessage readMessage;
+        inputStream >> readMessage;
+        QVERIFY(!readMessage.media.isNull());
+        QCOMPARE(readMessage.media->tlType, TLValue::MessageMediaGeo);
+        QCOMPARE(readMessage.media->geo.latitude, 1.5);
+        QVERIFY(readMessage.media->document.isNull());
+
+        const TLMessage copy = readMessage;
+        QCOMPARE(copy.media->geo.latitude, 1.5);
+    }
+}
+
+void tst_CTelegramStream::skipValidation()
+{
+    TLMessage textMessage;
+    textMessage.tlType = TLValue::Message;
+    textMessage.id = 1;
+    textMessage.toId.tlType = TLValue::PeerUser;
+    textMessage.toId.userId = 2;
+    textMessage.message = QStringLiteral("text");
+
+    TLMessage geoMessage = textMessage;
+    geoMessage.id = 2;
+    geoMessage.flags |= TLMessage::Media;
+    TLMessageMedia &geoMedia = *geoMessage.media;
+    geoMedia.tlType = TLValue::MessageMediaGeo;
+    geoMedia.geo.tlType = TLValue::GeoPoint;
+    geoMedia.geo.latitude = 1.5;
+
+    TLUser user;
+    user.tlType = TLValue::UserEmpty;
+    user.id = 2;
+
+    TLMessagesMessages messages;
+    messages.tlType = TLValue::MessagesMessages;
+    messages.messages = { textMessage, geoMessage };
+    messages.users = { user };
+
+    CTelegramStream outputStream(CTelegramStream::WriteOnly);
+    outputStream << messages;
+    const QByteArray data = outputStream.getData();
+
+    quint32 constructor = 0;
+    QCOMPARE(Telegram::TLSchema::skipValue(data.constData(), data.size(), &constructor), data.size());
+    QCOMPARE(constructor, static_cast<quint32>(TLValue::MessagesMessages));
+    QCOMPARE(Telegram::TLSchema::skip<TLMessagesMessages>(data), data.size());
+    QCOMPARE(Telegram::TLSchema::skip<TLUpdates>(data), -1);
+
+    // Trailing bytes are not a part of the value
+    QCOMPARE(Telegram::TLSchema::skip<TLMessagesMessages>(data + QByteArray(8, char(0))), data.size());
+    for (int size = 0; size < data.size(); ++size) {
+        QCOMPARE(Telegram::TLSchema::skip<TLMessagesMessages>(data.left(size)), -1);
+    }
+
+    // A nested value of a wrong type
+    TLMessagesMessages invalidMessages = messages;
+    (*invalidMessages.messages[1].media).geo.tlType = TLValue::PeerUser;
+    CTelegramStream invalidStream(CTelegramStream::WriteOnly);
+    invalidStream << invalidMessages;
+    QCOMPARE(Telegram::TLSchema::skip<TLMessagesMessages>(invalidStream.getData()), -1);
+}
+
+void tst_CTelegramStream::updatesSkipAndDecode_data()
+{
+    QTest::addColumn<TLUpdates>("updates");
+
+    TLMessageFwdHeader fwdFrom;
+    fwdFrom.tlType = TLValue::MessageFwdHeader;
+    fwdFrom.flags = TLMessageFwdHeader::FromId;
+    fwdFrom.fromId = 3;
+    fwdFrom.date = 1500000000;
+
+    TLMessageEntity entity;
+    entity.tlType = TLValue::MessageEntityBold;
+    entity.offset = 0;
+    entity.length = 5;
+
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.id = 10;
+    message.fromId = 2;
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 1;
+    message.date = 1500000001;
+    message.message = QStringLiteral("Hello from a full update");
+
+    TLUpdate newMessageUpdate;
+    newMessageUpdate.tlType = TLValue::UpdateNewMessage;
+    newMessageUpdate.message = message;
+    newMessageUpdate.pts = 5;
+    newMessageUpdate.ptsCount = 1;
+
+    TLUser user;
+    user.tlType = TLValue::UserEmpty;
+    user.id = 2;
+
+    TLChat chat;
+    chat.tlType = TLValue::ChatEmpty;
+    chat.id = 4;
+
+    {
+        TLUpdates updates;
+        updates.tlType = TLValue::UpdateShortMessage;
+        updates.flags = TLUpdates::Out | TLUpdates::FwdFrom | TLUpdates::ReplyToMsgId | TLUpdates::Entities;
+        updates.id = 11;
+        updates.userId = 2;
+        updates.message = QStringLiteral("Hello");
+        updates.pts = 6;
+        updates.ptsCount = 1;
+        updates.date = 1500000002;
+        updates.fwdFrom = fwdFrom;
+        updates.replyToMsgId = 10;
+        updates.entities = { entity };
+        QTest::newRow("updateShortMessage") << updates;
+    }
+    {
+        TLUpdates updates;
+        updates.tlType = TLValue::UpdateShortChatMessage;
+        updates.flags = TLUpdates::ViaBotId | TLUpdates::Entities;
+        updates.id = 12;
+        updates.fromId = 2;
+        updates.chatId = 4;
+        updates.message = QStringLiteral("Hello chat");
+        updates.pts = 7;
+        updates.ptsCount = 1;
+        updates.date = 1500000003;
+        updates.viaBotId = 5;
+        updates.entities = { entity, entity };
+        QTest::newRow("updateShortChatMessage") << updates;
+    }
+    {
+        TLUpdates updates;
+        updates.tlType = TLValue::Updates;
+        updates.updates = { newMessageUpdate };
+        updates.users = { user };
+        updates.chats = { chat };
+        updates.date = 1500000004;
+        updates.seq = 3;
+        QTest::newRow("updates") << updates;
+    }
+    {
+        TLUpdates updates;
+        updates.tlType = TLValue::UpdatesCombined;
+        updates.updates = { newMessageUpdate, newMessageUpdate };
+        updates.users = { user };
+        updates.date = 1500000005;
+        updates.seqStart = 4;
+        updates.seq = 5;
+        QTest::newRow("updatesCombined") << updates;
+    }
+    {
+        TLUpdates updates;
+        updates.tlType = TLValue::UpdateShort;
+        updates.update = newMessageUpdate;
+        updates.date = 1500000006;
+        QTest::newRow("updateShort") << updates;
+    }
+}
+
+void tst_CTelegramStream::updatesSkipAndDecode()
+{
+    QFETCH(TLUpdates, updates);
+
+    CTelegramStream outputStream(CTelegramStream::WriteOnly);
+    outputStream << updates;
+    const QByteArray data = outputStream.getData();
+
+    // The skip consumes exactly the bytes of the decoded value
+    QCOMPARE(Telegram::TLSchema::skip<TLUpdates>(data), data.size());
+    QCOMPARE(Telegram::TLSchema::skip<TLUpdates>(data + QByteArray(8, char(0))), data.size());
+
+    CTelegramStream inputStream(data);
+    TLUpdates decoded;
+    inputStream >> decoded;
+    QVERIFY(!inputStream.error());
+    QVERIFY(inputStream.atEnd());
+    QCOMPARE(decoded.tlType, updates.tlType);
+
+    CTelegramStream reencodedStream(CTelegramStream::WriteOnly);
+    reencodedStream << decoded;
+    QCOMPARE(reencodedStream.getData(), data);
+
+    // A truncated value is rejected by both the skip and the decoding
+    for (int size = 0; size < data.size(); ++size) {
+        const QByteArray truncatedData = data.left(size);
+        QCOMPARE(Telegram::TLSchema::skip<TLUpdates>(truncatedData), -1);
+        CTelegramStream truncatedStream(truncatedData);
+        TLUpdates truncated;
+        truncatedStream >> truncated;
+        QVERIFY2(truncatedStream.error(), qPrintable(QStringLiteral("Decoded %1 of %2 bytes").arg(size).arg(data.size())));
+    }
+}
+
+void tst_CTelegramStream::benchmarkMessageCache()
+{
+    // Decoding 100k messages is too slow for every test run, so the benchmark is run on demand only
+    if (!qEnvironmentVariableIsSet("TELEGRAMQT_MESSAGE_CACHE_BENCHMARK")) {
+        QSKIP("Set TELEGRAMQT_MESSAGE_CACHE_BENCHMARK to decode and cache 100k messages");
+    }
+    static const quint32 c_messageCount = 100000;
+
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.flags = TLMessage::FromId;
+    message.fromId = 1;
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 2;
+    message.date = 3;
+    message.message = QStringLiteral("A cached text message");
+
+    CTelegramStream outputStream(CTelegramStream::WriteOnly);
+    outputStream << message;
+    const QByteArray data = outputStream.getData();
+
+    QHash<quint32, TLMessage *> cache;
+    cache.reserve(c_messageCount);
+    QBENCHMARK_ONCE {
+        for (quint32 i = 0; i < c_messageCount; ++i) {
+            CTelegramStream inputStream(data);
+            TLMessage *cachedMessage = new TLMessage();
+            inputStream >> *cachedMessage;
+            cachedMessage->id = i;
+            cache.insert(i, cachedMessage);
+        }
+    }
+    QCOMPARE(static_cast<quint32>(cache.count()), c_messageCount);
+    qDeleteAll(cache);
+}
+
 void tst_CTelegramStream::readError()
 {
     {
@@ -913,6 +1203,124 @@ void tst_CTelegramStream::byteArrays()
     QCOMPARE(array2, a2);
 }
 
+static const QString c_asciiText = QStringLiteral("The quick brown fox jumps over the lazy dog. ");
+// "Съешь же ещё этих мягких французских булок" (a Russian pangram)
+static const QString c_cyrillicText = QString::fromUtf8(
+            "\xd0\xa1\xd1\x8a\xd0\xb5\xd1\x88\xd1\x8c \xd0\xb6\xd0\xb5 \xd0\xb5\xd1\x89\xd1\x91 "
+            "\xd1\x8d\xd1\x82\xd0\xb8\xd1\x85 \xd0\xbc\xd1\x8f\xd0\xb3\xd0\xba\xd0\xb8\xd1\x85 "
+            "\xd1\x84\xd1\x80\xd0\xb0\xd0\xbd\xd1\x86\xd1\x83\xd0\xb7\xd1\x81\xd0\xba\xd0\xb8\xd1\x85 "
+            "\xd0\xb1\xd1\x83\xd0\xbb\xd0\xbe\xd0\xba. ");
+// "Hello 😀👍🎉 " (the emoji are outside of BMP and need surrogate pairs)
+static const QString c_emojiText = QString::fromUtf8(
+            "Hello \xf0\x9f\x98\x80\xf0\x9f\x91\x8d\xf0\x9f\x8e\x89 ");
+
+void tst_CTelegramStream::utf8Strings_data()
+{
+    QTest::addColumn<QString>("value");
+
+    QTest::newRow("empty") << QString();
+    QTest::newRow("short ascii") << QStringLiteral("test");
+    QTest::newRow("long ascii") << c_asciiText.repeated(7);
+    QTest::newRow("latin1") << QString::fromUtf8("caf\xc3\xa9 na\xc3\xafve");
+    QTest::newRow("cyrillic") << c_cyrillicText;
+    QTest::newRow("emoji") << c_emojiText.repeated(3);
+    QTest::newRow("mixed") << c_asciiText + c_cyrillicText + c_emojiText + c_asciiText;
+    QTest::newRow("cjk") << QString::fromUtf8("\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e");
+    QTest::newRow("lone high surrogate") << c_asciiText + QChar(0xd83d) + c_asciiText;
+    QTest::newRow("lone low surrogate") << QString(QChar(0xde00)) + c_cyrillicText;
+    QTest::newRow("trailing high surrogate") << c_asciiText + QChar(0xd83d);
+}
+
+void tst_CTelegramStream::utf8Strings()
+{
+    QFETCH(QString, value);
+    const QByteArray utf8 = value.toUtf8();
+    const QByteArray expectedData = encodeData(utf8);
+
+    CTelegramStream outputStream(CTelegramStream::WriteOnly);
+    outputStream << value;
+    QCOMPARE(outputStream.getData(), expectedData);
+
+    // The same through an external device
+    QBuffer device;
+    device.open(QBuffer::WriteOnly);
+    CTelegramStream deviceStream(&device);
+    deviceStream << value;
+    QCOMPARE(device.data(), expectedData);
+
+    CTelegramStream inputStream(expectedData);
+    QString result = QStringLiteral("previous value");
+    inputStream >> result;
+    QVERIFY(!inputStream.error());
+    QVERIFY(inputStream.atEnd());
+    QCOMPARE(result, QString::fromUtf8(utf8));
+}
+
+void tst_CTelegramStream::utf8InvalidData_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+
+    QTest::newRow("bom") << QByteArray("\xef\xbb\xbfvalue");
+    QTest::newRow("truncated sequence") << QByteArray("abc\xd0");
+    QTest::newRow("unexpected continuation") << QByteArray("abc\x80" "def");
+    QTest::newRow("overlong") << QByteArray("\xc0\xaf" "abc");
+    QTest::newRow("overlong 3 bytes") << QByteArray("\xe0\x80\xaf");
+    QTest::newRow("encoded surrogate") << QByteArray("\xed\xa0\x80");
+    QTest::newRow("out of range") << QByteArray("\xf4\x90\x80\x80");
+    QTest::newRow("noncharacter") << QByteArray("\xef\xbf\xbf");
+    QTest::newRow("invalid in the middle of ascii")
+            << QByteArray("0123456789abcdef0123456789\xff" "abcdef0123456789abcdef");
+}
+
+void tst_CTelegramStream::utf8InvalidData()
+{
+    QFETCH(QByteArray, utf8);
+    CTelegramStream inputStream(encodeData(utf8));
+    QString result;
+    inputStream >> result;
+    QVERIFY(!inputStream.error());
+    QVERIFY(inputStream.atEnd());
+    QCOMPARE(result, QString::fromUtf8(utf8));
+}
+
+void tst_CTelegramStream::benchmarkDecodeString_data()
+{
+    QTest::addColumn<QString>("value");
+
+    QTest::newRow("ascii") << c_asciiText.repeated(20);
+    QTest::newRow("cyrillic") << c_cyrillicText.repeated(10);
+    QTest::newRow("emoji") << c_emojiText.repeated(40);
+}
+
+void tst_CTelegramStream::benchmarkDecodeString()
+{
+    QFETCH(QString, value);
+    const QByteArray data = encodeData(value);
+    QString result;
+    QBENCHMARK {
+        CTelegramStream stream(data);
+        stream >> result;
+    }
+    QCOMPARE(result, value);
+}
+
+void tst_CTelegramStream::benchmarkEncodeString_data()
+{
+    benchmarkDecodeString_data();
+}
+
+void tst_CTelegramStream::benchmarkEncodeString()
+{
+    QFETCH(QString, value);
+    QByteArray data;
+    QBENCHMARK {
+        CTelegramStream stream(CTelegramStream::WriteOnly, 4096);
+        stream << value;
+        data = stream.getData();
+    }
+    QCOMPARE(data, encodeData(value.toUtf8()));
+}
+
 void tst_CTelegramStream::reqPqData()
 {
     TLNumber128 clientNonce;
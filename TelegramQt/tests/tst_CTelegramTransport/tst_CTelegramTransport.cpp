@@ -19,6 +19,7 @@
 
 #include "ApiUtils.hpp"
 #include "CTelegramTransport.hpp"
+#include "TcpFramer.hpp"
 
 #include <QTest>
 #include <QDebug>
@@ -57,6 +58,9 @@ public:
 private slots:
     void testNewMessageId();
     void testNewMessageIdExtra();
+    void testTcpFramerRoundTrip_data();
+    void testTcpFramerRoundTrip();
+    void testTcpFramerPartialHeader();
 
 };
 
@@ -125,6 +129,83 @@ void tst_CTelegramTransport::testNewMessageIdExtra()
     }
 }
 
+void tst_CTelegramTransport::testTcpFramerRoundTrip_data()
+{
+    QTest::addColumn<quint32>("protocolTag");
+    QTest::addColumn<QByteArray>("payload");
+
+    // Encrypted packets: auth_key_id (8), msg_key (16), data aligned to 16 bytes
+    QByteArray shortEncrypted(8 + 16 + 32, char(0x11));
+    QByteArray longEncrypted(8 + 16 + 0x80 * 16, char(0x22));
+    // Plain packet: zero auth_key_id (8), message_id (8), message_data_length (4), data (20)
+    QByteArray plain(8 + 8 + 4 + 20, char(0x33));
+    memset(plain.data(), 0, 8);
+    const quint32 plainDataLength = 20;
+    memcpy(plain.data() + 16, &plainDataLength, sizeof(plainDataLength));
+
+    const QVector<quint32> tags = {
+        Telegram::TcpFramer::AbridgedTag,
+        Telegram::TcpFramer::IntermediateTag,
+        Telegram::TcpFramer::PaddedIntermediateTag,
+    };
+    for (const quint32 tag : tags) {
+        const QByteArray tagHex = QByteArray::number(tag, 0x10);
+        QTest::newRow(tagHex + " short") << tag << shortEncrypted;
+        QTest::newRow(tagHex + " long") << tag << longEncrypted;
+        QTest::newRow(tagHex + " plain") << tag << plain;
+    }
+}
+
+void tst_CTelegramTransport::testTcpFramerRoundTrip()
+{
+    QFETCH(quint32, protocolTag);
+    QFETCH(QByteArray, payload);
+
+    QScopedPointer<Telegram::TcpFramer> framer(Telegram::TcpFramer::fromProtocolTag(protocolTag));
+    QVERIFY(framer);
+    QCOMPARE(framer->protocolTag(), protocolTag);
+
+    QByteArray stream;
+    framer->writeFrame(&stream, payload);
+    framer->writeFrame(&stream, payload);
+
+    for (int i = 0; i < 2; ++i) {
+        int headerSize = 0;
+        quint32 frameSize = 0;
+        QCOMPARE(framer->readHeader(stream, &headerSize, &frameSize), Telegram::TcpFramer::ReadStatus::Ready);
+        QVERIFY(stream.size() >= headerSize + static_cast<int>(frameSize));
+        const QByteArray frame = stream.mid(headerSize, static_cast<int>(frameSize));
+        QCOMPARE(framer->payloadFromFrame(frame), payload);
+        stream.remove(0, headerSize + static_cast<int>(frameSize));
+    }
+    QVERIFY(stream.isEmpty());
+}
+
+void tst_CTelegramTransport::testTcpFramerPartialHeader()
+{
+    Telegram::AbridgedTcpFramer abridged;
+    Telegram::IntermediateTcpFramer intermediate;
+    int headerSize = 0;
+    quint32 frameSize = 0;
+
+    QCOMPARE(abridged.readHeader(QByteArray(), &headerSize, &frameSize), Telegram::TcpFramer::ReadStatus::NeedMoreData);
+    QCOMPARE(abridged.readHeader(QByteArray::fromHex("7f01"), &headerSize, &frameSize),
+             Telegram::TcpFramer::ReadStatus::NeedMoreData);
+    QCOMPARE(abridged.readHeader(QByteArray::fromHex("80"), &headerSize, &frameSize), Telegram::TcpFramer::ReadStatus::Error);
+    QCOMPARE(abridged.readHeader(QByteArray::fromHex("00"), &headerSize, &frameSize), Telegram::TcpFramer::ReadStatus::Error);
+
+    QCOMPARE(intermediate.readHeader(QByteArray::fromHex("100000"), &headerSize, &frameSize),
+             Telegram::TcpFramer::ReadStatus::NeedMoreData);
+    QCOMPARE(intermediate.readHeader(QByteArray::fromHex("00000000"), &headerSize, &frameSize),
+             Telegram::TcpFramer::ReadStatus::Error);
+    QCOMPARE(intermediate.readHeader(QByteArray::fromHex("10000000"), &headerSize, &frameSize),
+             Telegram::TcpFramer::ReadStatus::Ready);
+    QCOMPARE(headerSize, 4);
+    QCOMPARE(frameSize, 16u);
+
+    QVERIFY(!Telegram::TcpFramer::fromProtocolTag(0x12345678u));
+}
+
 QTEST_MAIN(tst_CTelegramTransport)
 
 #include "tst_CTelegramTransport.moc"
@@ -0,0 +1,220 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include <QObject>
+
+#include "MessageCache.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using namespace Telegram::Client;
+
+static TLMessage makeMessage(quint32 id, const QString &text)
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.id = id;
+    message.fromId = 1;
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 2;
+    message.message = text;
+    return message;
+}
+
+// Returns the number of the heap bytes in use or -1 if the allocator does not report it
+static qint64 heapInUse()
+{
+#ifdef __GLIBC__
+#if __GLIBC_PREREQ(2, 33)
+    return static_cast<qint64>(mallinfo2().uordblks);
+#endif
+#endif
+    return -1;
+}
+
+class tst_MessageCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void leastRecentlyUsedEviction();
+    void pinnedMessages();
+    void changeLimit();
+    void streamMessages();
+};
+
+void tst_MessageCache::leastRecentlyUsedEviction()
+{
+    const qint64 messageCost = MessageCache::messageCost(makeMessage(1, QStringLiteral("text")));
+    MessageCache cache(messageCost * 3);
+    cache.insert(1, makeMessage(1, QStringLiteral("text")));
+    cache.insert(2, makeMessage(2, QStringLiteral("text")));
+    cache.insert(3, makeMessage(3, QStringLiteral("text")));
+    QCOMPARE(cache.count(), 3);
+    QCOMPARE(cache.cost(), messageCost * 3);
+
+    // Touch the oldest message
+    QVERIFY(cache.get(1));
+    cache.insert(4, makeMessage(4, QStringLiteral("text")));
+    QCOMPARE(cache.count(), 3);
+    QVERIFY(cache.contains(1));
+    QVERIFY(!cache.contains(2));
+    QVERIFY(cache.contains(3));
+    QVERIFY(cache.contains(4));
+
+    // Replace the message data
+    cache.insert(3, makeMessage(3, QStringLiteral("TEXT")));
+    QCOMPARE(cache.count(), 3);
+    QCOMPARE(cache.get(3)->message, QStringLiteral("TEXT"));
+    cache.insert(5, makeMessage(5, QStringLiteral("text")));
+    QVERIFY(!cache.contains(1));
+    QVERIFY(cache.contains(3));
+    QVERIFY(!cache.get(1));
+}
+
+void tst_MessageCache::pinnedMessages()
+{
+    const qint64 messageCost = MessageCache::messageCost(makeMessage(1, QStringLiteral("text")));
+    MessageCache cache(messageCost * 2);
+    // The key is pinned before the message is cached
+    cache.setPinnedKeys({ 1 });
+    cache.insert(1, makeMessage(1, QStringLiteral("text")));
+    cache.insert(2, makeMessage(2, QStringLiteral("text")));
+    cache.insert(3, makeMessage(3, QStringLiteral("text")));
+    QVERIFY(cache.contains(1));
+    QVERIFY(!cache.contains(2));
+    QVERIFY(cache.contains(3));
+
+    // The pinned messages are kept even if they exceed the limit
+    cache.setPinnedKeys({ 1, 3 });
+    cache.setLimit(1);
+    QCOMPARE(cache.count(), 2);
+    QCOMPARE(cache.cost(), messageCost * 2);
+
+    // Unpinned message becomes the most recently used one
+    cache.setPinnedKeys({ 3 });
+    QVERIFY(!cache.contains(1));
+    QVERIFY(cache.contains(3));
+
+    // Swap a single pinned key as a dialog does on a new top message
+    cache.setLimit(messageCost * 3);
+    cache.insert(4, makeMessage(4, QStringLiteral("text")));
+    cache.pin(5);
+    cache.insert(5, makeMessage(5, QStringLiteral("text")));
+    QVERIFY(cache.isPinned(5));
+    cache.unpin(3);
+    QVERIFY(!cache.isPinned(3));
+    QCOMPARE(cache.count(), 3);
+    // The former pinned message is the most recently used one, so the older one is evicted
+    cache.insert(6, makeMessage(6, QStringLiteral("text")));
+    QVERIFY(cache.contains(3));
+    QVERIFY(!cache.contains(4));
+    QVERIFY(cache.contains(5));
+    QVERIFY(cache.contains(6));
+
+    // Repeated calls do not change anything
+    cache.pin(5);
+    cache.unpin(3);
+    QCOMPARE(cache.count(), 3);
+    QVERIFY(cache.isPinned(5));
+    cache.unpin(5);
+    cache.unpin(5);
+    QVERIFY(!cache.isPinned(5));
+    QCOMPARE(cache.count(), 3);
+}
+
+void tst_MessageCache::changeLimit()
+{
+    MessageCache cache(0);
+    for (quint32 i = 1; i <= 100; ++i) {
+        cache.insert(i, makeMessage(i, QString::number(i)));
+    }
+    QCOMPARE(cache.count(), 100);
+
+    const qint64 halfCost = cache.cost() / 2;
+    cache.setLimit(halfCost);
+    QVERIFY(cache.cost() <= halfCost);
+    QVERIFY(cache.count() < 100);
+    // The newest messages are kept
+    QVERIFY(cache.contains(100));
+    QVERIFY(!cache.contains(1));
+
+    cache.clear();
+    QCOMPARE(cache.count(), 0);
+    QCOMPARE(cache.cost(), qint64(0));
+}
+
+void tst_MessageCache::streamMessages()
+{
+    static const int c_messageCount = 1000000;
+    static const int c_warmUpCount = 100000;
+    static const qint64 c_limit = 256 * 1024;
+
+    // The estimated cost is checked against the heap usage, so the test does not rely on the cache accounting only
+    const qint64 heapBefore = heapInUse();
+    qint64 heapAfterWarmUp = -1;
+
+    MessageCache cache(c_limit);
+    const QSet<quint64> pinnedKeys = { 1, 2, 3 };
+    cache.setPinnedKeys(pinnedKeys);
+
+    // No more messages than the cheapest ones fit in the limit
+    const int maxCount = static_cast<int>(c_limit / MessageCache::messageCost(makeMessage(0, QString())));
+    for (int i = 1; i <= c_messageCount; ++i) {
+        const quint32 id = static_cast<quint32>(i);
+        cache.insert(id, makeMessage(id, QString(i % 100, QLatin1Char('x'))));
+        if (cache.cost() > c_limit) {
+            QFAIL(qPrintable(QStringLiteral("The cache cost %1 exceeds the limit after %2 messages").arg(cache.cost()).arg(i)));
+        }
+        if (i % 1000 == 0) {
+            // Touch the history as a scrolled view does
+            QVERIFY(cache.get(id - 10));
+        }
+        if (cache.count() > maxCount) {
+            QFAIL(qPrintable(QStringLiteral("The cache holds %1 messages after %2 messages").arg(cache.count()).arg(i)));
+        }
+        if (i == c_warmUpCount) {
+            heapAfterWarmUp = heapInUse();
+        }
+    }
+    const qint64 heapAfter = heapInUse();
+    qInfo() << "Cached messages:" << cache.count() << "cost:" << cache.cost();
+
+    if (heapBefore >= 0) {
+        qInfo() << "Heap growth:" << heapAfter - heapBefore
+                << "after the warm-up:" << heapAfter - heapAfterWarmUp;
+        // The estimation does not cover the allocator and the container overhead,
+        // but the real memory must stay within the same order as the limit
+        QVERIFY(heapAfter - heapBefore <= c_limit * 2);
+        // Nothing is leaked by the evicted messages
+        QVERIFY(heapAfter - heapAfterWarmUp <= c_limit / 8);
+    }
+
+    QVERIFY(cache.count() > pinnedKeys.count());
+    for (const quint64 key : pinnedKeys) {
+        QVERIFY(cache.contains(key));
+    }
+    QVERIFY(cache.contains(c_messageCount));
+}
+
+QTEST_APPLESS_MAIN(tst_MessageCache)
+
+#include "tst_MessageCache.moc"
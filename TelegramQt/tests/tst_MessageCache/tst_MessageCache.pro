@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_MessageCache
+SOURCES += tst_MessageCache.cpp
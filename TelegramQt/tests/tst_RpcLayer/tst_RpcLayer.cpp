@@ -194,6 +194,7 @@ private slots:
     void sendClientRequest();
     void sendServerReply();
     void processServerReply();
+    void messageDataView();
 
 private:
     Telegram::DeterministicGenerator *m_generator = nullptr;
@@ -271,7 +272,44 @@ void tst_RpcLayer::processServerReply()
     rpcLayer.processPackage(c_serverReplyPackage);
 
     Telegram::MTProto::Message m = rpcLayer.lastProcessedMessage();
-    QCOMPARE(m.data, data);
+    QCOMPARE(m.data(), data);
+}
+
+void tst_RpcLayer::messageDataView()
+{
+    Telegram::MTProto::MessageHeader header;
+    header.messageId = 1;
+    header.sequenceNumber = 0;
+    header.contentLength = 12;
+    const QByteArray payload = QByteArrayLiteral("0123456789ab");
+
+    QByteArray copiedData;
+    {
+        const Telegram::MTProto::Message message(header, payload);
+        QVERIFY(message.data().constData() == payload.constData());
+
+        const Telegram::MTProto::Message skipped = message.skipTLValue();
+        QCOMPARE(skipped.dataSize(), 8);
+        QCOMPARE(skipped.data(), QByteArrayLiteral("456789ab"));
+        // No copy on envelope unwrapping
+        QVERIFY(skipped.data().constData() == payload.constData() + 4);
+
+        Telegram::MTProto::MessageHeader innerHeader = header;
+        innerHeader.messageId = 2;
+        innerHeader.contentLength = 3;
+        const Telegram::MTProto::Message inner = skipped.innerMessage(innerHeader, 2);
+        QCOMPARE(inner.messageId, quint64(2));
+        QCOMPARE(inner.data(), QByteArrayLiteral("678"));
+        QVERIFY(inner.data().constData() == payload.constData() + 6);
+
+        // Out of range content length is truncated to the available data
+        innerHeader.contentLength = 100;
+        QCOMPARE(skipped.innerMessage(innerHeader, 6).data(), QByteArrayLiteral("ab"));
+        QCOMPARE(message.skipBytes(100).dataSize(), 0);
+
+        copiedData = inner.copyData();
+    }
+    QCOMPARE(copiedData, QByteArrayLiteral("678"));
 }
 
 QTEST_APPLESS_MAIN(tst_RpcLayer)
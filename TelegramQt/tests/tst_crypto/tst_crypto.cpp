@@ -15,16 +15,24 @@
 
  */
 
+#include <QCryptographicHash>
 #include <QObject>
 #include <QTest>
 
 #include "Crypto/AesCtr.hpp"
+#include "Crypto/AuthKeyContext.hpp"
+
+static QByteArray sha256(const QByteArray &data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+}
 
 class tst_crypto : public QObject
 {
     Q_OBJECT
 private slots:
     void aesCtrContext();
+    void authKeyContext();
 };
 
 void tst_crypto::aesCtrContext()
@@ -93,6 +101,44 @@ void tst_crypto::aesCtrContext()
     QCOMPARE(words.toHex(), (decrypted31 + decrypted32).toHex());
 }
 
+void tst_crypto::authKeyContext()
+{
+    using Telegram::Crypto::AuthKeyContext;
+
+    QByteArray authKey(256, Qt::Uninitialized);
+    for (int i = 0; i < authKey.size(); ++i) {
+        authKey[i] = static_cast<char>(i * 7 + 3);
+    }
+    const QByteArray data = QByteArrayLiteral("some_decrypted_message_data_with_padding_0123456789");
+
+    AuthKeyContext context;
+    context.setAuthKey(authKey);
+    QCOMPARE(context.authKey(), authKey);
+
+    for (const int x : { AuthKeyContext::ClientToServer, AuthKeyContext::ServerToClient }) {
+        // Reference implementation of https://core.telegram.org/mtproto/description
+        const QByteArray keyPart = authKey.mid(88 + x, 32);
+        const QByteArray expectedMessageKey = sha256(keyPart + data).mid(8, 16);
+        const QByteArray sha256_a = sha256(expectedMessageKey + authKey.mid(x, 36));
+        const QByteArray sha256_b = sha256(authKey.mid(40 + x, 36) + expectedMessageKey);
+        const QByteArray expectedKey = sha256_a.left(8) + sha256_b.mid(8, 16) + sha256_a.mid(24, 8);
+        const QByteArray expectedIv = sha256_b.left(8) + sha256_a.mid(8, 16) + sha256_b.mid(24, 8);
+
+        QCOMPARE(context.keyPart(x).toHex(), keyPart.toHex());
+
+        QByteArray messageKey(AuthKeyContext::MessageKeySize, Qt::Uninitialized);
+        AuthKeyContext::messageKey(keyPart, data.constData(), data.size(), messageKey.data());
+        QCOMPARE(messageKey.toHex(), expectedMessageKey.toHex());
+        QVERIFY(AuthKeyContext::verifyMessageKey(keyPart, data.constData(), data.size(), messageKey.constData()));
+        messageKey[0] = static_cast<char>(messageKey.at(0) ^ 1);
+        QVERIFY(!AuthKeyContext::verifyMessageKey(keyPart, data.constData(), data.size(), messageKey.constData()));
+
+        const SAesKey aesKey = context.aesKey(expectedMessageKey.constData(), x);
+        QCOMPARE(aesKey.key.toHex(), expectedKey.toHex());
+        QCOMPARE(aesKey.iv.toHex(), expectedIv.toHex());
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_crypto)
 
 #include "tst_crypto.moc"
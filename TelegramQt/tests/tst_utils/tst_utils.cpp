@@ -21,7 +21,9 @@
 #include "TelegramNamespace.hpp"
 #include "RandomGenerator.hpp"
 #include "RsaKey.hpp"
+#include "TLValues.hpp"
 
+#include <QMetaEnum>
 #include <QTest>
 #include <QDebug>
 
@@ -29,6 +31,53 @@
 
 using namespace Telegram;
 
+// The pq-solver used before Pollard-Brent; kept as the benchmark reference
+static quint64 legacyFindDivider(quint64 number)
+{
+    int it = 0;
+    quint64 g = 0;
+    for (int i = 0; i < 3 || it < 10000; i++) {
+        const quint64 q = ((rand() & 15) + 17) % number;
+        quint64 x = (quint64) rand() % (number - 1) + 1;
+        quint64 y = x;
+        const quint32 lim = 1 << (i + 18);
+        for (quint32 j = 1; j < lim; j++) {
+            ++it;
+            quint64 a = x;
+            quint64 b = x;
+            quint64 c = q;
+            while (b) {
+                if (b & 1) {
+                    c += a;
+                    if (c >= number) {
+                        c -= number;
+                    }
+                }
+                a += a;
+                if (a >= number) {
+                    a -= number;
+                }
+                b >>= 1;
+            }
+            x = c;
+            const quint64 z = x < y ? number + x - y : x - y;
+            g = Utils::greatestCommonOddDivisor(z, number);
+            if (g != 1) {
+                return g;
+            }
+            if (!(j & (j - 1))) {
+                y = x;
+            }
+        }
+
+        if (g > 1 && g < number) {
+            return g;
+        }
+    }
+
+    return 1;
+}
+
 class tst_utils : public QObject
 {
     Q_OBJECT
@@ -41,14 +90,24 @@ private slots:
     void testRsaLoadPrivateKey();
     void testRsaFingersprint();
     void testRsaEncryption();
+    void testRsaCrtDecryption();
     void testRsaKey();
     void testBuiltInKey();
     void testRsaKeyIsValid();
+    void testFindDivider_data();
+    void testFindDivider();
+    void testFindDividerNoDivider_data();
+    void testFindDividerNoDivider();
+    void benchmarkFindDivider_data();
+    void benchmarkFindDivider();
     void testDeterministicRandom();
     void testGzipPack();
     void testGzipUnpack();
+    void testGzipUnpackTruncated();
+    void testGzipCompressionLevels();
     void testGzipOnDifferentDataSizes_data();
     void testGzipOnDifferentDataSizes();
+    void testTLValueMetadata();
 };
 
 void tst_utils::initTestCase()
@@ -132,6 +191,27 @@ void tst_utils::testRsaEncryption()
     QCOMPARE(sourceData, decodedData);
 }
 
+void tst_utils::testRsaCrtDecryption()
+{
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY(!publicKey.hasCrtComponents());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY(privateKey.hasCrtComponents());
+
+    DeterministicGenerator deterministic;
+    RandomGeneratorSetter generatorKeeper(&deterministic);
+    for (int i = 0; i < 16; ++i) {
+        QByteArray sourceData = RandomGenerator::instance()->generate(255);
+        sourceData[0] = char(i + 1); // Ensure that the data is less than the modulus and has no leading zero
+        const QByteArray encodedData = Utils::rsa(sourceData, publicKey);
+        QCOMPARE(Utils::rsaDecrypt(encodedData, privateKey), sourceData);
+
+        RsaKey nonCrtKey = privateKey;
+        nonCrtKey.prime1.clear();
+        QCOMPARE(Utils::rsaDecrypt(encodedData, nonCrtKey), sourceData);
+    }
+}
+
 void tst_utils::testRsaKey()
 {
     Telegram::RsaKey key;
@@ -171,6 +251,66 @@ void tst_utils::testRsaKeyIsValid()
     QVERIFY2(!key.isValid(), "A key without a modulus is not valid");
 }
 
+void tst_utils::testFindDivider_data()
+{
+    QTest::addColumn<quint64>("p");
+    QTest::addColumn<quint64>("q");
+    QTest::newRow("Server pq") << quint64(1244159563ull) << quint64(1558201013ull);
+    QTest::newRow("Documentation pq") << quint64(1229739323ull) << quint64(1402015859ull);
+    QTest::newRow("Close primes") << quint64(4294967279ull) << quint64(4294967291ull);
+    QTest::newRow("Small primes") << quint64(65537ull) << quint64(65539ull);
+    QTest::newRow("Square") << quint64(1000003ull) << quint64(1000003ull);
+}
+
+void tst_utils::testFindDivider()
+{
+    QFETCH(quint64, p);
+    QFETCH(quint64, q);
+    const quint64 pq = p * q;
+    quint64 steps = 0;
+    const quint64 divider = Utils::findDivider(pq, &steps);
+    QVERIFY(divider == p || divider == q);
+    // A product of two 32-bit primes takes about 2^16 steps
+    QVERIFY2(steps <= (quint64(1) << 20), qPrintable(QStringLiteral("Too many steps: %1").arg(steps)));
+}
+
+void tst_utils::testFindDividerNoDivider_data()
+{
+    QTest::addColumn<quint64>("pq");
+    QTest::newRow("Small prime") << quint64(1000003ull);
+    QTest::newRow("32-bit prime") << quint64(4294967291ull);
+    QTest::newRow("63-bit prime") << quint64(9223372036854775783ull);
+    QTest::newRow("64-bit prime") << quint64(18446744073709551557ull);
+}
+
+void tst_utils::testFindDividerNoDivider()
+{
+    QFETCH(quint64, pq);
+    quint64 steps = 1;
+    const quint64 divider = Utils::findDivider(pq, &steps);
+    // A prime number has no divider and the answer comes without a search
+    QCOMPARE(divider, quint64(1));
+    QCOMPARE(steps, quint64(0));
+}
+
+void tst_utils::benchmarkFindDivider_data()
+{
+    QTest::addColumn<bool>("legacy");
+    QTest::newRow("Pollard-Brent") << false;
+    QTest::newRow("Legacy") << true;
+}
+
+void tst_utils::benchmarkFindDivider()
+{
+    QFETCH(bool, legacy);
+    const quint64 pq = 1244159563ull * 1558201013ull;
+    quint64 divider = 0;
+    QBENCHMARK {
+        divider = legacy ? legacyFindDivider(pq) : Utils::findDivider(pq);
+    }
+    QVERIFY(divider == 1244159563ull || divider == 1558201013ull);
+}
+
 void tst_utils::testDeterministicRandom()
 {
     DeterministicGenerator deterministic;
@@ -285,6 +425,27 @@ void tst_utils::testGzipUnpack()
     QCOMPARE(result.toHex(), c_gzipUnpackedData.toHex());
 }
 
+void tst_utils::testGzipUnpackTruncated()
+{
+    // The ISIZE trailer is missing (or misread), so the hint is wrong and the stream is not finished
+    QVERIFY(Utils::unpackGZip(c_gzipPackedData.left(c_gzipPackedData.size() - 8)).isEmpty());
+    QVERIFY(Utils::unpackGZip(c_gzipPackedData.left(c_gzipPackedData.size() / 2)).isEmpty());
+    // The reused context must not be affected by the failures
+    QCOMPARE(Utils::unpackGZip(c_gzipPackedData).toHex(), c_gzipUnpackedData.toHex());
+}
+
+void tst_utils::testGzipCompressionLevels()
+{
+    const QByteArray data = c_gzipUnpackedData.repeated(8);
+    for (int level : { 1, 9, Utils::c_gzipDefaultCompressionLevel }) {
+        const QByteArray packed = Utils::packGZip(data, level);
+        QVERIFY(!packed.isEmpty());
+        QCOMPARE(Utils::unpackGZip(packed), data);
+    }
+    // The context is reused with the default level again
+    QCOMPARE(Utils::packGZip(c_gzipUnpackedData).toHex(), c_gzipPackedData.toHex());
+}
+
 void tst_utils::testGzipOnDifferentDataSizes_data()
 {
     QTest::addColumn<uint>("dataSize");
@@ -313,6 +474,34 @@ void tst_utils::testGzipOnDifferentDataSizes()
     QCOMPARE(unpacked.size(), dataSizeInt);
 }
 
+void tst_utils::testTLValueMetadata()
+{
+    // The generated table must cover all enum values
+    const QMetaObject &metaObject = TLValue::staticMetaObject;
+    const QMetaEnum valueEnum = metaObject.enumerator(metaObject.indexOfEnumerator("Value"));
+    for (int i = 0; i < valueEnum.keyCount(); ++i) {
+        const TLValue value(static_cast<quint32>(valueEnum.value(i)));
+        QVERIFY(value.isValid());
+        QCOMPARE(value.toString(), QString::fromLatin1(valueEnum.key(i)));
+        QVERIFY(value.typeOf());
+        QVERIFY(value.kind() != TLValue::Kind::Invalid);
+    }
+
+    const TLValue user = TLValue::User;
+    QCOMPARE(user.kind(), TLValue::Kind::Type);
+    QCOMPARE(QByteArray(user.typeOf()), QByteArrayLiteral("TLUser"));
+
+    const TLValue getState = TLValue::UpdatesGetState;
+    QCOMPARE(getState.kind(), TLValue::Kind::Function);
+    QCOMPARE(QByteArray(getState.typeOf()), QByteArrayLiteral("TLUpdatesState"));
+
+    const TLValue invalid(0x12345678);
+    QVERIFY(!invalid.isValid());
+    QCOMPARE(invalid.kind(), TLValue::Kind::Invalid);
+    QVERIFY(!invalid.typeOf());
+    QCOMPARE(invalid.toString(), QStringLiteral("12345678"));
+}
+
 QTEST_APPLESS_MAIN(tst_utils)
 
 #include "tst_utils.moc"
@@ -23,6 +23,7 @@
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QRegularExpression>
+#include <QSet>
 
 #include <QTextStream>
 
@@ -363,6 +364,8 @@ QMap<QString, TLType> Generator::readTypesJson(const QJsonDocument &document)
         TLSubType tlSubType;
         tlSubType.name = predicateName;
         tlSubType.predicateId = predicateId;
+        tlSubType.predicateType = Predicate::Type;
+        tlSubType.typeName = typeName;
 
         const QJsonArray params = obj.value("params").toArray();
 
@@ -399,6 +402,7 @@ QMap<QString, TLMethod> Generator::readFunctionsJson(const QJsonDocument &docume
         tlMethod.name = methodName;
         tlMethod.predicateId = methodId;
         tlMethod.type = typeName;
+        tlMethod.predicateType = Predicate::Function;
 
         const QJsonArray params = obj.value("params").toArray();
 
@@ -602,7 +606,9 @@ QStringList Generator::generateTLTypeMembers(const TLType &type)
             if (member.dependOnFlag() && (member.type() == tlTrueType)) {
                 continue; // No extra data behind the flag
             }
-            if (member.accessByPointer()) {
+            if (member.isLazy()) {
+                membersCode.append(QStringLiteral("TLLazy<%1> %2;").arg(member.type(), member.getAlias()));
+            } else if (member.accessByPointer()) {
                 if (member.isVector()) {
                     membersCode.append(QStringLiteral("%1<%2*> %3;").arg(tlVectorType, member.bareType(), member.getAlias()));
                 } else {
@@ -635,7 +641,7 @@ QString Generator::streamReadImplementationEnd(const QString &argName)
 {
     QString code;
     code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
-    code.append(QString("%1%2 = result;\n\n%1return *this;\n}\n\n").arg(spacing, argName));
+    code.append(QString("%1%2 = std::move(result);\n\n%1return *this;\n}\n\n").arg(spacing, argName));
     return code;
 }
 
@@ -649,10 +655,14 @@ QString Generator::streamReadPerTypeImplementation(const QString &argName, const
                 continue;
             }
             code.append(doubleSpacing + QString("if (result.%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit));
-            code.append(doubleSpacing + spacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
+            if (member.isDereferenced()) {
+                code.append(doubleSpacing + spacing + QString("*this >> *result.%1;\n").arg(member.getAlias()));
+            } else {
+                code.append(doubleSpacing + spacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
+            }
             code.append(doubleSpacing + QLatin1Literal("}\n"));
         } else {
-            if (member.accessByPointer() && !member.isVector()) {
+            if (member.isDereferenced()) {
                 code.append(doubleSpacing + QString("*this >> *result.%1;\n").arg(member.getAlias()));
             } else {
                 code.append(doubleSpacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
@@ -754,10 +764,14 @@ QString Generator::streamWritePerTypeImplementationBase(const QString &argName,
                 continue;
             }
             code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName).arg(member.flagMember).arg(member.flagBit));
-            code.append(doubleSpacing + spacing + streamGetter + QString(" << %1.%2;\n").arg(argName).arg(member.getAlias()));
+            if (member.isDereferenced()) {
+                code.append(doubleSpacing + spacing + streamGetter + QString(" << *%1.%2;\n").arg(argName).arg(member.getAlias()));
+            } else {
+                code.append(doubleSpacing + spacing + streamGetter + QString(" << %1.%2;\n").arg(argName).arg(member.getAlias()));
+            }
             code.append(doubleSpacing + QLatin1Literal("}\n"));
         } else {
-            if (member.accessByPointer() && !member.isVector()) {
+            if (member.isDereferenced()) {
                 code.append(doubleSpacing + streamGetter + QString(" << *%1.%2;\n").arg(argName).arg(member.getAlias()));
             } else {
                 code.append(doubleSpacing + streamGetter + QString(" << %1.%2;\n").arg(argName).arg(member.getAlias()));
@@ -957,7 +971,9 @@ QString Generator::debugOperatorPerTypeImplementation(const QString &argName, co
 
     for (const TLParam &member : subType.members) {
         QString typeDebugStatement = QStringLiteral("type.%1");
-        if (member.type().contains(QLatin1String("QByteArray"))) {
+        if (member.isLazy()) {
+            typeDebugStatement = QStringLiteral("*type.%1");
+        } else if (member.type().contains(QLatin1String("QByteArray"))) {
             typeDebugStatement = QStringLiteral("type.%1.toHex()");
         }
         typeDebugStatement = typeDebugStatement.arg(member.getAlias());
@@ -1211,7 +1227,7 @@ Generator::MethodsCode Generator::generateServerRpcProcessMethods(const QString
         // bool AuthRpcOperation::processCheckPhone(RpcProcessingContext &context)
         // {
         //     setRunMethod(&AuthRpcOperation::runCheckPhone);
-        //     context.inputStream() >> m_checkPhone;
+        //     context.inputStream() >> constructArguments(&m_checkPhone);
         //     return true;
         // }
 
@@ -1219,7 +1235,7 @@ Generator::MethodsCode Generator::generateServerRpcProcessMethods(const QString
                     "bool %1::process%2(RpcProcessingContext &context)\n"
                     "{\n"
                     "    setRunMethod(&%1::run%2);\n"
-                    "    context.inputStream() >> m_%3;\n"
+                    "    context.inputStream() >> constructArguments(&m_%3);\n"
                     "    return !context.inputStream().error();\n"
                     "}\n\n"
                     ).arg(className, method.nameFromSecondWord(), predicateName);
@@ -1258,6 +1274,39 @@ QStringList Generator::generateServerMethodForRpcFunction(const QString &groupNa
     return result;
 }
 
+QStringList Generator::generateServerRpcDispatchTable() const
+{
+    struct Entry {
+        quint32 id;
+        QString code;
+    };
+    QVector<Entry> entries;
+    for (const QString &groupName : functionGroups()) {
+        const QString prefixFirstUpper = formatName(groupName, FormatOption::UpperCaseFirstLetter);
+        const QString className = prefixFirstUpper + QStringLiteral("RpcOperation");
+        for (const TLMethod &method : m_functions) {
+            if (!method.name.startsWith(groupName)) {
+                continue;
+            }
+            const QString methodName = method.nameFromSecondWord();
+            entries.append({ method.predicateId,
+                             QStringLiteral("{ %1::%2%3, processRpcCallWithMethod<%4, &%4::process%3> },")
+                             .arg(tlValueName, prefixFirstUpper, methodName, className) });
+        }
+    }
+    // The table is looked up via binary search
+    std::sort(entries.begin(), entries.end(), [](const Entry &e1, const Entry &e2) {
+        return e1.id < e2.id;
+    });
+
+    // { TLValue::UpdatesGetState, processRpcCallWithMethod<UpdatesRpcOperation, &UpdatesRpcOperation::processGetState> },
+    QStringList result;
+    for (const Entry &entry : entries) {
+        result.append(entry.code);
+    }
+    return result;
+}
+
 Generator::MethodsCode Generator::generateServerRpcRunMethods(const QString &groupName, const QString &previousSourceCode) const
 {
     const QString prefixFirstUpper = formatName(groupName, FormatOption::UpperCaseFirstLetter);
@@ -1425,7 +1474,8 @@ struct TypeTreeItem
     }
 };
 
-QList<TLType> Generator::solveTypes(QMap<QString, TLType> types, QMap<QString, TLType> *unresolved)
+QList<TLType> Generator::solveTypes(QMap<QString, TLType> types, QMap<QString, TLType> *unresolved,
+                                   const QStringList &compactTypes)
 {
     QStringList solvedTypesNames = nativeTypes;
     solvedTypesNames.append(tlValueName);
@@ -1479,6 +1529,41 @@ QList<TLType> Generator::solveTypes(QMap<QString, TLType> types, QMap<QString, T
                 }
             }
         }
+
+        // Bake lazy members of the compact types
+        for (const QString &typeName : compactTypes) {
+            if (!types.contains(typeName)) {
+                qWarning() << "Compact type" << typeName << "not found!";
+                continue;
+            }
+            TLType &type = types[typeName];
+            QHash<QString,int> memberUsage;
+            QSet<QString> optionalMembers;
+            for (const TLSubType &subType : type.subTypes) {
+                for (const TLParam &member : subType.members) {
+                    ++memberUsage[member.getAlias()];
+                    if (member.dependOnFlag()) {
+                        optionalMembers.insert(member.getAlias());
+                    }
+                }
+            }
+
+            for (TLSubType &subType : type.subTypes) {
+                for (TLParam &member : subType.members) {
+                    if (member.isVector() || member.accessByPointer() || !types.contains(member.type())) {
+                        continue;
+                    }
+                    if (isPlainType(types.value(member.type()))) {
+                        // Plain types are cheap to keep inline
+                        continue;
+                    }
+                    const QString alias = member.getAlias();
+                    if (optionalMembers.contains(alias) || (memberUsage.value(alias) < type.subTypes.count())) {
+                        member.setLazy(true);
+                    }
+                }
+            }
+        }
     }
 
     QVector<TypeTreeItem> typeTree;
@@ -1725,6 +1810,8 @@ bool Generator::loadFromText(const QByteArray &data)
             tlSubType.predicateId = parseResult.predicateId;
             tlSubType.members.append(parseResult.params);
             tlSubType.source = line;
+            tlSubType.predicateType = Predicate::Type;
+            tlSubType.typeName = typeName;
 
             tlType.subTypes.append(tlSubType);
 
@@ -1742,6 +1829,7 @@ bool Generator::loadFromText(const QByteArray &data)
             tlMethod.predicateId = parseResult.predicateId;
             tlMethod.source = line;
             tlMethod.type = typeName;
+            tlMethod.predicateType = Predicate::Function;
 
             if (!parseResult.predicateName.contains(QLatin1Char('.'))) {
                 parsedManually = true;
@@ -1783,7 +1871,7 @@ bool Generator::loadFromText(const QByteArray &data)
 bool Generator::resolveTypes()
 {
     QMap<QString, TLType> unresolved;
-    m_solvedTypes = solveTypes(m_types, &unresolved);
+    m_solvedTypes = solveTypes(m_types, &unresolved, m_compactTypes);
 
     if (!unresolved.isEmpty()) {
         qDebug() << "Unresolved:" << unresolved.count() << unresolved;
@@ -1929,6 +2017,8 @@ void Generator::generate()
         codeDebugWriteDefinitions .append(generateDebugWriteOperatorDefinition(type));
     }
     codeOfTLValues = joinLinesWithPrepend(generateTLValues(), doubleSpacing);
+    codeOfTLValuesTable = joinLinesWithPrepend(generateTLValuesTable(), spacing, QStringLiteral("\n"));
+    generateTLSchemaTables();
 }
 
 QStringList Generator::generateTLValues()
@@ -1979,6 +2069,146 @@ QStringList Generator::generateTLValues()
     return result;
 }
 
+QStringList Generator::generateTLValuesTable() const
+{
+    QVector<const Predicate *> predicates;
+    for (const TLType &type : m_types) {
+        for (const TLSubType &subType : type.subTypes) {
+            predicates.append(&subType);
+        }
+    }
+    for (const TLMethod &method : m_functions) {
+        predicates.append(&method);
+    }
+    for (const Predicate *predicate : m_extraPredicates) {
+        predicates.append(predicate);
+    }
+    // The table is looked up via binary search
+    std::sort(predicates.begin(), predicates.end(), [](const Predicate *p1, const Predicate *p2) {
+        return p1->predicateId < p2->predicateId;
+    });
+
+    // { TLValue::UpdatesGetState, "UpdatesGetState", "TLUpdatesState", TLValue::Kind::Function },
+    QStringList result;
+    quint32 previousId = 0;
+    for (const Predicate *predicate : predicates) {
+        if (predicate->predicateId == previousId) {
+            continue;
+        }
+        previousId = predicate->predicateId;
+        QString typeName;
+        QString kind;
+        if (predicate->predicateType == Predicate::Function) {
+            typeName = static_cast<const TLMethod *>(predicate)->type;
+            kind = QStringLiteral("Function");
+        } else {
+            typeName = static_cast<const TLSubType *>(predicate)->typeName;
+            kind = QStringLiteral("Type");
+        }
+        result.append(QStringLiteral("{ %1::%2, \"%2\", \"%3\", %1::Kind::%4 },")
+                      .arg(tlValueName, predicate->nameFirstCapital(), processOperationType(typeName), kind));
+    }
+    return result;
+}
+
+void Generator::generateTLSchemaTables()
+{
+    // The TL schema tables are used to validate and skip serialized values without decoding
+    QStringList typeNames;
+    QVector<const TLSubType *> subTypes;
+    QHash<const TLSubType *, QString> subTypeTypeNames;
+    for (const TLType &type : m_solvedTypes) {
+        if (nativeTypes.contains(type.name) || typesBlackList.contains(type.name)) {
+            continue;
+        }
+        typeNames.append(removePrefix(type.name));
+        for (const TLSubType &subType : type.subTypes) {
+            subTypes.append(&subType);
+            subTypeTypeNames.insert(&subType, removePrefix(type.name));
+        }
+    }
+    typeNames.sort();
+    std::sort(subTypes.begin(), subTypes.end(), [](const TLSubType *s1, const TLSubType *s2) {
+        return s1->predicateId < s2->predicateId;
+    });
+
+    QStringList types;
+    for (const QString &typeName : typeNames) {
+        types.append(typeName + QLatin1Char(','));
+    }
+
+    QStringList fields;
+    QStringList constructors;
+    int fieldIndex = 0;
+    for (const TLSubType *subType : subTypes) {
+        QSet<QString> flagMembers;
+        for (const TLParam &member : subType->members) {
+            if (member.dependOnFlag()) {
+                flagMembers.insert(member.flagMember);
+            }
+        }
+
+        QStringList subTypeFields;
+        for (const TLParam &member : subType->members) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            QString type = member.bareType();
+            if (type.endsWith(QLatin1Char('*'))) {
+                type.chop(1);
+            }
+            QString kind;
+            QString typeIndex = QStringLiteral("Any");
+            if (member.isVector()) {
+                if (type == QLatin1String("quint32")) {
+                    kind = QStringLiteral("IntVector");
+                } else if (type == QLatin1String("quint64")) {
+                    kind = QStringLiteral("LongVector");
+                } else {
+                    kind = QStringLiteral("ObjectVector");
+                    typeIndex = removePrefix(type);
+                }
+            } else if (flagMembers.contains(member.getName())) {
+                kind = QStringLiteral("Flags");
+            } else if (type == QLatin1String("quint32")) {
+                kind = QStringLiteral("Int");
+            } else if (type == QLatin1String("quint64")) {
+                kind = QStringLiteral("Long");
+            } else if (type == QLatin1String("double")) {
+                kind = QStringLiteral("Double");
+            } else if (type == QLatin1String("bool")) {
+                kind = QStringLiteral("Bool");
+            } else if ((type == QLatin1String("QString")) || (type == QLatin1String("QByteArray"))) {
+                kind = QStringLiteral("Bytes");
+            } else if (type == QLatin1String("TLNumber128")) {
+                kind = QStringLiteral("Int128");
+            } else if (type == QLatin1String("TLNumber256")) {
+                kind = QStringLiteral("Int256");
+            } else {
+                kind = QStringLiteral("Object");
+                typeIndex = removePrefix(type);
+            }
+            const QString flagBit = member.dependOnFlag() ? QString::number(member.flagBit) : QStringLiteral("c_noFlag");
+            subTypeFields.append(QStringLiteral("{ FieldKind::%1, %2, TypeIndex::%3 },").arg(kind, flagBit, typeIndex));
+        }
+
+        // { TLValue::UpdateShort, TypeIndex::Updates, 1042, 2 },
+        constructors.append(QStringLiteral("{ %1::%2, TypeIndex::%3, %4, %5 },")
+                            .arg(tlValueName, subType->nameFirstCapital(), subTypeTypeNames.value(subType))
+                            .arg(subTypeFields.isEmpty() ? 0 : fieldIndex)
+                            .arg(subTypeFields.count()));
+        if (!subTypeFields.isEmpty()) {
+            fields.append(QStringLiteral("// ") + subType->nameFirstCapital());
+            fields.append(subTypeFields);
+            fieldIndex += subTypeFields.count();
+        }
+    }
+
+    codeOfTLSchemaTypes = joinLinesWithPrepend(types, spacing, QStringLiteral("\n"));
+    codeOfTLSchemaFields = joinLinesWithPrepend(fields, spacing, QStringLiteral("\n"));
+    codeOfTLSchemaConstructors = joinLinesWithPrepend(constructors, spacing, QStringLiteral("\n"));
+}
+
 void Generator::dumpReadData() const
 {
     qDebug() << "\n" << Q_FUNC_INFO;
@@ -2211,6 +2441,23 @@ void Generator::setAddSpecSources(bool addSources)
     m_addSpecSources = addSources;
 }
 
+void Generator::setCompactTypes(const QStringList &typeNames)
+{
+    m_compactTypes = typeNames;
+}
+
+bool Generator::isPlainType(const TLType &type)
+{
+    for (const TLSubType &subType : type.subTypes) {
+        for (const TLParam &member : subType.members) {
+            if (!podTypes.contains(member.type())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 QStringList Generator::getWords(const QString &input)
 {
     if (input.isEmpty()) {
@@ -88,6 +88,13 @@ struct TLParam {
     bool accessByPointer() const { return m_accessByPointer; }
     void setAccessByPointer(bool accessByPointer) { m_accessByPointer = accessByPointer; }
 
+    // The member is allocated on demand (see compact types)
+    bool isLazy() const { return m_lazy; }
+    void setLazy(bool lazy) { m_lazy = lazy; }
+
+    // The stream and debug operators need to dereference the member
+    bool isDereferenced() const { return (m_accessByPointer || m_lazy) && !m_isVector; }
+
     QString getAlias() const { return !m_alias.isEmpty() ? m_alias : m_name; }
     void setAlias(const QString &newAlias) { m_alias = newAlias; }
 
@@ -102,6 +109,7 @@ protected:
     QString m_name;
     bool m_isVector = false;
     bool m_accessByPointer = false;
+    bool m_lazy = false;
 };
 
 struct TLSubType : public Predicate {
@@ -109,6 +117,7 @@ struct TLSubType : public Predicate {
     QString getEntityTLType() const override { return name; }
     QMap<quint8, QString> getBoolFlags() const;
     QList<TLParam> members;
+    QString typeName; // The TL type of this constructor
 };
 
 struct TLType : public TypedEntity {
@@ -168,6 +177,8 @@ public:
     bool resolveTypes();
     void generate();
     QStringList generateTLValues();
+    QStringList generateTLValuesTable() const;
+    void generateTLSchemaTables();
 
     void dumpReadData() const;
     void dumpSolvedTypes() const;
@@ -206,6 +217,11 @@ public:
 
     void setAddSpecSources(bool addSources);
 
+    // Types with compact layout: the non-trivial members which are optional or specific to
+    // some of the type constructors are allocated on demand.
+    QStringList compactTypes() const { return m_compactTypes; }
+    void setCompactTypes(const QStringList &typeNames);
+
     static QStringList getWords(const QString &input);
     static QString removeWord(QString input, QString word);
     static QString generateTLValuesDefinition(const Predicate *predicate);
@@ -276,6 +292,7 @@ public:
     MethodsCode generateServerRpcProcessMethods(const QString &groupName) const;
     QStringList generateServerRpcMembers(const QString &groupName) const;
     QStringList generateServerMethodForRpcFunction(const QString &groupName) const;
+    QStringList generateServerRpcDispatchTable() const;
 
     MethodsCode generateServerRpcRunMethods(const QString &groupName, const QString &previousSourceCode) const;
 
@@ -283,11 +300,17 @@ public:
 
     static QStringList reorderLinesAsExist(QStringList newLines, QStringList existLines);
 
-    static QList<TLType> solveTypes(QMap<QString, TLType> types, QMap<QString, TLType> *unresolved = nullptr);
+    static QList<TLType> solveTypes(QMap<QString, TLType> types, QMap<QString, TLType> *unresolved = nullptr,
+                                    const QStringList &compactTypes = QStringList());
+    static bool isPlainType(const TLType &type);
 
     void getUsedAndVectorTypes(QStringList &usedTypes, QStringList &vectors) const;
 
     QString codeOfTLValues;
+    QString codeOfTLValuesTable;
+    QString codeOfTLSchemaTypes;
+    QString codeOfTLSchemaFields;
+    QString codeOfTLSchemaConstructors;
     QString codeOfTLTypes;
     QString codeStreamReadDeclarations;
     QString codeStreamReadDefinitions;
@@ -317,6 +340,7 @@ private:
     QMap<QString, TLMethod> m_functions;
     QVector<QStringList> m_groups;
     bool m_addSpecSources;
+    QStringList m_compactTypes;
     QStringList m_functionGroups;
 };
 
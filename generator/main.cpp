@@ -48,6 +48,7 @@ enum SchemaFormat {
 static bool s_dryRun = false;
 static bool s_dump = true;
 static bool s_addSpecSources = false;
+static QStringList s_compactTypes;
 
 static const QByteArray c_textLayerMarker = QByteArrayLiteral("// LAYER ");
 
@@ -517,6 +518,7 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
 
     Generator generator;
     generator.setAddSpecSources(s_addSpecSources);
+    generator.setCompactTypes(s_compactTypes);
 
     bool success = true;
 
@@ -565,6 +567,16 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
         OutputFile fileValues("TLValues.hpp");
         fileValues.replace("TLValues", generator.codeOfTLValues, 8);
     }
+    {
+        OutputFile fileValues("TLValues.cpp");
+        fileValues.replace("TLValues table", generator.codeOfTLValuesTable, 4);
+    }
+    {
+        OutputFile fileSchema("TLSchema.cpp");
+        fileSchema.replace("TL schema types", generator.codeOfTLSchemaTypes, 4);
+        fileSchema.replace("TL schema fields", generator.codeOfTLSchemaFields, 4);
+        fileSchema.replace("TL schema constructors", generator.codeOfTLSchemaConstructors, 4);
+    }
     {
         OutputFile fileValues("TLTypes.hpp");
         fileValues.replace("TLTypes", generator.codeOfTLTypes);
@@ -719,8 +731,9 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
                 const QString defCode = Generator::joinLinesWithPrepend(functions.definitions);
                 sourceFile.replace("run methods", defCode);
             }
-            const QString rpcMembers = Generator::joinLinesWithPrepend(generator.generateServerRpcMembers(group.nameSmall), Generator::spacing, QStringLiteral("\n"));
-            headerFile.replace("RPC members", rpcMembers, 4);
+            // The members are in an anonymous union
+            const QString rpcMembers = Generator::joinLinesWithPrepend(generator.generateServerRpcMembers(group.nameSmall), Generator::spacing + Generator::spacing, QStringLiteral("\n"));
+            headerFile.replace("RPC members", rpcMembers, 8);
 
             const QString methodForRpcFunctionCases = Generator::joinLinesWithPrepend(generator.generateServerMethodForRpcFunction(group.nameSmall));
             sourceFile.replace("methodForRpcFunction cases", methodForRpcFunctionCases, 4);
@@ -736,6 +749,15 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
             sourceFile.replace("RPC Operation Factory includes", includes);
             sourceFile.replace("RPC Operation Factory initialization", initialization, initIndentation);
         }
+        {
+            OutputFile sourceFile("../server/RpcOperationFactory.cpp");
+            const QString includes = Generator::joinLinesWithPrepend(generator.serverRpcFactoryIncludes(),
+                                                                     QString(), QStringLiteral("\n"));
+            const QString table = Generator::joinLinesWithPrepend(generator.generateServerRpcDispatchTable(),
+                                                                  Generator::spacing, QStringLiteral("\n"));
+            sourceFile.replace("RPC Operation Factory includes", includes);
+            sourceFile.replace("RPC dispatch table", table, 4);
+        }
     }
 
     printf("Spec file successfully used for generation.\n");
@@ -778,6 +800,11 @@ int main(int argc, char *argv[])
     QCommandLineOption addSpecSourcesOption(QStringLiteral("add-spec-sources"));
     parser.addOption(addSpecSourcesOption);
 
+    QCommandLineOption compactTypesOption(QStringLiteral("compact-types"));
+    compactTypesOption.setValueName(QStringLiteral("types"));
+    compactTypesOption.setDefaultValue(QStringLiteral("TLMessage,TLMessageMedia,TLUpdate"));
+    parser.addOption(compactTypesOption);
+
     QCommandLineOption fetchTextOption(QStringLiteral("fetch-text"));
     fetchTextOption.setValueName(QStringLiteral("url"));
     parser.addOption(fetchTextOption);
@@ -806,6 +833,7 @@ int main(int argc, char *argv[])
     s_dryRun = parser.isSet(dryRunOption);
     s_dump = parser.isSet(dumpOption);
     s_addSpecSources = parser.isSet(addSpecSourcesOption);
+    s_compactTypes = parser.value(compactTypesOption).split(QLatin1Char(','), QString::SkipEmptyParts);
     s_inputDir = parser.value(inputDirOption);
     if (s_inputDir.isEmpty()) {
         s_inputDir = QStringLiteral("./");
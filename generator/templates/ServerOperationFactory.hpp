@@ -16,6 +16,7 @@ class __VAR_GROUP_NAME__RpcOperation : public RpcOperation
     Q_DISABLE_COPY(__VAR_GROUP_NAME__RpcOperation)
 public:
     explicit __VAR_GROUP_NAME__RpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~__VAR_GROUP_NAME__RpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processAccountGetPassword(RpcProcessingContext &context);
@@ -30,14 +31,21 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        // End of generated RPC members
+    };
 };
 
 class __VAR_GROUP_NAME__OperationFactory : public RpcOperationFactory
@@ -72,6 +72,17 @@ const QStringList c_sourcesPageBlock =
     QStringLiteral("pageBlockPhoto#e9c69982 photo_id:long caption:RichText = PageBlock;"),
 };
 
+const QStringList c_sourcesMessageMedia =
+{
+    QStringLiteral("photoEmpty#2331b22d id:long = Photo;"),
+    QStringLiteral("photo#bff852ef id:long access_hash:long date:int caption:string = Photo;"),
+    QStringLiteral("geoPointEmpty#1117dd5f = GeoPoint;"),
+    QStringLiteral("geoPoint#933cef18 lon:double lat:double = GeoPoint;"),
+    QStringLiteral("messageMediaEmpty#3ded6320 = MessageMedia;"),
+    QStringLiteral("messageMediaPhoto#931142dc flags:# photo:flags.0?Photo caption:flags.1?string = MessageMedia;"),
+    QStringLiteral("messageMediaGeo#56e0d474 geo:GeoPoint = MessageMedia;"),
+};
+
 class tst_Generator : public QObject
 {
     Q_OBJECT
@@ -86,6 +97,7 @@ private slots:
     void checkTypeWithMemberConflicts();
     void recursiveTypeMembers();
     void doubleRecursiveTypeMembers();
+    void compactTypeMembers();
     void predicateForCrc_data();
     void predicateForCrc();
 };
@@ -237,6 +249,33 @@ void tst_Generator::doubleRecursiveTypeMembers()
     }
 }
 
+void tst_Generator::compactTypeMembers()
+{
+    const QStringList sources = c_sourcesMessageMedia;
+    const QString generatedTypeName = Generator::parseLine(c_sourcesMessageMedia.last()).typeName;
+    const QByteArray textData = generateTextSpec(sources);
+    Generator generator;
+    generator.setCompactTypes({ Generator::formatType(generatedTypeName) });
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    QVERIFY(!generator.solvedTypes().isEmpty());
+    const TLType solvedType = getSolvedType(generator, generatedTypeName);
+    QVERIFY(!solvedType.name.isEmpty());
+    const QStringList structMembers = Generator::generateTLTypeMembers(solvedType);
+    static const QStringList checkList = {
+        QStringLiteral("TLLazy<TLPhoto> photo;"),
+        QStringLiteral("QString caption;"),
+        QStringLiteral("TLGeoPoint geo;"), // Plain types are kept inline
+    };
+    for (const QString &mustHaveMember : checkList) {
+        if (!structMembers.contains(mustHaveMember)) {
+            // qDebug().noquote() << structMembers.join(QLatin1Char('\n'));
+            QString message = QStringLiteral("The member \"%1\" is missing in the generated struct of the type %2.").arg(mustHaveMember, generatedTypeName);
+            QFAIL(message.toUtf8().constData());
+        }
+    }
+}
+
 void tst_Generator::predicateForCrc_data()
 {
     QTest::addColumn<QByteArray>("input");
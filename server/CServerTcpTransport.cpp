@@ -6,6 +6,7 @@
 
 #include "AesCtr.hpp"
 #include "CRawStream.hpp"
+#include "TcpFramer.hpp"
 #include "Utils.hpp"
 #include "TLValues.hpp"
 
@@ -13,6 +14,9 @@
 
 Q_LOGGING_CATEGORY(c_loggingServerTcpTransport, "telegram.server.transport.tcp", QtWarningMsg)
 
+// first, next, AES (key + Ivec) (48 bytes), protocol tag, random 4 bytes
+static const int c_obfuscatedHeaderSize = 64;
+
 namespace Telegram {
 
 namespace Server {
@@ -24,6 +28,11 @@ TcpTransport::TcpTransport(QTcpSocket *socket, QObject *parent) :
     setState(m_socket->state());
 }
 
+TcpTransport::TcpTransport(QObject *parent) :
+    BaseTcpTransport(parent)
+{
+}
+
 TcpTransport::~TcpTransport()
 {
     qCDebug(c_loggingServerTcpTransport) << this << __func__;
@@ -34,15 +43,46 @@ void TcpTransport::connectToHost(const QString &, quint16)
     qCCritical(c_loggingServerTcpTransport) << Q_FUNC_INFO << "The function must not be called in a server application";
 }
 
-bool TcpTransport::startObfuscatedSession()
+int TcpTransport::readSessionHeader(const QByteArray &data)
+{
+    if (data.isEmpty()) {
+        return 0;
+    }
+    if (data.at(0) == char(0xef)) {
+        setSessionType(Abridged);
+        return 1;
+    }
+    quint32 protocolTag = 0;
+    if (data.size() < static_cast<int>(sizeof(protocolTag))) {
+        return 0;
+    }
+    memcpy(&protocolTag, data.constData(), sizeof(protocolTag));
+    if (protocolTag == TcpFramer::IntermediateTag) {
+        setSessionType(Intermediate);
+        return sizeof(protocolTag);
+    }
+    if (protocolTag == TcpFramer::PaddedIntermediateTag) {
+        setSessionType(PaddedIntermediate);
+        return sizeof(protocolTag);
+    }
+    if (data.size() < c_obfuscatedHeaderSize) {
+        return 0;
+    }
+    if (!startObfuscatedSession(data.left(c_obfuscatedHeaderSize))) {
+        return -1;
+    }
+    setSessionType(Obfuscated);
+    return c_obfuscatedHeaderSize;
+}
+
+bool TcpTransport::startObfuscatedSession(const QByteArray &header)
 {
     qCDebug(c_loggingServerTcpTransport()) << Q_FUNC_INFO;
-    if (m_socket->bytesAvailable() < 64) {
+    if (header.size() != c_obfuscatedHeaderSize) {
         qCWarning(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Invalid package size";
         return false;
     }
-    QByteArray plainData = m_socket->read(56);
-    CRawStream raw(plainData);
+    CRawStream raw(header.left(56));
 
     quint32 firstByte;
     quint32 secondByte;
@@ -58,8 +98,18 @@ bool TcpTransport::startObfuscatedSession()
 
     // The client sends its encryption key in plain text
     setCryptoKeysSourceData(encryptionSourceData, DirectIsReadReversedIsWrite);
-    QByteArray content1 = plainData + m_socket->read(8);
-    m_readAesContext->crypt(content1);
+    const QByteArray decrypted = m_readAesContext->crypt(header);
+    // first, next, AES (key + Ivec) (48 bytes), protocol tag, random 4 bytes; 64 bytes in total
+    CRawStream tagStream(decrypted.mid(56, 4));
+    quint32 protocolTag = 0;
+    tagStream >> protocolTag;
+    TcpFramer *framer = TcpFramer::fromProtocolTag(protocolTag);
+    if (!framer) {
+        qCWarning(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Unsupported protocol tag"
+                                                 << hex << showbase << protocolTag;
+        return false;
+    }
+    setFramer(framer);
     return true;
 }
 
@@ -68,18 +118,15 @@ void TcpTransport::readEvent()
     if (Q_LIKELY(m_sessionType != Unknown)) {
         return;
     }
-    char sessionSign;
-    m_socket->getChar(&sessionSign);
-    if (sessionSign == char(0xef)) {
-        setSessionType(Abridged);
-    } else {
-        m_socket->ungetChar(sessionSign);
-        if (startObfuscatedSession()) {
-            setSessionType(Obfuscated);
-        } else {
-            qCCritical(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Invalid data";
-        }
+    const int headerSize = readSessionHeader(m_socket->peek(c_obfuscatedHeaderSize));
+    if (headerSize == 0) {
+        return;
+    }
+    if (headerSize < 0) {
+        qCCritical(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Invalid data";
+        return;
     }
+    m_socket->read(headerSize);
     qCDebug(c_loggingServerTcpTransport()) << Q_FUNC_INFO << remoteAddress() << "Session type:" << m_sessionType;
 }
 
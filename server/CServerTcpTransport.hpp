@@ -19,9 +19,15 @@ public:
     void connectToHost(const QString &ipAddress, quint16 port) override;
 
 protected:
+    // For the transports which do not use QTcpSocket
+    explicit TcpTransport(QObject *parent);
+
     void onStateChanged(QAbstractSocket::SocketState newState);
 
-    bool startObfuscatedSession();
+    // Reads the session header (the protocol tag or the obfuscation init) at the beginning of the data.
+    // Returns the header size, 0 if more data is needed or -1 if the header is invalid.
+    int readSessionHeader(const QByteArray &data);
+    bool startObfuscatedSession(const QByteArray &header);
     void readEvent() final;
 
 };
@@ -27,7 +27,10 @@ SentCodeInfo DefaultProvider::sendCode(Session *session, const QString &identifi
     if (code.type == Code::Type::Default) {
         code.type = Code::Type::Sms;
     }
-    m_sentCodeMap.insert(identifier, code);
+    {
+        QMutexLocker locker(&m_sentCodeLock);
+        m_sentCodeMap.insert(identifier, code);
+    }
 
     SentCodeInfo info;
     info.hash = code.hash;
@@ -44,10 +47,12 @@ CodeStatus DefaultProvider::getCodeStatus(const QString &identifier, const QByte
     if (hash.isEmpty()) {
         return CodeStatus::HashEmpty;
     }
+    QMutexLocker locker(&m_sentCodeLock);
     if (!m_sentCodeMap.contains(identifier)) {
         return CodeStatus::PhoneInvalid;
     }
     const Code c = m_sentCodeMap.value(identifier);
+    locker.unlock();
     if (c.hash != hash) {
         return CodeStatus::HashInvalid;
     }
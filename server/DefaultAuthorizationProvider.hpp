@@ -3,12 +3,15 @@
 
 #include "AuthorizationProvider.hpp"
 
+#include <QMutex>
+
 namespace Telegram {
 
 namespace Server {
 
 namespace Authorization {
 
+// The provider is shared by all DCs of a LocalCluster, so the codes map is guarded by a lock
 class DefaultProvider : public QObject, public Provider
 {
     Q_OBJECT
@@ -21,6 +24,7 @@ protected:
     static QString generateAuthCode();
     virtual Code generateCode(Session *session, const QString &identifier);
 
+    QMutex m_sentCodeLock;
     QHash<QString, Code> m_sentCodeMap;
 };
 
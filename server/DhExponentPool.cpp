@@ -0,0 +1,154 @@
+#include "DhExponentPool.hpp"
+
+#include "RandomGenerator.hpp"
+#include "SslBigNumber.hpp"
+
+#include <QLoggingCategory>
+#include <QMutexLocker>
+#include <QtConcurrentRun>
+#include <QtEndian>
+
+Q_LOGGING_CATEGORY(c_serverDhPoolCategory, "telegram.server.dhpool", QtInfoMsg)
+
+static const QByteArray c_hardcodedDhPrime =
+        QByteArray::fromHex(QByteArrayLiteral(
+                                "c71caeb9c6b1c9048e6c522f70f13f73980d40238e3e21c14934d037563d930f"
+                                "48198a0aa7c14058229493d22530f4dbfa336f6e0ac925139543aed44cce7c37"
+                                "20fd51f69458705ac68cd4fe6b6b13abdc9746512969328454f18faf8c595f64"
+                                "2477fe96bb2a941d5bcd1d4ac8cc49880708fa9b378e3c4f3a9060bee67cf9a4"
+                                "a4a695811051907e162753b56b0f6b410dba74d8a84b2a14b3144e0ef1284754"
+                                "fd17ed950d5965b4b9dd46582db1178d169c6bc465b0d6ff9ca3928fef5b9ae4"
+                                "e418fc15e83ebea0f87fa9ff5eed70050ded2849f47bf959d956850ce929851f"
+                                "0d8115f635b105ee2e4e15d04b2454bf6f4fadf034b10403119cd8e3b92fcc5b"));
+
+static const quint32 c_hardcodedDhGenerator = 7;
+static const int c_exponentSize = 256;
+static const int c_defaultDepth = 16;
+
+namespace Telegram {
+
+namespace Server {
+
+DhExponentPool::DhExponentPool(QObject *parent) :
+    QObject(parent)
+{
+    m_threadPool.setMaxThreadCount(1);
+    m_depth = c_defaultDepth;
+}
+
+DhExponentPool::~DhExponentPool()
+{
+    m_threadPool.clear();
+    m_threadPool.waitForDone();
+}
+
+QByteArray DhExponentPool::dhPrime()
+{
+    return c_hardcodedDhPrime;
+}
+
+quint32 DhExponentPool::generator()
+{
+    return c_hardcodedDhGenerator;
+}
+
+const Utils::SslMontgomeryContext *DhExponentPool::primeContext()
+{
+    static const Utils::SslMontgomeryContext context(c_hardcodedDhPrime);
+    return &context;
+}
+
+QByteArray DhExponentPool::computeGA(const QByteArray &a)
+{
+    QByteArray g(sizeof(c_hardcodedDhGenerator), Qt::Uninitialized);
+    qToBigEndian<quint32>(c_hardcodedDhGenerator, reinterpret_cast<uchar *>(g.data()));
+    return primeContext()->modExp(g, a);
+}
+
+void DhExponentPool::setDepth(int depth)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_depth = qMax(depth, 0);
+        while (m_entries.count() > m_depth) {
+            m_entries.removeLast();
+        }
+    }
+    refill();
+}
+
+int DhExponentPool::refillThreadCount() const
+{
+    return m_threadPool.maxThreadCount();
+}
+
+void DhExponentPool::setRefillThreadCount(int count)
+{
+    m_threadPool.setMaxThreadCount(qMax(count, 1));
+}
+
+int DhExponentPool::size() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_entries.count();
+}
+
+bool DhExponentPool::takeEntry(DhExponentPool::Entry *entry)
+{
+    bool taken = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_entries.isEmpty()) {
+            *entry = m_entries.dequeue();
+            taken = true;
+        }
+    }
+    if (taken) {
+        ++m_takenCount;
+    } else {
+        ++m_exhaustedCount;
+        qCInfo(c_serverDhPoolCategory) << this << "The pool is exhausted"
+                                       << "(depth:" << m_depth << "exhausted" << m_exhaustedCount << "times)";
+        emit exhausted();
+    }
+    refill();
+    return taken;
+}
+
+void DhExponentPool::refill()
+{
+    int jobsToStart = 0;
+    {
+        QMutexLocker locker(&m_mutex);
+        jobsToStart = m_depth - m_entries.count() - m_pendingJobs;
+        if (jobsToStart <= 0) {
+            return;
+        }
+        m_pendingJobs += jobsToStart;
+    }
+
+    // The random generator is not required to be thread-safe,
+    // so the secret exponents are generated on the owner thread.
+    for (int i = 0; i < jobsToStart; ++i) {
+        Entry entry;
+        entry.a = RandomGenerator::instance()->generate(c_exponentSize);
+        QtConcurrent::run(&m_threadPool, [this, entry]() {
+            Entry result = entry;
+            result.gA = computeGA(result.a);
+            addEntry(result);
+        });
+    }
+}
+
+void DhExponentPool::addEntry(const DhExponentPool::Entry &entry)
+{
+    QMutexLocker locker(&m_mutex);
+    --m_pendingJobs;
+    if (m_entries.count() < m_depth) {
+        m_entries.enqueue(entry);
+    }
+}
+
+} // Server namespace
+
+} // Telegram namespace
@@ -0,0 +1,72 @@
+#ifndef TELEGRAM_SERVER_DH_EXPONENT_POOL_HPP
+#define TELEGRAM_SERVER_DH_EXPONENT_POOL_HPP
+
+#include <QObject>
+#include <QMutex>
+#include <QQueue>
+#include <QThreadPool>
+
+namespace Telegram {
+
+namespace Utils {
+
+class SslMontgomeryContext;
+
+} // Utils namespace
+
+namespace Server {
+
+// The server DH parameters are fixed (see c_hardcodedDhPrime), so the (a, g_a) pairs
+// can be computed in advance in the background and taken on req_DH_params.
+class DhExponentPool : public QObject
+{
+    Q_OBJECT
+public:
+    struct Entry {
+        QByteArray a;
+        QByteArray gA;
+    };
+
+    explicit DhExponentPool(QObject *parent = nullptr);
+    ~DhExponentPool() override;
+
+    static QByteArray dhPrime();
+    static quint32 generator();
+    static const Utils::SslMontgomeryContext *primeContext();
+    static QByteArray computeGA(const QByteArray &a);
+
+    int depth() const { return m_depth; }
+    void setDepth(int depth);
+
+    int refillThreadCount() const;
+    void setRefillThreadCount(int count);
+
+    int size() const;
+    bool takeEntry(Entry *entry);
+    void refill();
+
+    // Telemetry
+    quint64 takenCount() const { return m_takenCount; }
+    quint64 exhaustedCount() const { return m_exhaustedCount; }
+
+signals:
+    void exhausted();
+
+protected:
+    void addEntry(const Entry &entry);
+
+    mutable QMutex m_mutex;
+    QQueue<Entry> m_entries;
+    QThreadPool m_threadPool;
+    int m_pendingJobs = 0; // Guarded by m_mutex
+    int m_depth = 0;
+
+    quint64 m_takenCount = 0;
+    quint64 m_exhaustedCount = 0;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_DH_EXPONENT_POOL_HPP
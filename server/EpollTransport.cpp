@@ -0,0 +1,558 @@
+#include "EpollTransport.hpp"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QHostAddress>
+#include <QLoggingCategory>
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+Q_LOGGING_CATEGORY(c_loggingEpollTransport, "telegram.server.transport.epoll", QtWarningMsg)
+
+namespace Telegram {
+
+namespace Server {
+
+// Most of the packets fit the chunk, so they are read without a copy.
+// The rest of a bigger read goes to the (per-thread) overflow buffer.
+static const int c_readChunkSize = 1024;
+static const int c_readBufferSize = 64 * 1024;
+static const int c_maxWriteVectors = 64;
+static const int c_maxEvents = 256;
+
+class EpollServerEvent : public QEvent
+{
+public:
+    EpollServerEvent(EpollServer::ConnectionEvent connectionEvent,
+                     const EpollConnectionPointer &connection, const QByteArray &data) :
+        QEvent(eventType()),
+        connectionEvent(connectionEvent),
+        connection(connection),
+        data(data)
+    {
+    }
+
+    static QEvent::Type eventType()
+    {
+        static const QEvent::Type type = static_cast<QEvent::Type>(QEvent::registerEventType());
+        return type;
+    }
+
+    const EpollServer::ConnectionEvent connectionEvent;
+    const EpollConnectionPointer connection;
+    const QByteArray data;
+};
+
+EpollConnection::EpollConnection(int fd, const QString &remoteAddress) :
+    m_fd(fd),
+    m_remoteAddress(remoteAddress)
+{
+}
+
+void EpollConnection::write(const QByteArray &data)
+{
+    QMutexLocker locker(&m_lock);
+    if ((m_fd < 0) || m_shutdownRequested) {
+        return;
+    }
+    m_pendingData.enqueue(data);
+    m_pendingBytes += data.size();
+    flushLocked();
+}
+
+void EpollConnection::flush()
+{
+    QMutexLocker locker(&m_lock);
+    flushLocked();
+}
+
+void EpollConnection::shutdown()
+{
+    QMutexLocker locker(&m_lock);
+    if ((m_fd < 0) || m_shutdownRequested) {
+        return;
+    }
+    m_shutdownRequested = true;
+    if (m_pendingData.isEmpty()) {
+        ::shutdown(m_fd, SHUT_RDWR);
+    }
+}
+
+void EpollConnection::abort()
+{
+    QMutexLocker locker(&m_lock);
+    if (m_fd < 0) {
+        return;
+    }
+    m_shutdownRequested = true;
+    m_pendingData.clear();
+    m_pendingOffset = 0;
+    m_pendingBytes = 0;
+    ::shutdown(m_fd, SHUT_RDWR);
+}
+
+void EpollConnection::close()
+{
+    QMutexLocker locker(&m_lock);
+    if (m_fd < 0) {
+        return;
+    }
+    ::close(m_fd);
+    m_fd = -1;
+    m_pendingData.clear();
+    m_pendingOffset = 0;
+    m_pendingBytes = 0;
+}
+
+int EpollConnection::pendingBytes() const
+{
+    QMutexLocker locker(&m_lock);
+    return m_pendingBytes;
+}
+
+void EpollConnection::flushLocked()
+{
+    while (!m_pendingData.isEmpty() && (m_fd >= 0)) {
+        iovec vectors[c_maxWriteVectors];
+        int count = 0;
+        for (const QByteArray &data : m_pendingData) {
+            const int offset = count ? 0 : m_pendingOffset;
+            vectors[count].iov_base = const_cast<char *>(data.constData()) + offset;
+            vectors[count].iov_len = static_cast<size_t>(data.size() - offset);
+            if (++count == c_maxWriteVectors) {
+                break;
+            }
+        }
+        // The same as writev(), but without SIGPIPE if the peer is gone
+        msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = vectors;
+        message.msg_iovlen = static_cast<size_t>(count);
+        const ssize_t written = ::sendmsg(m_fd, &message, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // On EAGAIN the rest is written on the next EPOLLOUT.
+            // Other errors are reported by epoll and the listener closes the connection.
+            return;
+        }
+        m_pendingBytes -= static_cast<int>(written);
+        ssize_t left = written;
+        while (left > 0) {
+            const int firstSize = m_pendingData.head().size() - m_pendingOffset;
+            if (left < firstSize) {
+                m_pendingOffset += static_cast<int>(left);
+                break;
+            }
+            left -= firstSize;
+            m_pendingData.dequeue();
+            m_pendingOffset = 0;
+        }
+    }
+    if (m_pendingData.isEmpty() && m_shutdownRequested && (m_fd >= 0)) {
+        ::shutdown(m_fd, SHUT_RDWR);
+    }
+}
+
+EpollTransport::EpollTransport(const EpollConnectionPointer &connection, QObject *parent) :
+    TcpTransport(parent),
+    m_connection(connection)
+{
+    setState(QAbstractSocket::ConnectedState);
+}
+
+EpollTransport::~EpollTransport()
+{
+    if (m_connection->m_transport == this) {
+        m_connection->m_transport = nullptr;
+    }
+    m_connection->shutdown();
+}
+
+QString EpollTransport::remoteAddress() const
+{
+    return m_connection->remoteAddress();
+}
+
+qint64 EpollTransport::bytesToWrite() const
+{
+    return m_connection->pendingBytes();
+}
+
+void EpollTransport::disconnectFromHost()
+{
+    qCDebug(c_loggingEpollTransport) << Q_FUNC_INFO << remoteAddress();
+    // The state is changed on the connection closed by the listener
+    m_connection->shutdown();
+    m_sessionHeader.clear();
+    m_readBuffer.clear();
+    m_packetNumber = 0;
+    m_expectedLength = 0;
+    setSessionType(Unknown);
+}
+
+void EpollTransport::abort()
+{
+    qCDebug(c_loggingEpollTransport) << Q_FUNC_INFO << remoteAddress();
+    m_connection->abort();
+    m_sessionHeader.clear();
+    m_readBuffer.clear();
+    m_packetNumber = 0;
+    m_expectedLength = 0;
+    setSessionType(Unknown);
+}
+
+void EpollTransport::sendPacketImplementation(const QByteArray &payload)
+{
+    m_connection->write(packetFromPayload(payload));
+}
+
+void EpollTransport::onDataReceived(const QByteArray &data)
+{
+    if (Q_LIKELY(m_sessionType != Unknown)) {
+        processReceivedData(data);
+        return;
+    }
+    m_sessionHeader.append(data);
+    const int headerSize = readSessionHeader(m_sessionHeader);
+    if (headerSize == 0) {
+        return;
+    }
+    if (headerSize < 0) {
+        qCWarning(c_loggingEpollTransport) << Q_FUNC_INFO << remoteAddress() << "Invalid session header";
+        setError(QAbstractSocket::UnknownSocketError, QStringLiteral("Invalid session header"));
+        disconnectFromHost();
+        return;
+    }
+    qCDebug(c_loggingEpollTransport) << Q_FUNC_INFO << remoteAddress() << "Session type:" << m_sessionType;
+    const QByteArray sessionData = m_sessionHeader.mid(headerSize);
+    m_sessionHeader.clear();
+    processReceivedData(sessionData);
+}
+
+void EpollTransport::onConnectionClosed()
+{
+    setState(QAbstractSocket::UnconnectedState);
+}
+
+EpollListener::EpollListener(EpollServer *server) :
+    QThread(server),
+    m_server(server)
+{
+}
+
+EpollListener::~EpollListener()
+{
+    stop();
+    wait();
+    if (m_listenFd >= 0) {
+        ::close(m_listenFd);
+    }
+    if (m_wakeUpFd >= 0) {
+        ::close(m_wakeUpFd);
+    }
+    if (m_epollFd >= 0) {
+        ::close(m_epollFd);
+    }
+}
+
+bool EpollListener::listen(const QHostAddress &address, quint16 port)
+{
+    sockaddr_storage storage;
+    memset(&storage, 0, sizeof(storage));
+    socklen_t storageSize = 0;
+    if (address.protocol() == QAbstractSocket::IPv6Protocol) {
+        sockaddr_in6 *address6 = reinterpret_cast<sockaddr_in6 *>(&storage);
+        address6->sin6_family = AF_INET6;
+        address6->sin6_port = htons(port);
+        const Q_IPV6ADDR ip6 = address.toIPv6Address();
+        memcpy(&address6->sin6_addr, &ip6, sizeof(ip6));
+        storageSize = sizeof(sockaddr_in6);
+    } else {
+        sockaddr_in *address4 = reinterpret_cast<sockaddr_in *>(&storage);
+        address4->sin_family = AF_INET;
+        address4->sin_port = htons(port);
+        address4->sin_addr.s_addr = htonl(address.toIPv4Address());
+        storageSize = sizeof(sockaddr_in);
+    }
+
+    m_listenFd = ::socket(storage.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (m_listenFd < 0) {
+        setErrorString("socket");
+        return false;
+    }
+    // Each listener thread binds its own socket to the same port and the kernel balances the connections
+    const int enable = 1;
+    if ((::setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) < 0)
+            || (::setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) < 0)) {
+        setErrorString("setsockopt");
+        return false;
+    }
+    if (::bind(m_listenFd, reinterpret_cast<const sockaddr *>(&storage), storageSize) < 0) {
+        setErrorString("bind");
+        return false;
+    }
+    if (::listen(m_listenFd, SOMAXCONN) < 0) {
+        setErrorString("listen");
+        return false;
+    }
+
+    m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (m_epollFd < 0) {
+        setErrorString("epoll_create1");
+        return false;
+    }
+    m_wakeUpFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_wakeUpFd < 0) {
+        setErrorString("eventfd");
+        return false;
+    }
+
+    // The listening and the wake up sockets are told apart from the connections by the data pointer
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLET;
+    event.data.ptr = &m_listenFd;
+    if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_listenFd, &event) < 0) {
+        setErrorString("epoll_ctl");
+        return false;
+    }
+    event.events = EPOLLIN;
+    event.data.ptr = &m_wakeUpFd;
+    if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeUpFd, &event) < 0) {
+        setErrorString("epoll_ctl");
+        return false;
+    }
+    m_readBuffer.resize(c_readBufferSize);
+    return true;
+}
+
+void EpollListener::stop()
+{
+    if (m_wakeUpFd < 0) {
+        return;
+    }
+    const quint64 value = 1;
+    while ((::write(m_wakeUpFd, &value, sizeof(value)) < 0) && (errno == EINTR)) {
+    }
+}
+
+void EpollListener::run()
+{
+    epoll_event events[c_maxEvents];
+    bool stopRequested = false;
+    while (!stopRequested) {
+        const int count = ::epoll_wait(m_epollFd, events, c_maxEvents, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            setErrorString("epoll_wait");
+            qCCritical(c_loggingEpollTransport) << Q_FUNC_INFO << m_errorString;
+            break;
+        }
+        for (int i = 0; i < count; ++i) {
+            void *pointer = events[i].data.ptr;
+            if (pointer == &m_wakeUpFd) {
+                stopRequested = true;
+                continue;
+            }
+            if (pointer == &m_listenFd) {
+                acceptConnections();
+                continue;
+            }
+            EpollConnection *connection = static_cast<EpollConnection *>(pointer);
+            const quint32 flags = events[i].events;
+            if (flags & EPOLLOUT) {
+                connection->flush();
+            }
+            if (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                readConnection(connection);
+            }
+        }
+    }
+
+    ::close(m_listenFd);
+    m_listenFd = -1;
+    const QList<EpollConnection *> connections = m_connections.keys();
+    for (EpollConnection *connection : connections) {
+        closeConnection(connection);
+    }
+}
+
+void EpollListener::acceptConnections()
+{
+    // The listening socket is edge-triggered, so accept until the queue is empty
+    forever {
+        sockaddr_storage address;
+        socklen_t addressSize = sizeof(address);
+        const int fd = ::accept4(m_listenFd, reinterpret_cast<sockaddr *>(&address), &addressSize,
+                                 SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if ((errno == EINTR) || (errno == ECONNABORTED)) {
+                continue;
+            }
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                // E.g. EMFILE; the pending connections are accepted on the next incoming connection
+                qCWarning(c_loggingEpollTransport) << Q_FUNC_INFO << "Unable to accept a connection:"
+                                                   << strerror(errno);
+            }
+            return;
+        }
+
+        const QHostAddress remoteAddress(reinterpret_cast<const sockaddr *>(&address));
+        const EpollConnectionPointer connection = EpollConnectionPointer::create(fd, remoteAddress.toString());
+
+        // Both directions are edge-triggered: the reads drain the socket and
+        // EPOLLOUT is reported only when the socket becomes writable again.
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.ptr = connection.data();
+        if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            qCWarning(c_loggingEpollTransport) << Q_FUNC_INFO << "Unable to watch a connection:" << strerror(errno);
+            connection->close();
+            continue;
+        }
+        m_connections.insert(connection.data(), connection);
+        m_server->postConnectionEvent(EpollServer::ConnectionEvent::Accepted, connection);
+    }
+}
+
+void EpollListener::readConnection(EpollConnection *connection)
+{
+    // The fd is changed only in this thread, so it is safe to use it without the lock
+    const int fd = connection->m_fd;
+    QByteArray received;
+    forever {
+        QByteArray chunk(c_readChunkSize, Qt::Uninitialized);
+        iovec vectors[2];
+        vectors[0].iov_base = chunk.data();
+        vectors[0].iov_len = static_cast<size_t>(chunk.size());
+        vectors[1].iov_base = m_readBuffer.data();
+        vectors[1].iov_len = static_cast<size_t>(m_readBuffer.size());
+        const ssize_t bytesRead = ::readv(fd, vectors, 2);
+        if (bytesRead > 0) {
+            if (bytesRead <= c_readChunkSize) {
+                chunk.resize(static_cast<int>(bytesRead));
+            } else {
+                chunk.append(m_readBuffer.constData(), static_cast<int>(bytesRead) - c_readChunkSize);
+            }
+            if (received.isEmpty()) {
+                received = chunk;
+            } else {
+                received.append(chunk);
+            }
+            continue;
+        }
+        const int error = (bytesRead < 0) ? errno : 0;
+        if (error == EINTR) {
+            continue;
+        }
+        if (!received.isEmpty()) {
+            m_server->postConnectionEvent(EpollServer::ConnectionEvent::DataReceived,
+                                          m_connections.value(connection), received);
+        }
+        if ((error == EAGAIN) || (error == EWOULDBLOCK)) {
+            return;
+        }
+        // The peer closed the connection (or the socket is shut down) or the read failed
+        closeConnection(connection);
+        return;
+    }
+}
+
+void EpollListener::closeConnection(EpollConnection *connection)
+{
+    ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, connection->m_fd, nullptr);
+    connection->close();
+    const EpollConnectionPointer pointer = m_connections.take(connection);
+    m_server->postConnectionEvent(EpollServer::ConnectionEvent::Closed, pointer);
+}
+
+void EpollListener::setErrorString(const char *call)
+{
+    m_errorString = QLatin1String(call) + QLatin1String(": ") + QString::fromLocal8Bit(strerror(errno));
+}
+
+EpollServer::EpollServer(QObject *parent) :
+    QObject(parent)
+{
+}
+
+EpollServer::~EpollServer()
+{
+    close();
+}
+
+bool EpollServer::listen(const QHostAddress &address, quint16 port, int threadCount)
+{
+    close();
+    for (int i = 0; i < qMax(threadCount, 1); ++i) {
+        EpollListener *listener = new EpollListener(this);
+        if (!listener->listen(address, port)) {
+            m_errorString = listener->errorString();
+            delete listener;
+            close();
+            return false;
+        }
+        m_listeners.append(listener);
+    }
+    for (EpollListener *listener : m_listeners) {
+        listener->start();
+    }
+    m_errorString.clear();
+    return true;
+}
+
+void EpollServer::close()
+{
+    for (EpollListener *listener : m_listeners) {
+        listener->stop();
+    }
+    qDeleteAll(m_listeners);
+    m_listeners.clear();
+}
+
+void EpollServer::postConnectionEvent(ConnectionEvent type, const EpollConnectionPointer &connection, const QByteArray &data)
+{
+    QCoreApplication::postEvent(this, new EpollServerEvent(type, connection, data));
+}
+
+void EpollServer::customEvent(QEvent *event)
+{
+    if (event->type() != EpollServerEvent::eventType()) {
+        QObject::customEvent(event);
+        return;
+    }
+    const EpollServerEvent *serverEvent = static_cast<const EpollServerEvent *>(event);
+    EpollConnection *connection = serverEvent->connection.data();
+    switch (serverEvent->connectionEvent) {
+    case ConnectionEvent::Accepted:
+        connection->m_transport = new EpollTransport(serverEvent->connection, this);
+        emit newConnection(connection->m_transport);
+        break;
+    case ConnectionEvent::DataReceived:
+        if (connection->m_transport) {
+            connection->m_transport->onDataReceived(serverEvent->data);
+        }
+        break;
+    case ConnectionEvent::Closed:
+        if (connection->m_transport) {
+            connection->m_transport->onConnectionClosed();
+        }
+        break;
+    }
+}
+
+} // Server namespace
+
+} // Telegram namespace
@@ -0,0 +1,159 @@
+#ifndef TELEGRAM_SERVER_EPOLL_TRANSPORT_HPP
+#define TELEGRAM_SERVER_EPOLL_TRANSPORT_HPP
+
+#include "CServerTcpTransport.hpp"
+
+#include <QHash>
+#include <QMutex>
+#include <QQueue>
+#include <QSharedPointer>
+#include <QThread>
+#include <QVector>
+
+QT_FORWARD_DECLARE_CLASS(QHostAddress)
+
+namespace Telegram {
+
+namespace Server {
+
+class EpollServer;
+class EpollTransport;
+
+// A client socket served by an EpollListener thread.
+// The socket is read and closed only in the listener thread; the writes come from the server thread.
+class EpollConnection
+{
+public:
+    explicit EpollConnection(int fd, const QString &remoteAddress);
+
+    QString remoteAddress() const { return m_remoteAddress; }
+
+    // Writes the data or queues it until the socket is writable again
+    void write(const QByteArray &data);
+    // Writes the queued data (called by the listener thread when the socket is writable)
+    void flush();
+    // Shuts the socket down; the listener thread closes it on the following hang up event
+    void shutdown();
+    // Drops the queued data and shuts the socket down immediately
+    void abort();
+    // Called by the listener thread
+    void close();
+
+    int pendingBytes() const;
+
+protected:
+    friend class EpollServer;
+    friend class EpollListener;
+    friend class EpollTransport;
+
+    void flushLocked();
+
+    mutable QMutex m_lock;
+    int m_fd = -1;
+    QString m_remoteAddress;
+    QQueue<QByteArray> m_pendingData;
+    int m_pendingOffset = 0; // The written part of the first pending data
+    int m_pendingBytes = 0;
+    bool m_shutdownRequested = false; // The socket is shut down once the pending data is written
+
+    EpollTransport *m_transport = nullptr; // Used only in the server thread
+};
+
+using EpollConnectionPointer = QSharedPointer<EpollConnection>;
+
+class EpollTransport : public TcpTransport
+{
+    Q_OBJECT
+public:
+    explicit EpollTransport(const EpollConnectionPointer &connection, QObject *parent = nullptr);
+    ~EpollTransport() override;
+
+    QString remoteAddress() const override;
+    qint64 bytesToWrite() const override;
+    void disconnectFromHost() override;
+    void abort() override;
+
+protected:
+    friend class EpollServer;
+
+    void sendPacketImplementation(const QByteArray &payload) override;
+
+    void onDataReceived(const QByteArray &data);
+    void onConnectionClosed();
+
+    EpollConnectionPointer m_connection;
+    QByteArray m_sessionHeader; // The received part of the session header
+};
+
+// Accepts the connections on a SO_REUSEPORT socket and serves them with edge-triggered epoll
+class EpollListener : public QThread
+{
+    Q_OBJECT
+public:
+    explicit EpollListener(EpollServer *server);
+    ~EpollListener() override;
+
+    bool listen(const QHostAddress &address, quint16 port);
+    void stop();
+
+    QString errorString() const { return m_errorString; }
+
+protected:
+    void run() override;
+
+    void acceptConnections();
+    void readConnection(EpollConnection *connection);
+    void closeConnection(EpollConnection *connection);
+
+    void setErrorString(const char *call);
+
+    EpollServer *m_server;
+    int m_listenFd = -1;
+    int m_epollFd = -1;
+    int m_wakeUpFd = -1;
+    QString m_errorString;
+    QHash<EpollConnection*, EpollConnectionPointer> m_connections;
+    QByteArray m_readBuffer; // The overflow of the reads (shared by all connections of the thread)
+};
+
+// Linux-only replacement for QTcpServer which does not need a QTcpSocket per connection.
+// The connections are accepted and read by the listener threads (one SO_REUSEPORT socket per thread),
+// while the transports and the received packets are processed in the thread of the server.
+class EpollServer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit EpollServer(QObject *parent = nullptr);
+    ~EpollServer() override;
+
+    bool listen(const QHostAddress &address, quint16 port, int threadCount = 1);
+    void close();
+
+    bool isListening() const { return !m_listeners.isEmpty(); }
+    QString errorString() const { return m_errorString; }
+
+    enum class ConnectionEvent {
+        Accepted,
+        DataReceived,
+        Closed,
+    };
+
+    // Thread-safe; the event is processed in the thread of the server
+    void postConnectionEvent(ConnectionEvent type, const EpollConnectionPointer &connection,
+                             const QByteArray &data = QByteArray());
+
+signals:
+    void newConnection(EpollTransport *transport);
+
+protected:
+    void customEvent(QEvent *event) override;
+
+    QVector<EpollListener*> m_listeners;
+    QString m_errorString;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_EPOLL_TRANSPORT_HPP
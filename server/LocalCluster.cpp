@@ -1,12 +1,14 @@
 #include "LocalCluster.hpp"
 
 #include "TelegramServer.hpp"
+#include "RemoteCallQueue.hpp"
 #include "RemoteServerConnection.hpp"
 #include "Storage.hpp"
 #include "TelegramServerUser.hpp"
 #include "DefaultAuthorizationProvider.hpp"
 
 #include <QLoggingCategory>
+#include <QThread>
 
 Q_LOGGING_CATEGORY(c_loggingClusterCategory, "telegram.server.cluster", QtWarningMsg)
 
@@ -18,6 +20,27 @@ LocalCluster::LocalCluster(QObject *parent)
     : QObject(parent)
 {
     m_constructor = [](QObject *parent) { return new Server(parent); };
+    m_callQueue = new RemoteCallQueue(this);
+}
+
+LocalCluster::~LocalCluster()
+{
+    if (!m_dcThreadsEnabled) {
+        // The servers are deleted as the children of the cluster
+        return;
+    }
+    stop();
+    QVector<QThread*> threads;
+    for (Server *server : m_serverInstances) {
+        threads.append(server->thread());
+        // The server is deleted in its thread (at the latest when the thread finishes)
+        server->deleteLater();
+    }
+    for (QThread *thread : threads) {
+        thread->quit();
+        thread->wait();
+        delete thread;
+    }
 }
 
 void LocalCluster::setServerContructor(LocalCluster::ServerConstructor constructor)
@@ -45,6 +68,17 @@ void LocalCluster::setServerPrivateRsaKey(const Telegram::RsaKey &key)
     m_key = key;
 }
 
+void LocalCluster::setDcThreadsEnabled(bool enabled)
+{
+    m_dcThreadsEnabled = enabled;
+}
+
+void LocalCluster::setTransportBackend(TransportBackend backend, int listenerThreads)
+{
+    m_transportBackend = backend;
+    m_listenerThreads = listenerThreads;
+}
+
 bool LocalCluster::start()
 {
     if (m_serverConfiguration.dcOptions.isEmpty()) {
@@ -80,16 +114,18 @@ bool LocalCluster::start()
             qCCritical(c_loggingClusterCategory) << Q_FUNC_INFO << "Invalid configuration: Server address is not set.";
             return false;
         }
-        Server *server = m_constructor(this);
+        // A QObject with a parent can not be moved to another thread
+        Server *server = m_constructor(m_dcThreadsEnabled ? nullptr : this);
         server->setServerConfiguration(m_serverConfiguration);
         server->setDcOption(dc);
         server->setServerPrivateRsaKey(m_key);
         server->setStorage(m_storage);
         server->setAuthorizationProvider(m_authProvider);
+        server->setTransportBackend(m_transportBackend);
+        server->setListenerThreadCount(m_listenerThreads);
         m_serverInstances.append(server);
     }
 
-    bool hasFails = false;
     for (Server *server : m_serverInstances) {
         for (Server *peer : m_serverInstances) {
             if (server == peer) {
@@ -99,8 +135,24 @@ bool LocalCluster::start()
             remote->setRemoteServer(peer);
             server->addServerConnection(remote);
         }
+    }
+
+    if (m_dcThreadsEnabled) {
+        for (Server *server : m_serverInstances) {
+            QThread *thread = new QThread();
+            thread->setObjectName(QStringLiteral("DC%1").arg(server->dcId()));
+            server->moveToThread(thread);
+            thread->start();
+        }
+    }
 
-        if (!server->start()) {
+    bool hasFails = false;
+    for (Server *server : m_serverInstances) {
+        bool started = false;
+        callInServerThread(server, [server, &started]() {
+            started = server->start();
+        });
+        if (!started) {
             qCCritical(c_loggingClusterCategory) << Q_FUNC_INFO << "Unable to start server" << server->dcId();
             hasFails = true;
         }
@@ -111,7 +163,9 @@ bool LocalCluster::start()
 void LocalCluster::stop()
 {
     for (Server *server : m_serverInstances) {
-        server->stop();
+        callInServerThread(server, [server]() {
+            server->stop();
+        });
     }
 }
 
@@ -122,14 +176,22 @@ LocalUser *LocalCluster::addUser(const QString &identifier, quint32 dcId)
         qCWarning(c_loggingClusterCategory) << Q_FUNC_INFO << "Unable to add user" << identifier << "to unknown server id" << dcId;
         return nullptr;
     }
-    return server->addUser(identifier);
+    LocalUser *user = nullptr;
+    callInServerThread(server, [server, identifier, &user]() {
+        user = server->addUser(identifier);
+    });
+    return user;
 }
 
 LocalUser *LocalCluster::getUser(const QString &identifier)
 {
-    AbstractUser *u = m_serverInstances.first()->getAbstractUser(identifier);
-    Server *s = getServerInstance(u->dcId());
-    return s->getUser(identifier);
+    for (Server *server : m_serverInstances) {
+        LocalUser *user = server->getUser(identifier);
+        if (user) {
+            return user;
+        }
+    }
+    return nullptr;
 }
 
 Server *LocalCluster::getServerInstance(quint32 dcId)
@@ -147,6 +209,11 @@ ServerApi *LocalCluster::getServerApiInstance(quint32 dcId)
     return getServerInstance(dcId);
 }
 
+void LocalCluster::callInServerThread(Server *server, const std::function<void()> &call)
+{
+    server->callQueue()->callAndWait(call, m_callQueue);
+}
+
 } // Server namespace
 
 } // Telegram namespace
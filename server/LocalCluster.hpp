@@ -21,8 +21,11 @@
 #include <QObject>
 #include <QVector>
 
+#include <functional>
+
 #include "DcConfiguration.hpp"
 #include "RsaKey.hpp"
+#include "ServerNamespace.hpp"
 
 namespace Telegram {
 
@@ -34,6 +37,7 @@ class Provider;
 
 } // Authorization namespace
 
+class RemoteCallQueue;
 class Server;
 class Session;
 class ServerApi;
@@ -46,6 +50,7 @@ class LocalCluster : public QObject
     Q_OBJECT
 public:
     explicit LocalCluster(QObject *parent = nullptr);
+    ~LocalCluster() override;
     using ServerConstructor = Server *(*)(QObject *parent);
     void setServerContructor(ServerConstructor constructor);
 
@@ -58,6 +63,15 @@ public:
     RsaKey serverRsaKey() const { return m_key; }
     void setServerPrivateRsaKey(const Telegram::RsaKey &key);
 
+    void setTransportBackend(TransportBackend backend, int listenerThreads = 1);
+
+    // Runs each server (with its sockets) in a dedicated thread; applied on start().
+    // The cluster methods are called in the thread of the cluster and make the calls in the server
+    // threads, while the returned servers and users can be accessed only if the servers are idle
+    // or from a call made via callInServerThread().
+    bool dcThreadsEnabled() const { return m_dcThreadsEnabled; }
+    void setDcThreadsEnabled(bool enabled);
+
     bool start();
     void stop();
 
@@ -68,13 +82,21 @@ public:
     Server *getServerInstance(quint32 dcId);
     ServerApi *getServerApiInstance(quint32 dcId);
 
+    // Runs the call in the thread of the server and waits for it to finish
+    void callInServerThread(Server *server, const std::function<void()> &call);
+
 protected:
+
     ServerConstructor m_constructor;
     QVector<Server*> m_serverInstances;
     DcConfiguration m_serverConfiguration;
     RsaKey m_key;
     Storage *m_storage = nullptr;
     Authorization::Provider *m_authProvider = nullptr;
+    TransportBackend m_transportBackend = TransportBackend::Qt;
+    int m_listenerThreads = 1;
+    bool m_dcThreadsEnabled = false;
+    RemoteCallQueue *m_callQueue;
 };
 
 } // Server namespace
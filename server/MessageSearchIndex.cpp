@@ -0,0 +1,315 @@
+#include "MessageSearchIndex.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace Telegram {
+
+namespace Server {
+
+// Longer words are truncated (the same way for the messages and the queries)
+static const int c_maxWordLength = 64;
+
+constexpr int PostingList::c_blockSize;
+
+static void appendVarInt(QByteArray *output, quint32 value)
+{
+    while (value >= 0x80) {
+        output->append(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    output->append(static_cast<char>(value));
+}
+
+static const uchar *readVarInt(const uchar *input, quint32 *value)
+{
+    if (!(*input & 0x80)) {
+        // Ids are dense enough for most of deltas to fit a single byte
+        *value = *input;
+        return input + 1;
+    }
+    quint32 result = 0;
+    int shift = 0;
+    uchar byte = 0;
+    do {
+        byte = *input++;
+        result |= quint32(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    *value = result;
+    return input;
+}
+
+int PostingList::findBlock(quint32 id) const
+{
+    const auto it = std::upper_bound(m_blocks.constBegin(), m_blocks.constEnd(), id,
+                                     [](quint32 value, const Block &block) {
+        return value < block.firstId;
+    });
+    return static_cast<int>(it - m_blocks.constBegin()) - 1;
+}
+
+void PostingList::decodeBlock(int index, quint32 *output) const
+{
+    const Block &block = m_blocks.at(index);
+    const uchar *input = reinterpret_cast<const uchar *>(m_data.constData()) + block.offset;
+    output[0] = block.firstId;
+    for (int i = 1; i < block.count; ++i) {
+        quint32 delta = 0;
+        input = readVarInt(input, &delta);
+        output[i] = output[i - 1] + delta;
+    }
+}
+
+void PostingList::insert(quint32 id)
+{
+    if (m_blocks.isEmpty() || (id > m_blocks.constLast().lastId)) {
+        // Message ids grow, so the append is the usual case
+        if (m_blocks.isEmpty() || (m_blocks.constLast().count == c_blockSize)) {
+            Block block;
+            block.firstId = id;
+            block.lastId = id;
+            block.count = 1;
+            block.offset = m_data.size();
+            m_blocks.append(block);
+        } else {
+            Block &block = m_blocks.last();
+            appendVarInt(&m_data, id - block.lastId);
+            block.lastId = id;
+            ++block.count;
+        }
+        ++m_count;
+        return;
+    }
+
+    const int index = qMax(findBlock(id), 0);
+    quint32 ids[c_blockSize + 1];
+    decodeBlock(index, ids);
+    const int count = m_blocks.at(index).count;
+    quint32 *position = std::lower_bound(ids, ids + count, id);
+    if ((position != ids + count) && (*position == id)) {
+        return;
+    }
+    std::copy_backward(position, ids + count, ids + count + 1);
+    *position = id;
+    replaceBlock(index, ids, count + 1);
+    ++m_count;
+}
+
+bool PostingList::remove(quint32 id)
+{
+    const int index = findBlock(id);
+    if ((index < 0) || (id > m_blocks.at(index).lastId)) {
+        return false;
+    }
+    quint32 ids[c_blockSize];
+    decodeBlock(index, ids);
+    const int count = m_blocks.at(index).count;
+    quint32 *position = std::lower_bound(ids, ids + count, id);
+    if ((position == ids + count) || (*position != id)) {
+        return false;
+    }
+    std::copy(position + 1, ids + count, position);
+    replaceBlock(index, ids, count - 1);
+    --m_count;
+    return true;
+}
+
+int PostingList::blockDataSize(int index) const
+{
+    const int end = (index + 1 < m_blocks.count()) ? m_blocks.at(index + 1).offset : m_data.size();
+    return end - m_blocks.at(index).offset;
+}
+
+// Replaces the block at the index with the ids (split to a few blocks if needed)
+void PostingList::replaceBlock(int index, const quint32 *ids, int count)
+{
+    const int offset = m_blocks.at(index).offset;
+    const int oldDataSize = blockDataSize(index);
+
+    QVector<Block> newBlocks;
+    QByteArray newData;
+    for (int first = 0; first < count; first += c_blockSize) {
+        const int blockCount = qMin(c_blockSize, count - first);
+        Block block;
+        block.firstId = ids[first];
+        block.lastId = ids[first + blockCount - 1];
+        block.count = blockCount;
+        block.offset = offset + newData.size();
+        for (int i = first + 1; i < first + blockCount; ++i) {
+            appendVarInt(&newData, ids[i] - ids[i - 1]);
+        }
+        newBlocks.append(block);
+    }
+
+    m_data.replace(offset, oldDataSize, newData);
+    const int dataSizeDiff = newData.size() - oldDataSize;
+    for (int i = index + 1; i < m_blocks.count(); ++i) {
+        m_blocks[i].offset += dataSizeDiff;
+    }
+    m_blocks.remove(index);
+    for (int i = 0; i < newBlocks.count(); ++i) {
+        m_blocks.insert(index + i, newBlocks.at(i));
+    }
+}
+
+quint32 MessageSearchIndex::Cursor::Term::largestAtMost(quint32 bound)
+{
+    if (!bound) {
+        return 0;
+    }
+    const bool boundIsInBlock = (blockIndex >= 0)
+            && (list->block(blockIndex).firstId <= bound)
+            && ((blockIndex + 1 == list->blockCount()) || (list->block(blockIndex + 1).firstId > bound));
+    if (!boundIsInBlock) {
+        const int index = list->findBlock(bound);
+        if (index < 0) {
+            return 0;
+        }
+        ids.resize(list->block(index).count);
+        list->decodeBlock(index, ids.data());
+        blockIndex = index;
+        position = ids.count() - 1;
+    }
+    // The bounds never grow, so scan back from the previous result.
+    // The first id of the block is not greater than the bound.
+    while (ids.at(position) > bound) {
+        --position;
+    }
+    return ids.at(position);
+}
+
+quint32 MessageSearchIndex::Cursor::next()
+{
+    if (m_terms.isEmpty()) {
+        return 0;
+    }
+    // Leapfrog: lower the candidate until all terms agree on it.
+    // The terms are sorted from the rarest and the check restarts from the first term
+    // on a mismatch, so the common terms (e.g. the dialog peer) are checked only for
+    // the candidates that matched all rarer terms.
+    quint32 candidate = m_bound;
+    int termIndex = 0;
+    while (termIndex < m_terms.count()) {
+        const quint32 id = m_terms[termIndex].largestAtMost(candidate);
+        if (!id) {
+            m_bound = 0;
+            return 0;
+        }
+        if (id == candidate) {
+            ++termIndex;
+        } else {
+            candidate = id;
+            termIndex = termIndex ? 0 : 1;
+        }
+    }
+    m_bound = candidate - 1;
+    return candidate;
+}
+
+QStringList MessageSearchIndex::tokenize(const QString &text)
+{
+    QStringList result;
+    const QString normalized = text.normalized(QString::NormalizationForm_KC).toCaseFolded();
+    const QChar *data = normalized.constData();
+    const int size = normalized.size();
+    int wordStart = -1;
+    for (int i = 0; i <= size; ++i) {
+        bool isWordChar = false;
+        int charSize = 1;
+        if (i < size) {
+            uint ucs4 = data[i].unicode();
+            if (data[i].isHighSurrogate() && (i + 1 < size) && data[i + 1].isLowSurrogate()) {
+                ucs4 = QChar::surrogateToUcs4(data[i], data[i + 1]);
+                charSize = 2;
+            }
+            isWordChar = QChar::isLetterOrNumber(ucs4) || QChar::isMark(ucs4);
+        }
+        if (isWordChar) {
+            if (wordStart < 0) {
+                wordStart = i;
+            }
+        } else if (wordStart >= 0) {
+            result.append(normalized.mid(wordStart, qMin(i - wordStart, c_maxWordLength)));
+            wordStart = -1;
+        }
+        i += charSize - 1;
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void MessageSearchIndex::addMessage(quint32 messageId, const Peer &dialogPeer, const QString &text)
+{
+    for (const QString &word : tokenize(text)) {
+        m_words[word].insert(messageId);
+    }
+    if (dialogPeer.isValid()) {
+        m_peers[dialogPeer].insert(messageId);
+    }
+}
+
+void MessageSearchIndex::removeMessage(quint32 messageId, const Peer &dialogPeer, const QString &text)
+{
+    for (const QString &word : tokenize(text)) {
+        auto it = m_words.find(word);
+        if (it == m_words.end()) {
+            continue;
+        }
+        it->remove(messageId);
+        if (it->isEmpty()) {
+            m_words.erase(it);
+        }
+    }
+    if (dialogPeer.isValid()) {
+        auto it = m_peers.find(dialogPeer);
+        if (it != m_peers.end()) {
+            it->remove(messageId);
+            if (it->isEmpty()) {
+                m_peers.erase(it);
+            }
+        }
+    }
+}
+
+MessageSearchIndex::Cursor MessageSearchIndex::search(const QString &query, const Peer &dialogPeer, quint32 maxId) const
+{
+    const QStringList words = tokenize(query);
+    // A query without words lists all messages of the dialog
+    if (words.isEmpty() && !dialogPeer.isValid()) {
+        return Cursor();
+    }
+
+    Cursor cursor;
+    cursor.m_terms.reserve(words.count() + 1);
+    for (const QString &word : words) {
+        const auto it = m_words.constFind(word);
+        if (it == m_words.constEnd()) {
+            return Cursor();
+        }
+        Cursor::Term term;
+        term.list = &it.value();
+        cursor.m_terms.append(term);
+    }
+    if (dialogPeer.isValid()) {
+        const auto it = m_peers.constFind(dialogPeer);
+        if (it == m_peers.constEnd()) {
+            return Cursor();
+        }
+        Cursor::Term term;
+        term.list = &it.value();
+        cursor.m_terms.append(term);
+    }
+
+    // The rarest term drives the iteration
+    std::sort(cursor.m_terms.begin(), cursor.m_terms.end(), [](const Cursor::Term &left, const Cursor::Term &right) {
+        return left.list->count() < right.list->count();
+    });
+    cursor.m_bound = maxId ? maxId - 1 : std::numeric_limits<quint32>::max();
+    return cursor;
+}
+
+} // Server namespace
+
+} // Telegram namespace
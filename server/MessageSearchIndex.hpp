@@ -0,0 +1,105 @@
+#ifndef TELEGRAM_SERVER_MESSAGE_SEARCH_INDEX_HPP
+#define TELEGRAM_SERVER_MESSAGE_SEARCH_INDEX_HPP
+
+#include "TelegramNamespace.hpp"
+
+#include <QByteArray>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+namespace Telegram {
+
+namespace Server {
+
+// Sorted message ids compressed as varint deltas in blocks of c_blockSize ids.
+// Each block keeps its first and last ids, so lookups decode only the needed blocks.
+class PostingList
+{
+public:
+    static constexpr int c_blockSize = 128;
+
+    struct Block {
+        quint32 firstId = 0;
+        quint32 lastId = 0;
+        int count = 0;
+        int offset = 0; // The offset of the deltas (the first id is not stored in the data)
+    };
+
+    bool isEmpty() const { return m_blocks.isEmpty(); }
+    int count() const { return m_count; }
+    int blockCount() const { return m_blocks.count(); }
+    const Block &block(int index) const { return m_blocks.at(index); }
+
+    // Returns the index of the last block with firstId <= id or -1 if there is no such block
+    int findBlock(quint32 id) const;
+    // Writes the block ids to the output (which must have room for c_blockSize ids)
+    void decodeBlock(int index, quint32 *output) const;
+
+    void insert(quint32 id);
+    bool remove(quint32 id);
+
+protected:
+    int blockDataSize(int index) const;
+    void replaceBlock(int index, const quint32 *ids, int count);
+
+    QVector<Block> m_blocks;
+    QByteArray m_data;
+    int m_count = 0;
+};
+
+// An inverted index of the messages of a PostBox.
+// Both the words of the messages and the dialog peers are indexed.
+class MessageSearchIndex
+{
+public:
+    // Iterates the message ids matched by all terms from the newer messages to the older.
+    // The cursor is valid until the index is changed.
+    class Cursor
+    {
+    public:
+        // Returns the next matched message id or 0 if there are no more messages
+        quint32 next();
+
+    protected:
+        friend class MessageSearchIndex;
+
+        struct Term {
+            // Returns the largest id <= bound or 0 (the bound must not grow between the calls)
+            quint32 largestAtMost(quint32 bound);
+
+            const PostingList *list = nullptr;
+            int blockIndex = -1;
+            int position = 0;
+            QVector<quint32> ids;
+        };
+
+        QVector<Term> m_terms;
+        quint32 m_bound = 0;
+    };
+
+    // Normalized (NFKC, case folded) unique words of the text
+    static QStringList tokenize(const QString &text);
+
+    void addMessage(quint32 messageId, const Peer &dialogPeer, const QString &text);
+    void removeMessage(quint32 messageId, const Peer &dialogPeer, const QString &text);
+
+    // Looks up messages containing all words of the query (with the dialog peer, if valid)
+    // and older than 'maxId' (0 means no limit).
+    // A query without words matches all messages of the dialog peer.
+    // Returns a cursor without matches if neither the query words nor the peer are given
+    // or no messages match a word.
+    Cursor search(const QString &query, const Peer &dialogPeer = Peer(), quint32 maxId = 0) const;
+
+    int wordCount() const { return m_words.count(); }
+
+protected:
+    QHash<QString, PostingList> m_words;
+    QHash<Peer, PostingList> m_peers;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_MESSAGE_SEARCH_INDEX_HPP
@@ -0,0 +1,204 @@
+#include "MetricsExporter.hpp"
+
+#include "ServerMetrics.hpp"
+
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <QSocketNotifier>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+
+#ifdef Q_OS_UNIX
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+Q_LOGGING_CATEGORY(loggingCategoryMetrics, "telegram.server.metrics", QtInfoMsg)
+
+namespace Telegram {
+
+namespace Server {
+
+// A metrics request is a bare GET, so a bigger request is dropped
+static const int c_maxRequestHeaderSize = 8 * 1024;
+
+#ifdef Q_OS_UNIX
+// The signal handler can only do async-signal-safe calls, so it just wakes up the notifier
+static int s_signalSockets[2] = { -1, -1 };
+
+static void signalHandler(int)
+{
+    const char byte = 1;
+    ssize_t result = ::write(s_signalSockets[0], &byte, sizeof(byte));
+    Q_UNUSED(result)
+}
+#endif
+
+MetricsExporter::MetricsExporter(QObject *parent) :
+    QObject(parent)
+{
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    setSignalDumpFile(QString());
+}
+
+void MetricsExporter::addServer(quint32 dcId, const ServerMetrics *metrics)
+{
+    m_servers.append({ dcId, metrics });
+}
+
+QByteArray MetricsExporter::prometheusText() const
+{
+    QVector<ServerMetrics::Snapshot> snapshots;
+    snapshots.reserve(m_servers.count());
+    for (const ServerEntry &entry : m_servers) {
+        ServerMetrics::Snapshot snapshot = entry.metrics->snapshot();
+        snapshot.dcId = entry.dcId;
+        snapshots.append(snapshot);
+    }
+    return ServerMetrics::toPrometheusText(snapshots);
+}
+
+bool MetricsExporter::listen(quint16 port, const QHostAddress &address)
+{
+    if (!m_httpServer) {
+        m_httpServer = new QTcpServer(this);
+        connect(m_httpServer, &QTcpServer::newConnection, this, &MetricsExporter::onNewConnection);
+    }
+    if (!m_httpServer->listen(address, port)) {
+        qCWarning(loggingCategoryMetrics) << "Unable to listen port" << port << m_httpServer->errorString();
+        return false;
+    }
+    qCInfo(loggingCategoryMetrics) << "Serving metrics on" << address << m_httpServer->serverPort();
+    return true;
+}
+
+quint16 MetricsExporter::serverPort() const
+{
+    return m_httpServer ? m_httpServer->serverPort() : 0;
+}
+
+bool MetricsExporter::dumpToFile(const QString &fileName) const
+{
+    // Write a temporary file and rename it so a reader never sees a partial dump
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(loggingCategoryMetrics) << "Unable to open metrics file" << fileName << file.errorString();
+        return false;
+    }
+    file.write(prometheusText());
+    return file.commit();
+}
+
+bool MetricsExporter::setSignalDumpFile(const QString &fileName)
+{
+#ifdef Q_OS_UNIX
+    if (fileName.isEmpty()) {
+        if (m_signalNotifier) {
+            ::signal(SIGUSR1, SIG_DFL);
+            delete m_signalNotifier;
+            m_signalNotifier = nullptr;
+            ::close(s_signalSockets[0]);
+            ::close(s_signalSockets[1]);
+            s_signalSockets[0] = -1;
+            s_signalSockets[1] = -1;
+        }
+        m_signalDumpFile = fileName;
+        return true;
+    }
+    if (!m_signalNotifier) {
+        if (s_signalSockets[0] >= 0) {
+            qCWarning(loggingCategoryMetrics) << "The signal is already handled by another exporter";
+            return false;
+        }
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, s_signalSockets) != 0) {
+            qCWarning(loggingCategoryMetrics) << "Unable to create the signal socket pair";
+            return false;
+        }
+        m_signalNotifier = new QSocketNotifier(s_signalSockets[1], QSocketNotifier::Read, this);
+        connect(m_signalNotifier, &QSocketNotifier::activated, this, &MetricsExporter::onSignalReceived);
+
+        struct sigaction action;
+        action.sa_handler = signalHandler;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        ::sigaction(SIGUSR1, &action, nullptr);
+    }
+    m_signalDumpFile = fileName;
+    return true;
+#else
+    Q_UNUSED(fileName)
+    qCWarning(loggingCategoryMetrics) << "The metrics dump on signal is not supported on this platform";
+    return false;
+#endif
+}
+
+void MetricsExporter::onNewConnection()
+{
+    while (QTcpSocket *socket = m_httpServer->nextPendingConnection()) {
+        connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+        socket->setReadBufferSize(c_maxRequestHeaderSize);
+
+        // The timer is not stopped on the reply, so a peer which does not read the reply is dropped as well
+        QTimer *timeoutTimer = new QTimer(socket);
+        timeoutTimer->setSingleShot(true);
+        connect(timeoutTimer, &QTimer::timeout, socket, [socket]() {
+            qCDebug(loggingCategoryMetrics) << "Drop idle metrics connection" << socket->peerAddress();
+            socket->abort();
+            socket->deleteLater();
+        });
+        timeoutTimer->start(m_requestTimeout);
+
+        int headerSize = 0;
+        connect(socket, &QTcpSocket::readyRead, this, [this, socket, headerSize]() mutable {
+            // Any request gets the metrics; wait for the end of the headers and reply
+            while (socket->canReadLine()) {
+                const QByteArray line = socket->readLine();
+                headerSize += line.size();
+                if (headerSize >= c_maxRequestHeaderSize) {
+                    break;
+                }
+                if ((line != "\r\n") && (line != "\n")) {
+                    continue;
+                }
+                const QByteArray body = prometheusText();
+                socket->write("HTTP/1.0 200 OK\r\n"
+                              "Content-Type: text/plain; version=0.0.4\r\n"
+                              "Content-Length: " + QByteArray::number(body.size()) + "\r\n"
+                              "Connection: close\r\n"
+                              "\r\n");
+                socket->write(body);
+                socket->disconnectFromHost();
+                return;
+            }
+            if (headerSize + socket->bytesAvailable() >= c_maxRequestHeaderSize) {
+                qCDebug(loggingCategoryMetrics) << "Drop metrics connection with too long request" << socket->peerAddress();
+                socket->abort();
+                socket->deleteLater();
+            }
+        });
+    }
+}
+
+void MetricsExporter::onSignalReceived()
+{
+#ifdef Q_OS_UNIX
+    char byte;
+    ssize_t result = ::read(s_signalSockets[1], &byte, sizeof(byte));
+    Q_UNUSED(result)
+#endif
+    if (m_signalDumpFile.isEmpty()) {
+        return;
+    }
+    if (dumpToFile(m_signalDumpFile)) {
+        qCInfo(loggingCategoryMetrics) << "Dumped metrics to" << m_signalDumpFile;
+    }
+}
+
+} // Server namespace
+
+} // Telegram namespace
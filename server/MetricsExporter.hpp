@@ -0,0 +1,65 @@
+#ifndef TELEGRAM_SERVER_METRICS_EXPORTER_HPP
+#define TELEGRAM_SERVER_METRICS_EXPORTER_HPP
+
+#include <QHostAddress>
+#include <QObject>
+#include <QVector>
+
+QT_FORWARD_DECLARE_CLASS(QSocketNotifier)
+QT_FORWARD_DECLARE_CLASS(QTcpServer)
+
+namespace Telegram {
+
+namespace Server {
+
+class ServerMetrics;
+
+// Exports the metrics of the servers in the Prometheus text format.
+// The snapshots are served over HTTP (any request gets the metrics) and/or
+// written to a file on SIGUSR1 (on Unix).
+class MetricsExporter : public QObject
+{
+    Q_OBJECT
+public:
+    explicit MetricsExporter(QObject *parent = nullptr);
+    ~MetricsExporter() override;
+
+    void addServer(quint32 dcId, const ServerMetrics *metrics);
+
+    QByteArray prometheusText() const;
+
+    bool listen(quint16 port, const QHostAddress &address = QHostAddress::LocalHost);
+    quint16 serverPort() const;
+
+    // An HTTP connection is dropped if it is not done with the request and the reply in time
+    int requestTimeout() const { return m_requestTimeout; }
+    void setRequestTimeout(int msecs) { m_requestTimeout = msecs; }
+
+    bool dumpToFile(const QString &fileName) const;
+
+    // Dumps the metrics to the file on SIGUSR1; the empty name disables the dump
+    bool setSignalDumpFile(const QString &fileName);
+    QString signalDumpFile() const { return m_signalDumpFile; }
+
+protected slots:
+    void onNewConnection();
+    void onSignalReceived();
+
+protected:
+    struct ServerEntry {
+        quint32 dcId;
+        const ServerMetrics *metrics;
+    };
+
+    QVector<ServerEntry> m_servers;
+    QTcpServer *m_httpServer = nullptr;
+    QSocketNotifier *m_signalNotifier = nullptr;
+    QString m_signalDumpFile;
+    int m_requestTimeout = 5000; // ms
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_METRICS_EXPORTER_HPP
@@ -0,0 +1,75 @@
+#include "OutboundLimiter.hpp"
+
+#include "Session.hpp"
+
+namespace Telegram {
+
+namespace Server {
+
+void OutboundLimiter::setHighWatermark(qint64 bytes)
+{
+    m_highWatermark = qMax<qint64>(0, bytes);
+}
+
+void OutboundLimiter::setLowWatermark(qint64 bytes)
+{
+    m_lowWatermark = qMax<qint64>(0, bytes);
+}
+
+void OutboundLimiter::setHardLimit(qint64 bytes)
+{
+    m_hardLimit = qMax<qint64>(0, bytes);
+}
+
+OutboundLimiter::UpdatesAction OutboundLimiter::checkUpdates(Session *session, qint64 pendingBytes)
+{
+    if (session->updatesSuspended) {
+        if (resumeUpdates(session, pendingBytes)) {
+            // The difference fetched by the client includes these updates too
+            return UpdatesAction::SendTooLong;
+        }
+        ++m_stats.droppedUpdates;
+        return UpdatesAction::Drop;
+    }
+    if (m_highWatermark && (pendingBytes >= m_highWatermark)) {
+        session->updatesSuspended = true;
+        ++m_stats.suspensions;
+        ++m_stats.droppedUpdates;
+        return UpdatesAction::Drop;
+    }
+    return UpdatesAction::Send;
+}
+
+bool OutboundLimiter::resumeUpdates(Session *session, qint64 pendingBytes)
+{
+    if (!session->updatesSuspended) {
+        return false;
+    }
+    // A low watermark above the high one would let the connection grow past the high watermark
+    const qint64 lowWatermark = m_highWatermark ? qMin(m_lowWatermark, m_highWatermark) : m_lowWatermark;
+    if (pendingBytes > lowWatermark) {
+        return false;
+    }
+    session->updatesSuspended = false;
+    ++m_stats.resumptions;
+    return true;
+}
+
+bool OutboundLimiter::exceedsHardLimit(qint64 pendingBytes)
+{
+    m_stats.maxPendingBytes = qMax(m_stats.maxPendingBytes, pendingBytes);
+    if (!m_hardLimit || (pendingBytes <= m_hardLimit)) {
+        return false;
+    }
+    ++m_stats.disconnects;
+    return true;
+}
+
+void OutboundLimiter::resetStats()
+{
+    m_stats = Stats();
+}
+
+} // Server namespace
+
+} // Telegram namespace
@@ -0,0 +1,68 @@
+#ifndef TELEGRAM_SERVER_OUTBOUND_LIMITER_HPP
+#define TELEGRAM_SERVER_OUTBOUND_LIMITER_HPP
+
+#include <QtGlobal>
+
+namespace Telegram {
+
+namespace Server {
+
+class Session;
+
+// Bounds the data queued for write to the slow (or stalled) clients.
+// The updates are not written to a connection with the high watermark of pending bytes.
+// The session is marked as suspended instead, and once the client drains the connection
+// below the low watermark, it gets updatesTooLong to fetch the missed updates with getDifference.
+// A connection with more than the hard limit of pending bytes is aborted.
+class OutboundLimiter
+{
+public:
+    struct Stats {
+        quint64 suspensions = 0; // Sessions suspended on the high watermark
+        quint64 droppedUpdates = 0; // Updates not written to the suspended sessions
+        quint64 resumptions = 0; // updatesTooLong sent to the drained sessions
+        quint64 disconnects = 0; // Connections aborted on the hard limit
+        qint64 maxPendingBytes = 0; // The most bytes seen pending on a connection
+    };
+
+    enum class UpdatesAction {
+        Send,
+        SendTooLong, // Send updatesTooLong instead of the updates
+        Drop,
+    };
+
+    OutboundLimiter() = default;
+
+    // The value 0 disables the limit
+    qint64 highWatermark() const { return m_highWatermark; }
+    void setHighWatermark(qint64 bytes);
+
+    qint64 lowWatermark() const { return m_lowWatermark; }
+    void setLowWatermark(qint64 bytes);
+
+    // The value 0 disables the limit
+    qint64 hardLimit() const { return m_hardLimit; }
+    void setHardLimit(qint64 bytes);
+
+    // Decides what to write on updates for the session with the given pending bytes of the connection
+    UpdatesAction checkUpdates(Session *session, qint64 pendingBytes);
+    // Returns true (and clears the suspension) if the suspended session is drained enough for updatesTooLong
+    bool resumeUpdates(Session *session, qint64 pendingBytes);
+    // Returns true if the connection with the given pending bytes should be aborted
+    bool exceedsHardLimit(qint64 pendingBytes);
+
+    const Stats &stats() const { return m_stats; }
+    void resetStats();
+
+protected:
+    qint64 m_highWatermark = 1024 * 1024;
+    qint64 m_lowWatermark = 256 * 1024;
+    qint64 m_hardLimit = 16 * 1024 * 1024;
+    Stats m_stats;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_OUTBOUND_LIMITER_HPP
@@ -0,0 +1,132 @@
+#include "RemoteCallQueue.hpp"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QThread>
+
+namespace Telegram {
+
+namespace Server {
+
+static QEvent::Type remoteCallEventType()
+{
+    static const QEvent::Type type = static_cast<QEvent::Type>(QEvent::registerEventType());
+    return type;
+}
+
+RemoteCallQueue::RemoteCallQueue(QObject *parent) :
+    QObject(parent)
+{
+}
+
+RemoteCallQueue::~RemoteCallQueue()
+{
+    // Only the queued calls are owned by the queue; nobody can wait for a call at this point
+    for (PendingCall *call : m_calls) {
+        if (!call->callerQueue) {
+            delete call;
+        }
+    }
+}
+
+void RemoteCallQueue::queueCall(const Call &call)
+{
+    PendingCall *pendingCall = new PendingCall();
+    pendingCall->call = call;
+    enqueue(pendingCall);
+}
+
+void RemoteCallQueue::callAndWait(const Call &call, RemoteCallQueue *callerQueue)
+{
+    if (thread() == QThread::currentThread()) {
+        call();
+        return;
+    }
+    Q_ASSERT(callerQueue && (callerQueue->thread() == QThread::currentThread()));
+
+    PendingCall pendingCall;
+    pendingCall.call = call;
+    pendingCall.callerQueue = callerQueue;
+    enqueue(&pendingCall);
+
+    QMutexLocker locker(&callerQueue->m_lock);
+    while (!pendingCall.finished) {
+        if (!callerQueue->hasAwaitedCalls()) {
+            callerQueue->m_wakeUp.wait(&callerQueue->m_lock);
+            continue;
+        }
+        locker.unlock();
+        callerQueue->processCalls(true);
+        locker.relock();
+    }
+}
+
+void RemoteCallQueue::enqueue(PendingCall *call)
+{
+    {
+        QMutexLocker locker(&m_lock);
+        m_calls.enqueue(call);
+        // Wake up the thread if it waits for a call of its own
+        m_wakeUp.wakeAll();
+    }
+    QCoreApplication::postEvent(this, new QEvent(remoteCallEventType()));
+}
+
+bool RemoteCallQueue::hasAwaitedCalls() const
+{
+    for (const PendingCall *call : m_calls) {
+        if (call->callerQueue) {
+            return true;
+        }
+    }
+    return false;
+}
+
+RemoteCallQueue::PendingCall *RemoteCallQueue::takeNextCall(bool awaitedOnly)
+{
+    for (int i = 0; i < m_calls.count(); ++i) {
+        if (!awaitedOnly || m_calls.at(i)->callerQueue) {
+            return m_calls.takeAt(i);
+        }
+    }
+    return nullptr;
+}
+
+void RemoteCallQueue::processCalls(bool awaitedOnly)
+{
+    forever {
+        PendingCall *pendingCall = nullptr;
+        {
+            QMutexLocker locker(&m_lock);
+            pendingCall = takeNextCall(awaitedOnly);
+            if (!pendingCall) {
+                return;
+            }
+        }
+        pendingCall->call();
+
+        RemoteCallQueue *callerQueue = pendingCall->callerQueue;
+        if (!callerQueue) {
+            delete pendingCall;
+            continue;
+        }
+        // The awaited call lives on the stack of the caller and it is gone once the caller is woken up
+        QMutexLocker locker(&callerQueue->m_lock);
+        pendingCall->finished = true;
+        callerQueue->m_wakeUp.wakeAll();
+    }
+}
+
+void RemoteCallQueue::customEvent(QEvent *event)
+{
+    if (event->type() != remoteCallEventType()) {
+        QObject::customEvent(event);
+        return;
+    }
+    // The awaited calls might be already processed while the thread waited for a call of its own
+    processCalls(false);
+}
+
+} // Server namespace
+
+} // Telegram namespace
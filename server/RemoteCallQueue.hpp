@@ -0,0 +1,65 @@
+#ifndef TELEGRAM_SERVER_REMOTE_CALL_QUEUE_HPP
+#define TELEGRAM_SERVER_REMOTE_CALL_QUEUE_HPP
+
+#include <QMutex>
+#include <QObject>
+#include <QQueue>
+#include <QWaitCondition>
+
+#include <functional>
+
+namespace Telegram {
+
+namespace Server {
+
+// Runs the calls made from the other threads in the thread of the queue.
+// Each server of a threaded LocalCluster has a queue, and the cross-DC calls go through it.
+// All public methods are thread-safe.
+class RemoteCallQueue : public QObject
+{
+    Q_OBJECT
+public:
+    using Call = std::function<void()>;
+
+    explicit RemoteCallQueue(QObject *parent = nullptr);
+    ~RemoteCallQueue() override;
+
+    // Queues the call to the thread of the queue and returns immediately.
+    // The queued calls are processed only from the event loop of the thread, so they never
+    // re-enter a handler of the thread (e.g. a message delivery can modify the state freely).
+    void queueCall(const Call &call);
+
+    // Runs the call in the thread of the queue and waits for it to finish.
+    // The awaited calls made to the 'callerQueue' (the queue of the calling thread) are processed
+    // meanwhile, so two threads which call each other do not deadlock. Such calls run inside the
+    // handler which waits (e.g. an RPC handler of a server which looks up a user of another DC),
+    // so they must not modify the state of the thread: the cross-DC calls are read-only lookups,
+    // and the calls made by the cluster to modify a server (e.g. addUser) are done while the
+    // server is idle.
+    // The call is made directly if the queue lives in the calling thread.
+    void callAndWait(const Call &call, RemoteCallQueue *callerQueue);
+
+protected:
+    struct PendingCall {
+        Call call;
+        RemoteCallQueue *callerQueue = nullptr; // Null for the queued (not awaited) calls
+        bool finished = false; // Guarded by the lock of the caller queue
+    };
+
+    void enqueue(PendingCall *call);
+    // Must be called with m_lock locked
+    bool hasAwaitedCalls() const;
+    PendingCall *takeNextCall(bool awaitedOnly);
+    void processCalls(bool awaitedOnly);
+    void customEvent(QEvent *event) override;
+
+    QMutex m_lock;
+    QWaitCondition m_wakeUp; // Signaled on a new call and on a finish of a call made by the thread of the queue
+    QQueue<PendingCall*> m_calls;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_REMOTE_CALL_QUEUE_HPP
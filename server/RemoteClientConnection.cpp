@@ -44,6 +44,32 @@ void RemoteClientConnection::setRpcFactories(const QVector<RpcOperationFactory *
     rpcLayer()->setRpcFactories(rpcFactories);
 }
 
+void RemoteClientConnection::setCryptoThreadPool(QThreadPool *pool)
+{
+    static_cast<DhLayer*>(m_dhLayer)->setCryptoThreadPool(pool);
+}
+
+void RemoteClientConnection::setDhExponentPool(DhExponentPool *pool)
+{
+    static_cast<DhLayer*>(m_dhLayer)->setExponentPool(pool);
+}
+
+void RemoteClientConnection::setReplyCompressor(ReplyCompressor *compressor)
+{
+    rpcLayer()->setReplyCompressor(compressor);
+}
+
+void RemoteClientConnection::setOutboundLimiter(OutboundLimiter *limiter)
+{
+    rpcLayer()->setOutboundLimiter(limiter);
+}
+
+void RemoteClientConnection::setMetrics(ServerMetrics *metrics)
+{
+    rpcLayer()->setMetrics(metrics);
+    static_cast<DhLayer*>(m_dhLayer)->setMetrics(metrics);
+}
+
 ServerApi *RemoteClientConnection::api() const
 {
     return rpcLayer()->api();
@@ -6,13 +6,19 @@
 
 #include "Connection.hpp"
 
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
+
 namespace Telegram {
 
 namespace Server {
 
+class DhExponentPool;
+class OutboundLimiter;
+class ReplyCompressor;
 class ServerApi;
 class RpcLayer;
 class RpcOperationFactory;
+class ServerMetrics;
 class Session;
 
 class RemoteClientConnection : public BaseConnection
@@ -25,6 +31,11 @@ public:
     BaseDhLayer *dhLayer() const;
 
     void setRpcFactories(const QVector<RpcOperationFactory*> &rpcFactories);
+    void setCryptoThreadPool(QThreadPool *pool);
+    void setDhExponentPool(DhExponentPool *pool);
+    void setReplyCompressor(ReplyCompressor *compressor);
+    void setOutboundLimiter(OutboundLimiter *limiter);
+    void setMetrics(ServerMetrics *metrics);
 
     ServerApi *api() const;
     void setServerApi(ServerApi *api);
@@ -1,6 +1,9 @@
 #include "RemoteServerConnection.hpp"
 
+#include "RemoteCallQueue.hpp"
 #include "ServerApi.hpp"
+#include "ServerMessageData.hpp"
+#include "TelegramServer.hpp"
 #include "TelegramServerUser.hpp"
 
 namespace Telegram {
@@ -12,14 +15,65 @@ RemoteServerConnection::RemoteServerConnection(QObject *parent)
 {
 }
 
-void RemoteServerConnection::setRemoteServer(ServerApi *remoteServer)
+RemoteServerConnection::~RemoteServerConnection()
+{
+    qDeleteAll(m_userSnapshots);
+}
+
+void RemoteServerConnection::setLocalServer(Server *localServer)
+{
+    m_localServer = localServer;
+}
+
+void RemoteServerConnection::setRemoteServer(Server *remoteServer)
 {
     m_server = remoteServer;
 }
 
+bool RemoteServerConnection::isThreaded() const
+{
+    return m_server->thread() != thread();
+}
+
+AbstractUser *RemoteServerConnection::getUser(quint32 userId)
+{
+    if (!isThreaded()) {
+        return m_server->getUser(userId);
+    }
+    Server *remoteServer = m_server;
+    RemoteUser snapshot;
+    m_server->callQueue()->callAndWait([remoteServer, userId, &snapshot]() {
+        const LocalUser *user = remoteServer->getUser(userId);
+        if (user) {
+            snapshot = RemoteUser(user);
+        }
+    }, m_localServer->callQueue());
+    return updateSnapshot(snapshot);
+}
+
 AbstractUser *RemoteServerConnection::getUser(const QString &identifier)
 {
-    return m_server->getUser(identifier);
+    if (!isThreaded()) {
+        return m_server->getUser(identifier);
+    }
+    Server *remoteServer = m_server;
+    RemoteUser snapshot;
+    m_server->callQueue()->callAndWait([remoteServer, identifier, &snapshot]() {
+        const LocalUser *user = remoteServer->getUser(identifier);
+        if (user) {
+            snapshot = RemoteUser(user);
+        }
+    }, m_localServer->callQueue());
+    return updateSnapshot(snapshot);
+}
+
+void RemoteServerConnection::deliverMessage(const MessageData &message)
+{
+    Server *remoteServer = m_server;
+    // The message is copied, so the remote server never touches the MessageData of the local one
+    m_server->callQueue()->queueCall([remoteServer, message]() {
+        remoteServer->deliverRemoteMessage(message);
+    });
 }
 
 ServerApi *RemoteServerConnection::api()
@@ -32,9 +86,24 @@ quint32 RemoteServerConnection::dcId() const
     if (!m_server) {
         return 0;
     }
+    // The DC option is set before the server start and never changes
     return m_server->dcId();
 }
 
+AbstractUser *RemoteServerConnection::updateSnapshot(const RemoteUser &snapshot)
+{
+    if (!snapshot.id()) {
+        return nullptr;
+    }
+    // Update the existing snapshot in place to keep the previously returned pointers valid
+    RemoteUser *&user = m_userSnapshots[snapshot.id()];
+    if (!user) {
+        user = new RemoteUser();
+    }
+    *user = snapshot;
+    return user;
+}
+
 } // Server namespace
 
 } // Telegram namespace
@@ -2,29 +2,54 @@
 #define TELEGRAM_REMOTE_SERVER_CONNECTION_HPP
 
 #include <QObject>
+#include <QHash>
 
 namespace Telegram {
 
 namespace Server {
 
+class Server;
 class ServerApi;
 class AbstractUser;
+class MessageData;
+class RemoteUser;
 
+// A connection from a server (the local one) to another DC of the cluster.
+// The connection lives in the thread of the local server and must be used only there.
+// If the remote server lives in another thread then the calls are queued to the thread
+// of the remote server and the remote users are returned as snapshots (RemoteUser).
 class RemoteServerConnection : public QObject
 {
     Q_OBJECT
 public:
     explicit RemoteServerConnection(QObject *parent = nullptr);
+    ~RemoteServerConnection() override;
 
     quint32 dcId() const;
 
-    void setRemoteServer(ServerApi *remoteServer);
+    void setLocalServer(Server *localServer);
+    void setRemoteServer(Server *remoteServer);
 
+    // Returns true if the remote server lives in another thread
+    bool isThreaded() const;
+
+    // The snapshots of the users of a threaded server are owned by the connection
+    // and refreshed on each lookup
+    AbstractUser *getUser(quint32 userId);
     AbstractUser *getUser(const QString &identifier);
+
+    // Queues the message delivery to the remote recipient (the call does not wait for the delivery)
+    void deliverMessage(const MessageData &message);
+
+    // Direct access to the remote server; must not be used if the server is threaded
     ServerApi *api();
 
 protected:
-    ServerApi *m_server = nullptr;
+    AbstractUser *updateSnapshot(const RemoteUser &snapshot);
+
+    Server *m_localServer = nullptr;
+    Server *m_server = nullptr;
+    QHash<quint32, RemoteUser*> m_userSnapshots; // Used only if the remote server is threaded
 };
 
 } // Server namespace
@@ -0,0 +1,110 @@
+#include "ReplyCompressor.hpp"
+
+#include "CTelegramStream.hpp"
+#include "TLValues.hpp"
+#include "Utils.hpp"
+
+#include <QElapsedTimer>
+#include <QtEndian>
+
+namespace Telegram {
+
+namespace Server {
+
+// The sample is too short to be representative for smaller replies
+// and it is cheap to just try to compress them.
+static const int c_minEntropySampleSize = 1024;
+
+void ReplyCompressor::setCompressionLevel(int level)
+{
+    m_compressionLevel = qBound(0, level, 9);
+}
+
+void ReplyCompressor::setThreshold(int bytes)
+{
+    m_threshold = qMax(0, bytes);
+}
+
+void ReplyCompressor::setMaxEntropy(double bitsPerByte)
+{
+    m_maxEntropy = qBound(0.0, bitsPerByte, 8.0);
+}
+
+QByteArray ReplyCompressor::compress(const QByteArray &reply)
+{
+    ++m_stats.replies;
+    if (!m_compressionLevel) {
+        return QByteArray();
+    }
+    // Telegram spec says the threshold should be 255, but we use a lower limit to pack DcConfig
+    if (reply.size() <= m_threshold) {
+        ++m_stats.skippedBySize;
+        return QByteArray();
+    }
+    if (hasIncompressiblePayload(reply)) {
+        ++m_stats.skippedByType;
+        return QByteArray();
+    }
+    if ((reply.size() >= c_minEntropySampleSize) && (Utils::estimateEntropy(reply) > m_maxEntropy)) {
+        ++m_stats.skippedByEntropy;
+        return QByteArray();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const QByteArray packedData = Utils::packGZip(reply, m_compressionLevel);
+    m_stats.compressionNsecs += static_cast<quint64>(timer.nsecsElapsed());
+    m_stats.inputBytes += static_cast<quint64>(reply.size());
+
+    if (packedData.isEmpty()) {
+        ++m_stats.rejected;
+        return QByteArray();
+    }
+
+    CTelegramStream stream(CTelegramStream::WriteOnly);
+    stream << TLValue::GzipPacked;
+    stream << packedData;
+    const QByteArray result = stream.getData();
+    if (result.size() >= reply.size()) {
+        ++m_stats.rejected;
+        return QByteArray();
+    }
+
+    ++m_stats.compressed;
+    m_stats.savedBytes += static_cast<quint64>(reply.size() - result.size());
+    return result;
+}
+
+void ReplyCompressor::resetStats()
+{
+    m_stats = Stats();
+}
+
+bool ReplyCompressor::hasIncompressiblePayload(const QByteArray &reply)
+{
+    switch (TLValue::firstFromArray(reply)) {
+    case TLValue::UploadFile:
+        // upload.file#96a18d5 type:storage.FileType mtime:int bytes:bytes
+        if (reply.size() >= 8) {
+            const quint32 fileType = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(reply.constData() + 4));
+            switch (fileType) {
+            case TLValue::StorageFileUnknown:
+            case TLValue::StorageFilePartial:
+            case TLValue::StorageFilePdf:
+                return false;
+            default:
+                return true;
+            }
+        }
+        return false;
+    case TLValue::UploadWebFile:
+    case TLValue::UploadCdnFile:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // Server namespace
+
+} // Telegram namespace
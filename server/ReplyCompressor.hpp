@@ -0,0 +1,61 @@
+#ifndef TELEGRAM_SERVER_REPLY_COMPRESSOR_HPP
+#define TELEGRAM_SERVER_REPLY_COMPRESSOR_HPP
+
+#include <QByteArray>
+
+namespace Telegram {
+
+namespace Server {
+
+// Decides which RPC replies are worth to be sent as gzip_packed.
+// Replies with known incompressible payload (e.g. JPEG or MP4 file parts) and replies
+// with high entropy of sampled bytes are sent as is without spending CPU on deflate.
+class ReplyCompressor
+{
+public:
+    struct Stats {
+        quint64 replies = 0; // All replies passed to the compressor
+        quint64 compressed = 0; // Replies sent gzip_packed
+        quint64 skippedBySize = 0;
+        quint64 skippedByType = 0;
+        quint64 skippedByEntropy = 0;
+        quint64 rejected = 0; // Compressed, but discarded because of too little gain
+        quint64 inputBytes = 0; // Total size of the replies passed to deflate
+        quint64 savedBytes = 0; // Bytes saved on the compressed replies
+        quint64 compressionNsecs = 0; // Time spent in deflate (including the rejected results)
+    };
+
+    ReplyCompressor() = default;
+
+    // The level 0 disables the compression
+    int compressionLevel() const { return m_compressionLevel; }
+    void setCompressionLevel(int level);
+
+    int threshold() const { return m_threshold; }
+    void setThreshold(int bytes);
+
+    // Bits per byte in range (0, 8]
+    double maxEntropy() const { return m_maxEntropy; }
+    void setMaxEntropy(double bitsPerByte);
+
+    // Returns serialized gzip_packed wrapper of the reply,
+    // or an empty array if the reply should be sent as is.
+    QByteArray compress(const QByteArray &reply);
+
+    const Stats &stats() const { return m_stats; }
+    void resetStats();
+
+    static bool hasIncompressiblePayload(const QByteArray &reply);
+
+protected:
+    int m_compressionLevel = 6;
+    int m_threshold = 128;
+    double m_maxEntropy = 7.5;
+    Stats m_stats;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_REPLY_COMPRESSOR_HPP
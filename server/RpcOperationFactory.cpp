@@ -1,10 +1,303 @@
 #include "RpcOperationFactory_p.hpp"
 
+// Generated RPC Operation Factory includes
+#include "AccountOperationFactory.hpp"
+#include "AuthOperationFactory.hpp"
+#include "BotsOperationFactory.hpp"
+#include "ChannelsOperationFactory.hpp"
+#include "ContactsOperationFactory.hpp"
+#include "HelpOperationFactory.hpp"
+#include "LangpackOperationFactory.hpp"
+#include "MessagesOperationFactory.hpp"
+#include "PaymentsOperationFactory.hpp"
+#include "PhoneOperationFactory.hpp"
+#include "PhotosOperationFactory.hpp"
+#include "StickersOperationFactory.hpp"
+#include "UpdatesOperationFactory.hpp"
+#include "UploadOperationFactory.hpp"
+#include "UsersOperationFactory.hpp"
+// End of generated RPC Operation Factory includes
+
+#include <algorithm>
+#include <iterator>
+
+Q_LOGGING_CATEGORY(c_serverRpcDispatchCategory, "telegram.server.rpc.dispatch", QtWarningMsg)
+
 namespace Telegram {
 
 namespace Server {
 
-class RpcOperation;
+namespace {
+
+struct RpcDispatchEntry
+{
+    quint32 function;
+    RpcOperationFactory::ProcessRpcCall processRpcCall;
+};
+
+bool operator<(const RpcDispatchEntry &entry, quint32 function)
+{
+    return entry.function < function;
+}
+
+// The table is sorted by the function id (the generator takes care of it)
+const RpcDispatchEntry c_rpcDispatchTable[] = {
+    // Generated RPC dispatch table
+    { TLValue::UpdatesGetChannelDifference, processRpcCallWithMethod<UpdatesRpcOperation, &UpdatesRpcOperation::processGetChannelDifference> },
+    { TLValue::MessagesSearch, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSearch> },
+    { TLValue::MessagesReceivedMessages, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReceivedMessages> },
+    { TLValue::MessagesEditMessage, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processEditMessage> },
+    { TLValue::ChannelsGetFullChannel, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetFullChannel> },
+    { TLValue::AccountSendChangePhoneCode, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processSendChangePhoneCode> },
+    { TLValue::AccountGetAccountTTL, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetAccountTTL> },
+    { TLValue::MessagesSetBotPrecheckoutResults, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetBotPrecheckoutResults> },
+    { TLValue::MessagesCreateChat, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processCreateChat> },
+    { TLValue::AuthCheckPassword, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processCheckPassword> },
+    { TLValue::ChannelsGetChannels, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetChannels> },
+    { TLValue::LangpackGetDifference, processRpcCallWithMethod<LangpackRpcOperation, &LangpackRpcOperation::processGetDifference> },
+    { TLValue::MessagesGetCommonChats, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetCommonChats> },
+    { TLValue::UsersGetUsers, processRpcCallWithMethod<UsersRpcOperation, &UsersRpcOperation::processGetUsers> },
+    { TLValue::MessagesReadHistory, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReadHistory> },
+    { TLValue::MessagesReadMentions, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReadMentions> },
+    { TLValue::MessagesGetInlineGameHighScores, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetInlineGameHighScores> },
+    { TLValue::ChannelsCheckUsername, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processCheckUsername> },
+    { TLValue::ContactsSearch, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processSearch> },
+    { TLValue::ChannelsGetParticipants, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetParticipants> },
+    { TLValue::AccountGetNotifySettings, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetNotifySettings> },
+    { TLValue::ChannelsEditAbout, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processEditAbout> },
+    { TLValue::AccountSendConfirmPhoneCode, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processSendConfirmPhoneCode> },
+    { TLValue::MessagesMigrateChat, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processMigrateChat> },
+    { TLValue::MessagesSetInlineGameScore, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetInlineGameScore> },
+    { TLValue::PhoneReceivedCall, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processReceivedCall> },
+    { TLValue::MessagesGetDialogs, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetDialogs> },
+    { TLValue::ChannelsInviteToChannel, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processInviteToChannel> },
+    { TLValue::ContactsResetTopPeerRating, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processResetTopPeerRating> },
+    { TLValue::UploadReuploadCdnFile, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processReuploadCdnFile> },
+    { TLValue::AuthSignUp, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processSignUp> },
+    { TLValue::MessagesDeleteHistory, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processDeleteHistory> },
+    { TLValue::PhoneSetCallRating, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processSetCallRating> },
+    { TLValue::MessagesGetAllStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetAllStickers> },
+    { TLValue::AuthCancelCode, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processCancelCode> },
+    { TLValue::ChannelsToggleSignatures, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processToggleSignatures> },
+    { TLValue::HelpGetNearestDc, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetNearestDc> },
+    { TLValue::UploadGetCdnFile, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processGetCdnFile> },
+    { TLValue::ChannelsEditAdmin, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processEditAdmin> },
+    { TLValue::MessagesGetFavedStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetFavedStickers> },
+    { TLValue::PaymentsGetSavedInfo, processRpcCallWithMethod<PaymentsRpcOperation, &PaymentsRpcOperation::processGetSavedInfo> },
+    { TLValue::AccountSetAccountTTL, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processSetAccountTTL> },
+    { TLValue::MessagesGetRecentLocations, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetRecentLocations> },
+    { TLValue::ChannelsJoinChannel, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processJoinChannel> },
+    { TLValue::UploadGetWebFile, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processGetWebFile> },
+    { TLValue::MessagesGetWebPagePreview, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetWebPagePreview> },
+    { TLValue::UpdatesGetDifference, processRpcCallWithMethod<UpdatesRpcOperation, &UpdatesRpcOperation::processGetDifference> },
+    { TLValue::MessagesGetStickerSet, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetStickerSet> },
+    { TLValue::MessagesGetDhConfig, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetDhConfig> },
+    { TLValue::AccountCheckUsername, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processCheckUsername> },
+    { TLValue::PhoneSaveCallDebug, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processSaveCallDebug> },
+    { TLValue::PaymentsSendPaymentForm, processRpcCallWithMethod<PaymentsRpcOperation, &PaymentsRpcOperation::processSendPaymentForm> },
+    { TLValue::ContactsImportContacts, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processImportContacts> },
+    { TLValue::MessagesGetPeerDialogs, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetPeerDialogs> },
+    { TLValue::MessagesGetFeaturedStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetFeaturedStickers> },
+    { TLValue::LangpackGetStrings, processRpcCallWithMethod<LangpackRpcOperation, &LangpackRpcOperation::processGetStrings> },
+    { TLValue::PhoneConfirmCall, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processConfirmCall> },
+    { TLValue::MessagesSaveGif, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSaveGif> },
+    { TLValue::MessagesToggleDialogPin, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processToggleDialogPin> },
+    { TLValue::MessagesGetWebPage, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetWebPage> },
+    { TLValue::MessagesSendEncryptedService, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendEncryptedService> },
+    { TLValue::ContactsBlock, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processBlock> },
+    { TLValue::MessagesGetDocumentByHash, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetDocumentByHash> },
+    { TLValue::MessagesForwardMessage, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processForwardMessage> },
+    { TLValue::ChannelsGetAdminLog, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetAdminLog> },
+    { TLValue::HelpGetTermsOfService, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetTermsOfService> },
+    { TLValue::ChannelsUpdateUsername, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processUpdateUsername> },
+    { TLValue::MessagesGetPeerSettings, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetPeerSettings> },
+    { TLValue::MessagesReadMessageContents, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReadMessageContents> },
+    { TLValue::AccountUpdateDeviceLocked, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUpdateDeviceLocked> },
+    { TLValue::MessagesSaveRecentSticker, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSaveRecentSticker> },
+    { TLValue::MessagesGetFullChat, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetFullChat> },
+    { TLValue::PhoneAcceptCall, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processAcceptCall> },
+    { TLValue::MessagesGetChats, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetChats> },
+    { TLValue::MessagesAcceptEncryption, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processAcceptEncryption> },
+    { TLValue::HelpGetRecentMeUrls, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetRecentMeUrls> },
+    { TLValue::AccountUpdateUsername, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUpdateUsername> },
+    { TLValue::MessagesCheckChatInvite, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processCheckChatInvite> },
+    { TLValue::AuthResendCode, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processResendCode> },
+    { TLValue::AccountDeleteAccount, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processDeleteAccount> },
+    { TLValue::MessagesGetMessages, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetMessages> },
+    { TLValue::MessagesGetUnreadMentions, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetUnreadMentions> },
+    { TLValue::ChannelsToggleInvites, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processToggleInvites> },
+    { TLValue::AccountGetTmpPassword, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetTmpPassword> },
+    { TLValue::MessagesReportEncryptedSpam, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReportEncryptedSpam> },
+    { TLValue::HelpGetInviteText, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetInviteText> },
+    { TLValue::AuthRecoverPassword, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processRecoverPassword> },
+    { TLValue::PhotosUploadProfilePhoto, processRpcCallWithMethod<PhotosRpcOperation, &PhotosRpcOperation::processUploadProfilePhoto> },
+    { TLValue::ContactsImportCard, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processImportCard> },
+    { TLValue::MessagesGetInlineBotResults, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetInlineBotResults> },
+    { TLValue::MessagesUploadMedia, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processUploadMedia> },
+    { TLValue::HelpGetCdnConfig, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetCdnConfig> },
+    { TLValue::ChannelsGetParticipant, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetParticipant> },
+    { TLValue::AccountGetPassword, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetPassword> },
+    { TLValue::PhoneGetCallConfig, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processGetCallConfig> },
+    { TLValue::MessagesReceivedQueue, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReceivedQueue> },
+    { TLValue::ChannelsEditTitle, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processEditTitle> },
+    { TLValue::AuthLogOut, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processLogOut> },
+    { TLValue::MessagesGetArchivedStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetArchivedStickers> },
+    { TLValue::ContactsDeleteContacts, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processDeleteContacts> },
+    { TLValue::MessagesReadFeaturedStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReadFeaturedStickers> },
+    { TLValue::PhoneRequestCall, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processRequestCall> },
+    { TLValue::MessagesGetRecentStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetRecentStickers> },
+    { TLValue::AccountConfirmPhone, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processConfirmPhone> },
+    { TLValue::AccountRegisterDevice, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processRegisterDevice> },
+    { TLValue::MessagesGetMaskStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetMaskStickers> },
+    { TLValue::AccountUnregisterDevice, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUnregisterDevice> },
+    { TLValue::AccountUpdateStatus, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUpdateStatus> },
+    { TLValue::AuthImportBotAuthorization, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processImportBotAuthorization> },
+    { TLValue::MessagesGetAllDrafts, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetAllDrafts> },
+    { TLValue::MessagesImportChatInvite, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processImportChatInvite> },
+    { TLValue::HelpSaveAppLog, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processSaveAppLog> },
+    { TLValue::AuthCheckPhone, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processCheckPhone> },
+    { TLValue::MessagesForwardMessages, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processForwardMessages> },
+    { TLValue::AccountChangePhone, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processChangePhone> },
+    { TLValue::PaymentsValidateRequestedInfo, processRpcCallWithMethod<PaymentsRpcOperation, &PaymentsRpcOperation::processValidateRequestedInfo> },
+    { TLValue::AuthSendInvites, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processSendInvites> },
+    { TLValue::MessagesReorderStickerSets, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReorderStickerSets> },
+    { TLValue::AccountUpdateProfile, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUpdateProfile> },
+    { TLValue::PhoneDiscardCall, processRpcCallWithMethod<PhoneRpcOperation, &PhoneRpcOperation::processDiscardCall> },
+    { TLValue::MessagesSetEncryptedTyping, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetEncryptedTyping> },
+    { TLValue::MessagesExportChatInvite, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processExportChatInvite> },
+    { TLValue::MessagesReadEncryptedHistory, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReadEncryptedHistory> },
+    { TLValue::LangpackGetLanguages, processRpcCallWithMethod<LangpackRpcOperation, &LangpackRpcOperation::processGetLanguages> },
+    { TLValue::MessagesGetBotCallbackAnswer, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetBotCallbackAnswer> },
+    { TLValue::MessagesGetSavedGifs, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetSavedGifs> },
+    { TLValue::AccountUpdateNotifySettings, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUpdateNotifySettings> },
+    { TLValue::ChannelsDeleteMessages, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteMessages> },
+    { TLValue::ContactsExportCard, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processExportCard> },
+    { TLValue::StickersAddStickerToSet, processRpcCallWithMethod<StickersRpcOperation, &StickersRpcOperation::processAddStickerToSet> },
+    { TLValue::AuthSendCode, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processSendCode> },
+    { TLValue::ContactsResetSaved, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processResetSaved> },
+    { TLValue::PhotosDeletePhotos, processRpcCallWithMethod<PhotosRpcOperation, &PhotosRpcOperation::processDeletePhotos> },
+    { TLValue::MessagesClearRecentStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processClearRecentStickers> },
+    { TLValue::ChannelsGetAdminedPublicChannels, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetAdminedPublicChannels> },
+    { TLValue::AuthDropTempAuthKeys, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processDropTempAuthKeys> },
+    { TLValue::ContactsDeleteContact, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processDeleteContact> },
+    { TLValue::MessagesSetGameScore, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetGameScore> },
+    { TLValue::HelpGetAppChangelog, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetAppChangelog> },
+    { TLValue::PhotosGetUserPhotos, processRpcCallWithMethod<PhotosRpcOperation, &PhotosRpcOperation::processGetUserPhotos> },
+    { TLValue::ChannelsGetMessages, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processGetMessages> },
+    { TLValue::MessagesReorderPinnedDialogs, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReorderPinnedDialogs> },
+    { TLValue::PaymentsGetPaymentForm, processRpcCallWithMethod<PaymentsRpcOperation, &PaymentsRpcOperation::processGetPaymentForm> },
+    { TLValue::MessagesSendEncryptedFile, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendEncryptedFile> },
+    { TLValue::LangpackGetLangPack, processRpcCallWithMethod<LangpackRpcOperation, &LangpackRpcOperation::processGetLangPack> },
+    { TLValue::StickersCreateStickerSet, processRpcCallWithMethod<StickersRpcOperation, &StickersRpcOperation::processCreateStickerSet> },
+    { TLValue::HelpGetSupport, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetSupport> },
+    { TLValue::MessagesSearchGlobal, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSearchGlobal> },
+    { TLValue::AuthResetAuthorizations, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processResetAuthorizations> },
+    { TLValue::PaymentsGetPaymentReceipt, processRpcCallWithMethod<PaymentsRpcOperation, &PaymentsRpcOperation::processGetPaymentReceipt> },
+    { TLValue::MessagesSetTyping, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetTyping> },
+    { TLValue::ChannelsUpdatePinnedMessage, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processUpdatePinnedMessage> },
+    { TLValue::MessagesHideReportSpam, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processHideReportSpam> },
+    { TLValue::MessagesSendEncrypted, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendEncrypted> },
+    { TLValue::MessagesEditChatAdmin, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processEditChatAdmin> },
+    { TLValue::BotsSendCustomRequest, processRpcCallWithMethod<BotsRpcOperation, &BotsRpcOperation::processSendCustomRequest> },
+    { TLValue::AccountReportPeer, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processReportPeer> },
+    { TLValue::HelpGetAppUpdate, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetAppUpdate> },
+    { TLValue::ChannelsDeleteHistory, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteHistory> },
+    { TLValue::MessagesEditInlineBotMessage, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processEditInlineBotMessage> },
+    { TLValue::MessagesSendInlineBotResult, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendInlineBotResult> },
+    { TLValue::UploadSaveFilePart, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processSaveFilePart> },
+    { TLValue::MessagesFaveSticker, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processFaveSticker> },
+    { TLValue::MessagesSaveDraft, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSaveDraft> },
+    { TLValue::AccountGetPasswordSettings, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetPasswordSettings> },
+    { TLValue::AuthSignIn, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processSignIn> },
+    { TLValue::MessagesSearchGifs, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSearchGifs> },
+    { TLValue::ChannelsEditBanned, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processEditBanned> },
+    { TLValue::ChannelsDeleteChannel, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteChannel> },
+    { TLValue::ContactsGetContacts, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processGetContacts> },
+    { TLValue::AccountGetWallPapers, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetWallPapers> },
+    { TLValue::ContactsGetStatuses, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processGetStatuses> },
+    { TLValue::MessagesGetMessagesViews, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetMessagesViews> },
+    { TLValue::HelpGetConfig, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processGetConfig> },
+    { TLValue::ChannelsExportInvite, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processExportInvite> },
+    { TLValue::MessagesInstallStickerSet, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processInstallStickerSet> },
+    { TLValue::ChannelsExportMessageLink, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processExportMessageLink> },
+    { TLValue::MessagesSendMedia, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendMedia> },
+    { TLValue::MessagesSendScreenshotNotification, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendScreenshotNotification> },
+    { TLValue::AccountSetPrivacy, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processSetPrivacy> },
+    { TLValue::UsersGetFullUser, processRpcCallWithMethod<UsersRpcOperation, &UsersRpcOperation::processGetFullUser> },
+    { TLValue::MessagesEditChatPhoto, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processEditChatPhoto> },
+    { TLValue::ChannelsReadHistory, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processReadHistory> },
+    { TLValue::MessagesGetAttachedStickers, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetAttachedStickers> },
+    { TLValue::AuthBindTempAuthKey, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processBindTempAuthKey> },
+    { TLValue::MessagesReportSpam, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processReportSpam> },
+    { TLValue::ChannelsDeleteUserHistory, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteUserHistory> },
+    { TLValue::ContactsGetTopPeers, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processGetTopPeers> },
+    { TLValue::MessagesSetBotCallbackAnswer, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetBotCallbackAnswer> },
+    { TLValue::PaymentsClearSavedInfo, processRpcCallWithMethod<PaymentsRpcOperation, &PaymentsRpcOperation::processClearSavedInfo> },
+    { TLValue::AuthRequestPasswordRecovery, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processRequestPasswordRecovery> },
+    { TLValue::AccountGetPrivacy, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetPrivacy> },
+    { TLValue::AccountResetNotifySettings, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processResetNotifySettings> },
+    { TLValue::MessagesEditChatTitle, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processEditChatTitle> },
+    { TLValue::MessagesGetHistory, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetHistory> },
+    { TLValue::UploadSaveBigFilePart, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processSaveBigFilePart> },
+    { TLValue::AccountResetAuthorization, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processResetAuthorization> },
+    { TLValue::MessagesDeleteChatUser, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processDeleteChatUser> },
+    { TLValue::MessagesGetPinnedDialogs, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetPinnedDialogs> },
+    { TLValue::AccountGetAuthorizations, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processGetAuthorizations> },
+    { TLValue::UploadGetFile, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processGetFile> },
+    { TLValue::AuthImportAuthorization, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processImportAuthorization> },
+    { TLValue::ContactsUnblock, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processUnblock> },
+    { TLValue::MessagesDeleteMessages, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processDeleteMessages> },
+    { TLValue::AuthExportAuthorization, processRpcCallWithMethod<AuthRpcOperation, &AuthRpcOperation::processExportAuthorization> },
+    { TLValue::MessagesSetBotShippingResults, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetBotShippingResults> },
+    { TLValue::BotsAnswerWebhookJSONQuery, processRpcCallWithMethod<BotsRpcOperation, &BotsRpcOperation::processAnswerWebhookJSONQuery> },
+    { TLValue::MessagesStartBot, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processStartBot> },
+    { TLValue::MessagesGetGameHighScores, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetGameHighScores> },
+    { TLValue::ChannelsSetStickers, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processSetStickers> },
+    { TLValue::ChannelsReadMessageContents, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processReadMessageContents> },
+    { TLValue::ChannelsTogglePreHistoryHidden, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processTogglePreHistoryHidden> },
+    { TLValue::MessagesSetInlineBotResults, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSetInlineBotResults> },
+    { TLValue::MessagesGetAllChats, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetAllChats> },
+    { TLValue::HelpSetBotUpdatesStatus, processRpcCallWithMethod<HelpRpcOperation, &HelpRpcOperation::processSetBotUpdatesStatus> },
+    { TLValue::MessagesToggleChatAdmins, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processToggleChatAdmins> },
+    { TLValue::UpdatesGetState, processRpcCallWithMethod<UpdatesRpcOperation, &UpdatesRpcOperation::processGetState> },
+    { TLValue::MessagesDiscardEncryption, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processDiscardEncryption> },
+    { TLValue::PhotosUpdateProfilePhoto, processRpcCallWithMethod<PhotosRpcOperation, &PhotosRpcOperation::processUpdateProfilePhoto> },
+    { TLValue::ChannelsEditPhoto, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processEditPhoto> },
+    { TLValue::ChannelsCreateChannel, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processCreateChannel> },
+    { TLValue::ContactsGetBlocked, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processGetBlocked> },
+    { TLValue::MessagesRequestEncryption, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processRequestEncryption> },
+    { TLValue::UploadGetCdnFileHashes, processRpcCallWithMethod<UploadRpcOperation, &UploadRpcOperation::processGetCdnFileHashes> },
+    { TLValue::StickersRemoveStickerFromSet, processRpcCallWithMethod<StickersRpcOperation, &StickersRpcOperation::processRemoveStickerFromSet> },
+    { TLValue::ChannelsLeaveChannel, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processLeaveChannel> },
+    { TLValue::ContactsResolveUsername, processRpcCallWithMethod<ContactsRpcOperation, &ContactsRpcOperation::processResolveUsername> },
+    { TLValue::MessagesUninstallStickerSet, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processUninstallStickerSet> },
+    { TLValue::MessagesAddChatUser, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processAddChatUser> },
+    { TLValue::AccountUpdatePasswordSettings, processRpcCallWithMethod<AccountRpcOperation, &AccountRpcOperation::processUpdatePasswordSettings> },
+    { TLValue::MessagesSendMessage, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processSendMessage> },
+    { TLValue::MessagesGetMessageEditData, processRpcCallWithMethod<MessagesRpcOperation, &MessagesRpcOperation::processGetMessageEditData> },
+    { TLValue::ChannelsReportSpam, processRpcCallWithMethod<ChannelsRpcOperation, &ChannelsRpcOperation::processReportSpam> },
+    { TLValue::StickersChangeStickerPosition, processRpcCallWithMethod<StickersRpcOperation, &StickersRpcOperation::processChangeStickerPosition> },
+    // End of generated RPC dispatch table
+};
+
+} // anonymous namespace
+
+RpcOperationFactory::ProcessRpcCall RpcOperationFactory::getProcessRpcCall(TLValue function)
+{
+    const RpcDispatchEntry *begin = std::begin(c_rpcDispatchTable);
+    const RpcDispatchEntry *end = std::end(c_rpcDispatchTable);
+#ifndef QT_NO_DEBUG
+    static const bool tableIsSorted = std::is_sorted(begin, end, [](const RpcDispatchEntry &left, const RpcDispatchEntry &right) {
+        return left.function < right.function;
+    });
+    Q_ASSERT(tableIsSorted);
+#endif
+    const RpcDispatchEntry *entry = std::lower_bound(begin, end, quint32(function));
+    if ((entry == end) || (entry->function != function)) {
+        return nullptr;
+    }
+    return entry->processRpcCall;
+}
 
 } // Server namespace
 
@@ -3,6 +3,8 @@
 
 #include <QObject>
 
+#include "TLValues.hpp"
+
 namespace Telegram {
 
 namespace Server {
@@ -14,7 +16,13 @@ class RpcProcessingContext;
 class RpcOperationFactory
 {
 public:
+    using ProcessRpcCall = RpcOperation *(*)(RpcLayer *layer, RpcProcessingContext &context);
+
     virtual RpcOperation *processRpcCall(RpcLayer *layer, RpcProcessingContext &context) = 0;
+
+    // Lookup in the generated table of all RPC functions known to the server.
+    // Returns nullptr if the function has no generated processing method.
+    static ProcessRpcCall getProcessRpcCall(TLValue function);
 };
 
 } // Server namespace
@@ -3,13 +3,31 @@
 
 #include "RpcOperationFactory.hpp"
 #include "RpcProcessingContext.hpp"
+#include "ServerRpcLayer.hpp"
 
 #include <QLoggingCategory>
 
+Q_DECLARE_LOGGING_CATEGORY(c_serverRpcDispatchCategory)
+
 namespace Telegram {
 
 namespace Server {
 
+template <typename T>
+RpcOperation *createRpcOperation(RpcLayer *layer, RpcProcessingContext &context,
+                                 bool (T::* const method)(RpcProcessingContext &))
+{
+    qCDebug(c_serverRpcDispatchCategory) << "Process" << context.readCode().toString() << "with messageId" << context.requestId();
+    T *operation = static_cast<T *>(layer->takeRecycledOperation(&T::staticMetaObject));
+    if (!operation) {
+        operation = new T(layer);
+    }
+    operation->setRequestId(context.requestId());
+    operation->setFunction(context.readCode());
+    (operation->*method)(context);
+    return operation;
+}
+
 template <typename T>
 RpcOperation *processRpcCallImpl(RpcLayer *layer, RpcProcessingContext &context)
 {
@@ -17,11 +35,13 @@ RpcOperation *processRpcCallImpl(RpcLayer *layer, RpcProcessingContext &context)
     if (!method) {
         return nullptr;
     }
-    qDebug() << Q_FUNC_INFO << "Process" << context.readCode().toString() << "with messageId" << context.requestId();
-    T *operation = new T(layer);
-    operation->setRequestId(context.requestId());
-    (operation->*method)(context);
-    return operation;
+    return createRpcOperation<T>(layer, context, method);
+}
+
+template <typename T, bool (T::*method)(RpcProcessingContext &)>
+RpcOperation *processRpcCallWithMethod(RpcLayer *layer, RpcProcessingContext &context)
+{
+    return createRpcOperation<T>(layer, context, method);
 }
 
 } // Server namespace
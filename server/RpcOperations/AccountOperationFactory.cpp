@@ -44,189 +44,189 @@ namespace Server {
 bool AccountRpcOperation::processChangePhone(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runChangePhone);
-    context.inputStream() >> m_changePhone;
+    context.inputStream() >> constructArguments(&m_changePhone);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processCheckUsername(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runCheckUsername);
-    context.inputStream() >> m_checkUsername;
+    context.inputStream() >> constructArguments(&m_checkUsername);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processConfirmPhone(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runConfirmPhone);
-    context.inputStream() >> m_confirmPhone;
+    context.inputStream() >> constructArguments(&m_confirmPhone);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processDeleteAccount(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runDeleteAccount);
-    context.inputStream() >> m_deleteAccount;
+    context.inputStream() >> constructArguments(&m_deleteAccount);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetAccountTTL(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetAccountTTL);
-    context.inputStream() >> m_getAccountTTL;
+    context.inputStream() >> constructArguments(&m_getAccountTTL);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetAuthorizations(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetAuthorizations);
-    context.inputStream() >> m_getAuthorizations;
+    context.inputStream() >> constructArguments(&m_getAuthorizations);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetNotifySettings(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetNotifySettings);
-    context.inputStream() >> m_getNotifySettings;
+    context.inputStream() >> constructArguments(&m_getNotifySettings);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetPassword(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetPassword);
-    context.inputStream() >> m_getPassword;
+    context.inputStream() >> constructArguments(&m_getPassword);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetPasswordSettings(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetPasswordSettings);
-    context.inputStream() >> m_getPasswordSettings;
+    context.inputStream() >> constructArguments(&m_getPasswordSettings);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetPrivacy(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetPrivacy);
-    context.inputStream() >> m_getPrivacy;
+    context.inputStream() >> constructArguments(&m_getPrivacy);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetTmpPassword(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetTmpPassword);
-    context.inputStream() >> m_getTmpPassword;
+    context.inputStream() >> constructArguments(&m_getTmpPassword);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processGetWallPapers(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runGetWallPapers);
-    context.inputStream() >> m_getWallPapers;
+    context.inputStream() >> constructArguments(&m_getWallPapers);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processRegisterDevice(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runRegisterDevice);
-    context.inputStream() >> m_registerDevice;
+    context.inputStream() >> constructArguments(&m_registerDevice);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processReportPeer(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runReportPeer);
-    context.inputStream() >> m_reportPeer;
+    context.inputStream() >> constructArguments(&m_reportPeer);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processResetAuthorization(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runResetAuthorization);
-    context.inputStream() >> m_resetAuthorization;
+    context.inputStream() >> constructArguments(&m_resetAuthorization);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processResetNotifySettings(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runResetNotifySettings);
-    context.inputStream() >> m_resetNotifySettings;
+    context.inputStream() >> constructArguments(&m_resetNotifySettings);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processSendChangePhoneCode(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runSendChangePhoneCode);
-    context.inputStream() >> m_sendChangePhoneCode;
+    context.inputStream() >> constructArguments(&m_sendChangePhoneCode);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processSendConfirmPhoneCode(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runSendConfirmPhoneCode);
-    context.inputStream() >> m_sendConfirmPhoneCode;
+    context.inputStream() >> constructArguments(&m_sendConfirmPhoneCode);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processSetAccountTTL(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runSetAccountTTL);
-    context.inputStream() >> m_setAccountTTL;
+    context.inputStream() >> constructArguments(&m_setAccountTTL);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processSetPrivacy(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runSetPrivacy);
-    context.inputStream() >> m_setPrivacy;
+    context.inputStream() >> constructArguments(&m_setPrivacy);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUnregisterDevice(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUnregisterDevice);
-    context.inputStream() >> m_unregisterDevice;
+    context.inputStream() >> constructArguments(&m_unregisterDevice);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUpdateDeviceLocked(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUpdateDeviceLocked);
-    context.inputStream() >> m_updateDeviceLocked;
+    context.inputStream() >> constructArguments(&m_updateDeviceLocked);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUpdateNotifySettings(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUpdateNotifySettings);
-    context.inputStream() >> m_updateNotifySettings;
+    context.inputStream() >> constructArguments(&m_updateNotifySettings);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUpdatePasswordSettings(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUpdatePasswordSettings);
-    context.inputStream() >> m_updatePasswordSettings;
+    context.inputStream() >> constructArguments(&m_updatePasswordSettings);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUpdateProfile(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUpdateProfile);
-    context.inputStream() >> m_updateProfile;
+    context.inputStream() >> constructArguments(&m_updateProfile);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUpdateStatus(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUpdateStatus);
-    context.inputStream() >> m_updateStatus;
+    context.inputStream() >> constructArguments(&m_updateStatus);
     return !context.inputStream().error();
 }
 
 bool AccountRpcOperation::processUpdateUsername(RpcProcessingContext &context)
 {
     setRunMethod(&AccountRpcOperation::runUpdateUsername);
-    context.inputStream() >> m_updateUsername;
+    context.inputStream() >> constructArguments(&m_updateUsername);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -498,7 +498,10 @@ void AccountRpcOperation::runUpdateUsername()
 {
     TLFunctions::TLAccountUpdateUsername &arguments = m_updateUsername;
     LocalUser *selfUser = layer()->getUser();
-    selfUser->setUserName(arguments.username);
+    if (!api()->setUserName(selfUser, arguments.username)) {
+        sendRpcError(RpcError::UsernameOccupied);
+        return;
+    }
 
     TLUser result;
     Utils::setupTLUser(&result, selfUser, selfUser);
@@ -33,6 +33,7 @@ class AccountRpcOperation : public RpcOperation
     Q_DISABLE_COPY(AccountRpcOperation)
 public:
     explicit AccountRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~AccountRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processChangePhone(RpcProcessingContext &context);
@@ -99,41 +100,48 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLAccountChangePhone m_changePhone;
-    TLFunctions::TLAccountCheckUsername m_checkUsername;
-    TLFunctions::TLAccountConfirmPhone m_confirmPhone;
-    TLFunctions::TLAccountDeleteAccount m_deleteAccount;
-    TLFunctions::TLAccountGetAccountTTL m_getAccountTTL;
-    TLFunctions::TLAccountGetAuthorizations m_getAuthorizations;
-    TLFunctions::TLAccountGetNotifySettings m_getNotifySettings;
-    TLFunctions::TLAccountGetPassword m_getPassword;
-    TLFunctions::TLAccountGetPasswordSettings m_getPasswordSettings;
-    TLFunctions::TLAccountGetPrivacy m_getPrivacy;
-    TLFunctions::TLAccountGetTmpPassword m_getTmpPassword;
-    TLFunctions::TLAccountGetWallPapers m_getWallPapers;
-    TLFunctions::TLAccountRegisterDevice m_registerDevice;
-    TLFunctions::TLAccountReportPeer m_reportPeer;
-    TLFunctions::TLAccountResetAuthorization m_resetAuthorization;
-    TLFunctions::TLAccountResetNotifySettings m_resetNotifySettings;
-    TLFunctions::TLAccountSendChangePhoneCode m_sendChangePhoneCode;
-    TLFunctions::TLAccountSendConfirmPhoneCode m_sendConfirmPhoneCode;
-    TLFunctions::TLAccountSetAccountTTL m_setAccountTTL;
-    TLFunctions::TLAccountSetPrivacy m_setPrivacy;
-    TLFunctions::TLAccountUnregisterDevice m_unregisterDevice;
-    TLFunctions::TLAccountUpdateDeviceLocked m_updateDeviceLocked;
-    TLFunctions::TLAccountUpdateNotifySettings m_updateNotifySettings;
-    TLFunctions::TLAccountUpdatePasswordSettings m_updatePasswordSettings;
-    TLFunctions::TLAccountUpdateProfile m_updateProfile;
-    TLFunctions::TLAccountUpdateStatus m_updateStatus;
-    TLFunctions::TLAccountUpdateUsername m_updateUsername;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLAccountChangePhone m_changePhone;
+        TLFunctions::TLAccountCheckUsername m_checkUsername;
+        TLFunctions::TLAccountConfirmPhone m_confirmPhone;
+        TLFunctions::TLAccountDeleteAccount m_deleteAccount;
+        TLFunctions::TLAccountGetAccountTTL m_getAccountTTL;
+        TLFunctions::TLAccountGetAuthorizations m_getAuthorizations;
+        TLFunctions::TLAccountGetNotifySettings m_getNotifySettings;
+        TLFunctions::TLAccountGetPassword m_getPassword;
+        TLFunctions::TLAccountGetPasswordSettings m_getPasswordSettings;
+        TLFunctions::TLAccountGetPrivacy m_getPrivacy;
+        TLFunctions::TLAccountGetTmpPassword m_getTmpPassword;
+        TLFunctions::TLAccountGetWallPapers m_getWallPapers;
+        TLFunctions::TLAccountRegisterDevice m_registerDevice;
+        TLFunctions::TLAccountReportPeer m_reportPeer;
+        TLFunctions::TLAccountResetAuthorization m_resetAuthorization;
+        TLFunctions::TLAccountResetNotifySettings m_resetNotifySettings;
+        TLFunctions::TLAccountSendChangePhoneCode m_sendChangePhoneCode;
+        TLFunctions::TLAccountSendConfirmPhoneCode m_sendConfirmPhoneCode;
+        TLFunctions::TLAccountSetAccountTTL m_setAccountTTL;
+        TLFunctions::TLAccountSetPrivacy m_setPrivacy;
+        TLFunctions::TLAccountUnregisterDevice m_unregisterDevice;
+        TLFunctions::TLAccountUpdateDeviceLocked m_updateDeviceLocked;
+        TLFunctions::TLAccountUpdateNotifySettings m_updateNotifySettings;
+        TLFunctions::TLAccountUpdatePasswordSettings m_updatePasswordSettings;
+        TLFunctions::TLAccountUpdateProfile m_updateProfile;
+        TLFunctions::TLAccountUpdateStatus m_updateStatus;
+        TLFunctions::TLAccountUpdateUsername m_updateUsername;
+        // End of generated RPC members
+    };
 };
 
 class AccountOperationFactory : public RpcOperationFactory
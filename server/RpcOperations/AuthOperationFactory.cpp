@@ -32,119 +32,119 @@ namespace Server {
 bool AuthRpcOperation::processBindTempAuthKey(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runBindTempAuthKey);
-    context.inputStream() >> m_bindTempAuthKey;
+    context.inputStream() >> constructArguments(&m_bindTempAuthKey);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processCancelCode(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runCancelCode);
-    context.inputStream() >> m_cancelCode;
+    context.inputStream() >> constructArguments(&m_cancelCode);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processCheckPassword(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runCheckPassword);
-    context.inputStream() >> m_checkPassword;
+    context.inputStream() >> constructArguments(&m_checkPassword);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processCheckPhone(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runCheckPhone);
-    context.inputStream() >> m_checkPhone;
+    context.inputStream() >> constructArguments(&m_checkPhone);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processDropTempAuthKeys(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runDropTempAuthKeys);
-    context.inputStream() >> m_dropTempAuthKeys;
+    context.inputStream() >> constructArguments(&m_dropTempAuthKeys);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processExportAuthorization(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runExportAuthorization);
-    context.inputStream() >> m_exportAuthorization;
+    context.inputStream() >> constructArguments(&m_exportAuthorization);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processImportAuthorization(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runImportAuthorization);
-    context.inputStream() >> m_importAuthorization;
+    context.inputStream() >> constructArguments(&m_importAuthorization);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processImportBotAuthorization(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runImportBotAuthorization);
-    context.inputStream() >> m_importBotAuthorization;
+    context.inputStream() >> constructArguments(&m_importBotAuthorization);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processLogOut(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runLogOut);
-    context.inputStream() >> m_logOut;
+    context.inputStream() >> constructArguments(&m_logOut);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processRecoverPassword(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runRecoverPassword);
-    context.inputStream() >> m_recoverPassword;
+    context.inputStream() >> constructArguments(&m_recoverPassword);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processRequestPasswordRecovery(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runRequestPasswordRecovery);
-    context.inputStream() >> m_requestPasswordRecovery;
+    context.inputStream() >> constructArguments(&m_requestPasswordRecovery);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processResendCode(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runResendCode);
-    context.inputStream() >> m_resendCode;
+    context.inputStream() >> constructArguments(&m_resendCode);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processResetAuthorizations(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runResetAuthorizations);
-    context.inputStream() >> m_resetAuthorizations;
+    context.inputStream() >> constructArguments(&m_resetAuthorizations);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processSendCode(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runSendCode);
-    context.inputStream() >> m_sendCode;
+    context.inputStream() >> constructArguments(&m_sendCode);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processSendInvites(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runSendInvites);
-    context.inputStream() >> m_sendInvites;
+    context.inputStream() >> constructArguments(&m_sendInvites);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processSignIn(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runSignIn);
-    context.inputStream() >> m_signIn;
+    context.inputStream() >> constructArguments(&m_signIn);
     return !context.inputStream().error();
 }
 
 bool AuthRpcOperation::processSignUp(RpcProcessingContext &context)
 {
     setRunMethod(&AuthRpcOperation::runSignUp);
-    context.inputStream() >> m_signUp;
+    context.inputStream() >> constructArguments(&m_signUp);
     return !context.inputStream().error();
 }
 // End of generated process methods
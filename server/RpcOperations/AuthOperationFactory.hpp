@@ -33,6 +33,7 @@ class AuthRpcOperation : public RpcOperation
     Q_DISABLE_COPY(AuthRpcOperation)
 public:
     explicit AuthRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~AuthRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processBindTempAuthKey(RpcProcessingContext &context);
@@ -81,31 +82,38 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLAuthBindTempAuthKey m_bindTempAuthKey;
-    TLFunctions::TLAuthCancelCode m_cancelCode;
-    TLFunctions::TLAuthCheckPassword m_checkPassword;
-    TLFunctions::TLAuthCheckPhone m_checkPhone;
-    TLFunctions::TLAuthDropTempAuthKeys m_dropTempAuthKeys;
-    TLFunctions::TLAuthExportAuthorization m_exportAuthorization;
-    TLFunctions::TLAuthImportAuthorization m_importAuthorization;
-    TLFunctions::TLAuthImportBotAuthorization m_importBotAuthorization;
-    TLFunctions::TLAuthLogOut m_logOut;
-    TLFunctions::TLAuthRecoverPassword m_recoverPassword;
-    TLFunctions::TLAuthRequestPasswordRecovery m_requestPasswordRecovery;
-    TLFunctions::TLAuthResendCode m_resendCode;
-    TLFunctions::TLAuthResetAuthorizations m_resetAuthorizations;
-    TLFunctions::TLAuthSendCode m_sendCode;
-    TLFunctions::TLAuthSendInvites m_sendInvites;
-    TLFunctions::TLAuthSignIn m_signIn;
-    TLFunctions::TLAuthSignUp m_signUp;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLAuthBindTempAuthKey m_bindTempAuthKey;
+        TLFunctions::TLAuthCancelCode m_cancelCode;
+        TLFunctions::TLAuthCheckPassword m_checkPassword;
+        TLFunctions::TLAuthCheckPhone m_checkPhone;
+        TLFunctions::TLAuthDropTempAuthKeys m_dropTempAuthKeys;
+        TLFunctions::TLAuthExportAuthorization m_exportAuthorization;
+        TLFunctions::TLAuthImportAuthorization m_importAuthorization;
+        TLFunctions::TLAuthImportBotAuthorization m_importBotAuthorization;
+        TLFunctions::TLAuthLogOut m_logOut;
+        TLFunctions::TLAuthRecoverPassword m_recoverPassword;
+        TLFunctions::TLAuthRequestPasswordRecovery m_requestPasswordRecovery;
+        TLFunctions::TLAuthResendCode m_resendCode;
+        TLFunctions::TLAuthResetAuthorizations m_resetAuthorizations;
+        TLFunctions::TLAuthSendCode m_sendCode;
+        TLFunctions::TLAuthSendInvites m_sendInvites;
+        TLFunctions::TLAuthSignIn m_signIn;
+        TLFunctions::TLAuthSignUp m_signUp;
+        // End of generated RPC members
+    };
 };
 
 class AuthOperationFactory : public RpcOperationFactory
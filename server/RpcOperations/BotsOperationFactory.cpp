@@ -42,14 +42,14 @@ namespace Server {
 bool BotsRpcOperation::processAnswerWebhookJSONQuery(RpcProcessingContext &context)
 {
     setRunMethod(&BotsRpcOperation::runAnswerWebhookJSONQuery);
-    context.inputStream() >> m_answerWebhookJSONQuery;
+    context.inputStream() >> constructArguments(&m_answerWebhookJSONQuery);
     return !context.inputStream().error();
 }
 
 bool BotsRpcOperation::processSendCustomRequest(RpcProcessingContext &context)
 {
     setRunMethod(&BotsRpcOperation::runSendCustomRequest);
-    context.inputStream() >> m_sendCustomRequest;
+    context.inputStream() >> constructArguments(&m_sendCustomRequest);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -33,6 +33,7 @@ class BotsRpcOperation : public RpcOperation
     Q_DISABLE_COPY(BotsRpcOperation)
 public:
     explicit BotsRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~BotsRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processAnswerWebhookJSONQuery(RpcProcessingContext &context);
@@ -49,16 +50,23 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLBotsAnswerWebhookJSONQuery m_answerWebhookJSONQuery;
-    TLFunctions::TLBotsSendCustomRequest m_sendCustomRequest;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLBotsAnswerWebhookJSONQuery m_answerWebhookJSONQuery;
+        TLFunctions::TLBotsSendCustomRequest m_sendCustomRequest;
+        // End of generated RPC members
+    };
 };
 
 class BotsOperationFactory : public RpcOperationFactory
@@ -42,224 +42,224 @@ namespace Server {
 bool ChannelsRpcOperation::processCheckUsername(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runCheckUsername);
-    context.inputStream() >> m_checkUsername;
+    context.inputStream() >> constructArguments(&m_checkUsername);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processCreateChannel(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runCreateChannel);
-    context.inputStream() >> m_createChannel;
+    context.inputStream() >> constructArguments(&m_createChannel);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processDeleteChannel(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runDeleteChannel);
-    context.inputStream() >> m_deleteChannel;
+    context.inputStream() >> constructArguments(&m_deleteChannel);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processDeleteHistory(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runDeleteHistory);
-    context.inputStream() >> m_deleteHistory;
+    context.inputStream() >> constructArguments(&m_deleteHistory);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processDeleteMessages(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runDeleteMessages);
-    context.inputStream() >> m_deleteMessages;
+    context.inputStream() >> constructArguments(&m_deleteMessages);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processDeleteUserHistory(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runDeleteUserHistory);
-    context.inputStream() >> m_deleteUserHistory;
+    context.inputStream() >> constructArguments(&m_deleteUserHistory);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processEditAbout(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runEditAbout);
-    context.inputStream() >> m_editAbout;
+    context.inputStream() >> constructArguments(&m_editAbout);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processEditAdmin(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runEditAdmin);
-    context.inputStream() >> m_editAdmin;
+    context.inputStream() >> constructArguments(&m_editAdmin);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processEditBanned(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runEditBanned);
-    context.inputStream() >> m_editBanned;
+    context.inputStream() >> constructArguments(&m_editBanned);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processEditPhoto(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runEditPhoto);
-    context.inputStream() >> m_editPhoto;
+    context.inputStream() >> constructArguments(&m_editPhoto);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processEditTitle(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runEditTitle);
-    context.inputStream() >> m_editTitle;
+    context.inputStream() >> constructArguments(&m_editTitle);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processExportInvite(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runExportInvite);
-    context.inputStream() >> m_exportInvite;
+    context.inputStream() >> constructArguments(&m_exportInvite);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processExportMessageLink(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runExportMessageLink);
-    context.inputStream() >> m_exportMessageLink;
+    context.inputStream() >> constructArguments(&m_exportMessageLink);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetAdminLog(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetAdminLog);
-    context.inputStream() >> m_getAdminLog;
+    context.inputStream() >> constructArguments(&m_getAdminLog);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetAdminedPublicChannels(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetAdminedPublicChannels);
-    context.inputStream() >> m_getAdminedPublicChannels;
+    context.inputStream() >> constructArguments(&m_getAdminedPublicChannels);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetChannels(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetChannels);
-    context.inputStream() >> m_getChannels;
+    context.inputStream() >> constructArguments(&m_getChannels);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetFullChannel(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetFullChannel);
-    context.inputStream() >> m_getFullChannel;
+    context.inputStream() >> constructArguments(&m_getFullChannel);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetMessages(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetMessages);
-    context.inputStream() >> m_getMessages;
+    context.inputStream() >> constructArguments(&m_getMessages);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetParticipant(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetParticipant);
-    context.inputStream() >> m_getParticipant;
+    context.inputStream() >> constructArguments(&m_getParticipant);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processGetParticipants(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runGetParticipants);
-    context.inputStream() >> m_getParticipants;
+    context.inputStream() >> constructArguments(&m_getParticipants);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processInviteToChannel(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runInviteToChannel);
-    context.inputStream() >> m_inviteToChannel;
+    context.inputStream() >> constructArguments(&m_inviteToChannel);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processJoinChannel(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runJoinChannel);
-    context.inputStream() >> m_joinChannel;
+    context.inputStream() >> constructArguments(&m_joinChannel);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processLeaveChannel(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runLeaveChannel);
-    context.inputStream() >> m_leaveChannel;
+    context.inputStream() >> constructArguments(&m_leaveChannel);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processReadHistory(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runReadHistory);
-    context.inputStream() >> m_readHistory;
+    context.inputStream() >> constructArguments(&m_readHistory);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processReadMessageContents(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runReadMessageContents);
-    context.inputStream() >> m_readMessageContents;
+    context.inputStream() >> constructArguments(&m_readMessageContents);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processReportSpam(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runReportSpam);
-    context.inputStream() >> m_reportSpam;
+    context.inputStream() >> constructArguments(&m_reportSpam);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processSetStickers(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runSetStickers);
-    context.inputStream() >> m_setStickers;
+    context.inputStream() >> constructArguments(&m_setStickers);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processToggleInvites(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runToggleInvites);
-    context.inputStream() >> m_toggleInvites;
+    context.inputStream() >> constructArguments(&m_toggleInvites);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processTogglePreHistoryHidden(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runTogglePreHistoryHidden);
-    context.inputStream() >> m_togglePreHistoryHidden;
+    context.inputStream() >> constructArguments(&m_togglePreHistoryHidden);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processToggleSignatures(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runToggleSignatures);
-    context.inputStream() >> m_toggleSignatures;
+    context.inputStream() >> constructArguments(&m_toggleSignatures);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processUpdatePinnedMessage(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runUpdatePinnedMessage);
-    context.inputStream() >> m_updatePinnedMessage;
+    context.inputStream() >> constructArguments(&m_updatePinnedMessage);
     return !context.inputStream().error();
 }
 
 bool ChannelsRpcOperation::processUpdateUsername(RpcProcessingContext &context)
 {
     setRunMethod(&ChannelsRpcOperation::runUpdateUsername);
-    context.inputStream() >> m_updateUsername;
+    context.inputStream() >> constructArguments(&m_updateUsername);
     return !context.inputStream().error();
 }
 // End of generated process methods
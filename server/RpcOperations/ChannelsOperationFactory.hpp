@@ -33,6 +33,7 @@ class ChannelsRpcOperation : public RpcOperation
     Q_DISABLE_COPY(ChannelsRpcOperation)
 public:
     explicit ChannelsRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~ChannelsRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processCheckUsername(RpcProcessingContext &context);
@@ -109,46 +110,53 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLChannelsCheckUsername m_checkUsername;
-    TLFunctions::TLChannelsCreateChannel m_createChannel;
-    TLFunctions::TLChannelsDeleteChannel m_deleteChannel;
-    TLFunctions::TLChannelsDeleteHistory m_deleteHistory;
-    TLFunctions::TLChannelsDeleteMessages m_deleteMessages;
-    TLFunctions::TLChannelsDeleteUserHistory m_deleteUserHistory;
-    TLFunctions::TLChannelsEditAbout m_editAbout;
-    TLFunctions::TLChannelsEditAdmin m_editAdmin;
-    TLFunctions::TLChannelsEditBanned m_editBanned;
-    TLFunctions::TLChannelsEditPhoto m_editPhoto;
-    TLFunctions::TLChannelsEditTitle m_editTitle;
-    TLFunctions::TLChannelsExportInvite m_exportInvite;
-    TLFunctions::TLChannelsExportMessageLink m_exportMessageLink;
-    TLFunctions::TLChannelsGetAdminLog m_getAdminLog;
-    TLFunctions::TLChannelsGetAdminedPublicChannels m_getAdminedPublicChannels;
-    TLFunctions::TLChannelsGetChannels m_getChannels;
-    TLFunctions::TLChannelsGetFullChannel m_getFullChannel;
-    TLFunctions::TLChannelsGetMessages m_getMessages;
-    TLFunctions::TLChannelsGetParticipant m_getParticipant;
-    TLFunctions::TLChannelsGetParticipants m_getParticipants;
-    TLFunctions::TLChannelsInviteToChannel m_inviteToChannel;
-    TLFunctions::TLChannelsJoinChannel m_joinChannel;
-    TLFunctions::TLChannelsLeaveChannel m_leaveChannel;
-    TLFunctions::TLChannelsReadHistory m_readHistory;
-    TLFunctions::TLChannelsReadMessageContents m_readMessageContents;
-    TLFunctions::TLChannelsReportSpam m_reportSpam;
-    TLFunctions::TLChannelsSetStickers m_setStickers;
-    TLFunctions::TLChannelsToggleInvites m_toggleInvites;
-    TLFunctions::TLChannelsTogglePreHistoryHidden m_togglePreHistoryHidden;
-    TLFunctions::TLChannelsToggleSignatures m_toggleSignatures;
-    TLFunctions::TLChannelsUpdatePinnedMessage m_updatePinnedMessage;
-    TLFunctions::TLChannelsUpdateUsername m_updateUsername;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLChannelsCheckUsername m_checkUsername;
+        TLFunctions::TLChannelsCreateChannel m_createChannel;
+        TLFunctions::TLChannelsDeleteChannel m_deleteChannel;
+        TLFunctions::TLChannelsDeleteHistory m_deleteHistory;
+        TLFunctions::TLChannelsDeleteMessages m_deleteMessages;
+        TLFunctions::TLChannelsDeleteUserHistory m_deleteUserHistory;
+        TLFunctions::TLChannelsEditAbout m_editAbout;
+        TLFunctions::TLChannelsEditAdmin m_editAdmin;
+        TLFunctions::TLChannelsEditBanned m_editBanned;
+        TLFunctions::TLChannelsEditPhoto m_editPhoto;
+        TLFunctions::TLChannelsEditTitle m_editTitle;
+        TLFunctions::TLChannelsExportInvite m_exportInvite;
+        TLFunctions::TLChannelsExportMessageLink m_exportMessageLink;
+        TLFunctions::TLChannelsGetAdminLog m_getAdminLog;
+        TLFunctions::TLChannelsGetAdminedPublicChannels m_getAdminedPublicChannels;
+        TLFunctions::TLChannelsGetChannels m_getChannels;
+        TLFunctions::TLChannelsGetFullChannel m_getFullChannel;
+        TLFunctions::TLChannelsGetMessages m_getMessages;
+        TLFunctions::TLChannelsGetParticipant m_getParticipant;
+        TLFunctions::TLChannelsGetParticipants m_getParticipants;
+        TLFunctions::TLChannelsInviteToChannel m_inviteToChannel;
+        TLFunctions::TLChannelsJoinChannel m_joinChannel;
+        TLFunctions::TLChannelsLeaveChannel m_leaveChannel;
+        TLFunctions::TLChannelsReadHistory m_readHistory;
+        TLFunctions::TLChannelsReadMessageContents m_readMessageContents;
+        TLFunctions::TLChannelsReportSpam m_reportSpam;
+        TLFunctions::TLChannelsSetStickers m_setStickers;
+        TLFunctions::TLChannelsToggleInvites m_toggleInvites;
+        TLFunctions::TLChannelsTogglePreHistoryHidden m_togglePreHistoryHidden;
+        TLFunctions::TLChannelsToggleSignatures m_toggleSignatures;
+        TLFunctions::TLChannelsUpdatePinnedMessage m_updatePinnedMessage;
+        TLFunctions::TLChannelsUpdateUsername m_updateUsername;
+        // End of generated RPC members
+    };
 };
 
 class ChannelsOperationFactory : public RpcOperationFactory
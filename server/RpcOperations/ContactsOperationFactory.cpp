@@ -44,105 +44,105 @@ namespace Server {
 bool ContactsRpcOperation::processBlock(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runBlock);
-    context.inputStream() >> m_block;
+    context.inputStream() >> constructArguments(&m_block);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processDeleteContact(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runDeleteContact);
-    context.inputStream() >> m_deleteContact;
+    context.inputStream() >> constructArguments(&m_deleteContact);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processDeleteContacts(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runDeleteContacts);
-    context.inputStream() >> m_deleteContacts;
+    context.inputStream() >> constructArguments(&m_deleteContacts);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processExportCard(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runExportCard);
-    context.inputStream() >> m_exportCard;
+    context.inputStream() >> constructArguments(&m_exportCard);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processGetBlocked(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runGetBlocked);
-    context.inputStream() >> m_getBlocked;
+    context.inputStream() >> constructArguments(&m_getBlocked);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processGetContacts(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runGetContacts);
-    context.inputStream() >> m_getContacts;
+    context.inputStream() >> constructArguments(&m_getContacts);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processGetStatuses(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runGetStatuses);
-    context.inputStream() >> m_getStatuses;
+    context.inputStream() >> constructArguments(&m_getStatuses);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processGetTopPeers(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runGetTopPeers);
-    context.inputStream() >> m_getTopPeers;
+    context.inputStream() >> constructArguments(&m_getTopPeers);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processImportCard(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runImportCard);
-    context.inputStream() >> m_importCard;
+    context.inputStream() >> constructArguments(&m_importCard);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processImportContacts(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runImportContacts);
-    context.inputStream() >> m_importContacts;
+    context.inputStream() >> constructArguments(&m_importContacts);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processResetSaved(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runResetSaved);
-    context.inputStream() >> m_resetSaved;
+    context.inputStream() >> constructArguments(&m_resetSaved);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processResetTopPeerRating(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runResetTopPeerRating);
-    context.inputStream() >> m_resetTopPeerRating;
+    context.inputStream() >> constructArguments(&m_resetTopPeerRating);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processResolveUsername(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runResolveUsername);
-    context.inputStream() >> m_resolveUsername;
+    context.inputStream() >> constructArguments(&m_resolveUsername);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processSearch(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runSearch);
-    context.inputStream() >> m_search;
+    context.inputStream() >> constructArguments(&m_search);
     return !context.inputStream().error();
 }
 
 bool ContactsRpcOperation::processUnblock(RpcProcessingContext &context)
 {
     setRunMethod(&ContactsRpcOperation::runUnblock);
-    context.inputStream() >> m_unblock;
+    context.inputStream() >> constructArguments(&m_unblock);
     return !context.inputStream().error();
 }
 // End of generated process methods
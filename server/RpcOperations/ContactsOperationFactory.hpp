@@ -33,6 +33,7 @@ class ContactsRpcOperation : public RpcOperation
     Q_DISABLE_COPY(ContactsRpcOperation)
 public:
     explicit ContactsRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~ContactsRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processBlock(RpcProcessingContext &context);
@@ -75,29 +76,36 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLContactsBlock m_block;
-    TLFunctions::TLContactsDeleteContact m_deleteContact;
-    TLFunctions::TLContactsDeleteContacts m_deleteContacts;
-    TLFunctions::TLContactsExportCard m_exportCard;
-    TLFunctions::TLContactsGetBlocked m_getBlocked;
-    TLFunctions::TLContactsGetContacts m_getContacts;
-    TLFunctions::TLContactsGetStatuses m_getStatuses;
-    TLFunctions::TLContactsGetTopPeers m_getTopPeers;
-    TLFunctions::TLContactsImportCard m_importCard;
-    TLFunctions::TLContactsImportContacts m_importContacts;
-    TLFunctions::TLContactsResetSaved m_resetSaved;
-    TLFunctions::TLContactsResetTopPeerRating m_resetTopPeerRating;
-    TLFunctions::TLContactsResolveUsername m_resolveUsername;
-    TLFunctions::TLContactsSearch m_search;
-    TLFunctions::TLContactsUnblock m_unblock;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLContactsBlock m_block;
+        TLFunctions::TLContactsDeleteContact m_deleteContact;
+        TLFunctions::TLContactsDeleteContacts m_deleteContacts;
+        TLFunctions::TLContactsExportCard m_exportCard;
+        TLFunctions::TLContactsGetBlocked m_getBlocked;
+        TLFunctions::TLContactsGetContacts m_getContacts;
+        TLFunctions::TLContactsGetStatuses m_getStatuses;
+        TLFunctions::TLContactsGetTopPeers m_getTopPeers;
+        TLFunctions::TLContactsImportCard m_importCard;
+        TLFunctions::TLContactsImportContacts m_importContacts;
+        TLFunctions::TLContactsResetSaved m_resetSaved;
+        TLFunctions::TLContactsResetTopPeerRating m_resetTopPeerRating;
+        TLFunctions::TLContactsResolveUsername m_resolveUsername;
+        TLFunctions::TLContactsSearch m_search;
+        TLFunctions::TLContactsUnblock m_unblock;
+        // End of generated RPC members
+    };
 };
 
 class ContactsOperationFactory : public RpcOperationFactory
@@ -42,77 +42,77 @@ namespace Server {
 bool HelpRpcOperation::processGetAppChangelog(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetAppChangelog);
-    context.inputStream() >> m_getAppChangelog;
+    context.inputStream() >> constructArguments(&m_getAppChangelog);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetAppUpdate(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetAppUpdate);
-    context.inputStream() >> m_getAppUpdate;
+    context.inputStream() >> constructArguments(&m_getAppUpdate);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetCdnConfig(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetCdnConfig);
-    context.inputStream() >> m_getCdnConfig;
+    context.inputStream() >> constructArguments(&m_getCdnConfig);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetConfig(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetConfig);
-    context.inputStream() >> m_getConfig;
+    context.inputStream() >> constructArguments(&m_getConfig);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetInviteText(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetInviteText);
-    context.inputStream() >> m_getInviteText;
+    context.inputStream() >> constructArguments(&m_getInviteText);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetNearestDc(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetNearestDc);
-    context.inputStream() >> m_getNearestDc;
+    context.inputStream() >> constructArguments(&m_getNearestDc);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetRecentMeUrls(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetRecentMeUrls);
-    context.inputStream() >> m_getRecentMeUrls;
+    context.inputStream() >> constructArguments(&m_getRecentMeUrls);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetSupport(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetSupport);
-    context.inputStream() >> m_getSupport;
+    context.inputStream() >> constructArguments(&m_getSupport);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processGetTermsOfService(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runGetTermsOfService);
-    context.inputStream() >> m_getTermsOfService;
+    context.inputStream() >> constructArguments(&m_getTermsOfService);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processSaveAppLog(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runSaveAppLog);
-    context.inputStream() >> m_saveAppLog;
+    context.inputStream() >> constructArguments(&m_saveAppLog);
     return !context.inputStream().error();
 }
 
 bool HelpRpcOperation::processSetBotUpdatesStatus(RpcProcessingContext &context)
 {
     setRunMethod(&HelpRpcOperation::runSetBotUpdatesStatus);
-    context.inputStream() >> m_setBotUpdatesStatus;
+    context.inputStream() >> constructArguments(&m_setBotUpdatesStatus);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -33,6 +33,7 @@ class HelpRpcOperation : public RpcOperation
     Q_DISABLE_COPY(HelpRpcOperation)
 public:
     explicit HelpRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~HelpRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processGetAppChangelog(RpcProcessingContext &context);
@@ -67,25 +68,32 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLHelpGetAppChangelog m_getAppChangelog;
-    TLFunctions::TLHelpGetAppUpdate m_getAppUpdate;
-    TLFunctions::TLHelpGetCdnConfig m_getCdnConfig;
-    TLFunctions::TLHelpGetConfig m_getConfig;
-    TLFunctions::TLHelpGetInviteText m_getInviteText;
-    TLFunctions::TLHelpGetNearestDc m_getNearestDc;
-    TLFunctions::TLHelpGetRecentMeUrls m_getRecentMeUrls;
-    TLFunctions::TLHelpGetSupport m_getSupport;
-    TLFunctions::TLHelpGetTermsOfService m_getTermsOfService;
-    TLFunctions::TLHelpSaveAppLog m_saveAppLog;
-    TLFunctions::TLHelpSetBotUpdatesStatus m_setBotUpdatesStatus;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLHelpGetAppChangelog m_getAppChangelog;
+        TLFunctions::TLHelpGetAppUpdate m_getAppUpdate;
+        TLFunctions::TLHelpGetCdnConfig m_getCdnConfig;
+        TLFunctions::TLHelpGetConfig m_getConfig;
+        TLFunctions::TLHelpGetInviteText m_getInviteText;
+        TLFunctions::TLHelpGetNearestDc m_getNearestDc;
+        TLFunctions::TLHelpGetRecentMeUrls m_getRecentMeUrls;
+        TLFunctions::TLHelpGetSupport m_getSupport;
+        TLFunctions::TLHelpGetTermsOfService m_getTermsOfService;
+        TLFunctions::TLHelpSaveAppLog m_saveAppLog;
+        TLFunctions::TLHelpSetBotUpdatesStatus m_setBotUpdatesStatus;
+        // End of generated RPC members
+    };
 };
 
 class HelpOperationFactory : public RpcOperationFactory
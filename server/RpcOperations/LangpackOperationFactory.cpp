@@ -42,28 +42,28 @@ namespace Server {
 bool LangpackRpcOperation::processGetDifference(RpcProcessingContext &context)
 {
     setRunMethod(&LangpackRpcOperation::runGetDifference);
-    context.inputStream() >> m_getDifference;
+    context.inputStream() >> constructArguments(&m_getDifference);
     return !context.inputStream().error();
 }
 
 bool LangpackRpcOperation::processGetLangPack(RpcProcessingContext &context)
 {
     setRunMethod(&LangpackRpcOperation::runGetLangPack);
-    context.inputStream() >> m_getLangPack;
+    context.inputStream() >> constructArguments(&m_getLangPack);
     return !context.inputStream().error();
 }
 
 bool LangpackRpcOperation::processGetLanguages(RpcProcessingContext &context)
 {
     setRunMethod(&LangpackRpcOperation::runGetLanguages);
-    context.inputStream() >> m_getLanguages;
+    context.inputStream() >> constructArguments(&m_getLanguages);
     return !context.inputStream().error();
 }
 
 bool LangpackRpcOperation::processGetStrings(RpcProcessingContext &context)
 {
     setRunMethod(&LangpackRpcOperation::runGetStrings);
-    context.inputStream() >> m_getStrings;
+    context.inputStream() >> constructArguments(&m_getStrings);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -33,6 +33,7 @@ class LangpackRpcOperation : public RpcOperation
     Q_DISABLE_COPY(LangpackRpcOperation)
 public:
     explicit LangpackRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~LangpackRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processGetDifference(RpcProcessingContext &context);
@@ -53,17 +54,24 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLLangpackGetDifference m_getDifference;
-    TLFunctions::TLLangpackGetLangPack m_getLangPack;
-    TLFunctions::TLLangpackGetLanguages m_getLanguages;
-    TLFunctions::TLLangpackGetStrings m_getStrings;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLLangpackGetDifference m_getDifference;
+        TLFunctions::TLLangpackGetLangPack m_getLangPack;
+        TLFunctions::TLLangpackGetLanguages m_getLanguages;
+        TLFunctions::TLLangpackGetStrings m_getStrings;
+        // End of generated RPC members
+    };
 };
 
 class LangpackOperationFactory : public RpcOperationFactory
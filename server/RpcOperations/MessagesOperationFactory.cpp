@@ -49,644 +49,644 @@ namespace Server {
 bool MessagesRpcOperation::processAcceptEncryption(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runAcceptEncryption);
-    context.inputStream() >> m_acceptEncryption;
+    context.inputStream() >> constructArguments(&m_acceptEncryption);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processAddChatUser(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runAddChatUser);
-    context.inputStream() >> m_addChatUser;
+    context.inputStream() >> constructArguments(&m_addChatUser);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processCheckChatInvite(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runCheckChatInvite);
-    context.inputStream() >> m_checkChatInvite;
+    context.inputStream() >> constructArguments(&m_checkChatInvite);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processClearRecentStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runClearRecentStickers);
-    context.inputStream() >> m_clearRecentStickers;
+    context.inputStream() >> constructArguments(&m_clearRecentStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processCreateChat(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runCreateChat);
-    context.inputStream() >> m_createChat;
+    context.inputStream() >> constructArguments(&m_createChat);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processDeleteChatUser(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runDeleteChatUser);
-    context.inputStream() >> m_deleteChatUser;
+    context.inputStream() >> constructArguments(&m_deleteChatUser);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processDeleteHistory(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runDeleteHistory);
-    context.inputStream() >> m_deleteHistory;
+    context.inputStream() >> constructArguments(&m_deleteHistory);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processDeleteMessages(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runDeleteMessages);
-    context.inputStream() >> m_deleteMessages;
+    context.inputStream() >> constructArguments(&m_deleteMessages);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processDiscardEncryption(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runDiscardEncryption);
-    context.inputStream() >> m_discardEncryption;
+    context.inputStream() >> constructArguments(&m_discardEncryption);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processEditChatAdmin(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runEditChatAdmin);
-    context.inputStream() >> m_editChatAdmin;
+    context.inputStream() >> constructArguments(&m_editChatAdmin);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processEditChatPhoto(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runEditChatPhoto);
-    context.inputStream() >> m_editChatPhoto;
+    context.inputStream() >> constructArguments(&m_editChatPhoto);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processEditChatTitle(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runEditChatTitle);
-    context.inputStream() >> m_editChatTitle;
+    context.inputStream() >> constructArguments(&m_editChatTitle);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processEditInlineBotMessage(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runEditInlineBotMessage);
-    context.inputStream() >> m_editInlineBotMessage;
+    context.inputStream() >> constructArguments(&m_editInlineBotMessage);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processEditMessage(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runEditMessage);
-    context.inputStream() >> m_editMessage;
+    context.inputStream() >> constructArguments(&m_editMessage);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processExportChatInvite(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runExportChatInvite);
-    context.inputStream() >> m_exportChatInvite;
+    context.inputStream() >> constructArguments(&m_exportChatInvite);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processFaveSticker(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runFaveSticker);
-    context.inputStream() >> m_faveSticker;
+    context.inputStream() >> constructArguments(&m_faveSticker);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processForwardMessage(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runForwardMessage);
-    context.inputStream() >> m_forwardMessage;
+    context.inputStream() >> constructArguments(&m_forwardMessage);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processForwardMessages(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runForwardMessages);
-    context.inputStream() >> m_forwardMessages;
+    context.inputStream() >> constructArguments(&m_forwardMessages);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetAllChats(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetAllChats);
-    context.inputStream() >> m_getAllChats;
+    context.inputStream() >> constructArguments(&m_getAllChats);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetAllDrafts(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetAllDrafts);
-    context.inputStream() >> m_getAllDrafts;
+    context.inputStream() >> constructArguments(&m_getAllDrafts);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetAllStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetAllStickers);
-    context.inputStream() >> m_getAllStickers;
+    context.inputStream() >> constructArguments(&m_getAllStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetArchivedStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetArchivedStickers);
-    context.inputStream() >> m_getArchivedStickers;
+    context.inputStream() >> constructArguments(&m_getArchivedStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetAttachedStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetAttachedStickers);
-    context.inputStream() >> m_getAttachedStickers;
+    context.inputStream() >> constructArguments(&m_getAttachedStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetBotCallbackAnswer(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetBotCallbackAnswer);
-    context.inputStream() >> m_getBotCallbackAnswer;
+    context.inputStream() >> constructArguments(&m_getBotCallbackAnswer);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetChats(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetChats);
-    context.inputStream() >> m_getChats;
+    context.inputStream() >> constructArguments(&m_getChats);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetCommonChats(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetCommonChats);
-    context.inputStream() >> m_getCommonChats;
+    context.inputStream() >> constructArguments(&m_getCommonChats);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetDhConfig(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetDhConfig);
-    context.inputStream() >> m_getDhConfig;
+    context.inputStream() >> constructArguments(&m_getDhConfig);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetDialogs(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetDialogs);
-    context.inputStream() >> m_getDialogs;
+    context.inputStream() >> constructArguments(&m_getDialogs);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetDocumentByHash(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetDocumentByHash);
-    context.inputStream() >> m_getDocumentByHash;
+    context.inputStream() >> constructArguments(&m_getDocumentByHash);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetFavedStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetFavedStickers);
-    context.inputStream() >> m_getFavedStickers;
+    context.inputStream() >> constructArguments(&m_getFavedStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetFeaturedStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetFeaturedStickers);
-    context.inputStream() >> m_getFeaturedStickers;
+    context.inputStream() >> constructArguments(&m_getFeaturedStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetFullChat(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetFullChat);
-    context.inputStream() >> m_getFullChat;
+    context.inputStream() >> constructArguments(&m_getFullChat);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetGameHighScores(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetGameHighScores);
-    context.inputStream() >> m_getGameHighScores;
+    context.inputStream() >> constructArguments(&m_getGameHighScores);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetHistory(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetHistory);
-    context.inputStream() >> m_getHistory;
+    context.inputStream() >> constructArguments(&m_getHistory);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetInlineBotResults(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetInlineBotResults);
-    context.inputStream() >> m_getInlineBotResults;
+    context.inputStream() >> constructArguments(&m_getInlineBotResults);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetInlineGameHighScores(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetInlineGameHighScores);
-    context.inputStream() >> m_getInlineGameHighScores;
+    context.inputStream() >> constructArguments(&m_getInlineGameHighScores);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetMaskStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetMaskStickers);
-    context.inputStream() >> m_getMaskStickers;
+    context.inputStream() >> constructArguments(&m_getMaskStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetMessageEditData(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetMessageEditData);
-    context.inputStream() >> m_getMessageEditData;
+    context.inputStream() >> constructArguments(&m_getMessageEditData);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetMessages(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetMessages);
-    context.inputStream() >> m_getMessages;
+    context.inputStream() >> constructArguments(&m_getMessages);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetMessagesViews(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetMessagesViews);
-    context.inputStream() >> m_getMessagesViews;
+    context.inputStream() >> constructArguments(&m_getMessagesViews);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetPeerDialogs(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetPeerDialogs);
-    context.inputStream() >> m_getPeerDialogs;
+    context.inputStream() >> constructArguments(&m_getPeerDialogs);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetPeerSettings(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetPeerSettings);
-    context.inputStream() >> m_getPeerSettings;
+    context.inputStream() >> constructArguments(&m_getPeerSettings);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetPinnedDialogs(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetPinnedDialogs);
-    context.inputStream() >> m_getPinnedDialogs;
+    context.inputStream() >> constructArguments(&m_getPinnedDialogs);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetRecentLocations(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetRecentLocations);
-    context.inputStream() >> m_getRecentLocations;
+    context.inputStream() >> constructArguments(&m_getRecentLocations);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetRecentStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetRecentStickers);
-    context.inputStream() >> m_getRecentStickers;
+    context.inputStream() >> constructArguments(&m_getRecentStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetSavedGifs(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetSavedGifs);
-    context.inputStream() >> m_getSavedGifs;
+    context.inputStream() >> constructArguments(&m_getSavedGifs);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetStickerSet(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetStickerSet);
-    context.inputStream() >> m_getStickerSet;
+    context.inputStream() >> constructArguments(&m_getStickerSet);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetUnreadMentions(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetUnreadMentions);
-    context.inputStream() >> m_getUnreadMentions;
+    context.inputStream() >> constructArguments(&m_getUnreadMentions);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetWebPage(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetWebPage);
-    context.inputStream() >> m_getWebPage;
+    context.inputStream() >> constructArguments(&m_getWebPage);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processGetWebPagePreview(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runGetWebPagePreview);
-    context.inputStream() >> m_getWebPagePreview;
+    context.inputStream() >> constructArguments(&m_getWebPagePreview);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processHideReportSpam(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runHideReportSpam);
-    context.inputStream() >> m_hideReportSpam;
+    context.inputStream() >> constructArguments(&m_hideReportSpam);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processImportChatInvite(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runImportChatInvite);
-    context.inputStream() >> m_importChatInvite;
+    context.inputStream() >> constructArguments(&m_importChatInvite);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processInstallStickerSet(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runInstallStickerSet);
-    context.inputStream() >> m_installStickerSet;
+    context.inputStream() >> constructArguments(&m_installStickerSet);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processMigrateChat(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runMigrateChat);
-    context.inputStream() >> m_migrateChat;
+    context.inputStream() >> constructArguments(&m_migrateChat);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReadEncryptedHistory(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReadEncryptedHistory);
-    context.inputStream() >> m_readEncryptedHistory;
+    context.inputStream() >> constructArguments(&m_readEncryptedHistory);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReadFeaturedStickers(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReadFeaturedStickers);
-    context.inputStream() >> m_readFeaturedStickers;
+    context.inputStream() >> constructArguments(&m_readFeaturedStickers);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReadHistory(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReadHistory);
-    context.inputStream() >> m_readHistory;
+    context.inputStream() >> constructArguments(&m_readHistory);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReadMentions(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReadMentions);
-    context.inputStream() >> m_readMentions;
+    context.inputStream() >> constructArguments(&m_readMentions);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReadMessageContents(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReadMessageContents);
-    context.inputStream() >> m_readMessageContents;
+    context.inputStream() >> constructArguments(&m_readMessageContents);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReceivedMessages(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReceivedMessages);
-    context.inputStream() >> m_receivedMessages;
+    context.inputStream() >> constructArguments(&m_receivedMessages);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReceivedQueue(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReceivedQueue);
-    context.inputStream() >> m_receivedQueue;
+    context.inputStream() >> constructArguments(&m_receivedQueue);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReorderPinnedDialogs(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReorderPinnedDialogs);
-    context.inputStream() >> m_reorderPinnedDialogs;
+    context.inputStream() >> constructArguments(&m_reorderPinnedDialogs);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReorderStickerSets(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReorderStickerSets);
-    context.inputStream() >> m_reorderStickerSets;
+    context.inputStream() >> constructArguments(&m_reorderStickerSets);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReportEncryptedSpam(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReportEncryptedSpam);
-    context.inputStream() >> m_reportEncryptedSpam;
+    context.inputStream() >> constructArguments(&m_reportEncryptedSpam);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processReportSpam(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runReportSpam);
-    context.inputStream() >> m_reportSpam;
+    context.inputStream() >> constructArguments(&m_reportSpam);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processRequestEncryption(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runRequestEncryption);
-    context.inputStream() >> m_requestEncryption;
+    context.inputStream() >> constructArguments(&m_requestEncryption);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSaveDraft(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSaveDraft);
-    context.inputStream() >> m_saveDraft;
+    context.inputStream() >> constructArguments(&m_saveDraft);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSaveGif(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSaveGif);
-    context.inputStream() >> m_saveGif;
+    context.inputStream() >> constructArguments(&m_saveGif);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSaveRecentSticker(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSaveRecentSticker);
-    context.inputStream() >> m_saveRecentSticker;
+    context.inputStream() >> constructArguments(&m_saveRecentSticker);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSearch(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSearch);
-    context.inputStream() >> m_search;
+    context.inputStream() >> constructArguments(&m_search);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSearchGifs(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSearchGifs);
-    context.inputStream() >> m_searchGifs;
+    context.inputStream() >> constructArguments(&m_searchGifs);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSearchGlobal(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSearchGlobal);
-    context.inputStream() >> m_searchGlobal;
+    context.inputStream() >> constructArguments(&m_searchGlobal);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendEncrypted(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendEncrypted);
-    context.inputStream() >> m_sendEncrypted;
+    context.inputStream() >> constructArguments(&m_sendEncrypted);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendEncryptedFile(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendEncryptedFile);
-    context.inputStream() >> m_sendEncryptedFile;
+    context.inputStream() >> constructArguments(&m_sendEncryptedFile);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendEncryptedService(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendEncryptedService);
-    context.inputStream() >> m_sendEncryptedService;
+    context.inputStream() >> constructArguments(&m_sendEncryptedService);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendInlineBotResult(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendInlineBotResult);
-    context.inputStream() >> m_sendInlineBotResult;
+    context.inputStream() >> constructArguments(&m_sendInlineBotResult);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendMedia(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendMedia);
-    context.inputStream() >> m_sendMedia;
+    context.inputStream() >> constructArguments(&m_sendMedia);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendMessage(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendMessage);
-    context.inputStream() >> m_sendMessage;
+    context.inputStream() >> constructArguments(&m_sendMessage);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSendScreenshotNotification(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSendScreenshotNotification);
-    context.inputStream() >> m_sendScreenshotNotification;
+    context.inputStream() >> constructArguments(&m_sendScreenshotNotification);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetBotCallbackAnswer(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetBotCallbackAnswer);
-    context.inputStream() >> m_setBotCallbackAnswer;
+    context.inputStream() >> constructArguments(&m_setBotCallbackAnswer);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetBotPrecheckoutResults(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetBotPrecheckoutResults);
-    context.inputStream() >> m_setBotPrecheckoutResults;
+    context.inputStream() >> constructArguments(&m_setBotPrecheckoutResults);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetBotShippingResults(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetBotShippingResults);
-    context.inputStream() >> m_setBotShippingResults;
+    context.inputStream() >> constructArguments(&m_setBotShippingResults);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetEncryptedTyping(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetEncryptedTyping);
-    context.inputStream() >> m_setEncryptedTyping;
+    context.inputStream() >> constructArguments(&m_setEncryptedTyping);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetGameScore(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetGameScore);
-    context.inputStream() >> m_setGameScore;
+    context.inputStream() >> constructArguments(&m_setGameScore);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetInlineBotResults(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetInlineBotResults);
-    context.inputStream() >> m_setInlineBotResults;
+    context.inputStream() >> constructArguments(&m_setInlineBotResults);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetInlineGameScore(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetInlineGameScore);
-    context.inputStream() >> m_setInlineGameScore;
+    context.inputStream() >> constructArguments(&m_setInlineGameScore);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processSetTyping(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runSetTyping);
-    context.inputStream() >> m_setTyping;
+    context.inputStream() >> constructArguments(&m_setTyping);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processStartBot(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runStartBot);
-    context.inputStream() >> m_startBot;
+    context.inputStream() >> constructArguments(&m_startBot);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processToggleChatAdmins(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runToggleChatAdmins);
-    context.inputStream() >> m_toggleChatAdmins;
+    context.inputStream() >> constructArguments(&m_toggleChatAdmins);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processToggleDialogPin(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runToggleDialogPin);
-    context.inputStream() >> m_toggleDialogPin;
+    context.inputStream() >> constructArguments(&m_toggleDialogPin);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processUninstallStickerSet(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runUninstallStickerSet);
-    context.inputStream() >> m_uninstallStickerSet;
+    context.inputStream() >> constructArguments(&m_uninstallStickerSet);
     return !context.inputStream().error();
 }
 
 bool MessagesRpcOperation::processUploadMedia(RpcProcessingContext &context)
 {
     setRunMethod(&MessagesRpcOperation::runUploadMedia);
-    context.inputStream() >> m_uploadMedia;
+    context.inputStream() >> constructArguments(&m_uploadMedia);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -1244,11 +1244,31 @@ void MessagesRpcOperation::runGetMessageEditData()
 
 void MessagesRpcOperation::runGetMessages()
 {
-    // TLFunctions::TLMessagesGetMessages &arguments = m_getMessages;
-    if (processNotImplementedMethod(TLValue::MessagesGetMessages)) {
-        return;
-    }
+    TLFunctions::TLMessagesGetMessages &arguments = m_getMessages;
+
+    const LocalUser *self = layer()->getUser();
+    const PostBox *postBox = self->getPostBox();
+
     TLMessagesMessages result;
+    result.messages.reserve(arguments.id.count());
+    for (const quint32 messageId : arguments.id) {
+        const quint64 globalMessageId = postBox->getMessageGlobalId(messageId);
+        if (!globalMessageId) {
+            // It's OK to have no message e.g. for deleted entires
+            continue;
+        }
+        const MessageData *messageData = api()->storage()->getMessage(globalMessageId);
+        if (!messageData) {
+            continue;
+        }
+        TLMessage message;
+        Utils::setupTLMessage(&message, messageData, messageId, self);
+        result.messages.append(message);
+    }
+
+    QSet<Peer> interestingPeers;
+    Utils::getInterestingPeers(&interestingPeers, result.messages);
+    Utils::setupTLPeers(&result, interestingPeers, api(), self);
     sendRpcReply(result);
 }
 
@@ -1460,11 +1480,12 @@ void MessagesRpcOperation::runReadHistory()
     const quint64 globalMessageId = self->getPostBox()->getMessageGlobalId(maxId);
     const MessageData *messageData = api()->storage()->getMessage(globalMessageId);
 
+    // The sender of another DC is not notified (the message is a copy of the sender one)
     LocalUser *messageSender = api()->getUser(messageData->fromId());
-    UserDialog *senderDialog = messageSender->getDialog(messageData->toPeer());
-    quint32 senderMessageId = messageData->getReference(messageSender->toPeer());
+    UserDialog *senderDialog = messageSender ? messageSender->getDialog(messageData->toPeer()) : nullptr;
+    quint32 senderMessageId = messageSender ? messageData->getReference(messageSender->toPeer()) : 0;
 
-    if (senderDialog->readOutboxMaxId < senderMessageId) {
+    if (senderDialog && (senderDialog->readOutboxMaxId < senderMessageId)) {
         // Message sender update needed
         senderDialog->readOutboxMaxId = senderMessageId;
         messageSender->getPostBox()->bumpPts();
@@ -1487,7 +1508,7 @@ void MessagesRpcOperation::runReadHistory()
         api()->queueUpdates({readNotification});
     }
 
-    if (messageSender->hasActiveSession()) {
+    if (messageSender && messageSender->hasActiveSession()) {
         UpdateNotification readNotification;
         readNotification.userId = messageSender->userId();
         readNotification.type = UpdateNotification::Type::ReadOutbox;
@@ -1621,11 +1642,95 @@ void MessagesRpcOperation::runSaveRecentSticker()
 
 void MessagesRpcOperation::runSearch()
 {
-    // TLFunctions::TLMessagesSearch &arguments = m_search;
-    if (processNotImplementedMethod(TLValue::MessagesSearch)) {
+    TLFunctions::TLMessagesSearch &arguments = m_search;
+    switch (arguments.peer.tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+    case TLValue::InputPeerUser:
+        break;
+    case TLValue::InputPeerChat:
+    case TLValue::InputPeerChannel:
+    default:
+        qCritical() << Q_FUNC_INFO << "Not implemented for requested peer" << arguments.peer.tlType;
+        processNotImplementedMethod(TLValue::MessagesSearch);
+        sendRpcError(RpcError());
+        return;
+    }
+
+    if (arguments.filter.tlType != TLValue::InputMessagesFilterEmpty) {
+        qCritical() << Q_FUNC_INFO << "Not implemented for requested filter" << arguments.filter.tlType;
+        processNotImplementedMethod(TLValue::MessagesSearch);
+        sendRpcError(RpcError());
         return;
     }
+
+    LocalUser *self = layer()->getUser();
+    const Peer peer = api()->getPeer(arguments.peer, self);
+    quint32 fromId = 0;
+    if (arguments.fromId.tlType != TLValue::InputUserEmpty) {
+        const AbstractUser *fromUser = api()->getUser(arguments.fromId, self);
+        if (!fromUser) {
+            sendRpcError(RpcError::UserIdInvalid);
+            return;
+        }
+        fromId = fromUser->id();
+    }
+
+    const PostBox *postBox = self->getPostBox();
+    int maxMessagesToAppend = arguments.limit
+            ? qMin<int>(static_cast<int>(arguments.limit), c_serverHistorySliceLimit)
+            : c_serverHistorySliceLimit;
+
+    // Both offsetId and maxId are exclusive
+    quint32 maxId = arguments.offsetId;
+    if (arguments.maxId && (!maxId || (arguments.maxId < maxId))) {
+        maxId = arguments.maxId;
+    }
+
     TLMessagesMessages result;
+    MessageSearchIndex::Cursor cursor = postBox->searchIndex()->search(arguments.q, peer, maxId);
+
+    // Iterate from newer messages (with bigger id) to older
+    while (maxMessagesToAppend > 0) {
+        const quint32 messageId = cursor.next();
+        if (!messageId || (messageId <= arguments.minId)) {
+            break;
+        }
+
+        const quint64 globalMessageId = postBox->getMessageGlobalId(messageId);
+        const MessageData *messageData = api()->storage()->getMessage(globalMessageId);
+        if (!messageData) {
+            continue;
+        }
+
+        if (arguments.maxDate && (messageData->date() > arguments.maxDate)) {
+            continue;
+        }
+        // The messages are added in the chronological order
+        if (arguments.minDate && (messageData->date() < arguments.minDate)) {
+            break;
+        }
+        if (fromId && (messageData->fromId() != fromId)) {
+            continue;
+        }
+
+        if (arguments.addOffset > 0) {
+            --arguments.addOffset;
+            continue;
+        }
+
+        TLMessage message;
+        Utils::setupTLMessage(&message, messageData, messageId, self);
+        result.messages.append(message);
+        --maxMessagesToAppend;
+    }
+
+    QSet<Peer> interestingPeers;
+    if (peer.isValid()) {
+        interestingPeers.insert(peer);
+    }
+    Utils::getInterestingPeers(&interestingPeers, result.messages);
+    Utils::setupTLPeers(&result, interestingPeers, api(), self);
     sendRpcReply(result);
 }
 
@@ -1937,14 +2042,14 @@ void MessagesRpcOperation::submitMessageData(MessageData *messageData, quint64 r
     newMessageUpdate.pts = selfNotification->pts;
     newMessageUpdate.ptsCount = 1;
 
-    Utils::setupTLMessage(&newMessageUpdate.message, messageData, selfNotification->messageId, fromUser);
+    Utils::setupTLMessage(&*newMessageUpdate.message, messageData, selfNotification->messageId, fromUser);
 
     const Peer targetPeer = messageData->toPeer();
 
     QSet<Peer> interestingPeers;
     interestingPeers.insert(targetPeer);
-    if ((fromUser->toPeer() != targetPeer) && newMessageUpdate.message.fromId) {
-        interestingPeers.insert(Peer::fromUserId(newMessageUpdate.message.fromId));
+    if ((fromUser->toPeer() != targetPeer) && newMessageUpdate.message->fromId) {
+        interestingPeers.insert(Peer::fromUserId(newMessageUpdate.message->fromId));
     }
 
     // Bake updates
@@ -35,6 +35,7 @@ class MessagesRpcOperation : public RpcOperation
     Q_DISABLE_COPY(MessagesRpcOperation)
 public:
     explicit MessagesRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~MessagesRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processAcceptEncryption(RpcProcessingContext &context);
@@ -231,7 +232,11 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
@@ -239,100 +244,103 @@ protected:
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLMessagesAcceptEncryption m_acceptEncryption;
-    TLFunctions::TLMessagesAddChatUser m_addChatUser;
-    TLFunctions::TLMessagesCheckChatInvite m_checkChatInvite;
-    TLFunctions::TLMessagesClearRecentStickers m_clearRecentStickers;
-    TLFunctions::TLMessagesCreateChat m_createChat;
-    TLFunctions::TLMessagesDeleteChatUser m_deleteChatUser;
-    TLFunctions::TLMessagesDeleteHistory m_deleteHistory;
-    TLFunctions::TLMessagesDeleteMessages m_deleteMessages;
-    TLFunctions::TLMessagesDiscardEncryption m_discardEncryption;
-    TLFunctions::TLMessagesEditChatAdmin m_editChatAdmin;
-    TLFunctions::TLMessagesEditChatPhoto m_editChatPhoto;
-    TLFunctions::TLMessagesEditChatTitle m_editChatTitle;
-    TLFunctions::TLMessagesEditInlineBotMessage m_editInlineBotMessage;
-    TLFunctions::TLMessagesEditMessage m_editMessage;
-    TLFunctions::TLMessagesExportChatInvite m_exportChatInvite;
-    TLFunctions::TLMessagesFaveSticker m_faveSticker;
-    TLFunctions::TLMessagesForwardMessage m_forwardMessage;
-    TLFunctions::TLMessagesForwardMessages m_forwardMessages;
-    TLFunctions::TLMessagesGetAllChats m_getAllChats;
-    TLFunctions::TLMessagesGetAllDrafts m_getAllDrafts;
-    TLFunctions::TLMessagesGetAllStickers m_getAllStickers;
-    TLFunctions::TLMessagesGetArchivedStickers m_getArchivedStickers;
-    TLFunctions::TLMessagesGetAttachedStickers m_getAttachedStickers;
-    TLFunctions::TLMessagesGetBotCallbackAnswer m_getBotCallbackAnswer;
-    TLFunctions::TLMessagesGetChats m_getChats;
-    TLFunctions::TLMessagesGetCommonChats m_getCommonChats;
-    TLFunctions::TLMessagesGetDhConfig m_getDhConfig;
-    TLFunctions::TLMessagesGetDialogs m_getDialogs;
-    TLFunctions::TLMessagesGetDocumentByHash m_getDocumentByHash;
-    TLFunctions::TLMessagesGetFavedStickers m_getFavedStickers;
-    TLFunctions::TLMessagesGetFeaturedStickers m_getFeaturedStickers;
-    TLFunctions::TLMessagesGetFullChat m_getFullChat;
-    TLFunctions::TLMessagesGetGameHighScores m_getGameHighScores;
-    TLFunctions::TLMessagesGetHistory m_getHistory;
-    TLFunctions::TLMessagesGetInlineBotResults m_getInlineBotResults;
-    TLFunctions::TLMessagesGetInlineGameHighScores m_getInlineGameHighScores;
-    TLFunctions::TLMessagesGetMaskStickers m_getMaskStickers;
-    TLFunctions::TLMessagesGetMessageEditData m_getMessageEditData;
-    TLFunctions::TLMessagesGetMessages m_getMessages;
-    TLFunctions::TLMessagesGetMessagesViews m_getMessagesViews;
-    TLFunctions::TLMessagesGetPeerDialogs m_getPeerDialogs;
-    TLFunctions::TLMessagesGetPeerSettings m_getPeerSettings;
-    TLFunctions::TLMessagesGetPinnedDialogs m_getPinnedDialogs;
-    TLFunctions::TLMessagesGetRecentLocations m_getRecentLocations;
-    TLFunctions::TLMessagesGetRecentStickers m_getRecentStickers;
-    TLFunctions::TLMessagesGetSavedGifs m_getSavedGifs;
-    TLFunctions::TLMessagesGetStickerSet m_getStickerSet;
-    TLFunctions::TLMessagesGetUnreadMentions m_getUnreadMentions;
-    TLFunctions::TLMessagesGetWebPage m_getWebPage;
-    TLFunctions::TLMessagesGetWebPagePreview m_getWebPagePreview;
-    TLFunctions::TLMessagesHideReportSpam m_hideReportSpam;
-    TLFunctions::TLMessagesImportChatInvite m_importChatInvite;
-    TLFunctions::TLMessagesInstallStickerSet m_installStickerSet;
-    TLFunctions::TLMessagesMigrateChat m_migrateChat;
-    TLFunctions::TLMessagesReadEncryptedHistory m_readEncryptedHistory;
-    TLFunctions::TLMessagesReadFeaturedStickers m_readFeaturedStickers;
-    TLFunctions::TLMessagesReadHistory m_readHistory;
-    TLFunctions::TLMessagesReadMentions m_readMentions;
-    TLFunctions::TLMessagesReadMessageContents m_readMessageContents;
-    TLFunctions::TLMessagesReceivedMessages m_receivedMessages;
-    TLFunctions::TLMessagesReceivedQueue m_receivedQueue;
-    TLFunctions::TLMessagesReorderPinnedDialogs m_reorderPinnedDialogs;
-    TLFunctions::TLMessagesReorderStickerSets m_reorderStickerSets;
-    TLFunctions::TLMessagesReportEncryptedSpam m_reportEncryptedSpam;
-    TLFunctions::TLMessagesReportSpam m_reportSpam;
-    TLFunctions::TLMessagesRequestEncryption m_requestEncryption;
-    TLFunctions::TLMessagesSaveDraft m_saveDraft;
-    TLFunctions::TLMessagesSaveGif m_saveGif;
-    TLFunctions::TLMessagesSaveRecentSticker m_saveRecentSticker;
-    TLFunctions::TLMessagesSearch m_search;
-    TLFunctions::TLMessagesSearchGifs m_searchGifs;
-    TLFunctions::TLMessagesSearchGlobal m_searchGlobal;
-    TLFunctions::TLMessagesSendEncrypted m_sendEncrypted;
-    TLFunctions::TLMessagesSendEncryptedFile m_sendEncryptedFile;
-    TLFunctions::TLMessagesSendEncryptedService m_sendEncryptedService;
-    TLFunctions::TLMessagesSendInlineBotResult m_sendInlineBotResult;
-    TLFunctions::TLMessagesSendMedia m_sendMedia;
-    TLFunctions::TLMessagesSendMessage m_sendMessage;
-    TLFunctions::TLMessagesSendScreenshotNotification m_sendScreenshotNotification;
-    TLFunctions::TLMessagesSetBotCallbackAnswer m_setBotCallbackAnswer;
-    TLFunctions::TLMessagesSetBotPrecheckoutResults m_setBotPrecheckoutResults;
-    TLFunctions::TLMessagesSetBotShippingResults m_setBotShippingResults;
-    TLFunctions::TLMessagesSetEncryptedTyping m_setEncryptedTyping;
-    TLFunctions::TLMessagesSetGameScore m_setGameScore;
-    TLFunctions::TLMessagesSetInlineBotResults m_setInlineBotResults;
-    TLFunctions::TLMessagesSetInlineGameScore m_setInlineGameScore;
-    TLFunctions::TLMessagesSetTyping m_setTyping;
-    TLFunctions::TLMessagesStartBot m_startBot;
-    TLFunctions::TLMessagesToggleChatAdmins m_toggleChatAdmins;
-    TLFunctions::TLMessagesToggleDialogPin m_toggleDialogPin;
-    TLFunctions::TLMessagesUninstallStickerSet m_uninstallStickerSet;
-    TLFunctions::TLMessagesUploadMedia m_uploadMedia;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLMessagesAcceptEncryption m_acceptEncryption;
+        TLFunctions::TLMessagesAddChatUser m_addChatUser;
+        TLFunctions::TLMessagesCheckChatInvite m_checkChatInvite;
+        TLFunctions::TLMessagesClearRecentStickers m_clearRecentStickers;
+        TLFunctions::TLMessagesCreateChat m_createChat;
+        TLFunctions::TLMessagesDeleteChatUser m_deleteChatUser;
+        TLFunctions::TLMessagesDeleteHistory m_deleteHistory;
+        TLFunctions::TLMessagesDeleteMessages m_deleteMessages;
+        TLFunctions::TLMessagesDiscardEncryption m_discardEncryption;
+        TLFunctions::TLMessagesEditChatAdmin m_editChatAdmin;
+        TLFunctions::TLMessagesEditChatPhoto m_editChatPhoto;
+        TLFunctions::TLMessagesEditChatTitle m_editChatTitle;
+        TLFunctions::TLMessagesEditInlineBotMessage m_editInlineBotMessage;
+        TLFunctions::TLMessagesEditMessage m_editMessage;
+        TLFunctions::TLMessagesExportChatInvite m_exportChatInvite;
+        TLFunctions::TLMessagesFaveSticker m_faveSticker;
+        TLFunctions::TLMessagesForwardMessage m_forwardMessage;
+        TLFunctions::TLMessagesForwardMessages m_forwardMessages;
+        TLFunctions::TLMessagesGetAllChats m_getAllChats;
+        TLFunctions::TLMessagesGetAllDrafts m_getAllDrafts;
+        TLFunctions::TLMessagesGetAllStickers m_getAllStickers;
+        TLFunctions::TLMessagesGetArchivedStickers m_getArchivedStickers;
+        TLFunctions::TLMessagesGetAttachedStickers m_getAttachedStickers;
+        TLFunctions::TLMessagesGetBotCallbackAnswer m_getBotCallbackAnswer;
+        TLFunctions::TLMessagesGetChats m_getChats;
+        TLFunctions::TLMessagesGetCommonChats m_getCommonChats;
+        TLFunctions::TLMessagesGetDhConfig m_getDhConfig;
+        TLFunctions::TLMessagesGetDialogs m_getDialogs;
+        TLFunctions::TLMessagesGetDocumentByHash m_getDocumentByHash;
+        TLFunctions::TLMessagesGetFavedStickers m_getFavedStickers;
+        TLFunctions::TLMessagesGetFeaturedStickers m_getFeaturedStickers;
+        TLFunctions::TLMessagesGetFullChat m_getFullChat;
+        TLFunctions::TLMessagesGetGameHighScores m_getGameHighScores;
+        TLFunctions::TLMessagesGetHistory m_getHistory;
+        TLFunctions::TLMessagesGetInlineBotResults m_getInlineBotResults;
+        TLFunctions::TLMessagesGetInlineGameHighScores m_getInlineGameHighScores;
+        TLFunctions::TLMessagesGetMaskStickers m_getMaskStickers;
+        TLFunctions::TLMessagesGetMessageEditData m_getMessageEditData;
+        TLFunctions::TLMessagesGetMessages m_getMessages;
+        TLFunctions::TLMessagesGetMessagesViews m_getMessagesViews;
+        TLFunctions::TLMessagesGetPeerDialogs m_getPeerDialogs;
+        TLFunctions::TLMessagesGetPeerSettings m_getPeerSettings;
+        TLFunctions::TLMessagesGetPinnedDialogs m_getPinnedDialogs;
+        TLFunctions::TLMessagesGetRecentLocations m_getRecentLocations;
+        TLFunctions::TLMessagesGetRecentStickers m_getRecentStickers;
+        TLFunctions::TLMessagesGetSavedGifs m_getSavedGifs;
+        TLFunctions::TLMessagesGetStickerSet m_getStickerSet;
+        TLFunctions::TLMessagesGetUnreadMentions m_getUnreadMentions;
+        TLFunctions::TLMessagesGetWebPage m_getWebPage;
+        TLFunctions::TLMessagesGetWebPagePreview m_getWebPagePreview;
+        TLFunctions::TLMessagesHideReportSpam m_hideReportSpam;
+        TLFunctions::TLMessagesImportChatInvite m_importChatInvite;
+        TLFunctions::TLMessagesInstallStickerSet m_installStickerSet;
+        TLFunctions::TLMessagesMigrateChat m_migrateChat;
+        TLFunctions::TLMessagesReadEncryptedHistory m_readEncryptedHistory;
+        TLFunctions::TLMessagesReadFeaturedStickers m_readFeaturedStickers;
+        TLFunctions::TLMessagesReadHistory m_readHistory;
+        TLFunctions::TLMessagesReadMentions m_readMentions;
+        TLFunctions::TLMessagesReadMessageContents m_readMessageContents;
+        TLFunctions::TLMessagesReceivedMessages m_receivedMessages;
+        TLFunctions::TLMessagesReceivedQueue m_receivedQueue;
+        TLFunctions::TLMessagesReorderPinnedDialogs m_reorderPinnedDialogs;
+        TLFunctions::TLMessagesReorderStickerSets m_reorderStickerSets;
+        TLFunctions::TLMessagesReportEncryptedSpam m_reportEncryptedSpam;
+        TLFunctions::TLMessagesReportSpam m_reportSpam;
+        TLFunctions::TLMessagesRequestEncryption m_requestEncryption;
+        TLFunctions::TLMessagesSaveDraft m_saveDraft;
+        TLFunctions::TLMessagesSaveGif m_saveGif;
+        TLFunctions::TLMessagesSaveRecentSticker m_saveRecentSticker;
+        TLFunctions::TLMessagesSearch m_search;
+        TLFunctions::TLMessagesSearchGifs m_searchGifs;
+        TLFunctions::TLMessagesSearchGlobal m_searchGlobal;
+        TLFunctions::TLMessagesSendEncrypted m_sendEncrypted;
+        TLFunctions::TLMessagesSendEncryptedFile m_sendEncryptedFile;
+        TLFunctions::TLMessagesSendEncryptedService m_sendEncryptedService;
+        TLFunctions::TLMessagesSendInlineBotResult m_sendInlineBotResult;
+        TLFunctions::TLMessagesSendMedia m_sendMedia;
+        TLFunctions::TLMessagesSendMessage m_sendMessage;
+        TLFunctions::TLMessagesSendScreenshotNotification m_sendScreenshotNotification;
+        TLFunctions::TLMessagesSetBotCallbackAnswer m_setBotCallbackAnswer;
+        TLFunctions::TLMessagesSetBotPrecheckoutResults m_setBotPrecheckoutResults;
+        TLFunctions::TLMessagesSetBotShippingResults m_setBotShippingResults;
+        TLFunctions::TLMessagesSetEncryptedTyping m_setEncryptedTyping;
+        TLFunctions::TLMessagesSetGameScore m_setGameScore;
+        TLFunctions::TLMessagesSetInlineBotResults m_setInlineBotResults;
+        TLFunctions::TLMessagesSetInlineGameScore m_setInlineGameScore;
+        TLFunctions::TLMessagesSetTyping m_setTyping;
+        TLFunctions::TLMessagesStartBot m_startBot;
+        TLFunctions::TLMessagesToggleChatAdmins m_toggleChatAdmins;
+        TLFunctions::TLMessagesToggleDialogPin m_toggleDialogPin;
+        TLFunctions::TLMessagesUninstallStickerSet m_uninstallStickerSet;
+        TLFunctions::TLMessagesUploadMedia m_uploadMedia;
+        // End of generated RPC members
+    };
 };
 
 class MessagesOperationFactory : public RpcOperationFactory
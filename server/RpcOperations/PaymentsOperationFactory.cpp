@@ -42,42 +42,42 @@ namespace Server {
 bool PaymentsRpcOperation::processClearSavedInfo(RpcProcessingContext &context)
 {
     setRunMethod(&PaymentsRpcOperation::runClearSavedInfo);
-    context.inputStream() >> m_clearSavedInfo;
+    context.inputStream() >> constructArguments(&m_clearSavedInfo);
     return !context.inputStream().error();
 }
 
 bool PaymentsRpcOperation::processGetPaymentForm(RpcProcessingContext &context)
 {
     setRunMethod(&PaymentsRpcOperation::runGetPaymentForm);
-    context.inputStream() >> m_getPaymentForm;
+    context.inputStream() >> constructArguments(&m_getPaymentForm);
     return !context.inputStream().error();
 }
 
 bool PaymentsRpcOperation::processGetPaymentReceipt(RpcProcessingContext &context)
 {
     setRunMethod(&PaymentsRpcOperation::runGetPaymentReceipt);
-    context.inputStream() >> m_getPaymentReceipt;
+    context.inputStream() >> constructArguments(&m_getPaymentReceipt);
     return !context.inputStream().error();
 }
 
 bool PaymentsRpcOperation::processGetSavedInfo(RpcProcessingContext &context)
 {
     setRunMethod(&PaymentsRpcOperation::runGetSavedInfo);
-    context.inputStream() >> m_getSavedInfo;
+    context.inputStream() >> constructArguments(&m_getSavedInfo);
     return !context.inputStream().error();
 }
 
 bool PaymentsRpcOperation::processSendPaymentForm(RpcProcessingContext &context)
 {
     setRunMethod(&PaymentsRpcOperation::runSendPaymentForm);
-    context.inputStream() >> m_sendPaymentForm;
+    context.inputStream() >> constructArguments(&m_sendPaymentForm);
     return !context.inputStream().error();
 }
 
 bool PaymentsRpcOperation::processValidateRequestedInfo(RpcProcessingContext &context)
 {
     setRunMethod(&PaymentsRpcOperation::runValidateRequestedInfo);
-    context.inputStream() >> m_validateRequestedInfo;
+    context.inputStream() >> constructArguments(&m_validateRequestedInfo);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -33,6 +33,7 @@ class PaymentsRpcOperation : public RpcOperation
     Q_DISABLE_COPY(PaymentsRpcOperation)
 public:
     explicit PaymentsRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~PaymentsRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processClearSavedInfo(RpcProcessingContext &context);
@@ -57,20 +58,27 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLPaymentsClearSavedInfo m_clearSavedInfo;
-    TLFunctions::TLPaymentsGetPaymentForm m_getPaymentForm;
-    TLFunctions::TLPaymentsGetPaymentReceipt m_getPaymentReceipt;
-    TLFunctions::TLPaymentsGetSavedInfo m_getSavedInfo;
-    TLFunctions::TLPaymentsSendPaymentForm m_sendPaymentForm;
-    TLFunctions::TLPaymentsValidateRequestedInfo m_validateRequestedInfo;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLPaymentsClearSavedInfo m_clearSavedInfo;
+        TLFunctions::TLPaymentsGetPaymentForm m_getPaymentForm;
+        TLFunctions::TLPaymentsGetPaymentReceipt m_getPaymentReceipt;
+        TLFunctions::TLPaymentsGetSavedInfo m_getSavedInfo;
+        TLFunctions::TLPaymentsSendPaymentForm m_sendPaymentForm;
+        TLFunctions::TLPaymentsValidateRequestedInfo m_validateRequestedInfo;
+        // End of generated RPC members
+    };
 };
 
 class PaymentsOperationFactory : public RpcOperationFactory
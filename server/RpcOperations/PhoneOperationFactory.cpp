@@ -42,56 +42,56 @@ namespace Server {
 bool PhoneRpcOperation::processAcceptCall(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runAcceptCall);
-    context.inputStream() >> m_acceptCall;
+    context.inputStream() >> constructArguments(&m_acceptCall);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processConfirmCall(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runConfirmCall);
-    context.inputStream() >> m_confirmCall;
+    context.inputStream() >> constructArguments(&m_confirmCall);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processDiscardCall(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runDiscardCall);
-    context.inputStream() >> m_discardCall;
+    context.inputStream() >> constructArguments(&m_discardCall);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processGetCallConfig(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runGetCallConfig);
-    context.inputStream() >> m_getCallConfig;
+    context.inputStream() >> constructArguments(&m_getCallConfig);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processReceivedCall(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runReceivedCall);
-    context.inputStream() >> m_receivedCall;
+    context.inputStream() >> constructArguments(&m_receivedCall);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processRequestCall(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runRequestCall);
-    context.inputStream() >> m_requestCall;
+    context.inputStream() >> constructArguments(&m_requestCall);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processSaveCallDebug(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runSaveCallDebug);
-    context.inputStream() >> m_saveCallDebug;
+    context.inputStream() >> constructArguments(&m_saveCallDebug);
     return !context.inputStream().error();
 }
 
 bool PhoneRpcOperation::processSetCallRating(RpcProcessingContext &context)
 {
     setRunMethod(&PhoneRpcOperation::runSetCallRating);
-    context.inputStream() >> m_setCallRating;
+    context.inputStream() >> constructArguments(&m_setCallRating);
     return !context.inputStream().error();
 }
 // End of generated process methods
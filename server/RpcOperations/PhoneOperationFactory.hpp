@@ -33,6 +33,7 @@ class PhoneRpcOperation : public RpcOperation
     Q_DISABLE_COPY(PhoneRpcOperation)
 public:
     explicit PhoneRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~PhoneRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processAcceptCall(RpcProcessingContext &context);
@@ -61,22 +62,29 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLPhoneAcceptCall m_acceptCall;
-    TLFunctions::TLPhoneConfirmCall m_confirmCall;
-    TLFunctions::TLPhoneDiscardCall m_discardCall;
-    TLFunctions::TLPhoneGetCallConfig m_getCallConfig;
-    TLFunctions::TLPhoneReceivedCall m_receivedCall;
-    TLFunctions::TLPhoneRequestCall m_requestCall;
-    TLFunctions::TLPhoneSaveCallDebug m_saveCallDebug;
-    TLFunctions::TLPhoneSetCallRating m_setCallRating;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLPhoneAcceptCall m_acceptCall;
+        TLFunctions::TLPhoneConfirmCall m_confirmCall;
+        TLFunctions::TLPhoneDiscardCall m_discardCall;
+        TLFunctions::TLPhoneGetCallConfig m_getCallConfig;
+        TLFunctions::TLPhoneReceivedCall m_receivedCall;
+        TLFunctions::TLPhoneRequestCall m_requestCall;
+        TLFunctions::TLPhoneSaveCallDebug m_saveCallDebug;
+        TLFunctions::TLPhoneSetCallRating m_setCallRating;
+        // End of generated RPC members
+    };
 };
 
 class PhoneOperationFactory : public RpcOperationFactory
@@ -44,28 +44,28 @@ namespace Server {
 bool PhotosRpcOperation::processDeletePhotos(RpcProcessingContext &context)
 {
     setRunMethod(&PhotosRpcOperation::runDeletePhotos);
-    context.inputStream() >> m_deletePhotos;
+    context.inputStream() >> constructArguments(&m_deletePhotos);
     return !context.inputStream().error();
 }
 
 bool PhotosRpcOperation::processGetUserPhotos(RpcProcessingContext &context)
 {
     setRunMethod(&PhotosRpcOperation::runGetUserPhotos);
-    context.inputStream() >> m_getUserPhotos;
+    context.inputStream() >> constructArguments(&m_getUserPhotos);
     return !context.inputStream().error();
 }
 
 bool PhotosRpcOperation::processUpdateProfilePhoto(RpcProcessingContext &context)
 {
     setRunMethod(&PhotosRpcOperation::runUpdateProfilePhoto);
-    context.inputStream() >> m_updateProfilePhoto;
+    context.inputStream() >> constructArguments(&m_updateProfilePhoto);
     return !context.inputStream().error();
 }
 
 bool PhotosRpcOperation::processUploadProfilePhoto(RpcProcessingContext &context)
 {
     setRunMethod(&PhotosRpcOperation::runUploadProfilePhoto);
-    context.inputStream() >> m_uploadProfilePhoto;
+    context.inputStream() >> constructArguments(&m_uploadProfilePhoto);
     return !context.inputStream().error();
 }
 // End of generated process methods
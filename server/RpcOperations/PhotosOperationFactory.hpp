@@ -33,6 +33,7 @@ class PhotosRpcOperation : public RpcOperation
     Q_DISABLE_COPY(PhotosRpcOperation)
 public:
     explicit PhotosRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~PhotosRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processDeletePhotos(RpcProcessingContext &context);
@@ -53,18 +54,25 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLPhotosDeletePhotos m_deletePhotos;
-    TLFunctions::TLPhotosGetUserPhotos m_getUserPhotos;
-    TLFunctions::TLPhotosUpdateProfilePhoto m_updateProfilePhoto;
-    TLFunctions::TLPhotosUploadProfilePhoto m_uploadProfilePhoto;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLPhotosDeletePhotos m_deletePhotos;
+        TLFunctions::TLPhotosGetUserPhotos m_getUserPhotos;
+        TLFunctions::TLPhotosUpdateProfilePhoto m_updateProfilePhoto;
+        TLFunctions::TLPhotosUploadProfilePhoto m_uploadProfilePhoto;
+        // End of generated RPC members
+    };
 };
 
 class PhotosOperationFactory : public RpcOperationFactory
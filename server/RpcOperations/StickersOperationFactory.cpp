@@ -42,28 +42,28 @@ namespace Server {
 bool StickersRpcOperation::processAddStickerToSet(RpcProcessingContext &context)
 {
     setRunMethod(&StickersRpcOperation::runAddStickerToSet);
-    context.inputStream() >> m_addStickerToSet;
+    context.inputStream() >> constructArguments(&m_addStickerToSet);
     return !context.inputStream().error();
 }
 
 bool StickersRpcOperation::processChangeStickerPosition(RpcProcessingContext &context)
 {
     setRunMethod(&StickersRpcOperation::runChangeStickerPosition);
-    context.inputStream() >> m_changeStickerPosition;
+    context.inputStream() >> constructArguments(&m_changeStickerPosition);
     return !context.inputStream().error();
 }
 
 bool StickersRpcOperation::processCreateStickerSet(RpcProcessingContext &context)
 {
     setRunMethod(&StickersRpcOperation::runCreateStickerSet);
-    context.inputStream() >> m_createStickerSet;
+    context.inputStream() >> constructArguments(&m_createStickerSet);
     return !context.inputStream().error();
 }
 
 bool StickersRpcOperation::processRemoveStickerFromSet(RpcProcessingContext &context)
 {
     setRunMethod(&StickersRpcOperation::runRemoveStickerFromSet);
-    context.inputStream() >> m_removeStickerFromSet;
+    context.inputStream() >> constructArguments(&m_removeStickerFromSet);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -33,6 +33,7 @@ class StickersRpcOperation : public RpcOperation
     Q_DISABLE_COPY(StickersRpcOperation)
 public:
     explicit StickersRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~StickersRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processAddStickerToSet(RpcProcessingContext &context);
@@ -53,18 +54,25 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLStickersAddStickerToSet m_addStickerToSet;
-    TLFunctions::TLStickersChangeStickerPosition m_changeStickerPosition;
-    TLFunctions::TLStickersCreateStickerSet m_createStickerSet;
-    TLFunctions::TLStickersRemoveStickerFromSet m_removeStickerFromSet;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLStickersAddStickerToSet m_addStickerToSet;
+        TLFunctions::TLStickersChangeStickerPosition m_changeStickerPosition;
+        TLFunctions::TLStickersCreateStickerSet m_createStickerSet;
+        TLFunctions::TLStickersRemoveStickerFromSet m_removeStickerFromSet;
+        // End of generated RPC members
+    };
 };
 
 class StickersOperationFactory : public RpcOperationFactory
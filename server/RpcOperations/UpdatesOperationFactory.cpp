@@ -17,13 +17,16 @@
 
 #include "UpdatesOperationFactory.hpp"
 
+#include "ApiUtils.hpp"
 #include "RpcOperationFactory_p.hpp"
 // TODO: Instead of this include, add a generated cpp with all needed template instances
 #include "ServerRpcOperation_p.hpp"
 
 #include "ServerApi.hpp"
+#include "ServerMessageData.hpp"
 #include "ServerRpcLayer.hpp"
 #include "ServerUtils.hpp"
+#include "Storage.hpp"
 #include "TelegramServerUser.hpp"
 
 #include "Debug_p.hpp"
@@ -35,6 +38,9 @@
 
 #include <QLoggingCategory>
 
+// Keep the difference replies small enough for the outbound limits of slow clients
+constexpr int c_serverDifferenceSliceLimit = 30;
+
 namespace Telegram {
 
 namespace Server {
@@ -43,21 +49,21 @@ namespace Server {
 bool UpdatesRpcOperation::processGetChannelDifference(RpcProcessingContext &context)
 {
     setRunMethod(&UpdatesRpcOperation::runGetChannelDifference);
-    context.inputStream() >> m_getChannelDifference;
+    context.inputStream() >> constructArguments(&m_getChannelDifference);
     return !context.inputStream().error();
 }
 
 bool UpdatesRpcOperation::processGetDifference(RpcProcessingContext &context)
 {
     setRunMethod(&UpdatesRpcOperation::runGetDifference);
-    context.inputStream() >> m_getDifference;
+    context.inputStream() >> constructArguments(&m_getDifference);
     return !context.inputStream().error();
 }
 
 bool UpdatesRpcOperation::processGetState(RpcProcessingContext &context)
 {
     setRunMethod(&UpdatesRpcOperation::runGetState);
-    context.inputStream() >> m_getState;
+    context.inputStream() >> constructArguments(&m_getState);
     return !context.inputStream().error();
 }
 // End of generated process methods
@@ -75,11 +81,55 @@ void UpdatesRpcOperation::runGetChannelDifference()
 
 void UpdatesRpcOperation::runGetDifference()
 {
-    // TLFunctions::TLUpdatesGetDifference &arguments = m_getDifference;
-    if (processNotImplementedMethod(TLValue::UpdatesGetDifference)) {
+    TLFunctions::TLUpdatesGetDifference &arguments = m_getDifference;
+
+    const LocalUser *self = layer()->getUser();
+    const PostBox *postBox = self->getPostBox();
+
+    TLUpdatesDifference result;
+    const quint32 firstMessageId = postBox->getFirstMessageIdAfterPts(arguments.pts);
+    if (!firstMessageId) {
+        result.tlType = TLValue::UpdatesDifferenceEmpty;
+        result.date = Telegram::Utils::getCurrentTime();
+        result.seq = 1; // FIXME
+        sendRpcReply(result);
         return;
     }
-    TLUpdatesDifference result;
+
+    int limit = c_serverDifferenceSliceLimit;
+    if ((arguments.flags & 1 << 0) && arguments.ptsTotalLimit) {
+        limit = qMin<int>(limit, static_cast<int>(arguments.ptsTotalLimit));
+    }
+
+    quint32 messageId = firstMessageId;
+    for (; (messageId <= postBox->lastMessageId()) && (result.newMessages.count() < limit); ++messageId) {
+        const quint64 globalMessageId = postBox->getMessageGlobalId(messageId);
+        if (!globalMessageId) {
+            // It's OK to have no message e.g. for deleted entires
+            continue;
+        }
+        const MessageData *messageData = api()->storage()->getMessage(globalMessageId);
+        if (!messageData) {
+            continue;
+        }
+        TLMessage message;
+        Utils::setupTLMessage(&message, messageData, messageId, self);
+        result.newMessages.append(message);
+    }
+
+    if (messageId <= postBox->lastMessageId()) {
+        // The state up to the last returned message
+        result.tlType = TLValue::UpdatesDifferenceSlice;
+        Utils::setupTLUpdatesState(&result.intermediateState, self);
+        result.intermediateState.pts = postBox->getMessagePts(messageId - 1);
+    } else {
+        result.tlType = TLValue::UpdatesDifference;
+        Utils::setupTLUpdatesState(&result.state, self);
+    }
+
+    QSet<Peer> interestingPeers;
+    Utils::getInterestingPeers(&interestingPeers, result.newMessages);
+    Utils::setupTLPeers(&result, interestingPeers, api(), self);
     sendRpcReply(result);
 }
 
@@ -33,6 +33,7 @@ class UpdatesRpcOperation : public RpcOperation
     Q_DISABLE_COPY(UpdatesRpcOperation)
 public:
     explicit UpdatesRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~UpdatesRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processGetChannelDifference(RpcProcessingContext &context);
@@ -51,17 +52,24 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLUpdatesGetChannelDifference m_getChannelDifference;
-    TLFunctions::TLUpdatesGetDifference m_getDifference;
-    TLFunctions::TLUpdatesGetState m_getState;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLUpdatesGetChannelDifference m_getChannelDifference;
+        TLFunctions::TLUpdatesGetDifference m_getDifference;
+        TLFunctions::TLUpdatesGetState m_getState;
+        // End of generated RPC members
+    };
 };
 
 class UpdatesOperationFactory : public RpcOperationFactory
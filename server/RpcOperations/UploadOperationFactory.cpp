@@ -45,49 +45,49 @@ namespace Server {
 bool UploadRpcOperation::processGetCdnFile(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runGetCdnFile);
-    context.inputStream() >> m_getCdnFile;
+    context.inputStream() >> constructArguments(&m_getCdnFile);
     return !context.inputStream().error();
 }
 
 bool UploadRpcOperation::processGetCdnFileHashes(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runGetCdnFileHashes);
-    context.inputStream() >> m_getCdnFileHashes;
+    context.inputStream() >> constructArguments(&m_getCdnFileHashes);
     return !context.inputStream().error();
 }
 
 bool UploadRpcOperation::processGetFile(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runGetFile);
-    context.inputStream() >> m_getFile;
+    context.inputStream() >> constructArguments(&m_getFile);
     return !context.inputStream().error();
 }
 
 bool UploadRpcOperation::processGetWebFile(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runGetWebFile);
-    context.inputStream() >> m_getWebFile;
+    context.inputStream() >> constructArguments(&m_getWebFile);
     return !context.inputStream().error();
 }
 
 bool UploadRpcOperation::processReuploadCdnFile(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runReuploadCdnFile);
-    context.inputStream() >> m_reuploadCdnFile;
+    context.inputStream() >> constructArguments(&m_reuploadCdnFile);
     return !context.inputStream().error();
 }
 
 bool UploadRpcOperation::processSaveBigFilePart(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runSaveBigFilePart);
-    context.inputStream() >> m_saveBigFilePart;
+    context.inputStream() >> constructArguments(&m_saveBigFilePart);
     return !context.inputStream().error();
 }
 
 bool UploadRpcOperation::processSaveFilePart(RpcProcessingContext &context)
 {
     setRunMethod(&UploadRpcOperation::runSaveFilePart);
-    context.inputStream() >> m_saveFilePart;
+    context.inputStream() >> constructArguments(&m_saveFilePart);
     return !context.inputStream().error();
 }
 // End of generated process methods
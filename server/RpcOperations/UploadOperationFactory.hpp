@@ -33,6 +33,7 @@ class UploadRpcOperation : public RpcOperation
     Q_DISABLE_COPY(UploadRpcOperation)
 public:
     explicit UploadRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~UploadRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processGetCdnFile(RpcProcessingContext &context);
@@ -59,21 +60,28 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLUploadGetCdnFile m_getCdnFile;
-    TLFunctions::TLUploadGetCdnFileHashes m_getCdnFileHashes;
-    TLFunctions::TLUploadGetFile m_getFile;
-    TLFunctions::TLUploadGetWebFile m_getWebFile;
-    TLFunctions::TLUploadReuploadCdnFile m_reuploadCdnFile;
-    TLFunctions::TLUploadSaveBigFilePart m_saveBigFilePart;
-    TLFunctions::TLUploadSaveFilePart m_saveFilePart;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLUploadGetCdnFile m_getCdnFile;
+        TLFunctions::TLUploadGetCdnFileHashes m_getCdnFileHashes;
+        TLFunctions::TLUploadGetFile m_getFile;
+        TLFunctions::TLUploadGetWebFile m_getWebFile;
+        TLFunctions::TLUploadReuploadCdnFile m_reuploadCdnFile;
+        TLFunctions::TLUploadSaveBigFilePart m_saveBigFilePart;
+        TLFunctions::TLUploadSaveFilePart m_saveFilePart;
+        // End of generated RPC members
+    };
 };
 
 class UploadOperationFactory : public RpcOperationFactory
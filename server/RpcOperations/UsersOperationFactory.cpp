@@ -43,14 +43,14 @@ namespace Server {
 bool UsersRpcOperation::processGetFullUser(RpcProcessingContext &context)
 {
     setRunMethod(&UsersRpcOperation::runGetFullUser);
-    context.inputStream() >> m_getFullUser;
+    context.inputStream() >> constructArguments(&m_getFullUser);
     return !context.inputStream().error();
 }
 
 bool UsersRpcOperation::processGetUsers(RpcProcessingContext &context)
 {
     setRunMethod(&UsersRpcOperation::runGetUsers);
-    context.inputStream() >> m_getUsers;
+    context.inputStream() >> constructArguments(&m_getUsers);
     return !context.inputStream().error();
 }
 // End of generated process methods
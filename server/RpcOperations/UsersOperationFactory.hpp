@@ -33,6 +33,7 @@ class UsersRpcOperation : public RpcOperation
     Q_DISABLE_COPY(UsersRpcOperation)
 public:
     explicit UsersRpcOperation(RpcLayer *rpcLayer) : RpcOperation(rpcLayer) { }
+    ~UsersRpcOperation() override { destroyArguments(); }
 
     // Generated process methods
     bool processGetFullUser(RpcProcessingContext &context);
@@ -49,16 +50,23 @@ public:
     static ProcessingMethod getMethodForRpcFunction(TLValue function);
 
 protected:
-    void startImplementation() override { callMember<>(this, m_runMethod); }
+    void startImplementation() override
+    {
+        callMember<>(this, m_runMethod);
+        recycle();
+    }
 
     void setRunMethod(RunMethod method);
 
     RunMethod m_runMethod = nullptr;
 
-    // Generated RPC members
-    TLFunctions::TLUsersGetFullUser m_getFullUser;
-    TLFunctions::TLUsersGetUsers m_getUsers;
-    // End of generated RPC members
+    // Arguments of the processed function
+    union {
+        // Generated RPC members
+        TLFunctions::TLUsersGetFullUser m_getFullUser;
+        TLFunctions::TLUsersGetUsers m_getUsers;
+        // End of generated RPC members
+    };
 };
 
 class UsersOperationFactory : public RpcOperationFactory
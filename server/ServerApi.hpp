@@ -92,6 +92,8 @@ public:
     virtual LocalUser *getUser(const QString &identifier) const = 0;
     virtual LocalUser *getUser(quint32 userId) const = 0;
     virtual Peer peerByUserName(const QString &userName) const = 0;
+    // Returns false if the username is taken by another user
+    virtual bool setUserName(LocalUser *user, const QString &newUserName) = 0;
     virtual AbstractUser *getUser(const TLInputUser &inputUser, LocalUser *self) const = 0;
     virtual AbstractUser *tryAccessUser(quint32 userId, quint64 accessHash, LocalUser *applicant) const = 0;
 
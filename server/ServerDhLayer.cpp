@@ -17,34 +17,56 @@
 
 #include "ServerDhLayer.hpp"
 
+#include "DhExponentPool.hpp"
 #include "CTelegramStream.hpp"
 #include "CTelegramTransport.hpp"
 #include "Utils.hpp"
 #include "RandomGenerator.hpp"
 #include "SendPackageHelper.hpp"
+#include "ServerMetrics.hpp"
+#include "SslBigNumber.hpp"
 #include "Debug_p.hpp"
 
 #include <QDateTime>
+#include <QFutureWatcher>
 #include <QLoggingCategory>
+#include <QThreadPool>
+#include <QtConcurrentRun>
 #include <QtEndian>
 
 Q_LOGGING_CATEGORY(c_serverDhLayerCategory, "telegram.server.dhlayer", QtInfoMsg)
 
-static const QByteArray c_hardcodedDhPrime =
-        QByteArray::fromHex(QByteArrayLiteral(
-                                "c71caeb9c6b1c9048e6c522f70f13f73980d40238e3e21c14934d037563d930f"
-                                "48198a0aa7c14058229493d22530f4dbfa336f6e0ac925139543aed44cce7c37"
-                                "20fd51f69458705ac68cd4fe6b6b13abdc9746512969328454f18faf8c595f64"
-                                "2477fe96bb2a941d5bcd1d4ac8cc49880708fa9b378e3c4f3a9060bee67cf9a4"
-                                "a4a695811051907e162753b56b0f6b410dba74d8a84b2a14b3144e0ef1284754"
-                                "fd17ed950d5965b4b9dd46582db1178d169c6bc465b0d6ff9ca3928fef5b9ae4"
-                                "e418fc15e83ebea0f87fa9ff5eed70050ded2849f47bf959d956850ce929851f"
-                                "0d8115f635b105ee2e4e15d04b2454bf6f4fadf034b10403119cd8e3b92fcc5b"));
-
 namespace Telegram {
 
 namespace Server {
 
+struct DhParamsJobResult
+{
+    QByteArray decryptedPackage;
+    QByteArray gA;
+};
+
+template <typename Result, typename Job, typename Continuation>
+void DhLayer::runCryptoJob(const Job &job, const Continuation &continuation)
+{
+    m_cryptoJobIsActive = true;
+    if (!m_cryptoThreadPool) {
+        const Result result = job();
+        m_cryptoJobIsActive = false;
+        continuation(result);
+        return;
+    }
+    // The watcher is owned by the layer, so the continuation is dropped
+    // if the connection is gone before the job is finished.
+    QFutureWatcher<Result> *watcher = new QFutureWatcher<Result>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, continuation]() {
+        watcher->deleteLater();
+        m_cryptoJobIsActive = false;
+        continuation(watcher->result());
+    });
+    watcher->setFuture(QtConcurrent::run(m_cryptoThreadPool, job));
+}
+
 DhLayer::DhLayer(QObject *parent) :
     BaseDhLayer(parent)
 {
@@ -58,6 +80,21 @@ void DhLayer::init()
     setState(State::Idle);
 }
 
+void DhLayer::setCryptoThreadPool(QThreadPool *pool)
+{
+    m_cryptoThreadPool = pool;
+}
+
+void DhLayer::setExponentPool(DhExponentPool *pool)
+{
+    m_exponentPool = pool;
+}
+
+void DhLayer::setMetrics(ServerMetrics *metrics)
+{
+    m_metrics = metrics;
+}
+
 bool DhLayer::processRequestPQ(const QByteArray &data)
 {
     CTelegramStream inputStream(data);
@@ -67,6 +104,7 @@ bool DhLayer::processRequestPQ(const QByteArray &data)
     if (value != TLValue::ReqPq) {
         return false;
     }
+    m_handshakeTimer.start();
     qCDebug(c_serverDhLayerCategory) << Q_FUNC_INFO << "Client nonce:" << m_clientNonce;
     return true;
 }
@@ -127,7 +165,41 @@ bool DhLayer::processRequestDHParams(const QByteArray &data)
 
     qCDebug(c_serverDhLayerCategory) << Q_FUNC_INFO << "encrypted:" << encryptedPackage.toHex();
 
-    QByteArray decryptedPackage = Utils::binaryNumberModExp(encryptedPackage, m_rsaKey.modulus, m_rsaKey.secretExponent);
+    m_g = DhExponentPool::generator();
+    m_dhPrime = DhExponentPool::dhPrime();
+
+    // #5 Server computes random 2048-bit number a (using a sufficient amount of entropy)
+    // Take a precomputed (a, g_a) pair if possible and fallback to the computation otherwise.
+    DhExponentPool::Entry exponent;
+    if (!m_exponentPool || !m_exponentPool->takeEntry(&exponent)) {
+        exponent.a = RandomGenerator::instance()->generate(256);
+    }
+    m_a = exponent.a;
+
+#ifdef TELEGRAMQT_DEBUG_REVEAL_SECRETS
+    qCDebug(c_serverDhLayerCategory) << "m_a" << m_a;
+#endif
+
+    const RsaKey key = m_rsaKey;
+    runCryptoJob<DhParamsJobResult>([key, encryptedPackage, exponent]() {
+        DhParamsJobResult result;
+        result.decryptedPackage = Utils::rsaDecrypt(encryptedPackage, key);
+        result.gA = exponent.gA.isEmpty() ? DhExponentPool::computeGA(exponent.a) : exponent.gA;
+        return result;
+    }, [this](const DhParamsJobResult &result) {
+        m_gA = result.gA;
+        if (!processPQInnerData(result.decryptedPackage) || !acceptDhParams()) {
+            setState(State::Failed);
+            return;
+        }
+        setState(State::DhRepliedOK);
+    });
+    return true;
+}
+
+bool DhLayer::processPQInnerData(const QByteArray &decryptedPackageData)
+{
+    QByteArray decryptedPackage = decryptedPackageData;
     constexpr int c_innerPackageSize = 255;
     if (decryptedPackage.size() < c_innerPackageSize) {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 7, 0)
@@ -195,40 +267,15 @@ bool DhLayer::processRequestDHParams(const QByteArray &data)
 bool DhLayer::acceptDhParams()
 {
     qCDebug(c_serverDhLayerCategory) << Q_FUNC_INFO;
-    m_g = 7;
-    m_dhPrime.resize(256);
-    RandomGenerator::instance()->generate(&m_dhPrime);
-    m_dhPrime = c_hardcodedDhPrime;
-
-    //    if ((m_g < 2) || (m_g > 7)) {
-    //        qCDebug(c_serverDhLayerCategory) << "Error: 'g' number is out of acceptable range [2-7].";
-    //        return nullptr;
-    //    }
-
-    //    if (m_dhPrime.length() != 2048 / 8) {
-    //        qCDebug(c_serverDhLayerCategory) << "Error: dhPrime number length is not correct." << m_dhPrime.length() << 2048 / 8;
-    //        return nullptr;
-    //    }
-
-    //    if (!(m_dhPrime.at(0) & 128)) {
-    //        qCDebug(c_serverDhLayerCategory) << "Error: dhPrime is too small.";
-    //        return nullptr;
-    //    }
-
-    // #5 Server computes random 2048-bit number a (using a sufficient amount of entropy)
-    m_a.resize(256);
-    RandomGenerator::instance()->generate(&m_a);
+    if (m_gA.isEmpty()) {
+        qCWarning(c_serverDhLayerCategory) << Q_FUNC_INFO << "g_a is not computed";
+        return false;
+    }
 
     // IMPORTANT: Apart from the conditions on the Diffie-Hellman prime dh_prime and generator g,
     // both sides are to check that g, g_a and g_b are greater than 1 and less than dh_prime - 1.
     // We recommend checking that g_a and g_b are between 2^{2048-64} and dh_prime - 2^{2048-64} as well.
 
-#ifdef TELEGRAMQT_DEBUG_REVEAL_SECRETS
-    qCDebug(c_serverDhLayerCategory) << "m_b" << m_a;
-#endif
-
-    m_gA = Utils::binaryNumberModExp(intToBytes(m_g), m_dhPrime, m_a);
-
     const QByteArray innerData = [this](){
         QByteArray data;
         CTelegramStream stream(&data, /* write */ true);
@@ -313,7 +360,24 @@ bool DhLayer::processSetClientDHParams(const QByteArray &data)
     QByteArray gB;
     encryptedInputStream >> gB;
 
-    const QByteArray newAuthKey = Utils::binaryNumberModExp(gB, m_dhPrime, m_a);
+    const QByteArray a = m_a;
+    runCryptoJob<QByteArray>([gB, a]() {
+        return DhExponentPool::primeContext()->modExp(gB, a);
+    }, [this](const QByteArray &newAuthKey) {
+        if (!acceptClientDHParams(newAuthKey)) {
+            setState(State::Failed);
+            return;
+        }
+        if (m_metrics && m_handshakeTimer.isValid()) {
+            m_metrics->recordHandshake(m_handshakeTimer.nsecsElapsed());
+        }
+        setState(State::HasKey);
+    });
+    return true;
+}
+
+bool DhLayer::acceptClientDHParams(const QByteArray &newAuthKey)
+{
     const QByteArray newAuthKeySha = Utils::sha1(newAuthKey);
 
     // answerDcGenOk
@@ -352,6 +416,12 @@ void DhLayer::processReceivedPacket(const QByteArray &payload)
 {
     const TLValue v = TLValue::firstFromArray(payload);
     qCInfo(c_serverDhLayerCategory) << this << __func__ << v.toString();
+    if (m_cryptoJobIsActive) {
+        qCWarning(c_serverDhLayerCategory) << this << __func__ << "Unexpected packet" << v.toString()
+                                           << "while the previous one is still in processing";
+        setState(State::Failed);
+        return;
+    }
     switch (v) {
     case TLValue::ReqPq:
         if (!processRequestPQ(payload)) {
@@ -362,19 +432,17 @@ void DhLayer::processReceivedPacket(const QByteArray &payload)
         setState(State::PqReplied);
         break;
     case TLValue::ReqDHParams:
+        // The reply is sent (and the state is changed) on the crypto job finished
         if (!processRequestDHParams(payload)) {
             setState(State::Failed);
             return;
         }
-        acceptDhParams();
-        setState(State::DhRepliedOK);
         break;
     case TLValue::SetClientDHParams:
         if (!processSetClientDHParams(payload)) {
             setState(State::Failed);
             return;
         }
-        setState(State::HasKey);
         break;
     default:
         break;
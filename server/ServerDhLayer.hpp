@@ -20,10 +20,17 @@
 
 #include "DhLayer.hpp"
 
+#include <QElapsedTimer>
+
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
+
 namespace Telegram {
 
 namespace Server {
 
+class DhExponentPool;
+class ServerMetrics;
+
 class DhLayer : public Telegram::BaseDhLayer
 {
     Q_OBJECT
@@ -31,19 +38,40 @@ public:
     explicit DhLayer(QObject *parent = nullptr);
     void init() override;
 
+    // RSA decryption and DH exponentiation are offloaded to the pool.
+    // The work is done synchronously if there is no pool set.
+    QThreadPool *cryptoThreadPool() const { return m_cryptoThreadPool; }
+    void setCryptoThreadPool(QThreadPool *pool);
+
+    DhExponentPool *exponentPool() const { return m_exponentPool; }
+    void setExponentPool(DhExponentPool *pool);
+
+    ServerMetrics *metrics() const { return m_metrics; }
+    void setMetrics(ServerMetrics *metrics);
+
     bool processRequestPQ(const QByteArray &data);
     bool sendResultPQ();
     bool processRequestDHParams(const QByteArray &data);
+    bool processPQInnerData(const QByteArray &decryptedPackage);
     bool acceptDhParams();
     bool declineDhParams();
     bool processSetClientDHParams(const QByteArray &data);
+    bool acceptClientDHParams(const QByteArray &newAuthKey);
 
     quint64 sendReplyPackage(const QByteArray &payload);
 
 protected:
     void processReceivedPacket(const QByteArray &payload) override;
 
+    template <typename Result, typename Job, typename Continuation>
+    void runCryptoJob(const Job &job, const Continuation &continuation);
+
     QByteArray m_a;
+    QThreadPool *m_cryptoThreadPool = nullptr;
+    DhExponentPool *m_exponentPool = nullptr;
+    ServerMetrics *m_metrics = nullptr;
+    QElapsedTimer m_handshakeTimer; // Started on req_pq
+    bool m_cryptoJobIsActive = false;
 };
 
 } // Server namespace
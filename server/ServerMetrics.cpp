@@ -0,0 +1,350 @@
+#include "ServerMetrics.hpp"
+
+#include <QtAlgorithms>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Telegram {
+
+namespace Server {
+
+constexpr int LatencyHistogram::c_subBucketBits;
+constexpr int LatencyHistogram::c_subBucketCount;
+constexpr int LatencyHistogram::c_maxValueBits;
+constexpr int LatencyHistogram::c_bucketCount;
+constexpr int ServerMetrics::c_rpcSlotCount;
+
+// The exported histogram buckets: from about a microsecond to about a minute with a step of x4
+static const int c_exportFirstBucketBits = 10;
+static const int c_exportLastBucketBits = 36;
+static const int c_exportBucketStepBits = 2;
+
+static const char *const c_transportNames[] = { "qt", "epoll" };
+
+static int highestBit(quint64 value)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 6, 0)
+    return 63 - static_cast<int>(qCountLeadingZeroBits(value));
+#else
+    int result = 0;
+    for (int shift = 32; shift; shift >>= 1) {
+        if (value >> shift) {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+#endif
+}
+
+quint64 LatencyHistogram::Snapshot::quantile(double q) const
+{
+    if (!count) {
+        return 0;
+    }
+    const quint64 target = qMax<quint64>(1, static_cast<quint64>(std::ceil(qBound(0.0, q, 1.0) * count)));
+    quint64 accumulated = 0;
+    for (int i = 0; i < buckets.count(); ++i) {
+        accumulated += buckets.at(i);
+        if (accumulated >= target) {
+            const quint64 lowerBound = bucketLowerBound(i);
+            return lowerBound + (bucketUpperBound(i) - lowerBound) / 2;
+        }
+    }
+    return bucketLowerBound(c_bucketCount - 1);
+}
+
+quint64 LatencyHistogram::Snapshot::countBelowPowerOfTwo(int bits) const
+{
+    if (bits >= c_maxValueBits) {
+        return count;
+    }
+    // The powers of two are the bucket bounds
+    const int end = bucketIndex(quint64(1) << bits);
+    quint64 result = 0;
+    for (int i = 0; i < end; ++i) {
+        result += buckets.at(i);
+    }
+    return result;
+}
+
+void LatencyHistogram::record(quint64 value)
+{
+    m_buckets[bucketIndex(value)].fetchAndAddRelaxed(1);
+    m_sum.fetchAndAddRelaxed(value);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    Snapshot result;
+    result.buckets.resize(c_bucketCount);
+    for (int i = 0; i < c_bucketCount; ++i) {
+        const quint64 bucketCount = m_buckets[i].load();
+        result.buckets[i] = bucketCount;
+        result.count += bucketCount;
+    }
+    result.sum = m_sum.load();
+    return result;
+}
+
+int LatencyHistogram::bucketIndex(quint64 value)
+{
+    if (value < c_subBucketCount) {
+        return static_cast<int>(value);
+    }
+    const int bits = highestBit(value);
+    if (bits >= c_maxValueBits) {
+        return c_bucketCount - 1;
+    }
+    const int shift = bits - c_subBucketBits;
+    return (shift + 1) * c_subBucketCount + static_cast<int>((value >> shift) & (c_subBucketCount - 1));
+}
+
+quint64 LatencyHistogram::bucketLowerBound(int index)
+{
+    if (index < c_subBucketCount) {
+        return static_cast<quint64>(index);
+    }
+    const int shift = index / c_subBucketCount - 1;
+    return static_cast<quint64>(c_subBucketCount + index % c_subBucketCount) << shift;
+}
+
+quint64 LatencyHistogram::bucketUpperBound(int index)
+{
+    if (index < c_subBucketCount) {
+        return static_cast<quint64>(index) + 1;
+    }
+    const int shift = index / c_subBucketCount - 1;
+    return bucketLowerBound(index) + (quint64(1) << shift);
+}
+
+ServerMetrics::~ServerMetrics()
+{
+    for (int i = 0; i < c_rpcSlotCount; ++i) {
+        delete m_rpcSlots[i].load();
+    }
+}
+
+void ServerMetrics::recordRpc(TLValue function, qint64 nsecs)
+{
+    LatencyHistogram *histogram = rpcHistogram(function);
+    if (histogram) {
+        histogram->record(static_cast<quint64>(qMax<qint64>(0, nsecs)));
+    }
+}
+
+void ServerMetrics::recordHandshake(qint64 nsecs)
+{
+    m_handshakeDurations.record(static_cast<quint64>(qMax<qint64>(0, nsecs)));
+}
+
+void ServerMetrics::addReceivedPacket(TransportBackend backend, int bytes)
+{
+    AtomicTransportCounters &counters = m_transports[static_cast<int>(backend)];
+    counters.receivedBytes.fetchAndAddRelaxed(static_cast<quint64>(bytes));
+    counters.receivedPackets.fetchAndAddRelaxed(1);
+}
+
+void ServerMetrics::addSentPacket(TransportBackend backend, int bytes)
+{
+    AtomicTransportCounters &counters = m_transports[static_cast<int>(backend)];
+    counters.sentBytes.fetchAndAddRelaxed(static_cast<quint64>(bytes));
+    counters.sentPackets.fetchAndAddRelaxed(1);
+}
+
+void ServerMetrics::addGzippedReply(int inputBytes, int outputBytes)
+{
+    m_gzipInputBytes.fetchAndAddRelaxed(static_cast<quint64>(inputBytes));
+    m_gzipOutputBytes.fetchAndAddRelaxed(static_cast<quint64>(outputBytes));
+}
+
+void ServerMetrics::addProcessedMessage()
+{
+    m_processedMessages.fetchAndAddRelaxed(1);
+}
+
+void ServerMetrics::addActiveConnections(int diff)
+{
+    m_activeConnections.fetchAndAddRelaxed(diff);
+}
+
+void ServerMetrics::addActiveSessions(int diff)
+{
+    m_activeSessions.fetchAndAddRelaxed(diff);
+}
+
+ServerMetrics::Snapshot ServerMetrics::snapshot() const
+{
+    Snapshot result;
+    for (int i = 0; i < c_rpcSlotCount; ++i) {
+        const RpcEntry *entry = m_rpcSlots[i].loadAcquire();
+        if (entry) {
+            result.rpcDurations.insert(entry->function, entry->durations.snapshot());
+        }
+    }
+    result.handshakeDurations = m_handshakeDurations.snapshot();
+    for (int i = 0; i < 2; ++i) {
+        result.transports[i].receivedBytes = m_transports[i].receivedBytes.load();
+        result.transports[i].sentBytes = m_transports[i].sentBytes.load();
+        result.transports[i].receivedPackets = m_transports[i].receivedPackets.load();
+        result.transports[i].sentPackets = m_transports[i].sentPackets.load();
+    }
+    result.gzipInputBytes = m_gzipInputBytes.load();
+    result.gzipOutputBytes = m_gzipOutputBytes.load();
+    result.processedMessages = m_processedMessages.load();
+    result.activeConnections = m_activeConnections.load();
+    result.activeSessions = m_activeSessions.load();
+    return result;
+}
+
+LatencyHistogram *ServerMetrics::rpcHistogram(TLValue function)
+{
+    const quint32 key = function;
+    int slot = static_cast<int>((key * 2654435761u) >> 22) & (c_rpcSlotCount - 1);
+    RpcEntry *newEntry = nullptr;
+    for (int i = 0; i < c_rpcSlotCount; ++i) {
+        RpcEntry *entry = m_rpcSlots[slot].loadAcquire();
+        if (!entry) {
+            if (!newEntry) {
+                newEntry = new RpcEntry();
+                newEntry->function = function;
+            }
+            if (m_rpcSlots[slot].testAndSetOrdered(nullptr, newEntry)) {
+                return &newEntry->durations;
+            }
+            // Another thread has taken the slot
+            entry = m_rpcSlots[slot].loadAcquire();
+        }
+        if (entry->function == function) {
+            delete newEntry;
+            return &entry->durations;
+        }
+        slot = (slot + 1) & (c_rpcSlotCount - 1);
+    }
+    delete newEntry;
+    return nullptr;
+}
+
+static QByteArray secondsFromNsecs(quint64 nsecs)
+{
+    return QByteArray::number(static_cast<double>(nsecs) / 1e9, 'g', 10);
+}
+
+static void appendFamilyHeader(QByteArray *output, const char *name, const char *type, const char *help)
+{
+    output->append("# HELP ");
+    output->append(name);
+    output->append(' ');
+    output->append(help);
+    output->append("\n# TYPE ");
+    output->append(name);
+    output->append(' ');
+    output->append(type);
+    output->append('\n');
+}
+
+static void appendSample(QByteArray *output, const char *name, const char *suffix,
+                         const QByteArray &labels, const QByteArray &value)
+{
+    output->append(name);
+    output->append(suffix);
+    output->append('{');
+    output->append(labels);
+    output->append("} ");
+    output->append(value);
+    output->append('\n');
+}
+
+static void appendHistogram(QByteArray *output, const char *name, const QByteArray &labels,
+                            const LatencyHistogram::Snapshot &histogram)
+{
+    for (int bits = c_exportFirstBucketBits; bits <= c_exportLastBucketBits; bits += c_exportBucketStepBits) {
+        const QByteArray bucketLabels = labels + ",le=\"" + secondsFromNsecs(quint64(1) << bits) + '"';
+        appendSample(output, name, "_bucket", bucketLabels, QByteArray::number(histogram.countBelowPowerOfTwo(bits)));
+    }
+    appendSample(output, name, "_bucket", labels + ",le=\"+Inf\"", QByteArray::number(histogram.count));
+    appendSample(output, name, "_sum", labels, secondsFromNsecs(histogram.sum));
+    appendSample(output, name, "_count", labels, QByteArray::number(histogram.count));
+}
+
+static QByteArray dcLabel(const ServerMetrics::Snapshot &snapshot)
+{
+    return "dc=\"" + QByteArray::number(snapshot.dcId) + '"';
+}
+
+QByteArray ServerMetrics::toPrometheusText(const QVector<Snapshot> &snapshots)
+{
+    QByteArray output;
+
+    static const char *const rpcName = "telegram_server_rpc_duration_seconds";
+    appendFamilyHeader(&output, rpcName, "histogram", "Time from an RPC request dispatched to its operation finished.");
+    for (const Snapshot &snapshot : snapshots) {
+        QVector<QPair<QString, quint32>> functions;
+        for (auto it = snapshot.rpcDurations.constBegin(); it != snapshot.rpcDurations.constEnd(); ++it) {
+            functions.append(qMakePair(TLValue(it.key()).toString(), it.key()));
+        }
+        std::sort(functions.begin(), functions.end());
+        for (const QPair<QString, quint32> &function : functions) {
+            const QByteArray labels = dcLabel(snapshot) + ",method=\"" + function.first.toLatin1() + '"';
+            appendHistogram(&output, rpcName, labels, snapshot.rpcDurations.value(function.second));
+        }
+    }
+
+    static const char *const handshakeName = "telegram_server_handshake_duration_seconds";
+    appendFamilyHeader(&output, handshakeName, "histogram", "Time from req_pq received to the auth key generated.");
+    for (const Snapshot &snapshot : snapshots) {
+        appendHistogram(&output, handshakeName, dcLabel(snapshot), snapshot.handshakeDurations);
+    }
+
+    struct TransportFamily {
+        const char *name;
+        const char *help;
+        quint64 TransportCounters::*value;
+    };
+    static const TransportFamily transportFamilies[] = {
+        { "telegram_server_transport_received_bytes_total", "Received MTProto packet bytes.", &TransportCounters::receivedBytes },
+        { "telegram_server_transport_sent_bytes_total", "Sent MTProto packet bytes.", &TransportCounters::sentBytes },
+        { "telegram_server_transport_received_packets_total", "Received MTProto packets.", &TransportCounters::receivedPackets },
+        { "telegram_server_transport_sent_packets_total", "Sent MTProto packets.", &TransportCounters::sentPackets },
+    };
+    for (const TransportFamily &family : transportFamilies) {
+        appendFamilyHeader(&output, family.name, "counter", family.help);
+        for (const Snapshot &snapshot : snapshots) {
+            for (int i = 0; i < 2; ++i) {
+                const QByteArray labels = dcLabel(snapshot) + ",transport=\"" + c_transportNames[i] + '"';
+                appendSample(&output, family.name, "", labels, QByteArray::number(snapshot.transports[i].*family.value));
+            }
+        }
+    }
+
+    struct Family {
+        const char *name;
+        const char *type;
+        const char *help;
+        qint64 (*value)(const Snapshot &snapshot);
+    };
+    static const Family families[] = {
+        { "telegram_server_reply_gzip_input_bytes_total", "counter", "Bytes of the RPC replies sent gzip_packed, before the compression.",
+          [](const Snapshot &snapshot) { return static_cast<qint64>(snapshot.gzipInputBytes); } },
+        { "telegram_server_reply_gzip_output_bytes_total", "counter", "Bytes of the RPC replies sent gzip_packed, after the compression.",
+          [](const Snapshot &snapshot) { return static_cast<qint64>(snapshot.gzipOutputBytes); } },
+        { "telegram_server_processed_messages_total", "counter", "Messages delivered to the post boxes of the recipients.",
+          [](const Snapshot &snapshot) { return static_cast<qint64>(snapshot.processedMessages); } },
+        { "telegram_server_active_connections", "gauge", "Connected clients.",
+          [](const Snapshot &snapshot) { return snapshot.activeConnections; } },
+        { "telegram_server_active_sessions", "gauge", "Sessions bound to a connection.",
+          [](const Snapshot &snapshot) { return snapshot.activeSessions; } },
+    };
+    for (const Family &family : families) {
+        appendFamilyHeader(&output, family.name, family.type, family.help);
+        for (const Snapshot &snapshot : snapshots) {
+            appendSample(&output, family.name, "", dcLabel(snapshot), QByteArray::number(family.value(snapshot)));
+        }
+    }
+    return output;
+}
+
+} // Server namespace
+
+} // Telegram namespace
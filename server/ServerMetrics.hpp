@@ -0,0 +1,128 @@
+#ifndef TELEGRAM_SERVER_METRICS_HPP
+#define TELEGRAM_SERVER_METRICS_HPP
+
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QHash>
+#include <QVector>
+
+#include "ServerNamespace.hpp"
+#include "TLValues.hpp"
+
+namespace Telegram {
+
+namespace Server {
+
+// A histogram of durations (in nanoseconds) with log-linear buckets:
+// each power of two is split to 8 equal buckets, so a value is known with 1/8 relative
+// precision and a quantile estimated from the bucket middle is off by 1/16 at most.
+// Recording is lock-free and can be done from any thread.
+class LatencyHistogram
+{
+public:
+    static constexpr int c_subBucketBits = 3;
+    static constexpr int c_subBucketCount = 1 << c_subBucketBits;
+    static constexpr int c_maxValueBits = 40; // About 18 minutes; bigger values go to the last bucket
+    static constexpr int c_bucketCount = (c_maxValueBits - c_subBucketBits + 1) * c_subBucketCount;
+
+    struct Snapshot {
+        QVector<quint64> buckets;
+        quint64 count = 0;
+        quint64 sum = 0;
+
+        // Returns the estimated value at the quantile in range [0, 1]
+        quint64 quantile(double q) const;
+        // Returns the number of values lower than the power of two
+        quint64 countBelowPowerOfTwo(int bits) const;
+    };
+
+    void record(quint64 value);
+    Snapshot snapshot() const;
+
+    static int bucketIndex(quint64 value);
+    static quint64 bucketLowerBound(int index);
+    static quint64 bucketUpperBound(int index); // Exclusive
+
+protected:
+    QAtomicInteger<quint64> m_buckets[c_bucketCount];
+    QAtomicInteger<quint64> m_sum;
+};
+
+// Metrics of a server (DC).
+// The counters are updated by the server thread and the snapshots can be taken from any thread.
+class ServerMetrics
+{
+public:
+    struct TransportCounters {
+        quint64 receivedBytes = 0;
+        quint64 sentBytes = 0;
+        quint64 receivedPackets = 0;
+        quint64 sentPackets = 0;
+    };
+
+    struct Snapshot {
+        quint32 dcId = 0; // Not known to the metrics; set by the exporter
+        QHash<quint32, LatencyHistogram::Snapshot> rpcDurations; // TLValue of the function to durations
+        LatencyHistogram::Snapshot handshakeDurations;
+        TransportCounters transports[2]; // Indexed by TransportBackend
+        quint64 gzipInputBytes = 0;
+        quint64 gzipOutputBytes = 0;
+        quint64 processedMessages = 0;
+        qint64 activeConnections = 0;
+        qint64 activeSessions = 0;
+    };
+
+    ServerMetrics() = default;
+    ~ServerMetrics();
+
+    // Duration from the request received to the reply sent
+    void recordRpc(TLValue function, qint64 nsecs);
+    void recordHandshake(qint64 nsecs);
+
+    // The bytes are MTProto packet (payload) bytes without the transport framing
+    void addReceivedPacket(TransportBackend backend, int bytes);
+    void addSentPacket(TransportBackend backend, int bytes);
+
+    void addGzippedReply(int inputBytes, int outputBytes);
+
+    // A message delivered to the post boxes of the recipients
+    void addProcessedMessage();
+
+    void addActiveConnections(int diff);
+    void addActiveSessions(int diff);
+
+    Snapshot snapshot() const;
+
+    static QByteArray toPrometheusText(const QVector<Snapshot> &snapshots);
+
+protected:
+    struct RpcEntry {
+        TLValue function;
+        LatencyHistogram durations;
+    };
+    struct AtomicTransportCounters {
+        QAtomicInteger<quint64> receivedBytes;
+        QAtomicInteger<quint64> sentBytes;
+        QAtomicInteger<quint64> receivedPackets;
+        QAtomicInteger<quint64> sentPackets;
+    };
+
+    LatencyHistogram *rpcHistogram(TLValue function);
+
+    // Open addressing table of the functions; the entries are inserted with CAS and never removed
+    static constexpr int c_rpcSlotCount = 1024;
+    QAtomicPointer<RpcEntry> m_rpcSlots[c_rpcSlotCount];
+    LatencyHistogram m_handshakeDurations;
+    AtomicTransportCounters m_transports[2];
+    QAtomicInteger<quint64> m_gzipInputBytes;
+    QAtomicInteger<quint64> m_gzipOutputBytes;
+    QAtomicInteger<quint64> m_processedMessages;
+    QAtomicInteger<qint64> m_activeConnections;
+    QAtomicInteger<qint64> m_activeSessions;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_METRICS_HPP
@@ -7,6 +7,11 @@ namespace Telegram {
 
 namespace Server {
 
+enum class TransportBackend {
+    Qt, // QTcpServer and a QTcpSocket per connection
+    Epoll, // Linux only: the sockets are served by the epoll listener threads (see EpollServer)
+};
+
 struct InputPeer : public Telegram::Peer
 {
     InputPeer() = default;
@@ -15,13 +20,6 @@ struct InputPeer : public Telegram::Peer
     qint64 accessHash = 0;
 };
 
-struct ServerSalt
-{
-    quint64 salt = 0;
-    quint32 validSince = 0;
-    quint32 validUntil = 0;
-};
-
 struct UserDialog
 {
     Telegram::Peer peer;
@@ -9,6 +9,9 @@
 #include "RpcError.hpp"
 #include "ServerRpcOperation.hpp"
 #include "RpcOperationFactory.hpp"
+#include "ReplyCompressor.hpp"
+#include "OutboundLimiter.hpp"
+#include "ServerMetrics.hpp"
 
 #include "Session.hpp"
 #include "ServerApi.hpp"
@@ -17,8 +20,14 @@
 
 #include "MTProto/MessageHeader.hpp"
 
+#include "CTelegramTransport.hpp"
+#include "RemoteClientConnection.hpp"
+
 #include "CTelegramStream.hpp"
 #include "CTelegramStreamExtraOperators.hpp"
+
+#include <QDateTime>
+#include <QIODevice>
 #include <QLoggingCategory>
 
 Q_LOGGING_CATEGORY(c_serverRpcLayerCategory, "telegram.server.rpclayer", QtWarningMsg)
@@ -100,6 +109,56 @@ void RpcLayer::setRpcFactories(const QVector<RpcOperationFactory *> &rpcFactorie
     m_operationFactories = rpcFactories;
 }
 
+ReplyCompressor *RpcLayer::replyCompressor() const
+{
+    if (!m_replyCompressor) {
+        // A layer without a server (e.g. in tests) uses the default policy
+        static thread_local ReplyCompressor defaultCompressor;
+        return &defaultCompressor;
+    }
+    return m_replyCompressor;
+}
+
+void RpcLayer::setReplyCompressor(ReplyCompressor *compressor)
+{
+    m_replyCompressor = compressor;
+}
+
+void RpcLayer::setOutboundLimiter(OutboundLimiter *limiter)
+{
+    m_outboundLimiter = limiter;
+}
+
+void RpcLayer::setMetrics(ServerMetrics *metrics)
+{
+    m_metrics = metrics;
+}
+
+RpcOperation *RpcLayer::takeRecycledOperation(const QMetaObject *operationType)
+{
+    QHash<const QMetaObject *, QVector<RpcOperation *>>::iterator it = m_operationPool.find(operationType);
+    if ((it == m_operationPool.end()) || it->isEmpty()) {
+        return nullptr;
+    }
+    RpcOperation *operation = it->takeLast();
+    operation->reset();
+    return operation;
+}
+
+void RpcLayer::recycleOperation(RpcOperation *operation)
+{
+    // The operations are processed synchronously, so there is rarely
+    // more than one operation of a type in flight.
+    static const int c_maxPooledOperationsPerType = 4;
+    QVector<RpcOperation *> &pool = m_operationPool[operation->metaObject()];
+    Q_ASSERT_X(!pool.contains(operation), "RpcLayer::recycleOperation()", "The operation is recycled twice");
+    if (pool.count() < c_maxPooledOperationsPerType) {
+        pool.append(operation);
+    } else {
+        operation->deleteLater();
+    }
+}
+
 bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 {
     TLValue requestValue = message.firstValue();
@@ -115,7 +174,7 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
     case TLValue::Ping:
     case TLValue::PingDelayDisconnect:
     {
-        MTProto::Stream stream(message.data);
+        MTProto::Stream stream(message.data());
         TLFunctions::TLPing ping;
         stream >> ping;
 
@@ -126,11 +185,13 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
         sendPackage(output.getData(), SendMode::ServerReply);
     }
         return true;
+    case TLValue::GetFutureSalts:
+        return processGetFutureSalts(message.skipTLValue());
     default:
         break;
     }
 
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data());
     RpcProcessingContext context(stream, message.messageId);
 
     context.inputStream() >> requestValue;
@@ -141,10 +202,16 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
     }
 
     RpcOperation *op = nullptr;
-    for (RpcOperationFactory *f : m_operationFactories) {
-        op = f->processRpcCall(this, context);
-        if (op) {
-            break;
+    const RpcOperationFactory::ProcessRpcCall processRpcCall = RpcOperationFactory::getProcessRpcCall(requestValue);
+    if (processRpcCall) {
+        op = processRpcCall(this, context);
+    } else {
+        // Fallback for the factories that are not a part of the generated table
+        for (RpcOperationFactory *f : m_operationFactories) {
+            op = f->processRpcCall(this, context);
+            if (op) {
+                break;
+            }
         }
     }
     if (!op) {
@@ -157,6 +224,18 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 
 void RpcLayer::sendUpdates(const TLUpdates &updates)
 {
+    if (m_outboundLimiter && m_session) {
+        switch (m_outboundLimiter->checkUpdates(m_session, pendingBytes())) {
+        case OutboundLimiter::UpdatesAction::Send:
+            break;
+        case OutboundLimiter::UpdatesAction::SendTooLong:
+            sendUpdatesTooLong();
+            return;
+        case OutboundLimiter::UpdatesAction::Drop:
+            qCDebug(c_serverRpcLayerCategory) << this << __func__ << "Drop updates for a slow client";
+            return;
+        }
+    }
     CTelegramStream stream(CTelegramStream::WriteOnly);
     stream << updates;
     sendRpcMessage(stream.getData());
@@ -164,7 +243,7 @@ void RpcLayer::sendUpdates(const TLUpdates &updates)
 
 bool RpcLayer::processInitConnection(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data());
     quint32 appId;
     QString deviceInfo;
     QString osInfo;
@@ -198,21 +277,50 @@ bool RpcLayer::processInitConnection(const MTProto::Message &message)
     session()->languageCode = languageCode;
     session()->deviceInfo = deviceInfo;
     session()->osInfo = osInfo;
-    MTProto::Message innerMessage = message;
-    innerMessage.data = stream.readAll();
-    return processMTProtoMessage(innerMessage);
+    return processMTProtoMessage(message.skipBytes(static_cast<int>(stream.device()->pos())));
 }
 
 bool RpcLayer::processInvokeWithLayer(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data());
     quint32 layer = 0;
     stream >> layer;
     qCDebug(c_serverRpcLayerCategory) << Q_FUNC_INFO << "InvokeWithLayer" << layer;
     StackValue<quint32> layerValue(&m_invokeWithLayer, layer);
-    MTProto::Message innerMessage = message;
-    innerMessage.data = stream.readAll();
-    return processMTProtoMessage(innerMessage);
+    return processMTProtoMessage(message.skipBytes(static_cast<int>(stream.device()->pos())));
+}
+
+bool RpcLayer::processGetFutureSalts(const MTProto::Message &message)
+{
+    // https://core.telegram.org/mtproto/service_messages#request-for-several-future-salts
+    MTProto::Stream stream(message.data());
+    quint32 number = 0;
+    stream >> number;
+    if (stream.error()) {
+        qCWarning(c_serverRpcLayerCategory) << Q_FUNC_INFO << "Invalid read!";
+        return false;
+    }
+    const QVector<ServerSalt> salts = m_session->getSalts(number);
+#if QT_VERSION > QT_VERSION_CHECK(5, 8, 0)
+    const qint64 timestamp = QDateTime::currentSecsSinceEpoch();
+#else
+    const qint64 timestamp = QDateTime::currentMSecsSinceEpoch() / 1000;
+#endif
+
+    // The reply is not wrapped into rpc_result
+    MTProto::Stream output(MTProto::Stream::WriteOnly);
+    output << TLValue::FutureSalts;
+    output << message.messageId;
+    output << static_cast<quint32>(timestamp);
+    output << TLValue::Vector;
+    output << static_cast<quint32>(salts.count());
+    for (const ServerSalt &salt : salts) {
+        output << TLValue::FutureSalt;
+        output << salt.validSince;
+        output << salt.validUntil;
+        output << salt.salt;
+    }
+    return sendPackage(output.getData(), SendMode::ServerReply);
 }
 
 void RpcLayer::sendIgnoredMessageNotification(quint32 errorCode, const MTProto::FullMessageHeader &header)
@@ -250,28 +358,28 @@ bool RpcLayer::sendRpcReply(const QByteArray &reply, quint64 messageId)
     CRawStream output(CRawStream::WriteOnly);
     output << TLValue::RpcResult;
     output << messageId;
-    if (reply.size() > 128) { // Telegram spec says it should be 255, but we need to lower the limit to pack DcConfig
-        const QByteArray innerData = Utils::packGZip(reply);
-        if (innerData.size() + 8 < reply.size()) {
-            CTelegramStream innerStream(CRawStream::WriteOnly);
-            innerStream << TLValue::GzipPacked;
-            innerStream << innerData;
-            output.writeBytes(innerStream.getData());
-            qCDebug(c_serverRpcDumpPackageCategory) << gzipPackMessage() << messageId << TLValue::firstFromArray(reply).toString();
-        } else {
-            qCDebug(c_serverRpcDumpPackageCategory) << "Server: It makes no sense to gzip the answer for message" << messageId;
-            output.writeBytes(reply);
-        }
-    } else {
+    const QByteArray packedReply = replyCompressor()->compress(reply);
+    if (packedReply.isEmpty()) {
         output.writeBytes(reply);
+    } else {
+        output.writeBytes(packedReply);
+        if (m_metrics) {
+            m_metrics->addGzippedReply(reply.size(), packedReply.size());
+        }
+        qCDebug(c_serverRpcDumpPackageCategory) << gzipPackMessage() << messageId << TLValue::firstFromArray(reply).toString();
     }
     qCDebug(c_serverRpcDumpPackageCategory) << Q_FUNC_INFO << TLValue::firstFromArray(reply) << "for message id" << messageId;
-    return sendPackage(output.getData(), SendMode::ServerReply);
+    const bool result = sendPackage(output.getData(), SendMode::ServerReply);
+    // The replies are never dropped, but a client which does not read them is disconnected
+    checkOutboundLimit();
+    return result;
 }
 
 bool RpcLayer::sendRpcMessage(const QByteArray &message)
 {
-    return sendPackage(message, SendMode::ServerInitiative);
+    const bool result = sendPackage(message, SendMode::ServerInitiative);
+    checkOutboundLimit();
+    return result;
 }
 
 const char *RpcLayer::gzipPackMessage()
@@ -332,6 +440,8 @@ bool RpcLayer::processDecryptedMessageHeader(const MTProto::FullMessageHeader &h
     }
     m_session->lastSequenceNumber = header.sequenceNumber;
     m_session->lastMessageNumber = header.messageId;
+    // A client which sends something probably reads as well
+    resumeUpdates();
     return true;
 }
 
@@ -350,6 +460,40 @@ MTProtoSendHelper *RpcLayer::getHelper() const
     return static_cast<MTProtoSendHelper *>(m_sendHelper);
 }
 
+qint64 RpcLayer::pendingBytes() const
+{
+    return getHelper()->getRemoteClientConnection()->transport()->bytesToWrite();
+}
+
+void RpcLayer::sendUpdatesTooLong()
+{
+    TLUpdates updates;
+    updates.tlType = TLValue::UpdatesTooLong;
+    CTelegramStream stream(CTelegramStream::WriteOnly);
+    stream << updates;
+    sendRpcMessage(stream.getData());
+}
+
+void RpcLayer::resumeUpdates()
+{
+    if (m_outboundLimiter && m_outboundLimiter->resumeUpdates(m_session, pendingBytes())) {
+        qCDebug(c_serverRpcLayerCategory) << this << __func__ << "Resume updates with updatesTooLong";
+        sendUpdatesTooLong();
+    }
+}
+
+void RpcLayer::checkOutboundLimit()
+{
+    if (!m_outboundLimiter || !m_outboundLimiter->exceedsHardLimit(pendingBytes())) {
+        return;
+    }
+    BaseTransport *transport = getHelper()->getRemoteClientConnection()->transport();
+    qCWarning(c_serverRpcLayerCategory) << this << __func__ << "Abort the connection from"
+                                        << transport->remoteAddress() << "with"
+                                        << transport->bytesToWrite() << "bytes pending";
+    transport->abort();
+}
+
 } // Server namespace
 
 } // Telegram namespace
@@ -3,6 +3,7 @@
 
 #include "RpcLayer.hpp"
 
+#include <QHash>
 #include <QStack>
 #include <QVector>
 
@@ -18,6 +19,9 @@ class RpcError;
 namespace Server {
 
 class MTProtoSendHelper;
+class OutboundLimiter;
+class ReplyCompressor;
+class ServerMetrics;
 class RpcOperation;
 class RpcOperationFactory;
 
@@ -42,13 +46,32 @@ public:
 
     void setRpcFactories(const QVector<RpcOperationFactory*> &rpcFactories);
 
+    ReplyCompressor *replyCompressor() const;
+    void setReplyCompressor(ReplyCompressor *compressor);
+
+    OutboundLimiter *outboundLimiter() const { return m_outboundLimiter; }
+    void setOutboundLimiter(OutboundLimiter *limiter);
+
+    ServerMetrics *metrics() const { return m_metrics; }
+    void setMetrics(ServerMetrics *metrics);
+
+    // Pool of processed operations to reuse for the next requests of the same type
+    RpcOperation *takeRecycledOperation(const QMetaObject *operationType);
+    void recycleOperation(RpcOperation *operation);
+    QVector<RpcOperation *> recycledOperations(const QMetaObject *operationType) const
+    {
+        return m_operationPool.value(operationType);
+    }
+
     bool processMTProtoMessage(const MTProto::Message &message) override;
 
+    // The updates are dropped (and replaced with updatesTooLong later) if the client does not read
     void sendUpdates(const TLUpdates &updates);
 
     // Low level
     bool processInitConnection(const MTProto::Message &message);
     bool processInvokeWithLayer(const MTProto::Message &message);
+    bool processGetFutureSalts(const MTProto::Message &message);
 
     void sendIgnoredMessageNotification(quint32 errorCode, const MTProto::FullMessageHeader &header);
     bool sendRpcError(const Telegram::RpcError &error, quint64 messageId);
@@ -69,11 +92,20 @@ protected:
 
     MTProtoSendHelper *getHelper() const;
 
+    qint64 pendingBytes() const;
+    void sendUpdatesTooLong();
+    void resumeUpdates();
+    void checkOutboundLimit();
+
     Session *m_session = nullptr;
     ServerApi *m_api = nullptr;
+    ReplyCompressor *m_replyCompressor = nullptr;
+    OutboundLimiter *m_outboundLimiter = nullptr;
+    ServerMetrics *m_metrics = nullptr;
     QStack<quint32> m_invokeWithLayer;
 
     QVector<RpcOperationFactory*> m_operationFactories;
+    QHash<const QMetaObject *, QVector<RpcOperation *>> m_operationPool;
 };
 
 } // Server namespace
@@ -1,5 +1,6 @@
 #include "ServerRpcOperation.hpp"
 
+#include "ServerMetrics.hpp"
 #include "ServerRpcLayer.hpp"
 #include "Session.hpp"
 #include "TelegramServerUser.hpp"
@@ -23,6 +24,46 @@ void RpcOperation::setRequestId(quint64 messageId)
     m_requestId = messageId;
 }
 
+void RpcOperation::setFunction(TLValue function)
+{
+    m_function = function;
+    m_processingTimer.start();
+}
+
+void RpcOperation::reset()
+{
+    destroyArguments();
+    m_api = m_rpcLayer->api();
+    m_layer = m_rpcLayer->activeLayer();
+    m_requestId = 0;
+    m_function = TLValue();
+}
+
+void RpcOperation::destroyArguments()
+{
+    if (!m_arguments) {
+        return;
+    }
+    m_argumentsDestructor(m_arguments);
+    m_arguments = nullptr;
+    m_argumentsDestructor = nullptr;
+}
+
+void RpcOperation::recycle()
+{
+    // A run method which deferred its work to a child object (e.g. a timer or a nested operation)
+    // would continue on the operation of the next request
+    Q_ASSERT_X(children().isEmpty(), "RpcOperation::recycle()",
+               "The operation is still used after the run method returned");
+    ServerMetrics *metrics = m_rpcLayer->metrics();
+    if (metrics && m_processingTimer.isValid()) {
+        metrics->recordRpc(m_function, m_processingTimer.nsecsElapsed());
+        m_processingTimer.invalidate();
+    }
+    destroyArguments();
+    m_rpcLayer->recycleOperation(this);
+}
+
 bool RpcOperation::sendRpcError(const RpcError &error)
 {
     qDebug() << Q_FUNC_INFO << error.type << error.reason << error.argument << error.message << m_requestId;
@@ -5,6 +5,10 @@
 #include "TLFunctions.hpp"
 #include "RpcError.hpp"
 
+#include <QElapsedTimer>
+
+#include <new>
+
 class CTelegramStream;
 class RpcProcessingContext;
 
@@ -23,6 +27,14 @@ public:
     explicit RpcOperation(RpcLayer *rpcLayer);
 
     void setRequestId(quint64 messageId);
+    // Sets the processed function and starts the measurement of the processing time
+    void setFunction(TLValue function);
+
+    // Prepare a recycled operation for the next request
+    void reset();
+
+    // Returns true if the arguments of a request are constructed (i.e. the request is not processed yet)
+    bool hasArguments() const { return m_arguments; }
 
 //    void sendReply(const QByteArray &reply);
 
@@ -39,11 +51,41 @@ public:
 protected:
     virtual bool processNotImplementedMethod(TLValue functionCode);
 
+    // The generated operations keep the arguments of all functions in a union,
+    // so only the arguments of the requested function are alive.
+    template <typename Arguments>
+    Arguments &constructArguments(Arguments *arguments)
+    {
+        destroyArguments();
+        new (arguments) Arguments();
+        m_arguments = arguments;
+        m_argumentsDestructor = &destroyArgumentsImpl<Arguments>;
+        return *arguments;
+    }
+    void destroyArguments();
+
+    // Return the operation to the layer pool once the request is processed.
+    // The operation is recycled right after the run method returns, so the run methods must reply
+    // synchronously and must not keep 'this' (e.g. in a connection, a timer or a lambda) past the call.
+    void recycle();
+
+    void *m_arguments = nullptr;
+    void (*m_argumentsDestructor)(void *arguments) = nullptr;
+
     RpcLayer *m_rpcLayer = nullptr;
     ServerApi *m_api = nullptr;
     quint64 m_requestId = 0;
     quint32 m_layer = 0;
+    TLValue m_function;
+    QElapsedTimer m_processingTimer;
 //    QByteArray m_request;
+
+private:
+    template <typename Arguments>
+    static void destroyArgumentsImpl(void *arguments)
+    {
+        static_cast<Arguments *>(arguments)->~Arguments();
+    }
 };
 
 } // Server namespace
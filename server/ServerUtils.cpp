@@ -64,9 +64,9 @@ bool setupTLUser(TLUser *output, const AbstractUser *input, const LocalUser *app
     if (output->id == applicant->id()) {
         flags |= TLUser::Self;
     }
-    if (applicant->contactList().contains(output->id)) {
+    if (applicant->hasContact(output->id)) {
         flags |= TLUser::Contact;
-        if (input->contactList().contains(applicant->id())) {
+        if (input->hasContact(applicant->id())) {
             flags |= TLUser::MutualContact;
         }
     }
@@ -126,7 +126,7 @@ bool setupTLMessage(TLMessage *output, const MessageData *messageData, quint32 m
     output->toId = Telegram::Utils::toTLPeer(messageData->toPeer());
 
     if (messageData->media().isValid()) {
-        setupTLMessageMedia(&output->media, &messageData->media());
+        setupTLMessageMedia(&*output->media, &messageData->media());
         flags |= TLMessage::Media;
     }
 
@@ -209,16 +209,18 @@ bool setupTLMessageMedia(TLMessageMedia *output, const MediaData *mediaData)
     case MediaData::Invalid:
         return false;
     case MediaData::Document:
+    {
         output->tlType = TLValue::MessageMediaDocument;
         output->flags = 0;
         output->flags |= TLMessageMedia::Document;
-        output->document.tlType = TLValue::Document;
-        output->document.date = mediaData->file.date;
-        output->document.size = mediaData->file.size;
-        output->document.mimeType = mediaData->mimeType;
-        output->document.dcId = mediaData->file.dcId;
-        output->document.accessHash = mediaData->file.accessHash;
-        output->document.id = mediaData->file.id;
+        TLDocument &document = *output->document;
+        document.tlType = TLValue::Document;
+        document.date = mediaData->file.date;
+        document.size = mediaData->file.size;
+        document.mimeType = mediaData->mimeType;
+        document.dcId = mediaData->file.dcId;
+        document.accessHash = mediaData->file.accessHash;
+        document.id = mediaData->file.id;
 
         for (const DocumentAttribute &attribute : mediaData->attributes) {
             TLDocumentAttribute tlAttribute;
@@ -226,7 +228,7 @@ bool setupTLMessageMedia(TLMessageMedia *output, const MediaData *mediaData)
             case DocumentAttribute::FileName:
                 tlAttribute.tlType = TLValue::DocumentAttributeFilename;
                 tlAttribute.fileName = attribute.value.toString();
-                output->document.attributes.append(tlAttribute);
+                document.attributes.append(tlAttribute);
                 break;
             default:
                 break;
@@ -235,6 +237,7 @@ bool setupTLMessageMedia(TLMessageMedia *output, const MediaData *mediaData)
 
         break;
     }
+    }
 
     if (!mediaData->caption.isEmpty()) {
         output->caption = mediaData->caption;
@@ -55,6 +55,8 @@ public:
     QString languageCode;
     QString ip;
     quint64 timestamp = 0;
+    // The client does not read fast enough and the updates are not written to it (see OutboundLimiter)
+    bool updatesSuspended = false;
 
 protected:
     void addSalt();
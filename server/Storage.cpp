@@ -46,6 +46,7 @@ Storage::Storage(QObject *parent) :
 
 MessageData *Storage::addMessage(quint32 fromId, Peer toPeer, const QString &text)
 {
+    QMutexLocker locker(&m_lock);
     ++m_lastGlobalId;
     m_messages.insert(m_lastGlobalId, MessageData(fromId, toPeer, text));
     MessageData *message = &m_messages[m_lastGlobalId];
@@ -56,6 +57,7 @@ MessageData *Storage::addMessage(quint32 fromId, Peer toPeer, const QString &tex
 
 MessageData *Storage::addMessageMedia(quint32 fromId, Peer toPeer, const MediaData &media)
 {
+    QMutexLocker locker(&m_lock);
     ++m_lastGlobalId;
     m_messages.insert(m_lastGlobalId, MessageData(fromId, toPeer, media));
     MessageData *message = &m_messages[m_lastGlobalId];
@@ -64,8 +66,19 @@ MessageData *Storage::addMessageMedia(quint32 fromId, Peer toPeer, const MediaDa
     return message;
 }
 
+MessageData *Storage::addMessageCopy(const MessageData &message)
+{
+    QMutexLocker locker(&m_lock);
+    ++m_lastGlobalId;
+    m_messages.insert(m_lastGlobalId, message);
+    MessageData *messageCopy = &m_messages[m_lastGlobalId];
+    messageCopy->setGlobalId(m_lastGlobalId);
+    return messageCopy;
+}
+
 const MessageData *Storage::getMessage(quint64 globalId)
 {
+    QMutexLocker locker(&m_lock);
     if (!m_messages.contains(globalId)) {
         return nullptr;
     }
@@ -74,6 +87,7 @@ const MessageData *Storage::getMessage(quint64 globalId)
 
 bool Storage::uploadFilePart(quint64 fileId, quint32 filePart, const QByteArray &bytes)
 {
+    QMutexLocker locker(&m_lock);
     if (!m_tmpFiles.contains(fileId)) {
         FileData newFile;
         newFile.fileId = fileId;
@@ -90,6 +104,7 @@ bool Storage::uploadFilePart(quint64 fileId, quint32 filePart, const QByteArray
 // InputFile
 FileDescriptor Storage::getFileDescriptor(quint64 fileId, quint32 parts) const
 {
+    QMutexLocker locker(&m_lock);
     if (!m_tmpFiles.contains(fileId)) {
         return FileDescriptor();
     }
@@ -108,6 +123,7 @@ FileDescriptor Storage::getSecretFileDescriptor(quint64 volumeId,
                                                 quint32 localId,
                                                 quint64 secret) const
 {
+    QMutexLocker locker(&m_lock);
     for (const FileDescriptor &descriptor : m_allFileDescriptors) {
         if ((descriptor.volumeId == volumeId) && (descriptor.localId == localId)) {
             if (descriptor.secret == secret) {
@@ -121,6 +137,7 @@ FileDescriptor Storage::getSecretFileDescriptor(quint64 volumeId,
 
 FileDescriptor Storage::getDocumentFileDescriptor(quint64 fileId, quint64 accessHash) const
 {
+    QMutexLocker locker(&m_lock);
     for (const FileDescriptor &descriptor : m_allFileDescriptors) {
         if (descriptor.id == fileId) {
             if (descriptor.accessHash == accessHash) {
@@ -144,6 +161,7 @@ quint64 Storage::getMessageUniqueTs()
 
 QIODevice *Storage::beginReadFile(const FileDescriptor &descriptor)
 {
+    QMutexLocker locker(&m_lock);
     QFile *file = new QFile();
     m_openFiles.insert(file);
     file->setFileName(c_storageFileDir.arg(descriptor.volumeId)
@@ -158,6 +176,7 @@ QIODevice *Storage::beginReadFile(const FileDescriptor &descriptor)
 
 void Storage::endReadFile(QIODevice *device)
 {
+    QMutexLocker locker(&m_lock);
     QFile *file = static_cast<QFile *>(device);
     if (!m_openFiles.contains(file)) {
         qWarning() << CALL_INFO << "not such file" << device;
@@ -213,6 +232,7 @@ FileDescriptor Storage::saveDocumentFile(const FileDescriptor &descriptor,
                                          const QString &fileName,
                                          const QString &mimeType)
 {
+    QMutexLocker locker(&m_lock);
     QIODevice *output = beginWriteFile();
     QByteArray data = m_tmpFiles.value(descriptor.id).partList.join();
     output->write(data);
@@ -228,6 +248,7 @@ FileDescriptor Storage::saveDocumentFile(const FileDescriptor &descriptor,
 
 ImageDescriptor Storage::processImageFile(const FileDescriptor &file, const QString &name)
 {
+    QMutexLocker locker(&m_lock);
     if (!m_tmpFiles.contains(file.id)) {
         return ImageDescriptor();
     }
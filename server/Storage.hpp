@@ -20,6 +20,7 @@
 
 #include <QObject>
 #include <QHash>
+#include <QMutex>
 #include <QSet>
 
 #include "ServerNamespace.hpp"
@@ -32,6 +33,8 @@ namespace Telegram {
 
 namespace Server {
 
+// The storage is shared by all DCs of a LocalCluster, so the public methods are thread-safe.
+// A MessageData is modified only by the server which added it.
 class Storage : public QObject
 {
     Q_OBJECT
@@ -39,6 +42,8 @@ public:
     explicit Storage(QObject *parent = nullptr);
     MessageData *addMessage(quint32 fromId, Peer toPeer, const QString &text);
     MessageData *addMessageMedia(quint32 fromId, Peer toPeer, const MediaData &media);
+    // Adds a copy of the message (with a new global id) for the server of the remote recipient
+    MessageData *addMessageCopy(const MessageData &message);
     const MessageData *getMessage(quint64 globalId);
 
     bool uploadFilePart(quint64 fileId, quint32 filePart, const QByteArray &bytes);
@@ -63,6 +68,7 @@ protected:
 
     quint64 volumeId() const;
 
+    mutable QMutex m_lock;
     QVector<FileDescriptor> m_allFileDescriptors;
     QHash<quint64, MessageData> m_messages;
     QHash<quint64, FileData> m_tmpFiles;
@@ -3,14 +3,19 @@
 #include <QLoggingCategory>
 #include <QTcpServer>
 #include <QTcpSocket>
+#include <QThreadPool>
 
 #include "ApiUtils.hpp"
 #include "TelegramServerUser.hpp"
 #include "RemoteClientConnection.hpp"
+#include "RemoteCallQueue.hpp"
 #include "RemoteServerConnection.hpp"
 #include "Session.hpp"
 
 #include "CServerTcpTransport.hpp"
+#ifdef TELEGRAMQT_SERVER_EPOLL
+#include "EpollTransport.hpp"
+#endif
 
 // Generated RPC Operation Factory includes
 #include "AccountOperationFactory.hpp"
@@ -30,6 +35,10 @@
 #include "UsersOperationFactory.hpp"
 // End of generated RPC Operation Factory includes
 
+#include "DhExponentPool.hpp"
+#include "ReplyCompressor.hpp"
+#include "OutboundLimiter.hpp"
+#include "ServerMetrics.hpp"
 #include "ServerMessageData.hpp"
 #include "ServerDhLayer.hpp"
 #include "ServerRpcLayer.hpp"
@@ -66,6 +75,12 @@ Server::Server(QObject *parent) :
         new UsersOperationFactory(),
         // End of generated RPC Operation Factory initialization
     };
+    m_cryptoThreadPool = new QThreadPool(this);
+    m_dhExponentPool = new DhExponentPool(this);
+    m_replyCompressor = new ReplyCompressor();
+    m_outboundLimiter = new OutboundLimiter();
+    m_metrics = new ServerMetrics();
+    m_callQueue = new RemoteCallQueue(this);
     m_serverSocket = new QTcpServer(this);
     connect(m_serverSocket, &QTcpServer::newConnection, this, &Server::onNewConnection);
 }
@@ -75,6 +90,9 @@ Server::~Server()
     qDeleteAll(m_sessions);
     qDeleteAll(m_users);
     qDeleteAll(m_rpcOperationFactories);
+    delete m_replyCompressor;
+    delete m_outboundLimiter;
+    delete m_metrics;
 }
 
 void Server::setDcOption(const DcOption &option)
@@ -87,20 +105,29 @@ void Server::setServerPrivateRsaKey(const Telegram::RsaKey &key)
     m_key = key;
 }
 
+void Server::setTransportBackend(TransportBackend backend)
+{
+    m_transportBackend = backend;
+}
+
+void Server::setListenerThreadCount(int count)
+{
+    m_listenerThreadCount = qMax(count, 1);
+}
+
 bool Server::start()
 {
     if (!m_dcOption.id) {
         qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to start server: Invalid (null) DC id.";
         return false;
     }
-    if (!m_serverSocket->listen(QHostAddress(m_dcOption.address), m_dcOption.port)) {
-        qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen port " << m_dcOption.port
-                                                              << " ("  << m_serverSocket->serverError() << ")";
+    if (!listen()) {
         return false;
     }
     qCInfo(loggingCategoryServer).nospace().noquote() << this << " start server (DC " << m_dcOption.id << ") "
                                                       << "on " << m_dcOption.address << ":" << m_dcOption.port
                                                       << "; Key:" << hex << showbase << m_key.fingerprint;
+    m_dhExponentPool->refill();
     return true;
 }
 
@@ -111,6 +138,12 @@ void Server::stop()
     if (m_serverSocket) {
         m_serverSocket->close();
     }
+#ifdef TELEGRAMQT_SERVER_EPOLL
+    if (m_epollServer) {
+        // Closes the sockets of all epoll connections
+        m_epollServer->close();
+    }
+#endif
 
     // Connections removed from the set on disconnected.
     // Copy connections to a variable to iterate over a constant container instead of
@@ -138,6 +171,7 @@ void Server::setServerConfiguration(const DcConfiguration &config)
 
 void Server::addServerConnection(RemoteServerConnection *remoteServer)
 {
+    remoteServer->setLocalServer(this);
     m_remoteServers.insert(remoteServer);
 }
 
@@ -159,6 +193,33 @@ void Server::setStorage(Storage *storage)
     m_storage = storage;
 }
 
+bool Server::listen()
+{
+    if (m_transportBackend == TransportBackend::Epoll) {
+#ifdef TELEGRAMQT_SERVER_EPOLL
+        if (!m_epollServer) {
+            m_epollServer = new EpollServer(this);
+            connect(m_epollServer, &EpollServer::newConnection, this, &Server::addClientConnection);
+        }
+        if (!m_epollServer->listen(QHostAddress(m_dcOption.address), m_dcOption.port, m_listenerThreadCount)) {
+            qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen port " << m_dcOption.port
+                                                                  << " ("  << m_epollServer->errorString() << ")";
+            return false;
+        }
+        return true;
+#else
+        qCWarning(loggingCategoryServer) << "The epoll transport is not available on this platform,"
+                                            " fallback to the Qt transport";
+#endif
+    }
+    if (!m_serverSocket->listen(QHostAddress(m_dcOption.address), m_dcOption.port)) {
+        qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen port " << m_dcOption.port
+                                                              << " ("  << m_serverSocket->serverError() << ")";
+        return false;
+    }
+    return true;
+}
+
 void Server::onNewConnection()
 {
     QTcpSocket *socket = m_serverSocket->nextPendingConnection();
@@ -166,17 +227,43 @@ void Server::onNewConnection()
         qCDebug(loggingCategoryServer) << "expected pending connection does not exist";
         return;
     }
-    qCInfo(loggingCategoryServer) << this << "An incoming connection from" << socket->peerAddress().toString();
     TcpTransport *transport = new TcpTransport(socket, this);
     socket->setParent(transport);
+    addClientConnection(transport);
+}
+
+void Server::addClientConnection(BaseTransport *transport)
+{
+    qCInfo(loggingCategoryServer) << this << "An incoming connection from" << transport->remoteAddress();
     RemoteClientConnection *client = new RemoteClientConnection(this);
+    // The transport is deleted along with the connection
+    transport->setParent(client);
     connect(client, &BaseConnection::statusChanged, this, &Server::onClientConnectionStatusChanged);
     client->setServerRsaKey(m_key);
     client->setTransport(transport);
     client->setServerApi(this);
     client->setRpcFactories(m_rpcOperationFactories);
+    client->setCryptoThreadPool(m_cryptoThreadPool);
+    client->setDhExponentPool(m_dhExponentPool);
+    client->setReplyCompressor(m_replyCompressor);
+    client->setOutboundLimiter(m_outboundLimiter);
+    client->setMetrics(m_metrics);
+
+#ifdef TELEGRAMQT_SERVER_EPOLL
+    const TransportBackend backend = qobject_cast<EpollTransport*>(transport) ? TransportBackend::Epoll : TransportBackend::Qt;
+#else
+    const TransportBackend backend = TransportBackend::Qt;
+#endif
+    ServerMetrics *metrics = m_metrics;
+    connect(transport, &BaseTransport::packetReceived, client, [metrics, backend](const QByteArray &payload) {
+        metrics->addReceivedPacket(backend, payload.size());
+    });
+    connect(transport, &BaseTransport::packetSent, client, [metrics, backend](const QByteArray &payload) {
+        metrics->addSentPacket(backend, payload.size());
+    });
 
     m_activeConnections.insert(client);
+    m_metrics->addActiveConnections(1);
 }
 
 void Server::onClientConnectionStatusChanged()
@@ -193,13 +280,19 @@ void Server::onClientConnectionStatusChanged()
             qCInfo(loggingCategoryServer) << this << __func__ << "Disconnected a client with session id"
                                           << hex << showbase << client->session()->id()
                                           << "from" << client->transport()->remoteAddress();
-            client->session()->setConnection(nullptr);
+            // The session might be already bound to a new connection of the client
+            if (client->session()->getConnection() == client) {
+                client->session()->setConnection(nullptr);
+                m_metrics->addActiveSessions(-1);
+            }
         } else {
             qCInfo(loggingCategoryServer) << this << __func__ << "Disconnected a client without a session"
                                           << "from" << client->transport()->remoteAddress();
         }
         // TODO: Initiate session cleanup after session expiration time out
-        m_activeConnections.remove(client);
+        if (m_activeConnections.remove(client)) {
+            m_metrics->addActiveConnections(-1);
+        }
         client->deleteLater();
     }
 }
@@ -228,7 +321,8 @@ MessageRecipient *Server::getRecipient(const Peer &peer, const LocalUser *applic
     Q_UNUSED(applicant)
     switch (peer.type) {
     case Telegram::Peer::User:
-        return getUser(peer.id);
+        // A user of another DC is a valid recipient too (see processMessage())
+        return getAbstractUser(peer.id);
     case Telegram::Peer::Chat:
         // recipient = api()->getChannel(arguments.peer.groupId, arguments.peer.accessHash);
         break;
@@ -255,13 +349,32 @@ LocalUser *Server::getUser(quint32 userId) const
 
 Peer Server::peerByUserName(const QString &userName) const
 {
-    // iterate over all users (too bad?)
-    for (LocalUser *user: m_users) {
-        if (user->userName() == userName) {
-            return user->toPeer();
+    const quint32 userId = m_userNameToUserId.value(userName.toCaseFolded());
+    if (!userId) {
+        return Peer();  // not found
+    }
+    return Peer::fromUserId(userId);
+}
+
+bool Server::setUserName(LocalUser *user, const QString &newUserName)
+{
+    // Usernames are case insensitive
+    const QString newKey = newUserName.toCaseFolded();
+    if (!newKey.isEmpty()) {
+        const quint32 ownerId = m_userNameToUserId.value(newKey);
+        if (ownerId && (ownerId != user->id())) {
+            return false;
         }
     }
-    return Peer();  // not found
+    const QString oldKey = user->userName().toCaseFolded();
+    if (!oldKey.isEmpty()) {
+        m_userNameToUserId.remove(oldKey);
+    }
+    user->setUserName(newUserName);
+    if (!newKey.isEmpty()) {
+        m_userNameToUserId.insert(newKey, user->id());
+    }
+    return true;
 }
 
 AbstractUser *Server::getUser(const TLInputUser &inputUser, LocalUser *self) const
@@ -308,7 +421,6 @@ bool Server::bindClientSession(RemoteClientConnection *client, quint64 sessionId
         session = new Session();
         session->ip = client->transport()->remoteAddress();
         session->sessionId = sessionId;
-        session->generateInitialServerSalt();
         m_sessions.insert(sessionId, session);
 
         if (client->dhLayer()->state() == DhLayer::State::HasKey) {
@@ -323,6 +435,9 @@ bool Server::bindClientSession(RemoteClientConnection *client, quint64 sessionId
         }
     }
 
+    if (!session->isActive()) {
+        m_metrics->addActiveSessions(1);
+    }
     client->setSession(session);
     return true;
 }
@@ -350,10 +465,21 @@ quint32 Server::getUserIdByAuthId(quint64 authId) const
 
 QVector<UpdateNotification> Server::processMessage(MessageData *messageData)
 {
+    m_metrics->addProcessedMessage();
     const Peer targetPeer = messageData->toPeer();
     LocalUser *fromUser = getUser(messageData->fromId());
-    MessageRecipient *recipient = getRecipient(targetPeer, fromUser);
-    QVector<PostBox *> boxes = recipient->postBoxes();
+    QVector<PostBox *> boxes;
+    if ((targetPeer.type == Peer::User) && !getUser(targetPeer.id)) {
+        // The recipient is a user of another DC
+        const AbstractUser *remoteUser = getRemoteUser(targetPeer.id);
+        RemoteServerConnection *remoteServer = remoteUser ? getRemoteServer(remoteUser->dcId()) : nullptr;
+        if (remoteServer) {
+            remoteServer->deliverMessage(*messageData);
+        }
+    } else {
+        MessageRecipient *recipient = getRecipient(targetPeer, fromUser);
+        boxes = recipient->postBoxes();
+    }
     if ((targetPeer.type == Peer::User) && !messageData->isMessageToSelf()) {
         boxes.append(fromUser->postBoxes());
     }
@@ -430,13 +556,13 @@ void Server::queueUpdates(const QVector<UpdateNotification> &notifications)
                 qWarning() << Q_FUNC_INFO << "no message";
                 continue;
             }
-            Utils::setupTLMessage(&update.message, messageData, notification.messageId, recipient);
+            Utils::setupTLMessage(&*update.message, messageData, notification.messageId, recipient);
             update.pts = notification.pts;
             update.ptsCount = 1;
 
             interestingPeers.insert(messageData->toPeer());
-            if (update.message.fromId) {
-                interestingPeers.insert(Peer::fromUserId(update.message.fromId));
+            if (update.message->fromId) {
+                interestingPeers.insert(Peer::fromUserId(update.message->fromId));
             }
 
             updates.seq = 0; // ??
@@ -478,6 +604,31 @@ void Server::insertUser(LocalUser *user)
     qCDebug(loggingCategoryServerApi) << Q_FUNC_INFO << user << user->phoneNumber() << user->id();
     m_users.insert(user->id(), user);
     m_phoneToUserId.insert(user->phoneNumber(), user->id());
+    if (!user->userName().isEmpty()) {
+        m_userNameToUserId.insert(user->userName().toCaseFolded(), user->id());
+    }
+}
+
+void Server::deliverRemoteMessage(const MessageData &message)
+{
+    LocalUser *recipient = getUser(message.toPeer().id);
+    if (!recipient) {
+        qCWarning(loggingCategoryServerApi) << this << __func__ << "Unknown recipient" << message.toPeer().id;
+        return;
+    }
+    MessageData *messageData = storage()->addMessageCopy(message);
+    PostBox *box = recipient->getPostBox();
+
+    UpdateNotification notification;
+    notification.type = UpdateNotification::Type::NewMessage;
+    notification.date = Telegram::Utils::getCurrentTime();
+    notification.messageId = box->addMessage(messageData);
+    notification.pts = box->pts();
+    notification.userId = recipient->id();
+    notification.dialogPeer = Peer::fromUserId(messageData->fromId());
+    recipient->syncDialogTopMessage(notification.dialogPeer, notification.messageId, messageData->date64());
+
+    queueUpdates({ notification });
 }
 
 PhoneStatus Server::getPhoneStatus(const QString &identifier) const
@@ -548,7 +699,7 @@ AbstractUser *Server::getAbstractUser(const QString &identifier) const
 AbstractUser *Server::getRemoteUser(quint32 userId) const
 {
     for (RemoteServerConnection *remoteServer : m_remoteServers) {
-        AbstractUser *u = remoteServer->api()->getUser(userId);
+        AbstractUser *u = remoteServer->getUser(userId);
         if (u) {
             return u;
         }
@@ -559,7 +710,7 @@ AbstractUser *Server::getRemoteUser(quint32 userId) const
 AbstractUser *Server::getRemoteUser(const QString &identifier) const
 {
     for (RemoteServerConnection *remoteServer : m_remoteServers) {
-        AbstractUser *u = remoteServer->api()->getUser(identifier);
+        AbstractUser *u = remoteServer->getUser(identifier);
         if (u) {
             return u;
         }
@@ -567,6 +718,16 @@ AbstractUser *Server::getRemoteUser(const QString &identifier) const
     return nullptr;
 }
 
+RemoteServerConnection *Server::getRemoteServer(quint32 dcId) const
+{
+    for (RemoteServerConnection *remoteServer : m_remoteServers) {
+        if (remoteServer->dcId() == dcId) {
+            return remoteServer;
+        }
+    }
+    return nullptr;
+}
+
 } // Server namespace
 
 } // Telegram namespace
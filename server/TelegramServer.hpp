@@ -8,9 +8,11 @@
 #include "TelegramNamespace.hpp"
 
 #include "ServerApi.hpp"
+#include "ServerNamespace.hpp"
 
 QT_FORWARD_DECLARE_CLASS(QTcpServer)
 QT_FORWARD_DECLARE_CLASS(QTcpSocket)
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
 QT_FORWARD_DECLARE_CLASS(QTimer)
 
 #include <QHash>
@@ -19,9 +21,18 @@ QT_FORWARD_DECLARE_CLASS(QTimer)
 
 namespace Telegram {
 
+class BaseTransport;
+
 namespace Server {
 
+class DhExponentPool;
+class EpollServer;
 class LocalUser;
+class MessageData;
+class RemoteCallQueue;
+class OutboundLimiter;
+class ReplyCompressor;
+class ServerMetrics;
 class Session;
 class RemoteClientConnection;
 class RemoteServerConnection;
@@ -39,6 +50,12 @@ public:
 
     void setServerPrivateRsaKey(const Telegram::RsaKey &key);
 
+    // The backend and the listener threads count are applied on start()
+    TransportBackend transportBackend() const { return m_transportBackend; }
+    void setTransportBackend(TransportBackend backend);
+    int listenerThreadCount() const { return m_listenerThreadCount; }
+    void setListenerThreadCount(int count);
+
     bool start();
     void stop();
     void loadData();
@@ -55,6 +72,15 @@ public:
 
     void registerAuthKey(quint64 authId, const QByteArray &authKey);
 
+    QThreadPool *cryptoThreadPool() const { return m_cryptoThreadPool; }
+    DhExponentPool *dhExponentPool() const { return m_dhExponentPool; }
+    ReplyCompressor *replyCompressor() const { return m_replyCompressor; }
+    OutboundLimiter *outboundLimiter() const { return m_outboundLimiter; }
+    // Thread-safe (the snapshots can be taken from any thread)
+    ServerMetrics *metrics() const { return m_metrics; }
+    // Thread-safe; runs the calls of the other DCs in the thread of the server
+    RemoteCallQueue *callQueue() const { return m_callQueue; }
+
     // ServerAPI:
     Authorization::Provider *getAuthorizationProvider() override { return m_authProvider; }
 
@@ -73,6 +99,7 @@ public:
     AbstractUser *getAbstractUser(const QString &identifier) const override;
     AbstractUser *getRemoteUser(quint32 userId) const;
     AbstractUser *getRemoteUser(const QString &identifier) const;
+    RemoteServerConnection *getRemoteServer(quint32 dcId) const;
 
     Telegram::Peer getPeer(const TLInputPeer &peer, const LocalUser *applicant) const override;
     MessageRecipient *getRecipient(const Peer &peer, const LocalUser *applicant) const override;
@@ -80,6 +107,7 @@ public:
     LocalUser *getUser(const QString &identifier) const override;
     LocalUser *getUser(quint32 userId) const override;
     Peer peerByUserName(const QString &userName) const override;
+    bool setUserName(LocalUser *user, const QString &newUserName) override;
     AbstractUser *getUser(const TLInputUser &inputUser, LocalUser *self) const override;
     AbstractUser *tryAccessUser(quint32 userId, quint64 accessHash, LocalUser *applicant) const override;
     LocalUser *addUser(const QString &identifier) override;
@@ -96,6 +124,9 @@ public:
 
     void insertUser(LocalUser *user);
 
+    // Adds a message sent from another DC to the box of the local recipient
+    void deliverRemoteMessage(const MessageData &message);
+
 signals:
 
 public slots:
@@ -104,6 +135,8 @@ protected slots:
     void onNewConnection();
 
 protected:
+    bool listen();
+    void addClientConnection(BaseTransport *transport);
     void onClientConnectionStatusChanged();
 
 protected:
@@ -112,10 +145,20 @@ protected:
 
 private:
     QTcpServer *m_serverSocket;
+    EpollServer *m_epollServer = nullptr;
+    TransportBackend m_transportBackend = TransportBackend::Qt;
+    int m_listenerThreadCount = 1;
+    QThreadPool *m_cryptoThreadPool;
+    DhExponentPool *m_dhExponentPool;
+    ReplyCompressor *m_replyCompressor;
+    OutboundLimiter *m_outboundLimiter;
+    ServerMetrics *m_metrics;
+    RemoteCallQueue *m_callQueue;
     DcOption m_dcOption;
     Telegram::RsaKey m_key;
 
     QHash<QString, quint32> m_phoneToUserId;
+    QHash<QString, quint32> m_userNameToUserId; // Case folded username to userId
     QHash<quint64, Session*> m_sessions; // Session id to session
     QHash<quint64, QByteArray> m_authorizations; // Auth id to auth key
     QHash<quint64, quint32> m_authToUser; // Auth key to userId
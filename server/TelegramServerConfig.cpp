@@ -33,6 +33,17 @@ namespace Server {
 namespace ConfigKey {
 
 static const QLatin1String c_privateKeyFile = QLatin1String("privateKeyFile");
+static const QLatin1String c_dhExponentPoolDepth = QLatin1String("dhExponentPoolDepth");
+static const QLatin1String c_dhExponentPoolThreads = QLatin1String("dhExponentPoolThreads");
+static const QLatin1String c_replyCompressionLevel = QLatin1String("replyCompressionLevel");
+static const QLatin1String c_replyCompressionThreshold = QLatin1String("replyCompressionThreshold");
+static const QLatin1String c_outboundHighWatermark = QLatin1String("outboundHighWatermark");
+static const QLatin1String c_outboundLowWatermark = QLatin1String("outboundLowWatermark");
+static const QLatin1String c_outboundHardLimit = QLatin1String("outboundHardLimit");
+static const QLatin1String c_transportBackend = QLatin1String("transportBackend");
+static const QLatin1String c_listenerThreads = QLatin1String("listenerThreads");
+static const QLatin1String c_metricsPort = QLatin1String("metricsPort");
+static const QLatin1String c_metricsDumpFile = QLatin1String("metricsDumpFile");
 static const QLatin1String c_serverConfiguration = QLatin1String("serverConfiguration");
 static const QLatin1String c_dcOptions = QLatin1String("dcOptions");
 static const QLatin1String c_address = QLatin1String("address");
@@ -41,7 +52,32 @@ static const QLatin1String c_id = QLatin1String("id");
 
 } // ConfigKey namespace
 
-Config::Config(const QString &fileName)
+static const int c_defaultDhExponentPoolDepth = 16;
+static const int c_defaultDhExponentPoolThreads = 1;
+static const int c_defaultReplyCompressionLevel = 6;
+static const int c_defaultReplyCompressionThreshold = 128;
+static const int c_defaultOutboundHighWatermark = 1024 * 1024;
+static const int c_defaultOutboundLowWatermark = 256 * 1024;
+static const int c_defaultOutboundHardLimit = 16 * 1024 * 1024;
+static const int c_defaultListenerThreads = 1;
+static const int c_defaultMetricsPort = 0;
+static const QLatin1String c_defaultMetricsDumpFile = QLatin1String("metrics.prom");
+
+static const QLatin1String c_qtTransportBackend = QLatin1String("qt");
+static const QLatin1String c_epollTransportBackend = QLatin1String("epoll");
+
+Config::Config(const QString &fileName) :
+    m_dhExponentPoolDepth(c_defaultDhExponentPoolDepth),
+    m_dhExponentPoolThreads(c_defaultDhExponentPoolThreads),
+    m_replyCompressionLevel(c_defaultReplyCompressionLevel),
+    m_replyCompressionThreshold(c_defaultReplyCompressionThreshold),
+    m_outboundHighWatermark(c_defaultOutboundHighWatermark),
+    m_outboundLowWatermark(c_defaultOutboundLowWatermark),
+    m_outboundHardLimit(c_defaultOutboundHardLimit),
+    m_transportBackend(TransportBackend::Qt),
+    m_listenerThreads(c_defaultListenerThreads),
+    m_metricsPort(c_defaultMetricsPort),
+    m_metricsDumpFile(c_defaultMetricsDumpFile)
 {
     if (fileName.isEmpty()) {
         m_fileName = QStringLiteral("config.json");
@@ -73,6 +109,61 @@ void Config::setPrivateKeyFile(const QString &fileName)
     m_privateKeyFile = fileName;
 }
 
+void Config::setDhExponentPoolDepth(int depth)
+{
+    m_dhExponentPoolDepth = depth;
+}
+
+void Config::setDhExponentPoolThreads(int threads)
+{
+    m_dhExponentPoolThreads = threads;
+}
+
+void Config::setReplyCompressionLevel(int level)
+{
+    m_replyCompressionLevel = level;
+}
+
+void Config::setReplyCompressionThreshold(int bytes)
+{
+    m_replyCompressionThreshold = bytes;
+}
+
+void Config::setOutboundHighWatermark(int bytes)
+{
+    m_outboundHighWatermark = bytes;
+}
+
+void Config::setOutboundLowWatermark(int bytes)
+{
+    m_outboundLowWatermark = bytes;
+}
+
+void Config::setOutboundHardLimit(int bytes)
+{
+    m_outboundHardLimit = bytes;
+}
+
+void Config::setTransportBackend(TransportBackend backend)
+{
+    m_transportBackend = backend;
+}
+
+void Config::setListenerThreads(int threads)
+{
+    m_listenerThreads = threads;
+}
+
+void Config::setMetricsPort(int port)
+{
+    m_metricsPort = port;
+}
+
+void Config::setMetricsDumpFile(const QString &fileName)
+{
+    m_metricsDumpFile = fileName;
+}
+
 bool Config::load()
 {
     QByteArray bytes;
@@ -101,6 +192,25 @@ bool Config::load()
 
     // read private key setting
     m_privateKeyFile = obj[ConfigKey::c_privateKeyFile].toString();
+    m_dhExponentPoolDepth = obj[ConfigKey::c_dhExponentPoolDepth].toInt(c_defaultDhExponentPoolDepth);
+    m_dhExponentPoolThreads = obj[ConfigKey::c_dhExponentPoolThreads].toInt(c_defaultDhExponentPoolThreads);
+    m_replyCompressionLevel = obj[ConfigKey::c_replyCompressionLevel].toInt(c_defaultReplyCompressionLevel);
+    m_replyCompressionThreshold = obj[ConfigKey::c_replyCompressionThreshold].toInt(c_defaultReplyCompressionThreshold);
+    m_outboundHighWatermark = obj[ConfigKey::c_outboundHighWatermark].toInt(c_defaultOutboundHighWatermark);
+    m_outboundLowWatermark = obj[ConfigKey::c_outboundLowWatermark].toInt(c_defaultOutboundLowWatermark);
+    m_outboundHardLimit = obj[ConfigKey::c_outboundHardLimit].toInt(c_defaultOutboundHardLimit);
+    const QString transportBackend = obj[ConfigKey::c_transportBackend].toString(c_qtTransportBackend);
+    if (transportBackend == c_epollTransportBackend) {
+        m_transportBackend = TransportBackend::Epoll;
+    } else {
+        if (transportBackend != c_qtTransportBackend) {
+            qCWarning(loggingCategoryConfig) << "Unknown transport backend" << transportBackend;
+        }
+        m_transportBackend = TransportBackend::Qt;
+    }
+    m_listenerThreads = obj[ConfigKey::c_listenerThreads].toInt(c_defaultListenerThreads);
+    m_metricsPort = obj[ConfigKey::c_metricsPort].toInt(c_defaultMetricsPort);
+    m_metricsDumpFile = obj[ConfigKey::c_metricsDumpFile].toString(c_defaultMetricsDumpFile);
 
     // read server configuration
     const QJsonObject &jserverConfig = obj[ConfigKey::c_serverConfiguration].toObject();
@@ -124,6 +234,18 @@ bool Config::save() const
 {
     QJsonObject jobj;
     jobj[ConfigKey::c_privateKeyFile] = m_privateKeyFile;
+    jobj[ConfigKey::c_dhExponentPoolDepth] = m_dhExponentPoolDepth;
+    jobj[ConfigKey::c_dhExponentPoolThreads] = m_dhExponentPoolThreads;
+    jobj[ConfigKey::c_replyCompressionLevel] = m_replyCompressionLevel;
+    jobj[ConfigKey::c_replyCompressionThreshold] = m_replyCompressionThreshold;
+    jobj[ConfigKey::c_outboundHighWatermark] = m_outboundHighWatermark;
+    jobj[ConfigKey::c_outboundLowWatermark] = m_outboundLowWatermark;
+    jobj[ConfigKey::c_outboundHardLimit] = m_outboundHardLimit;
+    jobj[ConfigKey::c_transportBackend] = m_transportBackend == TransportBackend::Epoll
+            ? c_epollTransportBackend : c_qtTransportBackend;
+    jobj[ConfigKey::c_listenerThreads] = m_listenerThreads;
+    jobj[ConfigKey::c_metricsPort] = m_metricsPort;
+    jobj[ConfigKey::c_metricsDumpFile] = m_metricsDumpFile;
 
     QJsonObject jserverConfiguration;
     QJsonArray jdcArr;
@@ -19,6 +19,7 @@
 #define TELEGRAM_SERVER_CONFIG_HPP
 
 #include "DcConfiguration.hpp"
+#include "ServerNamespace.hpp"
 
 namespace Telegram {
 
@@ -37,12 +38,64 @@ public:
     QString privateKeyFile() const { return m_privateKeyFile; }
     void setPrivateKeyFile(const QString &fileName);
 
+    int dhExponentPoolDepth() const { return m_dhExponentPoolDepth; }
+    void setDhExponentPoolDepth(int depth);
+
+    int dhExponentPoolThreads() const { return m_dhExponentPoolThreads; }
+    void setDhExponentPoolThreads(int threads);
+
+    // The gzip level of RPC replies (0 disables the compression)
+    int replyCompressionLevel() const { return m_replyCompressionLevel; }
+    void setReplyCompressionLevel(int level);
+
+    // The replies of this size or smaller are sent uncompressed
+    int replyCompressionThreshold() const { return m_replyCompressionThreshold; }
+    void setReplyCompressionThreshold(int bytes);
+
+    // The updates are not written to a client with this many bytes pending (0 disables the limit)
+    int outboundHighWatermark() const { return m_outboundHighWatermark; }
+    void setOutboundHighWatermark(int bytes);
+
+    // The suspended updates are resumed once the pending bytes drop to this value
+    int outboundLowWatermark() const { return m_outboundLowWatermark; }
+    void setOutboundLowWatermark(int bytes);
+
+    // A client with more bytes pending is disconnected (0 disables the limit)
+    int outboundHardLimit() const { return m_outboundHardLimit; }
+    void setOutboundHardLimit(int bytes);
+
+    TransportBackend transportBackend() const { return m_transportBackend; }
+    void setTransportBackend(TransportBackend backend);
+
+    // The number of SO_REUSEPORT listener threads of the epoll transport
+    int listenerThreads() const { return m_listenerThreads; }
+    void setListenerThreads(int threads);
+
+    // The port of the Prometheus metrics endpoint on localhost (0 disables the endpoint)
+    int metricsPort() const { return m_metricsPort; }
+    void setMetricsPort(int port);
+
+    // The metrics are written to this file on SIGUSR1 (the empty name disables the dump)
+    QString metricsDumpFile() const { return m_metricsDumpFile; }
+    void setMetricsDumpFile(const QString &fileName);
+
     bool load();
     bool save() const;
 
 private:
     QString m_fileName;
     QString m_privateKeyFile;
+    int m_dhExponentPoolDepth;
+    int m_dhExponentPoolThreads;
+    int m_replyCompressionLevel;
+    int m_replyCompressionThreshold;
+    int m_outboundHighWatermark;
+    int m_outboundLowWatermark;
+    int m_outboundHardLimit;
+    TransportBackend m_transportBackend;
+    int m_listenerThreads;
+    int m_metricsPort;
+    QString m_metricsDumpFile;
     DcConfiguration m_serverConfiguration;
 };
 
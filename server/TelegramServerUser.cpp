@@ -10,10 +10,20 @@
 #include <QCryptographicHash>
 #include <QLoggingCategory>
 
+#include <algorithm>
+
 namespace Telegram {
 
 namespace Server {
 
+static QString getSearchableText(const MessageData *message)
+{
+    if (message->media().caption.isEmpty()) {
+        return message->text();
+    }
+    return message->text() + QLatin1Char(' ') + message->media().caption;
+}
+
 quint32 PostBox::addMessage(MessageData *message)
 {
     ++m_lastMessageId;
@@ -21,19 +31,56 @@ quint32 PostBox::addMessage(MessageData *message)
 
     message->addReference(peer(), m_lastMessageId);
     m_messages.insert(m_lastMessageId, message->globalId());
+    m_messagePts.append(m_pts);
+    m_searchIndex.addMessage(m_lastMessageId, getDialogPeer(message), getSearchableText(message));
     return m_lastMessageId;
 }
 
+bool PostBox::removeMessage(quint32 messageId, const MessageData *message)
+{
+    if (!m_messages.remove(messageId)) {
+        return false;
+    }
+    m_searchIndex.removeMessage(messageId, getDialogPeer(message), getSearchableText(message));
+    return true;
+}
+
 quint64 PostBox::getMessageGlobalId(quint32 messageId) const
 {
     return m_messages.value(messageId);
 }
 
+quint32 PostBox::getFirstMessageIdAfterPts(quint32 pts) const
+{
+    // Both of message ids and pts grow monotonically, so the vector is sorted
+    const auto it = std::upper_bound(m_messagePts.constBegin(), m_messagePts.constEnd(), pts);
+    if (it == m_messagePts.constEnd()) {
+        return 0;
+    }
+    return static_cast<quint32>(it - m_messagePts.constBegin()) + 1;
+}
+
+quint32 PostBox::getMessagePts(quint32 messageId) const
+{
+    if (!messageId || (messageId > static_cast<quint32>(m_messagePts.count()))) {
+        return 0;
+    }
+    return m_messagePts.at(static_cast<int>(messageId - 1));
+}
+
 QHash<quint32, quint64> PostBox::getAllMessageKeys() const
 {
     return m_messages;
 }
 
+Peer PostBox::getDialogPeer(const MessageData *message) const
+{
+    if (m_peer.type == Peer::User) {
+        return message->getDialogPeer(m_peer.id);
+    }
+    return m_peer;
+}
+
 TLPeer MessageRecipient::toTLPeer() const
 {
     const Peer p = toPeer();
@@ -69,6 +116,30 @@ UserContact AbstractUser::toContact() const
     return contact;
 }
 
+RemoteUser::RemoteUser(const AbstractUser *user) :
+    m_id(user->id()),
+    m_phoneNumber(user->phoneNumber()),
+    m_userName(user->userName()),
+    m_firstName(user->firstName()),
+    m_lastName(user->lastName()),
+    m_online(user->isOnline()),
+    m_dcId(user->dcId()),
+    m_photos(user->getImages()),
+    m_contactList(user->contactList())
+{
+    for (const quint32 contactId : m_contactList) {
+        m_contactIds.insert(contactId);
+    }
+}
+
+ImageDescriptor RemoteUser::getCurrentImage() const
+{
+    if (m_photos.isEmpty()) {
+        return ImageDescriptor();
+    }
+    return m_photos.first();
+}
+
 void LocalUser::setPhoneNumber(const QString &phoneNumber)
 {
     m_phoneNumber = phoneNumber;
@@ -177,7 +248,8 @@ void LocalUser::importContact(const UserContact &contact)
     // Check for contact registration status and the contact id setup performed out of this function
     m_importedContacts.append(contact);
 
-    if (contact.id) {
+    if (contact.id && !m_contactIds.contains(contact.id)) {
+        m_contactIds.insert(contact.id);
         m_contactList.append(contact.id);
     }
 }
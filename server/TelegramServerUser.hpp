@@ -4,7 +4,9 @@
 #include <QObject>
 #include <QVector>
 #include <QHash>
+#include <QSet>
 
+#include "MessageSearchIndex.hpp"
 #include "ServerNamespace.hpp"
 #include "TLTypes.hpp"
 
@@ -31,15 +33,26 @@ public:
     virtual QVector<quint32> users() const = 0;
 
     quint32 addMessage(MessageData *message);
+    bool removeMessage(quint32 messageId, const MessageData *message);
     quint64 getMessageGlobalId(quint32 messageId) const;
 
+    // Returns the id of the first message added after the pts or 0 if there is no such message
+    quint32 getFirstMessageIdAfterPts(quint32 pts) const;
+    quint32 getMessagePts(quint32 messageId) const;
+
     QHash<quint32,quint64> getAllMessageKeys() const;
 
+    const MessageSearchIndex *searchIndex() const { return &m_searchIndex; }
+
 protected:
+    Peer getDialogPeer(const MessageData *message) const;
+
     Peer m_peer;
     quint32 m_pts = 0;
     quint32 m_lastMessageId = 0;
     QHash<quint32,quint64> m_messages; // messageId to MessageData object id
+    QVector<quint32> m_messagePts; // The pts of the message with id (index + 1)
+    MessageSearchIndex m_searchIndex;
 };
 
 class UserPostBox : public PostBox
@@ -81,11 +94,48 @@ public:
     virtual QVector<ImageDescriptor> getImages() const = 0;
     virtual ImageDescriptor getCurrentImage() const = 0;
     virtual QVector<quint32> contactList() const = 0;
+    virtual bool hasContact(quint32 userId) const = 0;
 
     Peer toPeer() const override { return Peer::fromUserId(id()); }
     UserContact toContact() const;
 };
 
+// A copy of a user of another DC.
+// Used when the DC lives in another thread, so its LocalUser objects can not be accessed directly.
+class RemoteUser : public AbstractUser
+{
+public:
+    RemoteUser() = default;
+    explicit RemoteUser(const AbstractUser *user);
+
+    quint32 id() const override { return m_id; }
+    QString phoneNumber() const override { return m_phoneNumber; }
+    QString userName() const override { return m_userName; }
+    QString firstName() const override { return m_firstName; }
+    QString lastName() const override { return m_lastName; }
+    bool isOnline() const override { return m_online; }
+    quint32 dcId() const override { return m_dcId; }
+    QVector<ImageDescriptor> getImages() const override { return m_photos; }
+    ImageDescriptor getCurrentImage() const override;
+    QVector<quint32> contactList() const override { return m_contactList; }
+    bool hasContact(quint32 userId) const override { return m_contactIds.contains(userId); }
+
+    // The messages are delivered to the user via the remote server
+    QVector<PostBox *> postBoxes() override { return {}; }
+
+protected:
+    quint32 m_id = 0;
+    QString m_phoneNumber;
+    QString m_userName;
+    QString m_firstName;
+    QString m_lastName;
+    bool m_online = false;
+    quint32 m_dcId = 0;
+    QVector<ImageDescriptor> m_photos;
+    QVector<quint32> m_contactList;
+    QSet<quint32> m_contactIds;
+};
+
 class LocalUser : public AbstractUser
 {
 public:
@@ -95,6 +145,7 @@ public:
     void setPhoneNumber(const QString &phoneNumber);
 
     QString userName() const override { return m_userName; }
+    // Use ServerApi::setUserName() to keep the server username index in sync
     void setUserName(const QString &userName);
 
     QString firstName() const override { return m_firstName; }
@@ -134,6 +185,7 @@ public:
 
     void importContact(const UserContact &contact);
     QVector<quint32> contactList() const override { return m_contactList; }
+    bool hasContact(quint32 userId) const override { return m_contactIds.contains(userId); }
     const QVector<UserDialog *> dialogs() const { return m_dialogs; }
 
     QVector<UserContact> importedContacts() const { return m_importedContacts; }
@@ -161,6 +213,7 @@ protected:
 
     QVector<UserDialog *> m_dialogs;
     QVector<quint32> m_contactList; // Contains only registered users from the added contacts
+    QSet<quint32> m_contactIds; // The same ids as in m_contactList for the lookups
     QVector<UserContact> m_importedContacts; // Contains phone + name of all added contacts (including not registered yet)
 };
 
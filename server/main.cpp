@@ -15,10 +15,16 @@
 
  */
 
+#include "TelegramServer.hpp"
 #include "TelegramServerConfig.hpp"
 #include "TelegramServerUser.hpp"
 #include "DcConfiguration.hpp"
+#include "DhExponentPool.hpp"
+#include "OutboundLimiter.hpp"
+#include "ReplyCompressor.hpp"
 #include "LocalCluster.hpp"
+#include "MetricsExporter.hpp"
+#include "ServerMetrics.hpp"
 #include "Session.hpp"
 
 #include "Utils.hpp"
@@ -105,6 +111,7 @@ int main(int argc, char *argv[])
     LocalCluster cluster;
     cluster.setServerPrivateRsaKey(key);
     cluster.setServerConfiguration(config.serverConfiguration());
+    cluster.setTransportBackend(config.transportBackend(), config.listenerThreads());
 
 #ifdef USE_DBUS_NOTIFIER
     DBusCodeAuthProvider authProvider;
@@ -116,5 +123,24 @@ int main(int argc, char *argv[])
         return -2;
     }
 
+    for (Server *server : cluster.getServerInstances()) {
+        server->dhExponentPool()->setRefillThreadCount(config.dhExponentPoolThreads());
+        server->dhExponentPool()->setDepth(config.dhExponentPoolDepth());
+        server->replyCompressor()->setCompressionLevel(config.replyCompressionLevel());
+        server->replyCompressor()->setThreshold(config.replyCompressionThreshold());
+        server->outboundLimiter()->setHighWatermark(config.outboundHighWatermark());
+        server->outboundLimiter()->setLowWatermark(config.outboundLowWatermark());
+        server->outboundLimiter()->setHardLimit(config.outboundHardLimit());
+    }
+
+    MetricsExporter metricsExporter;
+    for (Server *server : cluster.getServerInstances()) {
+        metricsExporter.addServer(server->dcId(), server->metrics());
+    }
+    if (config.metricsPort() > 0) {
+        metricsExporter.listen(static_cast<quint16>(config.metricsPort()));
+    }
+    metricsExporter.setSignalDumpFile(config.metricsDumpFile());
+
     return a.exec();
 }
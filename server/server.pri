@@ -1,11 +1,17 @@
 
 SOURCES += $$PWD/DefaultAuthorizationProvider.cpp
+SOURCES += $$PWD/DhExponentPool.cpp
 SOURCES += $$PWD/LocalCluster.cpp
+SOURCES += $$PWD/MessageSearchIndex.cpp
+SOURCES += $$PWD/MetricsExporter.cpp
+SOURCES += $$PWD/OutboundLimiter.cpp
 SOURCES += $$PWD/ServerDhLayer.cpp
 SOURCES += $$PWD/ServerMessageData.cpp
+SOURCES += $$PWD/ServerMetrics.cpp
 SOURCES += $$PWD/ServerRpcLayer.cpp
 SOURCES += $$PWD/ServerRpcOperation.cpp
 SOURCES += $$PWD/ServerUtils.cpp
+SOURCES += $$PWD/ReplyCompressor.cpp
 SOURCES += $$PWD/Session.cpp
 SOURCES += $$PWD/Storage.cpp
 SOURCES += $$PWD/RpcOperationFactory.cpp
@@ -16,19 +22,26 @@ SOURCES += $$PWD/TelegramServerUser.cpp
 SOURCES += $$PWD/CServerTcpTransport.cpp
 SOURCES += $$PWD/RemoteClientConnection.cpp
 SOURCES += $$PWD/RemoteClientConnectionHelper.cpp
+SOURCES += $$PWD/RemoteCallQueue.cpp
 SOURCES += $$PWD/RemoteServerConnection.cpp
 SOURCES += $$PWD/FunctionStreamOperators.cpp
 
 HEADERS += $$PWD/AuthorizationProvider.hpp
 HEADERS += $$PWD/DefaultAuthorizationProvider.hpp
+HEADERS += $$PWD/DhExponentPool.hpp
 HEADERS += $$PWD/LocalCluster.hpp
+HEADERS += $$PWD/MessageSearchIndex.hpp
+HEADERS += $$PWD/MetricsExporter.hpp
+HEADERS += $$PWD/OutboundLimiter.hpp
 HEADERS += $$PWD/ServerApi.hpp
 HEADERS += $$PWD/ServerDhLayer.hpp
 HEADERS += $$PWD/ServerNamespace.hpp
 HEADERS += $$PWD/ServerMessageData.hpp
+HEADERS += $$PWD/ServerMetrics.hpp
 HEADERS += $$PWD/ServerRpcLayer.hpp
 HEADERS += $$PWD/ServerRpcOperation.hpp
 HEADERS += $$PWD/ServerUtils.hpp
+HEADERS += $$PWD/ReplyCompressor.hpp
 HEADERS += $$PWD/Session.hpp
 HEADERS += $$PWD/Storage.hpp
 HEADERS += $$PWD/RpcOperationFactory.hpp
@@ -40,7 +53,16 @@ HEADERS += $$PWD/TelegramServerUser.hpp
 HEADERS += $$PWD/CServerTcpTransport.hpp
 HEADERS += $$PWD/RemoteClientConnection.hpp
 HEADERS += $$PWD/RemoteClientConnectionHelper.hpp
+HEADERS += $$PWD/RemoteCallQueue.hpp
 HEADERS += $$PWD/RemoteServerConnection.hpp
 HEADERS += $$PWD/FunctionStreamOperators.hpp
 
+linux:!android {
+    SOURCES += $$PWD/EpollTransport.cpp
+    HEADERS += $$PWD/EpollTransport.hpp
+    DEFINES += TELEGRAMQT_SERVER_EPOLL
+}
+
 include(RpcOperations/operations.pri)
+
+QT += concurrent
@@ -0,0 +1,672 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "AccountStorage.hpp"
+#include "CAppInformation.hpp"
+#include "Client.hpp"
+#include "ClientSettings.hpp"
+#include "ConnectionApi.hpp"
+#include "ContactsApi.hpp"
+#include "DataStorage.hpp"
+#include "DialogList.hpp"
+#include "MessagingApi.hpp"
+#include "PendingOperation.hpp"
+#include "Operations/ClientAuthOperation.hpp"
+#include "Operations/PendingContactsOperation.hpp"
+#include "Operations/PendingMessages.hpp"
+
+#include "DefaultAuthorizationProvider.hpp"
+#include "LocalCluster.hpp"
+#include "TelegramServer.hpp"
+
+// Test keys
+#include "keys_data.hpp"
+#include "test_server_data.hpp"
+#include "TestServerUtils.hpp"
+#include "TestUserData.hpp"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Telegram;
+
+class FixedCodeAuthProvider : public Server::Authorization::DefaultProvider
+{
+public:
+    static const QString c_code;
+protected:
+    Server::Authorization::Code generateCode(Server::Session *session, const QString &identifier) override;
+};
+
+const QString FixedCodeAuthProvider::c_code = QStringLiteral("11111");
+
+Server::Authorization::Code FixedCodeAuthProvider::generateCode(Server::Session *session, const QString &identifier)
+{
+    Server::Authorization::Code code = DefaultProvider::generateCode(session, identifier);
+    code.code = c_code;
+    return code;
+}
+
+enum class OperationType {
+    SendMessage,
+    GetHistory,
+    GetDialogs,
+    Count,
+};
+
+static const char *const c_operationNames[] = {
+    "sendMessage",
+    "getHistory",
+    "getDialogs",
+};
+
+struct LoadOptions
+{
+    int clients = 10;
+    int userDcs = 1; // The users are spread over this number of DCs
+    int durationSeconds = 10;
+    double rate = 10; // Operations per second per client
+    int maxInFlight = 32; // Per client; the operations beyond the limit are skipped
+    int weights[static_cast<int>(OperationType::Count)] = { 60, 30, 10 };
+    int messageSize = 64;
+    quint32 historyLimit = 20;
+    bool dcThreads = false;
+    Server::TransportBackend transportBackend = Server::TransportBackend::Qt;
+    int listenerThreads = 1;
+    quint32 seed = 0;
+};
+
+struct OperationStats
+{
+    QVector<qint64> latencies; // nsecs
+    quint64 failed = 0;
+};
+
+class LoadGenerator;
+
+class LoadClient : public QObject
+{
+    Q_OBJECT
+public:
+    LoadClient(LoadGenerator *generator, const UserData &userData, const UserData &peerData);
+
+    void signIn();
+    void runOperation(OperationType type);
+
+    int inFlight() const { return m_inFlight; }
+    int pendingMessages() const { return m_pendingMessages.count(); }
+
+signals:
+    void ready();
+    void setupFailed(const QString &reason);
+
+protected:
+    void onSignInFinished(PendingOperation *operation);
+    void onAddContactFinished(PendingOperation *operation);
+    void onMessageSent(const Telegram::Peer peer, quint64 messageRandomId, quint32 messageId);
+    void onOperationFinished(OperationType type, qint64 startTime, PendingOperation *operation);
+
+    LoadGenerator *m_generator;
+    Client::Client *m_client;
+    UserData m_userData;
+    UserData m_peerData;
+    Telegram::Peer m_peer;
+    QString m_messageText;
+    QHash<quint64, qint64> m_pendingMessages; // Random id to the start time
+    int m_inFlight = 0;
+};
+
+class LoadGenerator : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LoadGenerator(const LoadOptions &options, QObject *parent = nullptr);
+
+    bool start();
+
+    const LoadOptions &options() const { return m_options; }
+    const RsaKey &publicKey() const { return m_publicKey; }
+    Client::AppInformation *appInformation() const { return m_appInformation; }
+
+    // Nanoseconds since the load started
+    qint64 now() const { return m_clock.nsecsElapsed(); }
+    void recordOperation(OperationType type, qint64 startTime, bool succeeded);
+    void recordSkipped() { ++m_skippedOperations; }
+
+signals:
+    void finished(int exitCode);
+
+protected:
+    void onClientReady();
+    void onClientSetupFailed(const QString &reason);
+    void onSetupTimeout();
+    void runLoad();
+    void onTick(LoadClient *client);
+    void stopLoad();
+    void checkDrained();
+    void report();
+
+    OperationType nextOperation();
+
+    LoadOptions m_options;
+    RsaKey m_publicKey;
+    Server::LocalCluster *m_cluster = nullptr;
+    FixedCodeAuthProvider m_authProvider;
+    Client::AppInformation *m_appInformation = nullptr;
+    QVector<LoadClient *> m_clients;
+    QVector<QTimer *> m_timers;
+    QTimer m_setupTimer;
+    QElapsedTimer m_clock;
+    QElapsedTimer m_drainTimer;
+    std::mt19937 m_random;
+    OperationStats m_stats[static_cast<int>(OperationType::Count)];
+    quint64 m_skippedOperations = 0;
+    qint64 m_loadDuration = 0; // nsecs
+    int m_readyClients = 0;
+    bool m_running = false;
+};
+
+LoadClient::LoadClient(LoadGenerator *generator, const UserData &userData, const UserData &peerData) :
+    QObject(generator),
+    m_generator(generator),
+    m_userData(userData),
+    m_peerData(peerData),
+    m_messageText(generator->options().messageSize, QLatin1Char('x'))
+{
+    m_client = new Client::Client(this);
+    Client::AccountStorage *accountStorage = new Client::AccountStorage(m_client);
+    accountStorage->setPhoneNumber(userData.phoneNumber);
+    accountStorage->setDcInfo(c_localDcOptions.first());
+    Client::Settings *clientSettings = new Client::Settings(m_client);
+    clientSettings->setServerConfiguration({ c_localDcOptions.first() });
+    clientSettings->setServerRsaKey(generator->publicKey());
+    m_client->setAppInformation(generator->appInformation());
+    m_client->setSettings(clientSettings);
+    m_client->setAccountStorage(accountStorage);
+    m_client->setDataStorage(new Client::InMemoryDataStorage(m_client));
+
+    connect(m_client->messagingApi(), &Client::MessagingApi::messageSent, this, &LoadClient::onMessageSent);
+}
+
+void LoadClient::signIn()
+{
+    Client::AuthOperation *signInOperation = m_client->connectionApi()->startAuthentication();
+    connect(signInOperation, &Client::AuthOperation::authCodeRequired, signInOperation, [signInOperation]() {
+        signInOperation->submitAuthCode(FixedCodeAuthProvider::c_code);
+    });
+    connect(signInOperation, &PendingOperation::finished, this, &LoadClient::onSignInFinished);
+    signInOperation->setPhoneNumber(m_userData.phoneNumber);
+}
+
+void LoadClient::onSignInFinished(PendingOperation *operation)
+{
+    if (!operation->isSucceeded()) {
+        emit setupFailed(QLatin1String("Unable to sign in ") + m_userData.phoneNumber);
+        return;
+    }
+
+    // Add the peer as a contact to get its access hash
+    Client::ContactsApi::ContactInfo peerInfo;
+    peerInfo.phoneNumber = m_peerData.phoneNumber;
+    peerInfo.firstName = m_peerData.firstName;
+    peerInfo.lastName = m_peerData.lastName;
+    PendingOperation *addContactOperation = m_client->contactsApi()->addContacts({ peerInfo });
+    connect(addContactOperation, &PendingOperation::finished, this, &LoadClient::onAddContactFinished);
+}
+
+void LoadClient::onAddContactFinished(PendingOperation *operation)
+{
+    Client::PendingContactsOperation *addContactOperation = static_cast<Client::PendingContactsOperation *>(operation);
+    if (!addContactOperation->isSucceeded() || addContactOperation->peers().isEmpty()) {
+        emit setupFailed(QLatin1String("Unable to add contact ") + m_peerData.phoneNumber);
+        return;
+    }
+    m_peer = addContactOperation->peers().first();
+    addContactOperation->deleteLater();
+    emit ready();
+}
+
+void LoadClient::runOperation(OperationType type)
+{
+    if (m_inFlight >= m_generator->options().maxInFlight) {
+        m_generator->recordSkipped();
+        return;
+    }
+    ++m_inFlight;
+    const qint64 startTime = m_generator->now();
+
+    Client::MessagingApi *messagingApi = m_client->messagingApi();
+    PendingOperation *operation = nullptr;
+    switch (type) {
+    case OperationType::SendMessage:
+        // The message is finished on messageSent()
+        m_pendingMessages.insert(messagingApi->sendMessage(m_peer, m_messageText), startTime);
+        return;
+    case OperationType::GetHistory:
+        operation = messagingApi->getHistory(m_peer, Client::MessageFetchOptions::useLimit(m_generator->options().historyLimit));
+        break;
+    case OperationType::GetDialogs: {
+        // A DialogList fetches the dialogs only once, so use a new list each time
+        Client::DialogList *dialogList = new Client::DialogList(messagingApi);
+        operation = dialogList->becomeReady();
+        connect(operation, &PendingOperation::finished, dialogList, &QObject::deleteLater);
+        break;
+    }
+    case OperationType::Count:
+        break;
+    }
+    connect(operation, &PendingOperation::finished, this, [this, type, startTime](PendingOperation *finishedOperation) {
+        onOperationFinished(type, startTime, finishedOperation);
+    });
+}
+
+void LoadClient::onMessageSent(const Peer peer, quint64 messageRandomId, quint32 messageId)
+{
+    Q_UNUSED(peer)
+    Q_UNUSED(messageId)
+    if (!m_pendingMessages.contains(messageRandomId)) {
+        return;
+    }
+    --m_inFlight;
+    m_generator->recordOperation(OperationType::SendMessage, m_pendingMessages.take(messageRandomId), true);
+}
+
+void LoadClient::onOperationFinished(OperationType type, qint64 startTime, PendingOperation *operation)
+{
+    --m_inFlight;
+    m_generator->recordOperation(type, startTime, operation->isSucceeded());
+    operation->deleteLater();
+}
+
+LoadGenerator::LoadGenerator(const LoadOptions &options, QObject *parent) :
+    QObject(parent),
+    m_options(options),
+    m_random(options.seed)
+{
+    m_appInformation = new Client::AppInformation(this);
+    m_appInformation->setAppId(14617);
+    m_appInformation->setAppHash(QLatin1String("e17ac360fd072f83d5d08db45ce9a121"));
+    m_appInformation->setAppVersion(QLatin1String("0.1"));
+    m_appInformation->setDeviceInfo(QLatin1String("loadgen"));
+    m_appInformation->setOsInfo(QLatin1String("GNU/Linux"));
+    m_appInformation->setLanguageCode(QLatin1String("en"));
+
+    m_setupTimer.setSingleShot(true);
+    connect(&m_setupTimer, &QTimer::timeout, this, &LoadGenerator::onSetupTimeout);
+}
+
+bool LoadGenerator::start()
+{
+    m_publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    if (!m_publicKey.isValid() || !privateKey.isPrivate()) {
+        qCritical() << "Unable to read RSA keys.";
+        return false;
+    }
+
+    m_cluster = new Server::LocalCluster(this);
+    m_cluster->setAuthorizationProvider(&m_authProvider);
+    m_cluster->setServerPrivateRsaKey(privateKey);
+    m_cluster->setServerConfiguration(c_localDcConfiguration);
+    m_cluster->setTransportBackend(m_options.transportBackend, m_options.listenerThreads);
+    m_cluster->setDcThreadsEnabled(m_options.dcThreads);
+    if (!m_cluster->start()) {
+        qCritical() << "Unable to start the cluster.";
+        return false;
+    }
+
+    QVector<UserData> users;
+    users.reserve(m_options.clients);
+    for (int i = 0; i < m_options.clients; ++i) {
+        const quint32 dcId = c_localDcOptions.at(i % m_options.userDcs).id;
+        const UserData userData = mkUserData(i, dcId);
+        if (!tryAddUser(m_cluster, userData)) {
+            return false;
+        }
+        users.append(userData);
+    }
+
+    // Each client talks to the next one
+    for (int i = 0; i < m_options.clients; ++i) {
+        LoadClient *client = new LoadClient(this, users.at(i), users.at((i + 1) % m_options.clients));
+        connect(client, &LoadClient::ready, this, &LoadGenerator::onClientReady);
+        connect(client, &LoadClient::setupFailed, this, &LoadGenerator::onClientSetupFailed);
+        m_clients.append(client);
+    }
+    m_setupTimer.start(qMax(30, m_options.clients / 10) * 1000);
+    for (LoadClient *client : m_clients) {
+        client->signIn();
+    }
+    return true;
+}
+
+void LoadGenerator::recordOperation(OperationType type, qint64 startTime, bool succeeded)
+{
+    OperationStats &stats = m_stats[static_cast<int>(type)];
+    if (!succeeded) {
+        ++stats.failed;
+        return;
+    }
+    stats.latencies.append(now() - startTime);
+}
+
+void LoadGenerator::onClientReady()
+{
+    ++m_readyClients;
+    if (m_readyClients == m_clients.count()) {
+        m_setupTimer.stop();
+        runLoad();
+    }
+}
+
+void LoadGenerator::onClientSetupFailed(const QString &reason)
+{
+    qCritical() << "Setup failed:" << reason;
+    m_setupTimer.stop();
+    emit finished(1);
+}
+
+void LoadGenerator::onSetupTimeout()
+{
+    qCritical() << "Setup timed out:" << m_readyClients << "of" << m_clients.count() << "clients are ready";
+    emit finished(1);
+}
+
+void LoadGenerator::runLoad()
+{
+    qInfo() << "All" << m_clients.count() << "clients are ready; running the load for" << m_options.durationSeconds << "seconds";
+    const int interval = qMax(1, qRound(1000 / m_options.rate));
+    std::uniform_int_distribution<int> phaseDistribution(0, interval - 1);
+    m_running = true;
+    m_clock.start();
+    for (LoadClient *client : m_clients) {
+        QTimer *timer = new QTimer(this);
+        timer->setTimerType(Qt::PreciseTimer);
+        timer->setInterval(interval);
+        connect(timer, &QTimer::timeout, this, [this, client]() { onTick(client); });
+        m_timers.append(timer);
+        // Spread the clients over the interval to not send the requests in bursts
+        QTimer::singleShot(phaseDistribution(m_random), timer, static_cast<void (QTimer::*)()>(&QTimer::start));
+    }
+    QTimer::singleShot(m_options.durationSeconds * 1000, this, &LoadGenerator::stopLoad);
+}
+
+void LoadGenerator::onTick(LoadClient *client)
+{
+    if (m_running) {
+        client->runOperation(nextOperation());
+    }
+}
+
+OperationType LoadGenerator::nextOperation()
+{
+    int totalWeight = 0;
+    for (int weight : m_options.weights) {
+        totalWeight += weight;
+    }
+    std::uniform_int_distribution<int> distribution(0, totalWeight - 1);
+    int value = distribution(m_random);
+    for (int i = 0; i < static_cast<int>(OperationType::Count); ++i) {
+        if (value < m_options.weights[i]) {
+            return static_cast<OperationType>(i);
+        }
+        value -= m_options.weights[i];
+    }
+    return OperationType::SendMessage;
+}
+
+void LoadGenerator::stopLoad()
+{
+    m_running = false;
+    m_loadDuration = m_clock.nsecsElapsed();
+    qDeleteAll(m_timers);
+    m_timers.clear();
+    m_drainTimer.start();
+    checkDrained();
+}
+
+void LoadGenerator::checkDrained()
+{
+    int inFlight = 0;
+    for (const LoadClient *client : m_clients) {
+        inFlight += client->inFlight();
+    }
+    if (inFlight && (m_drainTimer.elapsed() < 5000)) {
+        QTimer::singleShot(50, this, &LoadGenerator::checkDrained);
+        return;
+    }
+    // The messages without the reply are failed
+    for (const LoadClient *client : m_clients) {
+        m_stats[static_cast<int>(OperationType::SendMessage)].failed += client->pendingMessages();
+    }
+    report();
+    emit finished(0);
+}
+
+static double percentileMsecs(const QVector<qint64> &sortedLatencies, double q)
+{
+    if (sortedLatencies.isEmpty()) {
+        return 0;
+    }
+    const int index = qBound(0, static_cast<int>(std::ceil(q * sortedLatencies.count())) - 1, sortedLatencies.count() - 1);
+    return sortedLatencies.at(index) / 1e6;
+}
+
+void LoadGenerator::report()
+{
+    const double seconds = m_loadDuration / 1e9;
+
+    QJsonObject operations;
+    for (int i = 0; i < static_cast<int>(OperationType::Count); ++i) {
+        QVector<qint64> latencies = m_stats[i].latencies;
+        std::sort(latencies.begin(), latencies.end());
+        qint64 sum = 0;
+        for (qint64 latency : latencies) {
+            sum += latency;
+        }
+        QJsonObject operation;
+        operation[QLatin1String("count")] = latencies.count();
+        operation[QLatin1String("failed")] = static_cast<qint64>(m_stats[i].failed);
+        operation[QLatin1String("perSecond")] = latencies.count() / seconds;
+        operation[QLatin1String("meanMs")] = latencies.isEmpty() ? 0 : sum / 1e6 / latencies.count();
+        operation[QLatin1String("p50Ms")] = percentileMsecs(latencies, 0.5);
+        operation[QLatin1String("p99Ms")] = percentileMsecs(latencies, 0.99);
+        operation[QLatin1String("p999Ms")] = percentileMsecs(latencies, 0.999);
+        operation[QLatin1String("maxMs")] = latencies.isEmpty() ? 0 : latencies.last() / 1e6;
+        operations[QLatin1String(c_operationNames[i])] = operation;
+    }
+
+    QJsonObject mix;
+    for (int i = 0; i < static_cast<int>(OperationType::Count); ++i) {
+        mix[QLatin1String(c_operationNames[i])] = m_options.weights[i];
+    }
+
+    QJsonObject config;
+    config[QLatin1String("clients")] = m_options.clients;
+    config[QLatin1String("userDcs")] = m_options.userDcs;
+    config[QLatin1String("durationSeconds")] = m_options.durationSeconds;
+    config[QLatin1String("rate")] = m_options.rate;
+    config[QLatin1String("maxInFlight")] = m_options.maxInFlight;
+    config[QLatin1String("messageSize")] = m_options.messageSize;
+    config[QLatin1String("dcThreads")] = m_options.dcThreads;
+    config[QLatin1String("transport")] = m_options.transportBackend == Server::TransportBackend::Epoll
+            ? QLatin1String("epoll") : QLatin1String("qt");
+    config[QLatin1String("mix")] = mix;
+
+    const int sentMessages = m_stats[static_cast<int>(OperationType::SendMessage)].latencies.count();
+
+    QJsonObject result;
+    result[QLatin1String("config")] = config;
+    result[QLatin1String("elapsedSeconds")] = seconds;
+    result[QLatin1String("messagesPerSecond")] = sentMessages / seconds;
+    result[QLatin1String("skipped")] = static_cast<qint64>(m_skippedOperations);
+    result[QLatin1String("operations")] = operations;
+
+    QFile output;
+    output.open(stdout, QIODevice::WriteOnly);
+    output.write(QJsonDocument(result).toJson(QJsonDocument::Indented));
+}
+
+static bool parseMix(const QString &value, LoadOptions *options)
+{
+    const QStringList parts = value.split(QLatin1Char(':'));
+    if (parts.count() != static_cast<int>(OperationType::Count)) {
+        return false;
+    }
+    int totalWeight = 0;
+    for (int i = 0; i < parts.count(); ++i) {
+        bool ok = false;
+        options->weights[i] = parts.at(i).toInt(&ok);
+        if (!ok || (options->weights[i] < 0)) {
+            return false;
+        }
+        totalWeight += options->weights[i];
+    }
+    return totalWeight > 0;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    a.setOrganizationName(QLatin1String("TelegramQt"));
+    a.setApplicationName(QLatin1String("TelegramLoadGenerator"));
+
+    Telegram::initialize();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QLatin1String("Runs a LocalCluster under the load of N clients "
+                                                   "and prints the latencies as JSON"));
+    parser.addHelpOption();
+
+    QCommandLineOption clientsOption(QStringList({ QLatin1String("n"), QLatin1String("clients") }));
+    clientsOption.setDescription(QLatin1String("The number of clients (at least 2)"));
+    clientsOption.setValueName(QLatin1String("count"));
+    clientsOption.setDefaultValue(QLatin1String("10"));
+    parser.addOption(clientsOption);
+
+    QCommandLineOption durationOption(QStringList({ QLatin1String("d"), QLatin1String("duration") }));
+    durationOption.setDescription(QLatin1String("The load duration"));
+    durationOption.setValueName(QLatin1String("seconds"));
+    durationOption.setDefaultValue(QLatin1String("10"));
+    parser.addOption(durationOption);
+
+    QCommandLineOption rateOption(QStringList({ QLatin1String("r"), QLatin1String("rate") }));
+    rateOption.setDescription(QLatin1String("The operations per second of each client"));
+    rateOption.setValueName(QLatin1String("rate"));
+    rateOption.setDefaultValue(QLatin1String("10"));
+    parser.addOption(rateOption);
+
+    QCommandLineOption mixOption(QStringList({ QLatin1String("m"), QLatin1String("mix") }));
+    mixOption.setDescription(QLatin1String("The weights of sendMessage, getHistory and getDialogs"));
+    mixOption.setValueName(QLatin1String("send:history:dialogs"));
+    mixOption.setDefaultValue(QLatin1String("60:30:10"));
+    parser.addOption(mixOption);
+
+    QCommandLineOption maxInFlightOption(QLatin1String("max-in-flight"));
+    maxInFlightOption.setDescription(QLatin1String("The operations of a client beyond this number are skipped"));
+    maxInFlightOption.setValueName(QLatin1String("count"));
+    maxInFlightOption.setDefaultValue(QLatin1String("32"));
+    parser.addOption(maxInFlightOption);
+
+    QCommandLineOption messageSizeOption(QLatin1String("message-size"));
+    messageSizeOption.setDescription(QLatin1String("The length of the sent messages"));
+    messageSizeOption.setValueName(QLatin1String("chars"));
+    messageSizeOption.setDefaultValue(QLatin1String("64"));
+    parser.addOption(messageSizeOption);
+
+    QCommandLineOption userDcsOption(QLatin1String("user-dcs"));
+    userDcsOption.setDescription(QLatin1String("Spread the users over this number of DCs"));
+    userDcsOption.setValueName(QLatin1String("count"));
+    userDcsOption.setDefaultValue(QLatin1String("1"));
+    parser.addOption(userDcsOption);
+
+    QCommandLineOption dcThreadsOption(QLatin1String("dc-threads"));
+    dcThreadsOption.setDescription(QLatin1String("Run each DC in a dedicated thread"));
+    parser.addOption(dcThreadsOption);
+
+    QCommandLineOption transportOption(QLatin1String("transport"));
+    transportOption.setDescription(QLatin1String("The server transport backend (qt or epoll)"));
+    transportOption.setValueName(QLatin1String("backend"));
+    transportOption.setDefaultValue(QLatin1String("qt"));
+    parser.addOption(transportOption);
+
+    QCommandLineOption listenerThreadsOption(QLatin1String("listener-threads"));
+    listenerThreadsOption.setDescription(QLatin1String("The listener threads of the epoll transport"));
+    listenerThreadsOption.setValueName(QLatin1String("count"));
+    listenerThreadsOption.setDefaultValue(QLatin1String("1"));
+    parser.addOption(listenerThreadsOption);
+
+    QCommandLineOption seedOption(QLatin1String("seed"));
+    seedOption.setDescription(QLatin1String("The seed of the operation mix"));
+    seedOption.setValueName(QLatin1String("seed"));
+    seedOption.setDefaultValue(QLatin1String("0"));
+    parser.addOption(seedOption);
+
+    parser.process(a);
+
+    LoadOptions options;
+    options.clients = parser.value(clientsOption).toInt();
+    options.durationSeconds = parser.value(durationOption).toInt();
+    options.rate = parser.value(rateOption).toDouble();
+    options.maxInFlight = parser.value(maxInFlightOption).toInt();
+    options.messageSize = parser.value(messageSizeOption).toInt();
+    options.userDcs = qBound(1, parser.value(userDcsOption).toInt(), c_localDcOptions.count());
+    options.dcThreads = parser.isSet(dcThreadsOption);
+    options.listenerThreads = qMax(1, parser.value(listenerThreadsOption).toInt());
+    options.seed = parser.value(seedOption).toUInt();
+    if (parser.value(transportOption) == QLatin1String("epoll")) {
+        options.transportBackend = Server::TransportBackend::Epoll;
+    } else if (parser.value(transportOption) != QLatin1String("qt")) {
+        qCritical() << "Unknown transport backend" << parser.value(transportOption);
+        return -1;
+    }
+    if ((options.clients < 2) || (options.durationSeconds <= 0) || (options.rate <= 0) || (options.maxInFlight <= 0)) {
+        qCritical() << "Invalid load options";
+        return -1;
+    }
+    if (!parseMix(parser.value(mixOption), &options)) {
+        qCritical() << "Invalid operation mix" << parser.value(mixOption);
+        return -1;
+    }
+
+    if (!TestKeyData::initKeyFiles()) {
+        qCritical() << "Unable to init RSA key files.";
+        return -1;
+    }
+
+    LoadGenerator generator(options);
+    QObject::connect(&generator, &LoadGenerator::finished, &a, &QCoreApplication::exit, Qt::QueuedConnection);
+    int retCode = -2;
+    if (generator.start()) {
+        retCode = a.exec();
+    }
+    TestKeyData::cleanupKeyFiles();
+    return retCode;
+}
+
+#include "main.moc"
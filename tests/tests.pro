@@ -3,3 +3,4 @@ SUBDIRS += tst_all
 #SUBDIRS += tst_toOfficial
 SUBDIRS += tst_ConnectionApi
 SUBDIRS += tst_MessagesApi
+SUBDIRS += tst_perf
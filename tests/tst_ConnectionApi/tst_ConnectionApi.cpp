@@ -23,17 +23,24 @@
 
 #include "AccountStorage.hpp"
 #include "Client.hpp"
+#include "Client_p.hpp"
+#include "ClientBackend.hpp"
+#include "ClientConnection.hpp"
+#include "ClientRpcLayer.hpp"
 #include "ClientSettings.hpp"
 #include "ConnectionApi.hpp"
+#include "ConnectionApi_p.hpp"
 #include "DataStorage.hpp"
 #include "Utils.hpp"
 #include "TelegramNamespace.hpp"
 #include "CAppInformation.hpp"
+#include "CRawStream.hpp"
 
 #include "Operations/ClientAuthOperation.hpp"
 
 #include "ContactsApi.hpp"
 #include "CTcpTransport.hpp"
+#include "CTelegramStream.hpp"
 #include "CTelegramTransport.hpp"
 #include "DcConfiguration.hpp"
 
@@ -48,7 +55,22 @@
 #include <QTest>
 #include <QSignalSpy>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QLoggingCategory>
 #include <QRegularExpression>
+#include <QTcpServer>
+#include <QTemporaryDir>
+
+#ifdef TELEGRAMQT_SERVER_EPOLL
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 #include "keys_data.hpp"
 #include "TestAuthProvider.hpp"
@@ -82,6 +104,12 @@ private slots:
     void testClientConnection();
     void registrationAuthError();
     void reconnect();
+    void connectionRacing();
+    void storedRoundTripTimes();
+    void futureSalts();
+    void epollTransport_data();
+    void epollTransport();
+    void epollManyConnections();
 };
 
 tst_ConnectionApi::tst_ConnectionApi(QObject *parent) :
@@ -475,6 +503,366 @@ void tst_ConnectionApi::reconnect()
     }
 }
 
+void tst_ConnectionApi::connectionRacing()
+{
+    const UserData userData = c_userWithPassword;
+    const DcOption clientDcOption = c_localDcOptions.first();
+
+    // An endpoint of the same DC that takes the TCP connection, but never answers
+    QTcpServer deadServer;
+    QVERIFY(deadServer.listen(QHostAddress(clientDcOption.address)));
+    deadServer.pauseAccepting();
+    const DcOption deadDcOption(clientDcOption.address, deadServer.serverPort(), clientDcOption.id);
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isValid(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Client::Client client;
+    setupClientHelper(&client, userData, publicKey, clientDcOption);
+    QVERIFY(client.settings()->setServerConfiguration({ deadDcOption, clientDcOption }));
+    Client::ConnectionApi *connectionApi = client.connectionApi();
+    Client::AccountStorage *accountStorage = client.accountStorage();
+    QCOMPARE(accountStorage->endpointRoundTripTime(clientDcOption), -1);
+
+    QElapsedTimer signInTimer;
+    signInTimer.start();
+    Client::AuthOperation *signInOperation = connectionApi->startAuthentication();
+    signInOperation->setPhoneNumber(userData.phoneNumber);
+
+    // The dead endpoint goes first, but the client should not wait for its timeout
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusWaitForAuthentication);
+#ifndef FAST_PASS
+    // FAST_PASS cuts the connection timeout below the racing delay
+    QVERIFY2(signInTimer.elapsed() < BaseTcpTransport::connectionTimeout() / 2,
+             "The client waited for the dead endpoint");
+#endif
+    QVERIFY(accountStorage->endpointRoundTripTime(clientDcOption) >= 0);
+    QCOMPARE(accountStorage->endpointRoundTripTime(deadDcOption), -1);
+
+    // The stored time is smoothed and it is reset on a failed attempt
+    accountStorage->setEndpointRoundTripTime(deadDcOption, 100);
+    QCOMPARE(accountStorage->endpointRoundTripTime(deadDcOption), 100);
+    accountStorage->setEndpointRoundTripTime(deadDcOption, 20);
+    QCOMPARE(accountStorage->endpointRoundTripTime(deadDcOption), 80);
+    accountStorage->setEndpointRoundTripTime(deadDcOption, -1);
+    QCOMPARE(accountStorage->endpointRoundTripTime(deadDcOption), -1);
+}
+
+void tst_ConnectionApi::storedRoundTripTimes()
+{
+    const DcOption fastDcOption = c_localDcOptions.first();
+    const DcOption slowDcOption(fastDcOption.address, fastDcOption.port + 1, fastDcOption.id);
+    const QByteArray authKey(256, 'k');
+    const quint64 authId = 0x12345678abcdef01ull;
+    const quint64 sessionId = 0x1020304050607080ull;
+
+    QTemporaryDir storageDir;
+    QVERIFY(storageDir.isValid());
+    const QString storageFileName = storageDir.filePath(QStringLiteral("account.bin"));
+
+    {
+        Client::FileAccountStorage accountStorage;
+        accountStorage.setFileName(storageFileName);
+        accountStorage.setDcInfo(fastDcOption);
+        accountStorage.setAuthKey(authKey);
+        accountStorage.setAuthId(authId);
+        accountStorage.setSessionData(sessionId, 7);
+        accountStorage.setEndpointRoundTripTime(fastDcOption, 20);
+        accountStorage.setEndpointRoundTripTime(slowDcOption, 300);
+        QVERIFY(accountStorage.saveData());
+    }
+    {
+        Client::FileAccountStorage accountStorage;
+        accountStorage.setFileName(storageFileName);
+        QVERIFY(accountStorage.loadData());
+        QVERIFY(accountStorage.hasMinimalDataSet());
+        QCOMPARE(accountStorage.authKey(), authKey);
+        QCOMPARE(accountStorage.sessionId(), sessionId);
+        QCOMPARE(accountStorage.endpointRoundTripTime(fastDcOption), 20);
+        QCOMPARE(accountStorage.endpointRoundTripTime(slowDcOption), 300);
+    }
+
+    // A file of the first format version has no round-trip times
+    {
+        QFile file(storageFileName);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        CRawStreamEx stream(&file);
+        stream.writeBytes(QByteArrayLiteral("TelegramQt_account"));
+        stream << quint32(1); // Format version
+        stream << qint32(0); // Delta time
+        stream << fastDcOption.id;
+        stream << fastDcOption.address.toLatin1();
+        stream << fastDcOption.port;
+        stream << authKey;
+        stream << authId;
+        stream << sessionId;
+        stream << quint32(7);
+    }
+    Client::FileAccountStorage accountStorage;
+    accountStorage.setFileName(storageFileName);
+    QVERIFY(accountStorage.loadData());
+    QVERIFY(accountStorage.hasMinimalDataSet());
+    QCOMPARE(accountStorage.dcInfo().port, fastDcOption.port);
+    QCOMPARE(accountStorage.authKey(), authKey);
+    QCOMPARE(accountStorage.authId(), authId);
+    QCOMPARE(accountStorage.sessionId(), sessionId);
+    QCOMPARE(accountStorage.contentRelatedMessagesNumber(), 7u);
+    QVERIFY(accountStorage.serverSalts().isEmpty());
+    QCOMPARE(accountStorage.endpointRoundTripTime(fastDcOption), -1);
+    QCOMPARE(accountStorage.endpointRoundTripTime(slowDcOption), -1);
+}
+
+void tst_ConnectionApi::futureSalts()
+{
+    const UserData userData = c_userWithPassword;
+    const DcOption clientDcOption = c_localDcOptions.first();
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isValid(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user = tryAddUser(&cluster, userData);
+    QVERIFY(user);
+
+    QTemporaryDir storageDir;
+    QVERIFY(storageDir.isValid());
+    const QString storageFileName = storageDir.filePath(QStringLiteral("account.bin"));
+
+    QVector<ServerSalt> salts;
+    {
+        Client::Client client;
+        setupClientHelper(&client, userData, publicKey, clientDcOption);
+        Client::FileAccountStorage *accountStorage = new Client::FileAccountStorage(&client);
+        accountStorage->setFileName(storageFileName);
+        accountStorage->setPhoneNumber(userData.phoneNumber);
+        accountStorage->setDcInfo(clientDcOption);
+        client.setAccountStorage(accountStorage);
+        signInHelper(&client, userData, &authProvider);
+        TRY_COMPARE(client.connectionApi()->status(), Client::ConnectionApi::StatusReady);
+
+        // The salts are prefetched and saved to the account storage
+        TRY_VERIFY(accountStorage->serverSalts().count() > 1);
+        salts = accountStorage->serverSalts();
+        for (int i = 1; i < salts.count(); ++i) {
+            QVERIFY(salts.at(i - 1).validSince <= salts.at(i).validSince);
+            QVERIFY(salts.at(i).validSince < salts.at(i - 1).validUntil); // The salts overlap
+        }
+
+        QCOMPARE(user->activeSessions().count(), 1);
+        Server::Session *session = user->activeSessions().first();
+        QCOMPARE(session->id(), accountStorage->sessionId());
+        QVERIFY(session->checkSalt(salts.first().salt));
+
+        // Save the final state as an application does on quit
+        QVERIFY(Client::ClientPrivate::get(&client)->syncAccountToStorage());
+    }
+
+    // Restore the account from the saved file
+    Client::Client client;
+    setupClientHelper(&client, userData, publicKey, clientDcOption);
+    Client::FileAccountStorage *accountStorage = new Client::FileAccountStorage(&client);
+    accountStorage->setFileName(storageFileName);
+    QVERIFY(accountStorage->loadData());
+    QVERIFY(accountStorage->hasMinimalDataSet());
+    QCOMPARE(accountStorage->serverSalts().count(), salts.count());
+    QCOMPARE(accountStorage->serverSalts().first().salt, salts.first().salt);
+    client.setAccountStorage(accountStorage);
+
+    Client::AuthOperation *checkInOperation = client.connectionApi()->checkIn();
+    TRY_VERIFY2(checkInOperation->isFinished(), "checkIn() not finished");
+    QVERIFY2(checkInOperation->isSucceeded(), "checkIn() failed");
+    TRY_COMPARE(client.connectionApi()->status(), Client::ConnectionApi::StatusReady);
+
+    // The first request of the restored session uses a saved salt, so the server does not bounce it
+    Client::Connection *connection = Client::ConnectionApiPrivate::get(client.connectionApi())->mainConnection();
+    QVERIFY(connection);
+    QCOMPARE(connection->rpcLayer()->serverSaltBounces(), 0u);
+    QCOMPARE(user->activeSessions().count(), 1);
+    QCOMPARE(user->activeSessions().first()->id(), accountStorage->sessionId());
+}
+
+void tst_ConnectionApi::epollTransport_data()
+{
+    QTest::addColumn<Telegram::Client::Settings::SessionType>("sessionType");
+    QTest::newRow("Abridged") << Client::Settings::SessionType::Abridged;
+    QTest::newRow("Obfuscated") << Client::Settings::SessionType::Obfuscated;
+}
+
+void tst_ConnectionApi::epollTransport()
+{
+#ifndef TELEGRAMQT_SERVER_EPOLL
+    QSKIP("The epoll transport is not available on this platform");
+#else
+    QFETCH(Telegram::Client::Settings::SessionType, sessionType);
+    const UserData userData = c_userWithPassword;
+    const DcOption clientDcOption = c_localDcOptions.first();
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isValid(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    cluster.setTransportBackend(Server::TransportBackend::Epoll, 2);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user = tryAddUser(&cluster, userData);
+    QVERIFY(user);
+
+    Client::Client client;
+    setupClientHelper(&client, userData, publicKey, clientDcOption, sessionType);
+    signInHelper(&client, userData, &authProvider);
+    TRY_COMPARE(client.connectionApi()->status(), Client::ConnectionApi::StatusReady);
+    QCOMPARE(user->activeSessions().count(), 1);
+
+    Server::Server *server = cluster.getServerInstance(clientDcOption.id);
+    QVERIFY(!server->getConnections().isEmpty());
+    client.connectionApi()->disconnectFromServer();
+    TRY_VERIFY(server->getConnections().isEmpty());
+#endif
+}
+
+void tst_ConnectionApi::epollManyConnections()
+{
+#ifndef TELEGRAMQT_SERVER_EPOLL
+    QSKIP("The epoll transport is not available on this platform");
+#else
+    static const int c_connectionsCount = 10000;
+    static const int c_probeInterval = 100;
+    static const int c_timeout = 30000;
+
+    // Each connection takes two descriptors (the client and the server sides)
+    const rlim_t requiredFileLimit = c_connectionsCount * 2 + 256;
+    rlimit fileLimit;
+    QCOMPARE(getrlimit(RLIMIT_NOFILE, &fileLimit), 0);
+    if (fileLimit.rlim_cur < requiredFileLimit) {
+        fileLimit.rlim_cur = qMin(requiredFileLimit, fileLimit.rlim_max);
+        setrlimit(RLIMIT_NOFILE, &fileLimit);
+    }
+    if (fileLimit.rlim_cur < requiredFileLimit) {
+        QSKIP("The limit of open files is too low for the test");
+    }
+
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isValid(), "Unable to read private RSA key");
+
+    QLoggingCategory::setFilterRules(QStringLiteral("telegram.server.main.info=false"));
+    Telegram::Server::LocalCluster cluster;
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    cluster.setTransportBackend(Server::TransportBackend::Epoll, 2);
+    QVERIFY(cluster.start());
+
+    const DcOption dcOption = c_localDcOptions.first();
+    Server::Server *server = cluster.getServerInstance(dcOption.id);
+    sockaddr_in serverAddress;
+    memset(&serverAddress, 0, sizeof(serverAddress));
+    serverAddress.sin_family = AF_INET;
+    serverAddress.sin_port = htons(dcOption.port);
+    QCOMPARE(inet_pton(AF_INET, dcOption.address.toLatin1().constData(), &serverAddress.sin_addr), 1);
+
+    struct Sockets {
+        ~Sockets() {
+            for (int fd : fds) {
+                ::close(fd);
+            }
+        }
+        QVector<int> fds;
+    } sockets;
+    sockets.fds.reserve(c_connectionsCount);
+
+    // Blocking client sockets: the listener threads accept the connections while the event loop is idle
+    for (int i = 0; i < c_connectionsCount; ++i) {
+        const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        QVERIFY(fd >= 0);
+        sockets.fds.append(fd);
+        QVERIFY2(::connect(fd, reinterpret_cast<const sockaddr *>(&serverAddress), sizeof(serverAddress)) == 0,
+                 strerror(errno));
+        const char abridgedTag = char(0xef);
+        QCOMPARE(::send(fd, &abridgedTag, sizeof(abridgedTag), MSG_NOSIGNAL), ssize_t(sizeof(abridgedTag)));
+    }
+    QTRY_COMPARE_WITH_TIMEOUT(server->getConnections().count(), c_connectionsCount, c_timeout);
+
+    // Some of the connections start the DH exchange; each one should get its own resPQ
+    QHash<int, QByteArray> replies;
+    for (int i = 0; i < c_connectionsCount; i += c_probeInterval) {
+        TLNumber128 nonce;
+        nonce.parts[0] = static_cast<quint64>(i);
+        nonce.parts[1] = 0x1234567890abcdefull;
+        QByteArray payload;
+        CTelegramStream payloadStream(&payload, /* write */ true);
+        payloadStream << TLValue::ReqPq;
+        payloadStream << nonce;
+
+        QByteArray packet;
+        CRawStream packetStream(&packet, /* write */ true);
+        packetStream << static_cast<quint8>((8 + 8 + 4 + payload.size()) / 4); // Abridged frame header
+        packetStream << quint64(0); // Plain message (no auth key)
+        packetStream << static_cast<quint64>(i + 1) * 4; // Message id
+        packetStream << static_cast<quint32>(payload.size());
+        packetStream << payload;
+
+        const int fd = sockets.fds.at(i);
+        QCOMPARE(::send(fd, packet.constData(), packet.size(), MSG_NOSIGNAL), ssize_t(packet.size()));
+        replies.insert(i, QByteArray());
+    }
+    const auto readReplies = [&]() {
+        bool allReceived = true;
+        for (auto it = replies.begin(); it != replies.end(); ++it) {
+            char buffer[256];
+            const ssize_t bytesRead = ::recv(sockets.fds.at(it.key()), buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (bytesRead > 0) {
+                it.value().append(buffer, static_cast<int>(bytesRead));
+            }
+            const QByteArray &reply = it.value();
+            if (reply.isEmpty() || (reply.size() < 1 + static_cast<uchar>(reply.at(0)) * 4)) {
+                allReceived = false;
+            }
+        }
+        return allReceived;
+    };
+    QTRY_VERIFY_WITH_TIMEOUT(readReplies(), c_timeout);
+    for (auto it = replies.constBegin(); it != replies.constEnd(); ++it) {
+        CTelegramStream replyStream(it.value().mid(1 + 8 + 8 + 4));
+        TLValue replyValue;
+        TLNumber128 replyNonce;
+        replyStream >> replyValue;
+        replyStream >> replyNonce;
+        QCOMPARE(replyValue, TLValue::ResPQ);
+        QCOMPARE(replyNonce.parts[0], static_cast<quint64>(it.key()));
+    }
+
+    // The connections closed by the clients are removed from the server
+    for (int fd : sockets.fds) {
+        ::close(fd);
+    }
+    sockets.fds.clear();
+    QTRY_VERIFY_WITH_TIMEOUT(server->getConnections().isEmpty(), c_timeout);
+    QLoggingCategory::setFilterRules(QString());
+#endif
+}
+
 QTEST_GUILESS_MAIN(tst_ConnectionApi)
 
 #include "tst_ConnectionApi.moc"
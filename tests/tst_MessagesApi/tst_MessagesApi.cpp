@@ -21,8 +21,13 @@
 #include "AccountStorage.hpp"
 #include "CAppInformation.hpp"
 #include "Client.hpp"
+#include "Client_p.hpp"
+#include "ClientBackend.hpp"
+#include "ClientConnection.hpp"
+#include "ClientRpcLayer.hpp"
 #include "ClientSettings.hpp"
 #include "ConnectionApi.hpp"
+#include "ConnectionApi_p.hpp"
 #include "ContactList.hpp"
 #include "ContactsApi.hpp"
 #include "DataStorage.hpp"
@@ -34,13 +39,23 @@
 #include "Operations/ClientAuthOperation.hpp"
 #include "Operations/PendingContactsOperation.hpp"
 #include "Operations/PendingMessages.hpp"
+#include "RandomGenerator.hpp"
+#include "RpcLayers/ClientRpcMessagesLayer.hpp"
+#include "RpcLayers/ClientRpcUploadLayer.hpp"
 
 // Server
+#include "CTelegramTransport.hpp"
 #include "LocalCluster.hpp"
+#include "MessageSearchIndex.hpp"
+#include "OutboundLimiter.hpp"
+#include "RemoteClientConnection.hpp"
 #include "ServerApi.hpp"
+#include "Session.hpp"
 #include "Storage.hpp"
+#include "TelegramServer.hpp"
 #include "TelegramServerUser.hpp"
 
+#include <QAbstractSocket>
 #include <QTest>
 #include <QSignalSpy>
 #include <QDebug>
@@ -82,10 +97,18 @@ private slots:
     void initTestCase();
     void cleanupTestCase();
     void getDialogs();
+    void compressRequests();
     void getMessage();
     void getHistory_data();
     void getHistory();
+    void getEvictedMessages();
     void syncPeerDialogs();
+    void search_data();
+    void search();
+    void searchIndex();
+    void benchmarkSearchIndex();
+    void floodSlowClient_data();
+    void floodSlowClient();
 };
 
 tst_MessagesApi::tst_MessagesApi(QObject *parent) :
@@ -298,6 +321,90 @@ void tst_MessagesApi::getDialogs()
     }
 }
 
+void tst_MessagesApi::compressRequests()
+{
+    const UserData user1Data = c_user1;
+    const UserData user2Data = c_user2;
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY(publicKey.isValid() && privateKey.isPrivate()); // Sanity check
+
+    // Prepare server
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user1 = tryAddUser(&cluster, user1Data);
+    Server::LocalUser *user2 = tryAddUser(&cluster, user2Data);
+    QVERIFY(user1 && user2);
+
+    // Prepare clients
+    Client::Client client1;
+    setupClientHelper(&client1, user1Data, publicKey, clientDcOption);
+    client1.settings()->setOutgoingCompressionThreshold(256);
+    signInHelper(&client1, user1Data, &authProvider);
+    Client::Client client2;
+    setupClientHelper(&client2, user2Data, publicKey, clientDcOption);
+    signInHelper(&client2, user2Data, &authProvider);
+    TRY_VERIFY2(client1.isSignedIn() && client2.isSignedIn(), "Unexpected sign in fail");
+
+    Client::Backend *backend1 = Client::ClientPrivate::get(&client1);
+    Client::Connection *connection1 = Client::ConnectionApiPrivate::get(backend1->connectionApi())->mainConnection();
+    QVERIFY(connection1);
+    const Client::RpcLayer *rpcLayer1 = connection1->rpcLayer();
+    QCOMPARE(rpcLayer1->compressionThreshold(), 256);
+
+    Telegram::Peer client2AsClient1Peer;
+    {
+        Telegram::Client::ContactsApi::ContactInfo user2ContactInfo;
+        user2ContactInfo.phoneNumber = user2->phoneNumber();
+        user2ContactInfo.firstName   = user2->firstName();
+        user2ContactInfo.lastName    = user2->lastName();
+        Telegram::Client::PendingContactsOperation *addContactOperation = client1.contactsApi()->addContacts({user2ContactInfo});
+        TRY_VERIFY(addContactOperation->isFinished());
+        QVERIFY(addContactOperation->isSucceeded());
+        QCOMPARE(addContactOperation->peers().count(), 1);
+        client2AsClient1Peer = addContactOperation->peers().first();
+    }
+
+    // A long text request is sent gzip_packed and the server unpacks it
+    {
+        const Client::RpcLayer::CompressionStats statsBefore = rpcLayer1->compressionStats();
+        const QString messageText = QStringLiteral("Hello! ").repeated(64);
+        QSignalSpy client1MessageSentSpy(client1.messagingApi(), &Client::MessagingApi::messageSent);
+        QSignalSpy client2MessageReceivedSpy(client2.messagingApi(), &Client::MessagingApi::messageReceived);
+        client1.messagingApi()->sendMessage(client2AsClient1Peer, messageText);
+        TRY_COMPARE(client1MessageSentSpy.count(), 1);
+        QVERIFY(rpcLayer1->compressionStats().compressed > statsBefore.compressed);
+        QVERIFY(rpcLayer1->compressionStats().savedBytes > statsBefore.savedBytes);
+
+        TRY_COMPARE(client2MessageReceivedSpy.count(), 1);
+        const QList<QVariant> receivedArgs = client2MessageReceivedSpy.takeFirst();
+        Telegram::Message message;
+        QVERIFY(client2.dataStorage()->getMessage(&message,
+                                                  receivedArgs.at(0).value<Telegram::Peer>(),
+                                                  receivedArgs.at(1).value<quint32>()));
+        QCOMPARE(message.text, messageText);
+    }
+
+    // A high-entropy request (e.g. a file part) is sent as is
+    {
+        const Client::RpcLayer::CompressionStats statsBefore = rpcLayer1->compressionStats();
+        const QByteArray fileBytes = RandomGenerator::instance()->generate(8192);
+        Client::UploadRpcLayer::PendingBool *saveOperation = backend1->uploadLayer()->saveFilePart(1, 0, fileBytes);
+        TRY_VERIFY(saveOperation->isFinished());
+        QVERIFY(saveOperation->isSucceeded());
+        TLBool result;
+        QVERIFY(saveOperation->getResult(&result));
+        QCOMPARE(result.tlType, TLValue::BoolTrue);
+        QCOMPARE(rpcLayer1->compressionStats().skippedByEntropy, statsBefore.skippedByEntropy + 1);
+    }
+}
+
 void tst_MessagesApi::getMessage()
 {
     const UserData user1Data = c_userWithPassword;
@@ -632,6 +739,82 @@ void tst_MessagesApi::getHistory()
     }
 }
 
+void tst_MessagesApi::getEvictedMessages()
+{
+    const UserData c_user1 = c_userWithPassword;
+    constexpr int messagesCount = 50;
+
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+
+    // Prepare server
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user1 = tryAddUser(&cluster, c_user1);
+    Server::AbstractUser *user2 = tryAddUser(&cluster, c_user2);
+    QVERIFY(user1 && user2);
+
+    Server::ServerApi *server = cluster.getServerApiInstance(c_user1.dcId);
+    QVERIFY(server);
+
+    for (int i = 0; i < messagesCount; ++i) {
+        Server::MessageData *messageData = server->storage()->addMessage(
+                    user2->id(), user1->toPeer(), QString::number(i + 1));
+        server->processMessage(messageData);
+    }
+
+    // Prepare clients
+    Client::Client client;
+    setupClientHelper(&client, c_user1, publicKey, clientDcOption);
+    signInHelper(&client, c_user1, &authProvider);
+    TRY_VERIFY2(client.isSignedIn(), "Unexpected sign in fail");
+    TRY_COMPARE(client.connectionApi()->status(), Telegram::Client::ConnectionApi::StatusReady);
+
+    Client::MessagingApi *messagingApi = client.messagingApi();
+    Telegram::Client::DialogList *dialogList = messagingApi->getDialogList();
+    {
+        PendingOperation *dialogsReady = dialogList->becomeReady();
+        TRY_VERIFY(dialogsReady->isFinished());
+        QVERIFY(dialogsReady->isSucceeded());
+    }
+    const Peer dialogPeer = user2->toPeer();
+
+    Client::PendingMessages *historyOp = messagingApi->getHistory(dialogPeer, Client::MessageFetchOptions::useLimit(10));
+    TRY_VERIFY(historyOp->isFinished());
+    QVERIFY(historyOp->isSucceeded());
+
+    const quint32 topMessageId = messagesCount;
+    const QVector<quint32> evictedIds = { 45, 41 };
+    Telegram::Message message;
+    QVERIFY(client.dataStorage()->getMessage(&message, dialogPeer, evictedIds.first()));
+
+    // Evict everything but the pinned top message
+    client.dataStorage()->setMessageCacheLimit(1);
+    QVERIFY(client.dataStorage()->getMessage(&message, dialogPeer, topMessageId));
+    QCOMPARE(message.text, QString::number(topMessageId));
+    for (const quint32 messageId : evictedIds) {
+        QVERIFY(!client.dataStorage()->getMessage(&message, dialogPeer, messageId));
+    }
+
+    client.dataStorage()->setMessageCacheLimit(0);
+    Client::PendingMessages *getMessagesOp = messagingApi->getMessages(dialogPeer, evictedIds);
+    TRY_VERIFY(getMessagesOp->isFinished());
+    QVERIFY(getMessagesOp->isSucceeded());
+    QCOMPARE(getMessagesOp->messages(), evictedIds);
+    for (const quint32 messageId : evictedIds) {
+        QVERIFY(client.dataStorage()->getMessage(&message, dialogPeer, messageId));
+        QCOMPARE(message.id, messageId);
+        QCOMPARE(message.text, QString::number(messageId));
+        QCOMPARE(message.fromId, user2->id());
+    }
+}
+
 void tst_MessagesApi::syncPeerDialogs()
 {
     const DcOption clientDcOption = c_localDcOptions.first();
@@ -1109,6 +1292,366 @@ void tst_MessagesApi::syncPeerDialogs()
     }
 }
 
+void tst_MessagesApi::search_data()
+{
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<bool>("inDialog"); // Search only in the dialog with user2
+    QTest::addColumn<quint32>("offsetId");
+    QTest::addColumn<quint32>("addOffset");
+    QTest::addColumn<quint32>("limit");
+    QTest::addColumn<Telegram::MessageIdList>("messageIds");
+
+    QTest::newRow("All dialogs")
+            << QStringLiteral("hello world") << false << 0u << 0u << 0u << MessageIdList({ 6, 5, 3, 1 });
+    QTest::newRow("Case and punctuation")
+            << QStringLiteral("WORLD, Hello!") << false << 0u << 0u << 0u << MessageIdList({ 6, 5, 3, 1 });
+    QTest::newRow("Single word")
+            << QStringLiteral("world") << false << 0u << 0u << 0u << MessageIdList({ 6, 5, 4, 3, 1 });
+    QTest::newRow("Dialog")
+            << QStringLiteral("hello world") << true << 0u << 0u << 0u << MessageIdList({ 5, 3, 1 });
+    QTest::newRow("Limit")
+            << QStringLiteral("hello world") << true << 0u << 0u << 2u << MessageIdList({ 5, 3 });
+    QTest::newRow("OffsetId")
+            << QStringLiteral("hello world") << true << 5u << 0u << 0u << MessageIdList({ 3, 1 });
+    QTest::newRow("AddOffset")
+            << QStringLiteral("world") << false << 6u << 1u << 2u << MessageIdList({ 4, 3 });
+    QTest::newRow("No match")
+            << QStringLiteral("hello peace") << false << 0u << 0u << 0u << MessageIdList();
+    QTest::newRow("Unknown word")
+            << QStringLiteral("hello missing") << false << 0u << 0u << 0u << MessageIdList();
+    QTest::newRow("Empty query in dialog")
+            << QString() << true << 0u << 0u << 0u << MessageIdList({ 5, 4, 3, 2, 1 });
+    QTest::newRow("Empty query in dialog with offsetId")
+            << QString() << true << 4u << 0u << 2u << MessageIdList({ 3, 2 });
+    QTest::newRow("Empty query")
+            << QString() << false << 0u << 0u << 0u << MessageIdList();
+}
+
+void tst_MessagesApi::search()
+{
+    QFETCH(QString, query);
+    QFETCH(bool, inDialog);
+    QFETCH(quint32, offsetId);
+    QFETCH(quint32, addOffset);
+    QFETCH(quint32, limit);
+    QFETCH(Telegram::MessageIdList, messageIds);
+
+    const UserData c_user1 = c_userWithPassword;
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+
+    // Prepare server
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user1 = tryAddUser(&cluster, c_user1);
+    Server::AbstractUser *user2 = tryAddUser(&cluster, c_user2);
+    QVERIFY(user1 && user2);
+
+    Server::ServerApi *server = cluster.getServerApiInstance(c_user1.dcId);
+    QVERIFY(server);
+
+    const QStringList texts = {
+        QStringLiteral("Hello world"),
+        QStringLiteral("Unrelated text"),
+        QStringLiteral("hello, WORLD!"),
+        QStringLiteral("World peace"),
+        QStringLiteral("Hello there, world"),
+    };
+    for (const QString &text : texts) {
+        server->processMessage(server->storage()->addMessage(user2->id(), user1->toPeer(), text));
+    }
+    // A message to self (id 6) to check the dialog filter
+    server->processMessage(server->storage()->addMessage(user1->id(), user1->toPeer(), QStringLiteral("hello world")));
+
+    // Prepare clients
+    Client::Client client;
+    setupClientHelper(&client, c_user1, publicKey, clientDcOption);
+    signInHelper(&client, c_user1, &authProvider);
+    TRY_VERIFY2(client.isSignedIn(), "Unexpected sign in fail");
+    TRY_COMPARE(client.connectionApi()->status(), Telegram::Client::ConnectionApi::StatusReady);
+
+    TLInputPeer inputPeer;
+    if (inDialog) {
+        inputPeer.tlType = TLValue::InputPeerUser;
+        inputPeer.userId = user2->id();
+    }
+
+    Client::Backend *backend = Client::ClientPrivate::get(&client);
+    Client::MessagesRpcLayer::PendingMessagesMessages *rpcOperation
+            = backend->messagesLayer()->search(0, inputPeer, query, TLInputUser(), TLMessagesFilter(),
+                                               0, 0, offsetId, addOffset, limit, 0, 0);
+    TRY_VERIFY(rpcOperation->isFinished());
+    QVERIFY(rpcOperation->isSucceeded());
+
+    TLMessagesMessages result;
+    rpcOperation->getResult(&result);
+    MessageIdList ids;
+    for (const TLMessage &message : result.messages) {
+        ids.append(message.id);
+    }
+    QCOMPARE(ids, messageIds);
+}
+
+void tst_MessagesApi::searchIndex()
+{
+    const Peer dialog1 = Peer::fromUserId(1);
+    const Peer dialog2 = Peer::fromUserId(2);
+
+    Server::MessageSearchIndex index;
+    // More than a block of messages to check the multi-block lookups
+    const quint32 messagesCount = Server::PostingList::c_blockSize * 3 + 10;
+    for (quint32 messageId = 1; messageId <= messagesCount; ++messageId) {
+        const Peer dialog = (messageId % 2) ? dialog1 : dialog2;
+        QString text = QStringLiteral("common");
+        if (messageId % 3 == 0) {
+            text += QStringLiteral(" three");
+        }
+        if (messageId % 5 == 0) {
+            text += QStringLiteral(" FIVE");
+        }
+        index.addMessage(messageId, dialog, text);
+    }
+
+    auto collect = [&index](const QString &query, const Peer &peer, quint32 maxId) {
+        MessageIdList result;
+        Server::MessageSearchIndex::Cursor cursor = index.search(query, peer, maxId);
+        while (const quint32 messageId = cursor.next()) {
+            result.append(messageId);
+        }
+        return result;
+    };
+    auto expected = [messagesCount](quint32 divider, quint32 parity, quint32 maxId) {
+        MessageIdList result;
+        for (quint32 messageId = maxId ? maxId - 1 : messagesCount; messageId > 0; --messageId) {
+            if ((messageId % divider == 0) && ((parity > 1) || (messageId % 2 == parity))) {
+                result.append(messageId);
+            }
+        }
+        return result;
+    };
+
+    QCOMPARE(collect(QStringLiteral("common"), Peer(), 0), expected(1, 2, 0));
+    QCOMPARE(collect(QStringLiteral("five three"), Peer(), 0), expected(15, 2, 0));
+    QCOMPARE(collect(QStringLiteral("Five"), dialog2, 0), expected(10, 0, 0));
+    QCOMPARE(collect(QStringLiteral("three"), dialog1, 300), expected(3, 1, 300));
+    QCOMPARE(collect(QStringLiteral("common unknown"), Peer(), 0), MessageIdList());
+    QCOMPARE(collect(QStringLiteral(" ,. "), Peer(), 0), MessageIdList());
+    // A query without words lists the dialog
+    QCOMPARE(collect(QString(), dialog1, 0), expected(1, 1, 0));
+    QCOMPARE(collect(QStringLiteral(" ,. "), dialog2, 300), expected(1, 0, 300));
+
+    // Remove every 15th message
+    for (quint32 messageId = 15; messageId <= messagesCount; messageId += 15) {
+        const Peer dialog = (messageId % 2) ? dialog1 : dialog2;
+        index.removeMessage(messageId, dialog, QStringLiteral("common three five"));
+    }
+    QCOMPARE(collect(QStringLiteral("five three"), Peer(), 0), MessageIdList());
+    QCOMPARE(collect(QStringLiteral("five"), Peer(), 0).count(), expected(5, 2, 0).count() - expected(15, 2, 0).count());
+    QVERIFY(!collect(QStringLiteral("common"), Peer(), 0).contains(30));
+
+    // Out of order insertion
+    index.addMessage(30, dialog2, QStringLiteral("common three five"));
+    QCOMPARE(collect(QStringLiteral("five three"), Peer(), 0), MessageIdList({ 30 }));
+    QVERIFY(collect(QStringLiteral("common"), dialog2, 0).contains(30));
+}
+
+void tst_MessagesApi::benchmarkSearchIndex()
+{
+    // Building the index takes most of the time of the whole test, so the benchmark is run on demand only
+    if (!qEnvironmentVariableIsSet("TELEGRAMQT_SEARCH_BENCHMARK")) {
+        QSKIP("Set TELEGRAMQT_SEARCH_BENCHMARK to index 1M messages and run the search benchmark");
+    }
+    static const int c_messagesCount = 1000000;
+    static const int c_vocabularySize = 2000;
+    static const int c_wordsPerMessage = 8;
+
+    const Peer dialogs[] = { Peer::fromUserId(1), Peer::fromUserId(2), Peer::fromUserId(3), Peer::fromUserId(4) };
+    QStringList vocabulary;
+    vocabulary.reserve(c_vocabularySize);
+    for (int i = 0; i < c_vocabularySize; ++i) {
+        vocabulary.append(QStringLiteral("word%1").arg(i));
+    }
+
+    Server::MessageSearchIndex index;
+    quint32 random = 12345;
+    auto nextRandom = [&random]() {
+        random = random * 1103515245u + 12345u;
+        return random >> 8;
+    };
+    for (int i = 1; i <= c_messagesCount; ++i) {
+        QString text;
+        for (int w = 0; w < c_wordsPerMessage; ++w) {
+            // Skew the distribution, so there are both common and rare words
+            const quint32 wordIndex = (nextRandom() % c_vocabularySize) * (nextRandom() % c_vocabularySize) / c_vocabularySize;
+            text += vocabulary.at(static_cast<int>(wordIndex)) + QLatin1Char(' ');
+        }
+        index.addMessage(static_cast<quint32>(i), dialogs[i % 4], text);
+    }
+
+    const QString query = QStringLiteral("word3 word50");
+    MessageIdList result;
+    QBENCHMARK {
+        result.clear();
+        Server::MessageSearchIndex::Cursor cursor = index.search(query, dialogs[1]);
+        while (result.count() < 30) {
+            const quint32 messageId = cursor.next();
+            if (!messageId) {
+                break;
+            }
+            result.append(messageId);
+        }
+    }
+    QCOMPARE(result.count(), 30);
+    for (int i = 1; i < result.count(); ++i) {
+        QVERIFY(result.at(i) < result.at(i - 1));
+        QCOMPARE(result.at(i) % 4, 1u);
+    }
+}
+
+void tst_MessagesApi::floodSlowClient_data()
+{
+    QTest::addColumn<qint64>("highWatermark");
+    QTest::addColumn<bool>("expectDisconnect");
+
+    QTest::newRow("Watermarks") << qint64(16 * 1024) << false;
+    QTest::newRow("Hard limit only") << qint64(0) << true;
+}
+
+void tst_MessagesApi::floodSlowClient()
+{
+    QFETCH(qint64, highWatermark);
+    QFETCH(bool, expectDisconnect);
+
+    static const qint64 c_lowWatermark = 4 * 1024;
+    static const qint64 c_hardLimit = 64 * 1024;
+    static const qint64 c_maxUpdateSize = 2048;
+    static const int c_messagesCount = 500;
+    const QString c_messageText = QStringLiteral("Flood ").repeated(160);
+
+    const UserData user1Data = c_user1;
+    const UserData user2Data = c_user2;
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::OutboundLimiter *limiter = cluster.getServerInstance(clientDcOption.id)->outboundLimiter();
+    limiter->setHighWatermark(highWatermark);
+    limiter->setLowWatermark(c_lowWatermark);
+    limiter->setHardLimit(c_hardLimit);
+
+    Server::LocalUser *user1 = tryAddUser(&cluster, user1Data);
+    Server::LocalUser *user2 = tryAddUser(&cluster, user2Data);
+    QVERIFY(user1 && user2);
+
+    Client::Client client1;
+    setupClientHelper(&client1, user1Data, publicKey, clientDcOption);
+    signInHelper(&client1, user1Data, &authProvider);
+    TRY_VERIFY(client1.isSignedIn());
+
+    Client::Client client2;
+    setupClientHelper(&client2, user2Data, publicKey, clientDcOption);
+    signInHelper(&client2, user2Data, &authProvider);
+    TRY_VERIFY(client2.isSignedIn());
+
+    Telegram::Client::ContactsApi::ContactInfo user2ContactInfo;
+    user2ContactInfo.phoneNumber = user2->phoneNumber();
+    user2ContactInfo.firstName = user2->firstName();
+    user2ContactInfo.lastName = user2->lastName();
+    Telegram::Client::PendingContactsOperation *addContactOperation = client1.contactsApi()->addContacts({user2ContactInfo});
+    TRY_VERIFY(addContactOperation->isFinished());
+    QVERIFY(addContactOperation->isSucceeded());
+    const Telegram::Peer client2AsClient1Peer = addContactOperation->peers().first();
+
+    QCOMPARE(user2->activeSessions().count(), 1);
+    Server::Session *session = user2->activeSessions().first();
+    BaseTransport *serverSideTransport = session->getConnection()->transport();
+    QAbstractSocket *serverSideSocket = serverSideTransport->findChild<QAbstractSocket*>();
+    QVERIFY(serverSideSocket);
+    QAbstractSocket *clientSocket = nullptr;
+    for (QAbstractSocket *socket : client2.findChildren<QAbstractSocket*>()) {
+        if (socket->localPort() == serverSideSocket->peerPort()) {
+            clientSocket = socket;
+        }
+    }
+    QVERIFY(clientSocket);
+
+    // The second client stops reading: its socket takes no more than a byte from the kernel,
+    // and the small kernel buffers make the server queue the rest of the updates
+    serverSideSocket->setSocketOption(QAbstractSocket::SendBufferSizeSocketOption, 4096);
+    clientSocket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, 4096);
+    clientSocket->setReadBufferSize(1);
+    clientSocket->blockSignals(true);
+
+    QSignalSpy client1MessageSentSpy(client1.messagingApi(), &Client::MessagingApi::messageSent);
+    QSignalSpy client2MessageReceivedSpy(client2.messagingApi(), &Client::MessagingApi::messageReceived);
+    for (int i = 0; i < c_messagesCount; ++i) {
+        client1.messagingApi()->sendMessage(client2AsClient1Peer, c_messageText);
+    }
+    QTRY_COMPARE_WITH_TIMEOUT(client1MessageSentSpy.count(), c_messagesCount, 20000);
+
+    // The memory held for the slow client is bounded regardless of the flood size
+    const Server::OutboundLimiter::Stats stats = limiter->stats();
+    QVERIFY(stats.maxPendingBytes > 0);
+    QVERIFY(stats.maxPendingBytes <= c_hardLimit + c_maxUpdateSize);
+
+    if (expectDisconnect) {
+        QCOMPARE(stats.suspensions, quint64(0));
+        QCOMPARE(stats.disconnects, quint64(1));
+        QVERIFY(!session->isActive());
+        clientSocket->blockSignals(false);
+        return;
+    }
+
+    QCOMPARE(stats.disconnects, quint64(0));
+    QVERIFY(stats.suspensions >= 1);
+    QVERIFY(stats.droppedUpdates > 0);
+    QVERIFY(stats.maxPendingBytes <= highWatermark + c_maxUpdateSize);
+    QVERIFY(session->updatesSuspended);
+    QVERIFY(session->isActive());
+
+    // The client reads again and the connection is drained
+    clientSocket->blockSignals(false);
+    clientSocket->setReadBufferSize(0);
+    QTRY_COMPARE_WITH_TIMEOUT(serverSideTransport->bytesToWrite(), qint64(0), 5000);
+
+    // The next updates (if no client request came first) are replaced with updatesTooLong
+    client1.messagingApi()->sendMessage(client2AsClient1Peer, QStringLiteral("Resume"));
+    TRY_COMPARE(client1MessageSentSpy.count(), c_messagesCount + 1);
+    TRY_VERIFY(!session->updatesSuspended);
+    QCOMPARE(limiter->stats().resumptions, limiter->stats().suspensions);
+    QCOMPARE(limiter->stats().disconnects, quint64(0));
+
+    // The dropped updates are recovered via updates.getDifference
+    const quint32 c_totalMessagesCount = c_messagesCount + 1;
+    QSet<quint32> receivedIds;
+    QTRY_VERIFY_WITH_TIMEOUT([&]() {
+        for (const QList<QVariant> &args : client2MessageReceivedSpy) {
+            receivedIds.insert(args.at(1).value<quint32>());
+        }
+        client2MessageReceivedSpy.clear();
+        return receivedIds.count() == static_cast<int>(c_totalMessagesCount);
+    }(), 10000);
+    for (quint32 messageId = 1; messageId <= c_totalMessagesCount; ++messageId) {
+        QVERIFY(receivedIds.contains(messageId));
+        Telegram::Message message;
+        QVERIFY(client2.dataStorage()->getMessage(&message, user1->toPeer(), messageId));
+    }
+    QCOMPARE(limiter->stats().disconnects, quint64(0));
+}
+
 QTEST_GUILESS_MAIN(tst_MessagesApi)
 
 #include "tst_MessagesApi.moc"
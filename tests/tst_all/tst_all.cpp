@@ -19,34 +19,47 @@
 
 #include "AccountStorage.hpp"
 #include "Client.hpp"
+#include "Client_p.hpp"
 #include "ClientSettings.hpp"
 #include "ConnectionApi.hpp"
 #include "ConnectionError.hpp"
 #include "ContactsApi.hpp"
 #include "DataStorage.hpp"
+#include "MessagingApi.hpp"
 #include "Utils.hpp"
 #include "TelegramNamespace.hpp"
 #include "CAppInformation.hpp"
 #include "CRawStream.hpp"
 
 #include "Operations/ClientAuthOperation.hpp"
+#include "Operations/PendingContactsOperation.hpp"
+#include "RpcLayers/ClientRpcUsersLayer.hpp"
 
 #include "ContactList.hpp"
 #include "ContactsApi.hpp"
 #include "DefaultAuthorizationProvider.hpp"
+#include "DhExponentPool.hpp"
 #include "TelegramServer.hpp"
 #include "RemoteClientConnection.hpp"
 #include "TelegramServerUser.hpp"
 #include "ServerRpcLayer.hpp"
+#include "RpcOperations/UsersOperationFactory.hpp"
+#include "ServerUtils.hpp"
 #include "Session.hpp"
 #include "DcConfiguration.hpp"
 #include "LocalCluster.hpp"
+#include "ReplyCompressor.hpp"
+#include "MetricsExporter.hpp"
+#include "ServerMetrics.hpp"
+#include "RandomGenerator.hpp"
 
 #include <QLoggingCategory>
 #include <QTest>
 #include <QSignalSpy>
 #include <QRegularExpression>
+#include <QTcpSocket>
 #include <QTemporaryFile>
+#include <QThread>
 
 #include "keys_data.hpp"
 #include "TestAuthProvider.hpp"
@@ -82,6 +95,15 @@ private slots:
     void testSignInCheckIn();
     void testSignUp_data();
     void testSignUp();
+    void testReplyCompressionPolicy();
+    void testOperationRecycling();
+    void testServerMetrics();
+    void testMetricsExporterLimits();
+    void testDhExponentPool();
+    void testDhExponentPoolFallback();
+    void testContactsScale();
+    void testCrossDcMessage_data();
+    void testCrossDcMessage();
 };
 
 tst_all::tst_all(QObject *parent) :
@@ -107,6 +129,7 @@ void tst_all::testSignIn_data()
     QTest::addColumn<Telegram::Client::Settings::SessionType>("sessionType");
     QTest::addColumn<UserData>("userData");
     QTest::addColumn<DcOption>("clientDcOption");
+    QTest::addColumn<bool>("threadedDcs");
     UserData userOnDc1 = c_userWithPassword;
     userOnDc1.dcId = 1;
     UserData userOnDc2 = c_userWithPassword;
@@ -119,24 +142,43 @@ void tst_all::testSignIn_data()
 
     QTest::newRow("Abridged")   << Client::Settings::SessionType::Abridged
                                 << userOnDc1
-                                << opt;
+                                << opt
+                                << false;
     QTest::newRow("Obfuscated") << Client::Settings::SessionType::Obfuscated
                                 << userOnDc1
-                                << opt;
+                                << opt
+                                << false;
     QTest::newRow("Abridged with migration")   << Client::Settings::SessionType::Abridged
                                                << userOnDc2
-                                               << opt;
+                                               << opt
+                                               << false;
     QTest::newRow("Obfuscated with migration") << Client::Settings::SessionType::Obfuscated
                                                << userOnDc2
-                                               << opt;
+                                               << opt
+                                               << false;
+    // The same multi-DC cases with each DC in a dedicated thread
+    QTest::newRow("Abridged with migration (threaded DCs)")   << Client::Settings::SessionType::Abridged
+                                                              << userOnDc2
+                                                              << opt
+                                                              << true;
+    QTest::newRow("Obfuscated with migration (threaded DCs)") << Client::Settings::SessionType::Obfuscated
+                                                              << userOnDc2
+                                                              << opt
+                                                              << true;
 
     opt.id = 0;
     QTest::newRow("Migration from unknown dc (with password)") << Client::Settings::SessionType::Obfuscated
                                                << userOnDc2
-                                               << opt;
+                                               << opt
+                                               << false;
     QTest::newRow("Migration from unknown dc, no password") << Client::Settings::SessionType::Obfuscated
                                                << user2OnDc2
-                                               << opt;
+                                               << opt
+                                               << false;
+    QTest::newRow("Migration from unknown dc, no password (threaded DCs)") << Client::Settings::SessionType::Obfuscated
+                                               << user2OnDc2
+                                               << opt
+                                               << true;
 }
 
 void tst_all::testSignIn()
@@ -144,6 +186,7 @@ void tst_all::testSignIn()
     QFETCH(Telegram::Client::Settings::SessionType, sessionType);
     QFETCH(UserData, userData);
     QFETCH(DcOption, clientDcOption);
+    QFETCH(bool, threadedDcs);
 
     const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
     QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
@@ -155,10 +198,12 @@ void tst_all::testSignIn()
     cluster.setAuthorizationProvider(&authProvider);
     cluster.setServerPrivateRsaKey(privateKey);
     cluster.setServerConfiguration(c_localDcConfiguration);
+    cluster.setDcThreadsEnabled(threadedDcs);
     QVERIFY(cluster.start());
 
     Server::Server *server = cluster.getServerInstance(userData.dcId);
     QVERIFY(server);
+    QCOMPARE(server->thread() != QThread::currentThread(), threadedDcs);
 
     Server::LocalUser *user = tryAddUser(&cluster, userData);
     QVERIFY(user);
@@ -218,18 +263,263 @@ void tst_all::testSignIn()
 
     quint64 clientAuthId = accountStorage.authId();
     QVERIFY(clientAuthId);
-    QSet<Server::RemoteClientConnection*> clientConnections = server->getConnections();
-    QCOMPARE(clientConnections.count(), 1);
-    Server::RemoteClientConnection *remoteClientConnection = *clientConnections.cbegin();
-    QCOMPARE(remoteClientConnection->authId(), clientAuthId);
-    QVERIFY(remoteClientConnection->session());
-    Server::Session *serverSession = server->getSessionById(remoteClientConnection->session()->id());
-    QCOMPARE(remoteClientConnection->session(), serverSession);
-    QVERIFY(serverSession);
-    QVERIFY(serverSession->user());
+
+    // The server state is read in the server thread, so it does not race with a threaded DC
+    int connectionsCount = 0;
+    quint64 connectionAuthId = 0;
+    Server::Session *connectionSession = nullptr;
+    Server::Session *serverSession = nullptr;
+    bool sessionHasUser = false;
+    Server::ReplyCompressor::Stats compressionStats;
+    cluster.callInServerThread(server, [&]() {
+        const QSet<Server::RemoteClientConnection*> clientConnections = server->getConnections();
+        connectionsCount = clientConnections.count();
+        if (connectionsCount != 1) {
+            return;
+        }
+        const Server::RemoteClientConnection *remoteClientConnection = *clientConnections.cbegin();
+        connectionAuthId = remoteClientConnection->authId();
+        connectionSession = remoteClientConnection->session();
+        if (connectionSession) {
+            serverSession = server->getSessionById(connectionSession->id());
+            sessionHasUser = serverSession && serverSession->user();
+        }
+        compressionStats = server->replyCompressor()->stats();
+    });
+    QCOMPARE(connectionsCount, 1);
+    QCOMPARE(connectionAuthId, clientAuthId);
+    QVERIFY(connectionSession);
+    QCOMPARE(connectionSession, serverSession);
+    QVERIFY(sessionHasUser);
     QCOMPARE(accountStorage.phoneNumber(), userData.phoneNumber);
     QCOMPARE(accountStorage.dcInfo().id, server->dcId());
     TRY_VERIFY(client.isSignedIn());
+
+    QVERIFY(compressionStats.compressed > 0);
+    QVERIFY(compressionStats.savedBytes > 0);
+
+    const Server::ServerMetrics::Snapshot metrics = server->metrics()->snapshot();
+    QVERIFY(metrics.rpcDurations.contains(TLValue::AuthSignIn));
+    QCOMPARE(metrics.rpcDurations.value(TLValue::AuthSignIn).count, quint64(1));
+    QVERIFY(metrics.handshakeDurations.count > 0);
+    QCOMPARE(metrics.activeConnections, qint64(1));
+    QCOMPARE(metrics.activeSessions, qint64(1));
+    QVERIFY(metrics.gzipInputBytes > metrics.gzipOutputBytes);
+    const Server::ServerMetrics::TransportCounters &transport = metrics.transports[static_cast<int>(Server::TransportBackend::Qt)];
+    QVERIFY(transport.receivedPackets > 0);
+    QVERIFY(transport.sentBytes > 0);
+}
+
+void tst_all::testReplyCompressionPolicy()
+{
+    Server::ReplyCompressor compressor;
+
+    const QByteArray smallReply(compressor.threshold(), 'a');
+    QVERIFY(compressor.compress(smallReply).isEmpty());
+    QCOMPARE(compressor.stats().skippedBySize, quint64(1));
+
+    const QByteArray textReply = QByteArray("Some compressible reply text").repeated(200);
+    const QByteArray packedReply = compressor.compress(textReply);
+    QVERIFY(!packedReply.isEmpty());
+    QCOMPARE(TLValue::firstFromArray(packedReply), TLValue::GzipPacked);
+    QCOMPARE(compressor.stats().compressed, quint64(1));
+    QCOMPARE(compressor.stats().savedBytes, quint64(textReply.size() - packedReply.size()));
+
+    // Already compressed data has high entropy and it is not worth to deflate it again
+    const QByteArray randomReply = RandomGenerator::instance()->generate(8192);
+    QVERIFY(Utils::estimateEntropy(randomReply) > compressor.maxEntropy());
+    QVERIFY(Utils::estimateEntropy(textReply) < compressor.maxEntropy());
+    QVERIFY(compressor.compress(randomReply).isEmpty());
+    QCOMPARE(compressor.stats().skippedByEntropy, quint64(1));
+
+    // File parts of the known compressed formats are not even sampled
+    CRawStream jpegStream(CRawStream::WriteOnly);
+    jpegStream << quint32(TLValue::UploadFile);
+    jpegStream << quint32(TLValue::StorageFileJpeg);
+    jpegStream << quint32(0);
+    jpegStream << textReply;
+    QVERIFY(compressor.compress(jpegStream.getData()).isEmpty());
+    QCOMPARE(compressor.stats().skippedByType, quint64(1));
+
+    compressor.setCompressionLevel(0);
+    QVERIFY(compressor.compress(textReply).isEmpty());
+    QCOMPARE(compressor.stats().compressed, quint64(1));
+    QCOMPARE(compressor.stats().replies, quint64(5));
+
+    compressor.resetStats();
+    QCOMPARE(compressor.stats().replies, quint64(0));
+}
+
+void tst_all::testOperationRecycling()
+{
+    const UserData userData = c_userWithPassword;
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::Server *server = cluster.getServerInstance(clientDcOption.id);
+    QVERIFY(server);
+    QVERIFY(tryAddUser(&cluster, userData));
+
+    Client::Client client;
+    setupClientHelper(&client, userData, publicKey, clientDcOption);
+    signInHelper(&client, userData, &authProvider);
+    TRY_VERIFY(client.isSignedIn());
+
+    const QSet<Server::RemoteClientConnection*> clientConnections = server->getConnections();
+    QCOMPARE(clientConnections.count(), 1);
+    const Server::RpcLayer *serverLayer = (*clientConnections.cbegin())->rpcLayer();
+    const QMetaObject *operationType = &Server::UsersRpcOperation::staticMetaObject;
+
+    Client::UsersRpcLayer *usersLayer = Client::ClientPrivate::get(&client)->usersLayer();
+    TLInputUser selfInput;
+    selfInput.tlType = TLValue::InputUserSelf;
+
+    Client::UsersRpcLayer::PendingUserVector *usersOperation = usersLayer->getUsers({ selfInput });
+    TRY_VERIFY(usersOperation->isFinished());
+    QVERIFY(usersOperation->isSucceeded());
+    TLVector<TLUser> users;
+    usersOperation->getResult(&users);
+    QCOMPARE(users.count(), 1);
+
+    // The processed operation is pooled without the request arguments
+    const QVector<Server::RpcOperation *> pool = serverLayer->recycledOperations(operationType);
+    QVERIFY(!pool.isEmpty());
+    const Server::RpcOperation *recycledOperation = pool.last();
+    QVERIFY(!recycledOperation->hasArguments());
+
+    // The next request of the same type reuses the operation with its own arguments
+    usersOperation = usersLayer->getUsers({ selfInput, selfInput });
+    TRY_VERIFY(usersOperation->isFinished());
+    QVERIFY(usersOperation->isSucceeded());
+    usersOperation->getResult(&users);
+    QCOMPARE(users.count(), 2);
+    QCOMPARE(serverLayer->recycledOperations(operationType), pool);
+    QVERIFY(!recycledOperation->hasArguments());
+
+    // Another function of the same operation type switches the arguments
+    Client::UsersRpcLayer::PendingUserFull *fullUserOperation = usersLayer->getFullUser(selfInput);
+    TRY_VERIFY(fullUserOperation->isFinished());
+    QVERIFY(fullUserOperation->isSucceeded());
+    TLUserFull fullUser;
+    fullUserOperation->getResult(&fullUser);
+    QCOMPARE(fullUser.user.id, client.contactsApi()->selfContactId());
+    QCOMPARE(serverLayer->recycledOperations(operationType), pool);
+    QVERIFY(!recycledOperation->hasArguments());
+}
+
+void tst_all::testServerMetrics()
+{
+    using Server::LatencyHistogram;
+
+    // The buckets cover the values without gaps and overlaps
+    for (int i = 0; i < LatencyHistogram::c_bucketCount - 1; ++i) {
+        QCOMPARE(LatencyHistogram::bucketUpperBound(i), LatencyHistogram::bucketLowerBound(i + 1));
+        QCOMPARE(LatencyHistogram::bucketIndex(LatencyHistogram::bucketLowerBound(i)), i);
+        QCOMPARE(LatencyHistogram::bucketIndex(LatencyHistogram::bucketUpperBound(i) - 1), i);
+    }
+    QCOMPARE(LatencyHistogram::bucketIndex(quint64(1) << 62), LatencyHistogram::c_bucketCount - 1);
+
+    // 1000 values from 1 microsecond to 1 millisecond
+    LatencyHistogram histogram;
+    quint64 sum = 0;
+    for (quint64 i = 1; i <= 1000; ++i) {
+        histogram.record(i * 1000);
+        sum += i * 1000;
+    }
+    const LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    QCOMPARE(snapshot.count, quint64(1000));
+    QCOMPARE(snapshot.sum, sum);
+    QCOMPARE(snapshot.countBelowPowerOfTwo(20), quint64(1000)); // 1048576 ns
+    QCOMPARE(snapshot.countBelowPowerOfTwo(19), quint64(524)); // 524288 ns
+
+    // The estimation is off by a half of the bucket (1/16 of the value) at most
+    const QVector<double> quantiles = { 0.01, 0.1, 0.5, 0.9, 0.99, 1.0 };
+    for (double q : quantiles) {
+        const double expected = q * 1000 * 1000;
+        const double estimated = snapshot.quantile(q);
+        QVERIFY2(qAbs(estimated - expected) <= expected / 16,
+                 qPrintable(QStringLiteral("q%1: %2 instead of %3").arg(q).arg(estimated).arg(expected)));
+    }
+
+    Server::ServerMetrics metrics;
+    metrics.recordRpc(TLValue::AuthSignIn, 2000);
+    metrics.recordRpc(TLValue::AuthSignIn, 3000);
+    metrics.recordRpc(TLValue::MessagesSendMessage, 5000000);
+    metrics.addSentPacket(Server::TransportBackend::Epoll, 100);
+    metrics.addGzippedReply(1000, 300);
+    Server::ServerMetrics::Snapshot metricsSnapshot = metrics.snapshot();
+    QCOMPARE(metricsSnapshot.rpcDurations.count(), 2);
+    QCOMPARE(metricsSnapshot.rpcDurations.value(TLValue::AuthSignIn).count, quint64(2));
+    QCOMPARE(metricsSnapshot.rpcDurations.value(TLValue::AuthSignIn).sum, quint64(5000));
+
+    metricsSnapshot.dcId = 2;
+    const QByteArray text = Server::ServerMetrics::toPrometheusText({ metricsSnapshot });
+    const QList<QByteArray> lines = text.split('\n');
+    QVERIFY(lines.contains("# TYPE telegram_server_rpc_duration_seconds histogram"));
+    QVERIFY(lines.contains("telegram_server_rpc_duration_seconds_count{dc=\"2\",method=\"AuthSignIn\"} 2"));
+    QVERIFY(lines.contains("telegram_server_rpc_duration_seconds_bucket{dc=\"2\",method=\"AuthSignIn\",le=\"4.096e-06\"} 2"));
+    QVERIFY(lines.contains("telegram_server_rpc_duration_seconds_bucket{dc=\"2\",method=\"MessagesSendMessage\",le=\"0.004194304\"} 0"));
+    QVERIFY(lines.contains("telegram_server_rpc_duration_seconds_bucket{dc=\"2\",method=\"MessagesSendMessage\",le=\"+Inf\"} 1"));
+    QVERIFY(lines.contains("telegram_server_transport_sent_bytes_total{dc=\"2\",transport=\"epoll\"} 100"));
+    QVERIFY(lines.contains("telegram_server_reply_gzip_output_bytes_total{dc=\"2\"} 300"));
+}
+
+void tst_all::testMetricsExporterLimits()
+{
+    Server::ServerMetrics metrics;
+    metrics.recordRpc(TLValue::AuthSignIn, 2000);
+    Server::MetricsExporter exporter;
+    exporter.addServer(1, &metrics);
+    exporter.setRequestTimeout(60000);
+    QVERIFY(exporter.listen(0));
+
+    // A complete request gets the metrics
+    {
+        QTcpSocket socket;
+        QByteArray reply;
+        connect(&socket, &QTcpSocket::readyRead, this, [&socket, &reply]() { reply += socket.readAll(); });
+        socket.connectToHost(QHostAddress::LocalHost, exporter.serverPort());
+        TRY_COMPARE(socket.state(), QAbstractSocket::ConnectedState);
+        socket.write("GET /metrics HTTP/1.0\r\nHost: localhost\r\n\r\n");
+        TRY_COMPARE(socket.state(), QAbstractSocket::UnconnectedState);
+        QVERIFY(reply.startsWith("HTTP/1.0 200 OK\r\n"));
+        QVERIFY(reply.contains("telegram_server_rpc_duration_seconds_count{dc=\"1\",method=\"AuthSignIn\"} 1"));
+    }
+
+    // A request with too long headers is dropped without a reply
+    {
+        QTcpSocket socket;
+        QByteArray reply;
+        connect(&socket, &QTcpSocket::readyRead, this, [&socket, &reply]() { reply += socket.readAll(); });
+        socket.connectToHost(QHostAddress::LocalHost, exporter.serverPort());
+        TRY_COMPARE(socket.state(), QAbstractSocket::ConnectedState);
+        socket.write("GET /metrics HTTP/1.0\r\nX-Padding: " + QByteArray(16 * 1024, 'a') + "\r\n\r\n");
+        TRY_COMPARE(socket.state(), QAbstractSocket::UnconnectedState);
+        QVERIFY(reply.isEmpty());
+    }
+
+    // An incomplete request is dropped on the timeout
+    exporter.setRequestTimeout(100);
+    {
+        QTcpSocket socket;
+        QByteArray reply;
+        connect(&socket, &QTcpSocket::readyRead, this, [&socket, &reply]() { reply += socket.readAll(); });
+        socket.connectToHost(QHostAddress::LocalHost, exporter.serverPort());
+        TRY_COMPARE(socket.state(), QAbstractSocket::ConnectedState);
+        socket.write("GET /metrics HTTP/1.0\r\n");
+        QTRY_COMPARE_WITH_TIMEOUT(socket.state(), QAbstractSocket::UnconnectedState, 2000);
+        QVERIFY(reply.isEmpty());
+    }
 }
 
 void tst_all::testCheckInSignIn()
@@ -429,17 +719,20 @@ void tst_all::testSignInCheckIn()
 void tst_all::testSignUp_data()
 {
     QTest::addColumn<UserData>("userData");
+    QTest::addColumn<bool>("threadedDcs");
 
     UserData user2OnDc2 = c_userWithPassword;
     user2OnDc2.unsetPassword();
     user2OnDc2.dcId = 2;
 
-    QTest::newRow("Valid user") << user2OnDc2;
+    QTest::newRow("Valid user") << user2OnDc2 << false;
+    QTest::newRow("Valid user (threaded DCs)") << user2OnDc2 << true;
 }
 
 void tst_all::testSignUp()
 {
     QFETCH(UserData, userData);
+    QFETCH(bool, threadedDcs);
 
     const Telegram::Client::Settings::SessionType sessionType = Telegram::Client::Settings::SessionType::Obfuscated;
     const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
@@ -452,6 +745,7 @@ void tst_all::testSignUp()
     cluster.setAuthorizationProvider(&authProvider);
     cluster.setServerPrivateRsaKey(privateKey);
     cluster.setServerConfiguration(c_localDcConfiguration);
+    cluster.setDcThreadsEnabled(threadedDcs);
     QVERIFY(cluster.start());
 
     Server::Server *server = qobject_cast<Server::Server*>(cluster.getServerInstance(1));
@@ -498,22 +792,252 @@ void tst_all::testSignUp()
 
     quint64 clientAuthId = accountStorage.authId();
     QVERIFY(clientAuthId);
-    QSet<Server::RemoteClientConnection*> clientConnections = server->getConnections();
-    QCOMPARE(clientConnections.count(), 1);
-    Server::RemoteClientConnection *remoteClientConnection = *clientConnections.cbegin();
-    QCOMPARE(remoteClientConnection->authId(), clientAuthId);
-    quint32 clientUserId = server->getUserIdByAuthId(clientAuthId);
+
+    // The server state is read in the server thread, so it does not race with a threaded DC
+    int connectionsCount = 0;
+    quint64 connectionAuthId = 0;
+    quint32 clientUserId = 0;
+    UserData serverSideUserData;
+    cluster.callInServerThread(server, [&]() {
+        const QSet<Server::RemoteClientConnection*> clientConnections = server->getConnections();
+        connectionsCount = clientConnections.count();
+        if (connectionsCount == 1) {
+            connectionAuthId = (*clientConnections.cbegin())->authId();
+        }
+        clientUserId = server->getUserIdByAuthId(clientAuthId);
+        const Telegram::Server::LocalUser *serverSideUser = server->getUser(clientUserId);
+        if (serverSideUser) {
+            serverSideUserData.firstName = serverSideUser->firstName();
+            serverSideUserData.lastName = serverSideUser->lastName();
+            serverSideUserData.phoneNumber = serverSideUser->phoneNumber();
+        }
+    });
+    QCOMPARE(connectionsCount, 1);
+    QCOMPARE(connectionAuthId, clientAuthId);
     QVERIFY(clientUserId);
-    Telegram::Server::LocalUser *serverSideUser = server->getUser(clientUserId);
-    QVERIFY(serverSideUser);
-    QCOMPARE(serverSideUser->firstName(), userData.firstName);
-    QCOMPARE(serverSideUser->lastName(), userData.lastName);
-    QCOMPARE(serverSideUser->phoneNumber(), userData.phoneNumber);
+    QCOMPARE(serverSideUserData.firstName, userData.firstName);
+    QCOMPARE(serverSideUserData.lastName, userData.lastName);
+    QCOMPARE(serverSideUserData.phoneNumber, userData.phoneNumber);
     QCOMPARE(accountStorage.phoneNumber(), userData.phoneNumber);
     QCOMPARE(accountStorage.dcInfo().id, server->dcId());
     TRY_VERIFY(client.isSignedIn());
 }
 
+void tst_all::testDhExponentPool()
+{
+    Server::DhExponentPool pool;
+    QCOMPARE(pool.size(), 0);
+    pool.setDepth(4);
+    QCOMPARE(pool.depth(), 4);
+    // The pool is filled in the background
+    TRY_COMPARE(pool.size(), pool.depth());
+
+    Server::DhExponentPool::Entry entry;
+    QVERIFY(pool.takeEntry(&entry));
+    QCOMPARE(pool.takenCount(), quint64(1));
+    QCOMPARE(entry.a.size(), 256);
+    QCOMPARE(entry.gA, Server::DhExponentPool::computeGA(entry.a));
+    // The taken entry is replaced in the background
+    TRY_COMPARE(pool.size(), pool.depth());
+
+    // A smaller depth drops the extra entries
+    pool.setDepth(1);
+    QCOMPARE(pool.size(), 1);
+    QVERIFY(pool.takeEntry(&entry));
+
+    // An empty pool reports the exhaustion
+    pool.setDepth(0);
+    QCOMPARE(pool.size(), 0);
+    QSignalSpy exhaustedSpy(&pool, &Server::DhExponentPool::exhausted);
+    QVERIFY(!pool.takeEntry(&entry));
+    QCOMPARE(exhaustedSpy.count(), 1);
+    QCOMPARE(pool.exhaustedCount(), quint64(1));
+    QCOMPARE(pool.takenCount(), quint64(2));
+}
+
+void tst_all::testDhExponentPoolFallback()
+{
+    const UserData userData = c_userWithPassword;
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::Server *server = cluster.getServerInstance(clientDcOption.id);
+    QVERIFY(server);
+    // The handshake computes the (a, g_a) pair synchronously if there is no precomputed one
+    server->dhExponentPool()->setDepth(0);
+    QVERIFY(tryAddUser(&cluster, userData));
+
+    Client::Client client;
+    setupClientHelper(&client, userData, publicKey, clientDcOption);
+    signInHelper(&client, userData, &authProvider);
+    TRY_VERIFY(client.isSignedIn());
+    QVERIFY(server->dhExponentPool()->exhaustedCount() > 0);
+    QCOMPARE(server->dhExponentPool()->takenCount(), quint64(0));
+}
+
+void tst_all::testContactsScale()
+{
+    static const int c_usersCount = 50000;
+    static const int c_contactsPerUser = 5000;
+    // Importing 5k contacts for each of 50k users would take 250M contacts,
+    // so only a part of the users import the contacts.
+    static const int c_importersCount = 100;
+
+    Server::Server server;
+    QVector<Server::LocalUser *> users;
+    QSet<quint32> userIds;
+    users.reserve(c_usersCount);
+    for (int i = 0; i < c_usersCount; ++i) {
+        const QString phoneNumber = QStringLiteral("7%1").arg(i, 9, 10, QLatin1Char('0'));
+        Server::LocalUser *user = server.addUser(phoneNumber);
+        if (userIds.contains(user->id())) {
+            // The user id is a hash of the phone number, so skip the (unlikely) collisions
+            continue;
+        }
+        userIds.insert(user->id());
+        QVERIFY(server.setUserName(user, QStringLiteral("User%1").arg(users.count())));
+        users.append(user);
+    }
+    const int usersCount = users.count();
+    QVERIFY(usersCount > c_usersCount - 10);
+
+    // Usernames are case insensitive and unique
+    QCOMPARE(server.peerByUserName(QStringLiteral("user42")), users.at(42)->toPeer());
+    QCOMPARE(server.peerByUserName(QStringLiteral("USER42")), users.at(42)->toPeer());
+    QVERIFY(!server.setUserName(users.at(43), QStringLiteral("uSeR42")));
+    QCOMPARE(users.at(43)->userName(), QStringLiteral("User43"));
+    QVERIFY(server.setUserName(users.at(42), QStringLiteral("renamed")));
+    QVERIFY(!server.peerByUserName(QStringLiteral("user42")).isValid());
+    QCOMPARE(server.peerByUserName(QStringLiteral("Renamed")), users.at(42)->toPeer());
+    QVERIFY(server.setUserName(users.at(43), QStringLiteral("user42")));
+    QCOMPARE(server.peerByUserName(QStringLiteral("User42")), users.at(43)->toPeer());
+
+    // Each importer adds the users around it (so all importers are mutual contacts)
+    for (int i = 0; i < c_importersCount; ++i) {
+        Server::LocalUser *importer = users.at(i);
+        for (int offset = -c_contactsPerUser / 2; offset <= c_contactsPerUser / 2; ++offset) {
+            if (!offset) {
+                continue;
+            }
+            const Server::LocalUser *contactUser = users.at((i + offset + usersCount) % usersCount);
+            importer->importContact(contactUser->toContact());
+        }
+        // Import a contact twice
+        importer->importContact(users.at(i + 1)->toContact());
+        QCOMPARE(importer->contactList().count(), c_contactsPerUser);
+    }
+
+    for (int i = 0; i < c_importersCount; ++i) {
+        const Server::LocalUser *importer = users.at(i);
+        int mutualContacts = 0;
+        TLUser userInfo;
+        for (const quint32 contactId : importer->contactList()) {
+            Server::Utils::setupTLUser(&userInfo, server.getAbstractUser(contactId), importer);
+            QVERIFY(userInfo.flags & TLUser::Contact);
+            if (userInfo.flags & TLUser::MutualContact) {
+                ++mutualContacts;
+            }
+        }
+        QCOMPARE(mutualContacts, c_importersCount - 1);
+
+        Server::Utils::setupTLUser(&userInfo, users.at(usersCount / 2), importer);
+        QVERIFY(!(userInfo.flags & TLUser::Contact));
+    }
+}
+
+void tst_all::testCrossDcMessage_data()
+{
+    QTest::addColumn<bool>("threadedDcs");
+
+    QTest::newRow("Same thread") << false;
+    QTest::newRow("Threaded DCs") << true;
+}
+
+void tst_all::testCrossDcMessage()
+{
+    QFETCH(bool, threadedDcs);
+
+    UserData user1Data = c_userWithPassword;
+    user1Data.dcId = 1;
+    UserData user2Data;
+    user2Data.dcId = 2;
+    user2Data.setName(QStringLiteral("Second"), QStringLiteral("User"));
+    user2Data.phoneNumber = QStringLiteral("654321");
+
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    cluster.setDcThreadsEnabled(threadedDcs);
+    QVERIFY(cluster.start());
+
+    QVERIFY(tryAddUser(&cluster, user1Data));
+    QVERIFY(tryAddUser(&cluster, user2Data));
+
+    Client::Client client1;
+    setupClientHelper(&client1, user1Data, publicKey, clientDcOption);
+    signInHelper(&client1, user1Data, &authProvider);
+    TRY_VERIFY(client1.isSignedIn());
+    QCOMPARE(client1.accountStorage()->dcInfo().id, user1Data.dcId);
+
+    // The user of DC 2 signs in with migration from DC 1
+    Client::Client client2;
+    setupClientHelper(&client2, user2Data, publicKey, clientDcOption);
+    signInHelper(&client2, user2Data, &authProvider);
+    TRY_VERIFY(client2.isSignedIn());
+    QCOMPARE(client2.accountStorage()->dcInfo().id, user2Data.dcId);
+
+    // DC 1 looks up the user of DC 2
+    Telegram::Client::ContactsApi::ContactInfo user2ContactInfo;
+    user2ContactInfo.phoneNumber = user2Data.phoneNumber;
+    user2ContactInfo.firstName = user2Data.firstName;
+    user2ContactInfo.lastName = user2Data.lastName;
+    Client::PendingContactsOperation *addContactOperation = client1.contactsApi()->addContacts({user2ContactInfo});
+    TRY_VERIFY(addContactOperation->isFinished());
+    QVERIFY(addContactOperation->isSucceeded());
+    QCOMPARE(addContactOperation->peers().count(), 1);
+    const Peer user2Peer = addContactOperation->peers().first();
+    UserInfo user2Info;
+    QVERIFY(client1.dataStorage()->getUserInfo(&user2Info, user2Peer.id));
+    QCOMPARE(user2Info.firstName(), user2Data.firstName);
+
+    // DC 1 delivers the message to the box of the recipient on DC 2
+    const QString c_messageText = QStringLiteral("Hello from DC 1");
+    QSignalSpy client1MessageSentSpy(client1.messagingApi(), &Client::MessagingApi::messageSent);
+    QSignalSpy client2MessageReceivedSpy(client2.messagingApi(), &Client::MessagingApi::messageReceived);
+    client1.messagingApi()->sendMessage(user2Peer, c_messageText);
+    TRY_COMPARE(client1MessageSentSpy.count(), 1);
+    TRY_COMPARE(client2MessageReceivedSpy.count(), 1);
+
+    const QList<QVariant> receivedArgs = client2MessageReceivedSpy.takeFirst();
+    const Peer user1Peer = receivedArgs.first().value<Telegram::Peer>();
+    QCOMPARE(user1Peer, Peer::fromUserId(client1.contactsApi()->selfContactId()));
+    Telegram::Message message;
+    QVERIFY(client2.dataStorage()->getMessage(&message, user1Peer, receivedArgs.last().toUInt()));
+    QCOMPARE(message.text, c_messageText);
+
+    // DC 2 looks up the sender on DC 1
+    UserInfo user1Info;
+    QVERIFY(client2.dataStorage()->getUserInfo(&user1Info, user1Peer.id));
+    QCOMPARE(user1Info.firstName(), user1Data.firstName);
+}
+
 QTEST_GUILESS_MAIN(tst_all)
 
 #include "tst_all.moc"
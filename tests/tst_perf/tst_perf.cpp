@@ -0,0 +1,417 @@
+/*
+   Copyright (C) 2019 Alexander Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include <QObject>
+
+// Client
+#include "Client.hpp"
+#include "Client_p.hpp"
+#include "DataStorage.hpp"
+#include "DialogList.hpp"
+#include "MessagingApi.hpp"
+#include "RandomGenerator.hpp"
+#include "UpdatesLayer.hpp"
+#include "Operations/PendingMessages.hpp"
+
+// Server
+#include "DhExponentPool.hpp"
+#include "LocalCluster.hpp"
+#include "OutboundLimiter.hpp"
+#include "ServerApi.hpp"
+#include "ServerMetrics.hpp"
+#include "Storage.hpp"
+#include "TelegramServer.hpp"
+#include "TelegramServerUser.hpp"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTest>
+#include <QThreadPool>
+
+#include <cmath>
+#include <cstdlib>
+
+#include "keys_data.hpp"
+#include "TestAuthProvider.hpp"
+#include "TestClientUtils.hpp"
+#include "TestServerUtils.hpp"
+#include "TestUserData.hpp"
+#include "TestUtils.hpp"
+
+using namespace Telegram;
+
+// The allocations are counted per thread by the malloc() of the executable which overrides the libc one.
+// The test reads the counters of the server thread only, so the clients, the crypto thread pool
+// and the DH exponent refill threads do not affect the measured values.
+// It is glibc-specific; the allocation thresholds are not checked on other platforms.
+static thread_local quint64 s_threadAllocations = 0;
+static thread_local quint64 s_threadAllocatedBytes = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+
+void *malloc(size_t size)
+{
+    ++s_threadAllocations;
+    s_threadAllocatedBytes += size;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    ++s_threadAllocations;
+    s_threadAllocatedBytes += count * size;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size)
+{
+    ++s_threadAllocations;
+    s_threadAllocatedBytes += size;
+    return __libc_realloc(pointer, size);
+}
+
+} // extern "C"
+
+static const bool c_allocationsCounted = true;
+#else
+static const bool c_allocationsCounted = false;
+#endif
+
+static const int c_userCount = 200;
+static const int c_onlineUserCount = 4;
+// The messages are replayed in two equal halves to compare the cost of the second half to the first one
+static const int c_messageCount = 20000;
+
+// The environment variable with the name of the file to write the calibrated thresholds to
+static const char *c_calibrationVariable = "TELEGRAMQT_PERF_CALIBRATE";
+
+struct OperationCounters
+{
+    quint64 allocations;
+    quint64 allocatedBytes;
+    quint64 sentBytes;
+};
+
+// Must be called in the server thread
+static OperationCounters serverCounters(const Server::Server *server)
+{
+    const Server::ServerMetrics::Snapshot snapshot = server->metrics()->snapshot();
+    OperationCounters counters;
+    counters.allocations = s_threadAllocations;
+    counters.allocatedBytes = s_threadAllocatedBytes;
+    counters.sentBytes = snapshot.transports[static_cast<int>(Server::TransportBackend::Qt)].sentBytes;
+    return counters;
+}
+
+static OperationCounters operator-(const OperationCounters &after, const OperationCounters &before)
+{
+    OperationCounters counters;
+    counters.allocations = after.allocations - before.allocations;
+    counters.allocatedBytes = after.allocatedBytes - before.allocatedBytes;
+    counters.sentBytes = after.sentBytes - before.sentBytes;
+    return counters;
+}
+
+static OperationCounters operator+(const OperationCounters &first, const OperationCounters &second)
+{
+    OperationCounters counters;
+    counters.allocations = first.allocations + second.allocations;
+    counters.allocatedBytes = first.allocatedBytes + second.allocatedBytes;
+    counters.sentBytes = first.sentBytes + second.sentBytes;
+    return counters;
+}
+
+// Returns the sender and the recipient of the scenario message
+static QPair<int, int> messageUsers(int messageIndex)
+{
+    const int from = messageIndex % c_userCount;
+    int to = (messageIndex * 37 + 11) % c_userCount;
+    if (to == from) {
+        to = (to + 1) % c_userCount;
+    }
+    return qMakePair(from, to);
+}
+
+class tst_perf : public QObject
+{
+    Q_OBJECT
+public:
+    explicit tst_perf(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void replayScenario();
+
+protected:
+    bool checkThreshold(const QString &phase, const QString &name, double value, QString *message);
+    bool waitForServerIdle(Server::Server *server);
+    bool writeCalibratedThresholds() const;
+
+    QJsonObject m_thresholds;
+    QJsonObject m_measured;
+    QString m_calibrationFileName;
+    DeterministicGenerator *m_generator = nullptr;
+    RandomGenerator *m_defaultGenerator = nullptr;
+};
+
+tst_perf::tst_perf(QObject *parent) :
+    QObject(parent)
+{
+}
+
+void tst_perf::initTestCase()
+{
+    qRegisterMetaType<UserData>();
+    QVERIFY(TestKeyData::initKeyFiles());
+    // The generator is used by the DC thread and the clients concurrently; it is thread-safe,
+    // but the order of the generated values depends on the thread scheduling
+    m_generator = new DeterministicGenerator();
+    m_defaultGenerator = RandomGenerator::setInstance(m_generator);
+
+    QFile thresholdsFile(QFINDTESTDATA("perf_thresholds.json"));
+    QVERIFY2(thresholdsFile.open(QIODevice::ReadOnly), "Unable to open the thresholds file");
+    m_thresholds = QJsonDocument::fromJson(thresholdsFile.readAll()).object();
+    QVERIFY(!m_thresholds.isEmpty());
+    QVERIFY(m_thresholds.value(QLatin1String("margin")).toDouble() >= 1);
+
+    m_calibrationFileName = QString::fromLocal8Bit(qgetenv(c_calibrationVariable));
+    if (!m_calibrationFileName.isEmpty()) {
+        qInfo().noquote() << "Calibration mode: the thresholds are written to" << m_calibrationFileName;
+    }
+}
+
+void tst_perf::cleanupTestCase()
+{
+    RandomGenerator::setInstance(m_defaultGenerator);
+    delete m_generator;
+    QVERIFY(TestKeyData::cleanupKeyFiles());
+    if (!m_calibrationFileName.isEmpty()) {
+        QVERIFY2(writeCalibratedThresholds(), "Unable to write the calibrated thresholds");
+    }
+}
+
+bool tst_perf::checkThreshold(const QString &phase, const QString &name, double value, QString *message)
+{
+    QJsonObject measuredPhase = m_measured.value(phase).toObject();
+    measuredPhase.insert(name, value);
+    m_measured.insert(phase, measuredPhase);
+
+    const double threshold = m_thresholds.value(phase).toObject().value(name).toDouble(-1);
+    *message = QStringLiteral("%1/%2 is %3 (the threshold is %4)").arg(phase, name).arg(value).arg(threshold);
+    qInfo().noquote() << *message;
+    if (!m_calibrationFileName.isEmpty()) {
+        return true;
+    }
+    return (threshold >= 0) && (value <= threshold);
+}
+
+// The thresholds are the measured values multiplied by the margin of the thresholds file
+bool tst_perf::writeCalibratedThresholds() const
+{
+    const double margin = m_thresholds.value(QLatin1String("margin")).toDouble();
+    QJsonObject thresholds = m_thresholds;
+    for (const QString &phase : m_measured.keys()) {
+        const QJsonObject measuredPhase = m_measured.value(phase).toObject();
+        QJsonObject phaseThresholds = thresholds.value(phase).toObject();
+        for (const QString &name : measuredPhase.keys()) {
+            const double bound = measuredPhase.value(name).toDouble() * margin;
+            // Keep two decimals of the ratios and round up the counts
+            phaseThresholds.insert(name, bound < 100 ? std::ceil(bound * 100) / 100 : std::ceil(bound));
+        }
+        thresholds.insert(phase, phaseThresholds);
+    }
+    QFile file(m_calibrationFileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(QJsonDocument(thresholds).toJson());
+    return true;
+}
+
+// Waits for the background work of the server (the DH pool refill and the crypto jobs) to finish
+bool tst_perf::waitForServerIdle(Server::Server *server)
+{
+    const Server::DhExponentPool *dhPool = server->dhExponentPool();
+    QElapsedTimer timer;
+    timer.start();
+    while ((dhPool->size() < dhPool->depth()) || (server->cryptoThreadPool()->activeThreadCount() > 0)) {
+        if (timer.hasExpired(30000)) {
+            return false;
+        }
+        QTest::qWait(50);
+    }
+    return true;
+}
+
+void tst_perf::replayScenario()
+{
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    // The server runs in its own thread, so the counters of the thread cover only the server work
+    cluster.setDcThreadsEnabled(true);
+    QVERIFY(cluster.start());
+
+    const DcOption clientDcOption = c_localDcOptions.first();
+    Server::Server *server = cluster.getServerInstance(clientDcOption.id);
+    QVERIFY(server);
+    cluster.callInServerThread(server, [server]() {
+        // The scenario writes the updates without returning to the event loop
+        server->outboundLimiter()->setHighWatermark(0);
+        server->outboundLimiter()->setHardLimit(0);
+    });
+
+    QVector<UserData> usersData;
+    QVector<Server::LocalUser *> users;
+    for (int i = 0; i < c_userCount; ++i) {
+        const UserData userData = mkUserData(i, clientDcOption.id);
+        Server::LocalUser *user = tryAddUser(&cluster, userData);
+        QVERIFY(user);
+        usersData.append(userData);
+        users.append(user);
+    }
+
+    QVector<Client::Client *> clients;
+    for (int i = 0; i < c_onlineUserCount; ++i) {
+        Client::Client *client = new Client::Client(this);
+        clients.append(client);
+        setupClientHelper(client, usersData.at(i), publicKey, clientDcOption);
+        signInHelper(client, usersData.at(i), &authProvider);
+        TRY_VERIFY2(client->isSignedIn(), "Unexpected sign in fail");
+    }
+
+    QSet<quint32> onlineUserIds;
+    for (int i = 0; i < c_onlineUserCount; ++i) {
+        onlineUserIds.insert(users.at(i)->id());
+    }
+
+    QVERIFY2(waitForServerIdle(server), "The server background work is not finished");
+
+    // --- Replay the messages ---
+    // Each half of the messages is processed synchronously in a single call in the server thread
+    quint64 processedMessages = 0;
+    int onlineUpdates = 0;
+    OperationCounters halves[2];
+    for (int half = 0; half < 2; ++half) {
+        const int firstMessage = half * c_messageCount / 2;
+        const int lastMessage = (half + 1) * c_messageCount / 2;
+        cluster.callInServerThread(server, [&]() {
+            const quint64 processedBefore = server->metrics()->snapshot().processedMessages;
+            const OperationCounters before = serverCounters(server);
+            for (int i = firstMessage; i < lastMessage; ++i) {
+                const QPair<int, int> fromTo = messageUsers(i);
+                Server::MessageData *messageData = server->storage()->addMessage(users.at(fromTo.first)->id(),
+                                                                                 users.at(fromTo.second)->toPeer(),
+                                                                                 QString::number(i));
+                const QVector<Server::UpdateNotification> notifications = server->processMessage(messageData);
+                for (const Server::UpdateNotification &notification : notifications) {
+                    if (onlineUserIds.contains(notification.userId)) {
+                        ++onlineUpdates;
+                    }
+                }
+                server->queueUpdates(notifications);
+            }
+            halves[half] = serverCounters(server) - before;
+            processedMessages += server->metrics()->snapshot().processedMessages - processedBefore;
+        });
+    }
+    QCOMPARE(processedMessages, quint64(c_messageCount));
+    QVERIFY(onlineUpdates > 0);
+    const OperationCounters replay = halves[0] + halves[1];
+
+    QString message;
+    const QString replayPhase = QStringLiteral("replay");
+    QVERIFY2(checkThreshold(replayPhase, QStringLiteral("sentBytesPerUpdate"),
+                            double(replay.sentBytes) / onlineUpdates, &message), qPrintable(message));
+    if (c_allocationsCounted) {
+        QVERIFY2(checkThreshold(replayPhase, QStringLiteral("allocationsPerMessage"),
+                                double(replay.allocations) / c_messageCount, &message), qPrintable(message));
+        // A cost which grows with the number of the stored messages (e.g. a copy of a per-user list
+        // on each message) makes the second half notably more expensive than the first one
+        QVERIFY2(checkThreshold(replayPhase, QStringLiteral("allocationsGrowth"),
+                                double(halves[1].allocations) / halves[0].allocations, &message),
+                 qPrintable(message));
+        QVERIFY2(checkThreshold(replayPhase, QStringLiteral("allocatedBytesGrowth"),
+                                double(halves[1].allocatedBytes) / halves[0].allocatedBytes, &message),
+                 qPrintable(message));
+    }
+
+    // Wait for the clients to process all the updates
+    QVector<quint32> expectedPts;
+    cluster.callInServerThread(server, [&]() {
+        for (int i = 0; i < c_onlineUserCount; ++i) {
+            expectedPts.append(users.at(i)->getPostBox()->pts());
+        }
+    });
+    for (int i = 0; i < c_onlineUserCount; ++i) {
+        const Client::UpdatesInternalApi *updatesApi = Client::ClientPrivate::get(clients.at(i))->updatesApi();
+        QTRY_COMPARE_WITH_TIMEOUT(updatesApi->pts(), expectedPts.at(i), 30000);
+    }
+    QVERIFY2(waitForServerIdle(server), "The server background work is not finished");
+
+    // --- Fetch the dialogs and a history of the first online user ---
+    // The server thread is idle, so the work made in the thread between the snapshots
+    // is the processing of the fetch requests.
+    Client::Client *client = clients.first();
+    OperationCounters fetchBefore;
+    cluster.callInServerThread(server, [&]() {
+        fetchBefore = serverCounters(server);
+    });
+    Client::DialogList *dialogList = client->messagingApi()->getDialogList();
+    PendingOperation *dialogsReady = dialogList->becomeReady();
+    QTRY_VERIFY_WITH_TIMEOUT(dialogsReady->isFinished(), 10000);
+    QVERIFY(dialogsReady->isSucceeded());
+    QVERIFY(!dialogList->peers().isEmpty());
+    Client::PendingMessages *historyOperation = client->messagingApi()->getHistory(dialogList->peers().first(),
+                                                                                   Client::MessageFetchOptions::useLimit(100));
+    QTRY_VERIFY_WITH_TIMEOUT(historyOperation->isFinished(), 10000);
+    QVERIFY(historyOperation->isSucceeded());
+    QVERIFY(!historyOperation->messages().isEmpty());
+    OperationCounters fetch;
+    cluster.callInServerThread(server, [&]() {
+        fetch = serverCounters(server) - fetchBefore;
+    });
+
+    const QString fetchPhase = QStringLiteral("fetch");
+    QVERIFY2(checkThreshold(fetchPhase, QStringLiteral("sentBytes"), fetch.sentBytes, &message), qPrintable(message));
+    if (c_allocationsCounted) {
+        QVERIFY2(checkThreshold(fetchPhase, QStringLiteral("allocations"), fetch.allocations, &message),
+                 qPrintable(message));
+    }
+
+    qDeleteAll(clients);
+    cluster.stop();
+}
+
+QTEST_GUILESS_MAIN(tst_perf)
+
+#include "tst_perf.moc"
@@ -0,0 +1,8 @@
+include(../tests.pri)
+
+TARGET = tst_perf
+SOURCES += tst_perf.cpp
+HEADERS += ../utils/TestAuthProvider.hpp
+OTHER_FILES += perf_thresholds.json
+
+include(../../tests/data/data.pri)